@@ -3,7 +3,9 @@
  * ************************************************************************ */
 
 #include "rocblascommon/program_options.hpp"
+#include "rocsolver_bench_report.hpp"
 #include "rocsolver_dispatcher.hpp"
+#include <fstream>
 
 using namespace roc;
 
@@ -26,29 +28,32 @@ m) and a square-size matrix will be assumed.
 Example: ./rocsolver-bench -f getf2_batched -m 30 --lda 75 --batch_count 350
 This will test getf2_batched with a set of 350 random 30x30 matrices. strideP will be set to be equal to 30.
 
+Example: ./rocsolver-bench -f getrf -r d -m 512 --iters 100 --format json
+This will time 100 calls of dgetrf with a 512x512 matrix and print a JSON record with every per-iteration time,
+their statistics (min, median, p95, max, standard deviation) and the achieved GFLOP/s and GB/s.
+
+Example: ROCSOLVER_LAYER=2 ROCSOLVER_LOG_BENCH_PATH=bench.log ./my_app; ./rocsolver-bench --replay bench.log
+This will time every distinct rocSOLVER call made by my_app and report its share of the total time,
+weighting each call by the number of times it appeared in the log.
+
 Options:
 )HELP_STR";
 // clang-format on
 
-int main(int argc, char* argv[])
-try
+struct bench_options
 {
-    Arguments argus;
-
-    // disable unit_check in client benchmark, it is only
-    // used in gtest unit test
-    argus.unit_check = 0;
-
-    // enable timing check,otherwise no performance data collected
-    argus.timing = 1;
-
     std::string function;
+    std::string format;
+    std::string replay;
     char precision;
     rocblas_int device_id;
+    rocsolver_bench_peak peak;
+};
 
-    // take arguments and set default values
+// take arguments and set default values
+void add_bench_options(options_description& desc, Arguments& argus, bench_options& opt)
+{
     // clang-format off
-    options_description desc("rocsolver client command line options");
     desc.add_options()("help,h", "Produces this help message.")
 
         // test options
@@ -59,12 +64,19 @@ try
             "                           ")
 
         ("device",
-         value<rocblas_int>(&device_id)->default_value(0),
+         value<rocblas_int>(&opt.device_id)->default_value(0),
             "Set the default device to be used for subsequent program runs.\n"
             "                           ")
 
+        ("format",
+         value<std::string>(&opt.format)->default_value("text"),
+            "text = human-readable tables, json = JSON record, csv = CSV header and row.\n"
+            "                           The json and csv formats include every per-iteration GPU time, their\n"
+            "                           statistics, the achieved GFLOP/s and GB/s and all the used arguments.\n"
+            "                           ")
+
         ("function,f",
-         value<std::string>(&function)->default_value("potf2"),
+         value<std::string>(&opt.function)->default_value("potf2"),
             "The LAPACK function to test.\n"
             "                           Options are: getf2, getrf, gesvd_batched, etc.\n"
             "                           ")
@@ -81,8 +93,21 @@ try
             "                           This forces the client to print only the GPU time and the error if requested.\n"
             "                           ")
 
+        ("peak_gbs",
+         value<double>(&opt.peak.gbytes)->default_value(0),
+            "Peak memory bandwidth of the device in GB/s, or 0 if unknown.\n"
+            "                           Used to report the achieved fraction of the peak bandwidth and, together\n"
+            "                           with peak_gflops, whether the function is compute, memory or launch bound.\n"
+            "                           ")
+
+        ("peak_gflops",
+         value<double>(&opt.peak.gflops)->default_value(0),
+            "Peak floating point rate of the device in GFLOP/s (for the tested precision), or 0 if unknown.\n"
+            "                           Used to report the achieved fraction of the peak rate.\n"
+            "                           ")
+
         ("precision,r",
-         value<char>(&precision)->default_value('s'),
+         value<char>(&opt.precision)->default_value('s'),
             "Precision to be used in the tests.\n"
             "                           Options are: s, d, c, z.\n"
             "                           ")
@@ -99,6 +124,14 @@ try
             "                           This will additionally print the relative error of the computations.\n"
             "                           ")
 
+        ("replay",
+         value<std::string>(&opt.replay),
+            "File with rocsolver-bench command lines, such as a bench log (ROCSOLVER_LAYER=2).\n"
+            "                           Every distinct command line is run once in this process, and a consolidated\n"
+            "                           report gives the timings of each one and weighted by its number of occurrences.\n"
+            "                           The values of iters, perf, singular and verify are used as defaults.\n"
+            "                           ")
+
         // size options
         ("k",
          value<rocblas_int>(),
@@ -181,6 +214,12 @@ try
             "                           Leading dimension of matrices Y.\n"
             "                           ")
 
+        ("ldz",
+         value<rocblas_int>(),
+            "Matrix size parameter.\n"
+            "                           Leading dimension of matrices Z.\n"
+            "                           ")
+
         // stride options
         ("strideA",
          value<rocblas_stride>(),
@@ -206,6 +245,18 @@ try
             "                           Stride for matrices/vectors E.\n"
             "                           ")
 
+        ("strideF",
+         value<rocblas_stride>(),
+            "Matrix/vector stride parameter.\n"
+            "                           Stride for vectors ifail.\n"
+            "                           ")
+
+        ("strideJ",
+         value<rocblas_stride>(),
+            "Matrix/vector stride parameter.\n"
+            "                           Stride for vectors jpvt.\n"
+            "                           ")
+
         ("strideQ",
          value<rocblas_stride>(),
             "Matrix/vector stride parameter.\n"
@@ -236,6 +287,18 @@ try
             "                           Stride for matrices/vectors V.\n"
             "                           ")
 
+        ("strideW",
+         value<rocblas_stride>(),
+            "Matrix/vector stride parameter.\n"
+            "                           Stride for vectors W.\n"
+            "                           ")
+
+        ("strideZ",
+         value<rocblas_stride>(),
+            "Matrix/vector stride parameter.\n"
+            "                           Stride for matrices Z.\n"
+            "                           ")
+
         // bdsqr options
         ("nc",
          value<rocblas_int>()->default_value(0),
@@ -285,6 +348,65 @@ try
             "                           Indicates how the right singular vectors are to be calculated and stored.\n"
             "                           ")
 
+        // stebz and syevx options
+        ("erange",
+         value<char>()->default_value('A'),
+            "A = all, V = in (vl, vu], I = from the il-th to the iu-th.\n"
+            "                           Indicates the range of the eigenvalues to be computed.\n"
+            "                           Only applicable to stebz and syevx/heevx.\n"
+            "                           ")
+
+        ("eorder",
+         value<char>()->default_value('E'),
+            "B = by blocks, E = entire matrix.\n"
+            "                           Indicates how the computed eigenvalues are ordered.\n"
+            "                           Only applicable to stebz.\n"
+            "                           ")
+
+        ("vl",
+         value<double>(),
+            "Lower bound of the half-open interval (vl, vu].\n"
+            "                           Only applicable when erange is V.\n"
+            "                           ")
+
+        ("vu",
+         value<double>(),
+            "Upper bound of the half-open interval (vl, vu].\n"
+            "                           Only applicable when erange is V.\n"
+            "                           ")
+
+        ("il",
+         value<rocblas_int>(),
+            "Index of the smallest eigenvalue to be computed.\n"
+            "                           Only applicable when erange is I.\n"
+            "                           ")
+
+        ("iu",
+         value<rocblas_int>(),
+            "Index of the largest eigenvalue to be computed.\n"
+            "                           Only applicable when erange is I.\n"
+            "                           ")
+
+        ("abstol",
+         value<double>()->default_value(0),
+            "Absolute tolerance at which the bisection or Jacobi iteration converges.\n"
+            "                           A non-positive value uses a default based on machine precision.\n"
+            "                           ")
+
+        // syevj and gesvdj options
+        ("max_sweeps",
+         value<rocblas_int>()->default_value(100),
+            "Maximum number of sweeps of the Jacobi iteration.\n"
+            "                           Only applicable to syevj/heevj and gesvdj.\n"
+            "                           ")
+
+        // gelsy options
+        ("rcond",
+         value<double>(),
+            "Relative threshold used to determine the effective rank of the matrix.\n"
+            "                           Only applicable to gelsy. Default value is 1e-3.\n"
+            "                           ")
+
         // trtri options
         ("diag",
          value<char>()->default_value('N'),
@@ -347,7 +469,193 @@ try
             "U = upper, L = lower.\n"
             "                           Indicates where the data for a triangular or symmetric/hermitian matrix is stored.\n"
             "                           ");
+
     // clang-format on
+}
+
+// checks the arguments that only accept a fixed set of values
+void validate_bench_arguments(const Arguments& argus)
+{
+    argus.validate_precision("precision");
+    argus.validate_operation("trans");
+    argus.validate_side("side");
+    argus.validate_fill("uplo");
+    argus.validate_diag("diag");
+    argus.validate_direct("direct");
+    argus.validate_storev("storev");
+    argus.validate_svect("left_svect");
+    argus.validate_svect("right_svect");
+    argus.validate_workmode("fast_alg");
+    argus.validate_evect("evect");
+    argus.validate_erange("erange");
+    argus.validate_eorder("eorder");
+    argus.validate_itype("itype");
+}
+
+// a distinct command line of a replay file
+struct replay_command
+{
+    std::string command;
+    std::vector<std::string> tokens;
+    rocblas_int occurrences;
+};
+
+// reads the command lines of a replay file. Every line containing "rocsolver-bench" is a command
+// (the rest of the lines are ignored), and repeated commands are merged in order of appearance.
+std::vector<replay_command> read_replay_file(const std::string& file)
+{
+    std::ifstream in(file);
+    if(!in)
+        throw std::invalid_argument("Could not open replay file " + file);
+
+    const std::string client = "rocsolver-bench";
+    std::vector<replay_command> commands;
+    std::map<std::string, size_t> index;
+    std::string line;
+    while(std::getline(in, line))
+    {
+        size_t pos = line.find(client);
+        if(pos == std::string::npos)
+            continue;
+
+        std::istringstream ss(line.substr(pos + client.size()));
+        std::vector<std::string> tokens;
+        std::string command = "./" + client;
+        for(std::string token; ss >> token;)
+        {
+            tokens.push_back(token);
+            command += ' ' + token;
+        }
+
+        auto it = index.find(command);
+        if(it != index.end())
+            commands[it->second].occurrences++;
+        else
+        {
+            index[command] = commands.size();
+            commands.push_back({command, tokens, 1});
+        }
+    }
+
+    return commands;
+}
+
+void print_replay_report(const std::string& file,
+                         const std::vector<rocsolver_bench_record>& records,
+                         rocblas_int skipped,
+                         const rocsolver_bench_peak& peak)
+{
+    double total = rocsolver_bench_total_time(records);
+    rocblas_int calls = 0;
+    for(const rocsolver_bench_record& rec : records)
+        calls += rec.occurrences;
+
+    rocsolver_cout << "\n============================================\n";
+    rocsolver_cout << "Replay of " << file << ":\n";
+    rocsolver_bench_output("occurrences", "mean_us", "median_us", "p95_us", "weighted_us", "share",
+                           "gflops", "gbytes_per_s", "bound", "command");
+    for(const rocsolver_bench_record& rec : records)
+    {
+        const char* bound = rec.bound(peak);
+        rocsolver_bench_output(rec.occurrences, rec.stats.mean, rec.stats.median, rec.stats.p95,
+                               rec.weighted_time(), rocsolver_bench_share(rec, total),
+                               rec.gflops(), rec.gbytes(), bound ? bound : "-", rec.command);
+    }
+    rocsolver_cout << "\nTotals:\n";
+    rocsolver_bench_output("calls", "distinct", "skipped", "weighted_us");
+    rocsolver_bench_output(calls, records.size(), skipped, total);
+    rocsolver_cout << std::endl;
+}
+
+// runs every distinct command of a replay file in this process, and prints a consolidated report
+void run_replay(const bench_options& opt, const Arguments& defaults)
+{
+    rocsolver_bench_format fmt = rocsolver_bench_parse_format(opt.format);
+    std::vector<replay_command> commands = read_replay_file(opt.replay);
+
+    // all the tests share a handle (and its device workspace) and reuse their device buffers
+    rocblas_handle handle;
+    rocblas_create_handle(&handle);
+    rocblas_local_handle::set_shared(handle);
+    d_vector_pool::enable();
+
+    std::vector<rocsolver_bench_record> records;
+    rocblas_int skipped = 0;
+    for(const replay_command& cmd : commands)
+    {
+        Arguments argus;
+        argus.unit_check = 0;
+        argus.timing = 1;
+        argus.quiet = 1;
+
+        // the test options of the replay invocation are defaults for every command
+        std::vector<std::string> tokens
+            = {"rocsolver-bench",
+               "--iters",
+               std::to_string(defaults.iters),
+               "--perf",
+               std::to_string(defaults.perf),
+               "--singular",
+               std::to_string(defaults.singular),
+               "--verify",
+               std::to_string(defaults.norm_check)};
+        tokens.insert(tokens.end(), cmd.tokens.begin(), cmd.tokens.end());
+        std::vector<char*> argv;
+        for(std::string& token : tokens)
+            argv.push_back(&token[0]);
+
+        try
+        {
+            bench_options cmd_opt;
+            options_description desc("rocsolver client command line options");
+            add_bench_options(desc, argus, cmd_opt);
+            variables_map vm;
+            store(parse_command_line(int(argv.size()), argv.data(), desc), vm);
+            notify(vm);
+
+            argus.populate(vm);
+            validate_bench_arguments(argus);
+
+            rocsolver_dispatcher::invoke(cmd_opt.function, cmd_opt.precision, argus);
+
+            records.emplace_back(cmd_opt.function, cmd_opt.precision, argus);
+            records.back().occurrences = cmd.occurrences;
+            records.back().command = cmd.command;
+        }
+        catch(const std::invalid_argument& exp)
+        {
+            rocsolver_cerr << "Skipping " << cmd.command << ": " << exp.what() << std::endl;
+            skipped++;
+        }
+    }
+
+    d_vector_pool::disable();
+    rocblas_local_handle::set_shared(nullptr);
+    rocblas_destroy_handle(handle);
+
+    if(fmt == rocsolver_bench_format_json)
+        rocsolver_bench_write_json(rocsolver_cout, records, opt.peak);
+    else if(fmt == rocsolver_bench_format_csv)
+        rocsolver_bench_write_csv(rocsolver_cout, records, opt.peak);
+    else
+        print_replay_report(opt.replay, records, skipped, opt.peak);
+}
+
+int main(int argc, char* argv[])
+try
+{
+    Arguments argus;
+
+    // disable unit_check in client benchmark, it is only
+    // used in gtest unit test
+    argus.unit_check = 0;
+
+    // enable timing check,otherwise no performance data collected
+    argus.timing = 1;
+
+    bench_options opt;
+    options_description desc("rocsolver client command line options");
+    add_bench_options(desc, argus, opt);
 
     variables_map vm;
     store(parse_command_line(argc, argv, desc), vm);
@@ -366,27 +674,37 @@ try
     if(!argus.perf)
     {
         rocblas_int device_count = query_device_property();
-        if(device_count <= device_id)
+        if(device_count <= opt.device_id)
             throw std::invalid_argument("Invalid Device ID");
     }
-    set_device(device_id);
+    set_device(opt.device_id);
+
+    // replay the command lines of a file
+    if(!opt.replay.empty())
+    {
+        run_replay(opt, argus);
+        return 0;
+    }
 
     // catch invalid arguments
-    argus.validate_precision("precision");
-    argus.validate_operation("trans");
-    argus.validate_side("side");
-    argus.validate_fill("uplo");
-    argus.validate_diag("diag");
-    argus.validate_direct("direct");
-    argus.validate_storev("storev");
-    argus.validate_svect("left_svect");
-    argus.validate_svect("right_svect");
-    argus.validate_workmode("fast_alg");
-    argus.validate_evect("evect");
-    argus.validate_itype("itype");
+    validate_bench_arguments(argus);
+
+    rocsolver_bench_format fmt = rocsolver_bench_parse_format(opt.format);
+    if(fmt != rocsolver_bench_format_text)
+        argus.quiet = 1;
 
     // select and dispatch function test/benchmark
-    rocsolver_dispatcher::invoke(function, precision, argus);
+    rocsolver_dispatcher::invoke(opt.function, opt.precision, argus);
+
+    // write the achieved rates, or the machine-readable report
+    std::vector<rocsolver_bench_record> records;
+    records.emplace_back(opt.function, opt.precision, argus);
+    if(fmt == rocsolver_bench_format_json)
+        rocsolver_bench_write_json(rocsolver_cout, records, opt.peak);
+    else if(fmt == rocsolver_bench_format_csv)
+        rocsolver_bench_write_csv(rocsolver_cout, records, opt.peak);
+    else if(!argus.quiet)
+        rocsolver_bench_print_roofline(records.back(), opt.peak);
 
     return 0;
 }
@@ -0,0 +1,444 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "rocblascommon/program_options.hpp"
+#include "rocsolver_dispatcher.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+
+using namespace roc;
+
+// clang-format off
+const char* help_str = R"HELP_STR(
+rocSOLVER tuning client help.
+
+Usage: ./rocsolver-tune <options>
+
+This program searches for the block sizes and switch sizes that minimize the execution time of a rocSOLVER
+function on the current device. For each of the given problem sizes, the function is timed (as with
+rocsolver-bench) using each of the candidate values. The fastest choices are then written as a tuning table
+that can be loaded with rocsolver_tuning_load or with the environment variable ROCSOLVER_TUNING_PATH.
+
+The tunable functions are:
+    getrf, getrf_batched, getrf_strided_batched, getrf_npvt, getrf_npvt_batched,
+    getrf_npvt_strided_batched, getri, getri_batched, getri_strided_batched, trtri, trtri_batched,
+    trtri_strided_batched, potrf, potrf_batched, potrf_strided_batched, geqrf, geqrf_batched,
+    geqrf_strided_batched, gebrd, gebrd_batched, gebrd_strided_batched, sytrd, sytrd_batched,
+    sytrd_strided_batched (hetrd for complex precisions).
+
+Functions with size-dependent block sizes (getrf, getri and trtri) produce interval tables; for the other
+functions, the values with the best overall performance over all the given sizes are selected.
+Parameters that are not tuned keep the values of the input table (or the built-in defaults).
+
+Example: ./rocsolver-tune -f getrf_batched -r d --sizes 16,32,64,128,256,512 --batch_count 1000 -o getrf.tune
+This will tune the block sizes of getrf_batched with double precision for batches of 1000 matrices, and write the
+resulting table to getrf.tune.
+
+Options:
+)HELP_STR";
+// clang-format on
+
+// describes the parameters of the tuning table that are associated with a function
+struct tune_target
+{
+    // name of the interval table, or nullptr if the parameters do not depend on the size
+    const char* intervals;
+    // name of the table of block sizes, or of the block size
+    const char* blksizes;
+    // name of the switch size that must not be smaller than the block size, or nullptr
+    const char* switchsize;
+    // default candidate values
+    const char* candidates;
+    // does the function take the number of rows m?
+    bool use_m;
+    // does the function take uplo/diag?
+    bool use_uplo;
+    bool use_diag;
+};
+
+// clang-format off
+const std::map<std::string, tune_target> tune_targets = {
+    {"getrf",                      {"GETRF_INTERVALS", "GETRF_BLKSIZES", nullptr, "1,16,32,64,128,192,256", true, false, false}},
+    {"getrf_batched",              {"GETRF_BATCH_INTERVALS", "GETRF_BATCH_BLKSIZES", nullptr, "1,8,16,32,64,128", true, false, false}},
+    {"getrf_strided_batched",      {"GETRF_BATCH_INTERVALS", "GETRF_BATCH_BLKSIZES", nullptr, "1,8,16,32,64,128", true, false, false}},
+    {"getrf_npvt",                 {"GETRF_NPVT_INTERVALS", "GETRF_NPVT_BLKSIZES", nullptr, "1,16,32,64,128,192,256", true, false, false}},
+    {"getrf_npvt_batched",         {"GETRF_NPVT_BATCH_INTERVALS", "GETRF_NPVT_BATCH_BLKSIZES", nullptr, "1,8,16,32,64,128", true, false, false}},
+    {"getrf_npvt_strided_batched", {"GETRF_NPVT_BATCH_INTERVALS", "GETRF_NPVT_BATCH_BLKSIZES", nullptr, "1,8,16,32,64,128", true, false, false}},
+    {"getri",                      {"GETRI_INTERVALS", "GETRI_BLKSIZES", nullptr, "0,32,64,128,256", false, false, false}},
+    {"getri_batched",              {"GETRI_BATCH_INTERVALS", "GETRI_BATCH_BLKSIZES", nullptr, "0,16,32,64,128,256", false, false, false}},
+    {"getri_strided_batched",      {"GETRI_BATCH_INTERVALS", "GETRI_BATCH_BLKSIZES", nullptr, "0,16,32,64,128,256", false, false, false}},
+    {"trtri",                      {"TRTRI_INTERVALS", "TRTRI_BLKSIZES", nullptr, "0,1,16,32,64", false, true, true}},
+    {"trtri_batched",              {"TRTRI_BATCH_INTERVALS", "TRTRI_BATCH_BLKSIZES", nullptr, "0,1,16,32,64", false, true, true}},
+    {"trtri_strided_batched",      {"TRTRI_BATCH_INTERVALS", "TRTRI_BATCH_BLKSIZES", nullptr, "0,1,16,32,64", false, true, true}},
+    {"potrf",                      {nullptr, "POTRF_POTF2_SWITCHSIZE", nullptr, "16,32,64,128,256", false, true, false}},
+    {"potrf_batched",              {nullptr, "POTRF_POTF2_SWITCHSIZE", nullptr, "16,32,64,128,256", false, true, false}},
+    {"potrf_strided_batched",      {nullptr, "POTRF_POTF2_SWITCHSIZE", nullptr, "16,32,64,128,256", false, true, false}},
+    {"geqrf",                      {nullptr, "GEQxF_GEQx2_BLOCKSIZE", "GEQxF_GEQx2_SWITCHSIZE", "16,32,64,128,256", true, false, false}},
+    {"geqrf_batched",              {nullptr, "GEQxF_GEQx2_BLOCKSIZE", "GEQxF_GEQx2_SWITCHSIZE", "16,32,64,128,256", true, false, false}},
+    {"geqrf_strided_batched",      {nullptr, "GEQxF_GEQx2_BLOCKSIZE", "GEQxF_GEQx2_SWITCHSIZE", "16,32,64,128,256", true, false, false}},
+    {"gebrd",                      {nullptr, "GEBRD_GEBD2_SWITCHSIZE", nullptr, "16,32,64,128", true, false, false}},
+    {"gebrd_batched",              {nullptr, "GEBRD_GEBD2_SWITCHSIZE", nullptr, "16,32,64,128", true, false, false}},
+    {"gebrd_strided_batched",      {nullptr, "GEBRD_GEBD2_SWITCHSIZE", nullptr, "16,32,64,128", true, false, false}},
+    {"sytrd",                      {nullptr, "xxTRD_xxTD2_BLOCKSIZE", "xxTRD_xxTD2_SWITCHSIZE", "16,32,64,128", false, true, false}},
+    {"sytrd_batched",              {nullptr, "xxTRD_xxTD2_BLOCKSIZE", "xxTRD_xxTD2_SWITCHSIZE", "16,32,64,128", false, true, false}},
+    {"sytrd_strided_batched",      {nullptr, "xxTRD_xxTD2_BLOCKSIZE", "xxTRD_xxTD2_SWITCHSIZE", "16,32,64,128", false, true, false}},
+};
+// clang-format on
+
+struct tune_options
+{
+    std::string function;
+    char precision;
+    rocblas_int batch_count;
+    rocblas_int iters;
+    char uplo;
+    char diag;
+    std::string input;
+    std::string tmp_file;
+};
+
+// a candidate setting: (block size, switch size)
+using tune_point = std::pair<rocblas_int, rocblas_int>;
+
+std::vector<rocblas_int> parse_list(const std::string& str, const std::string& name)
+{
+    std::vector<rocblas_int> list;
+    std::stringstream ss(str);
+    std::string item;
+    while(std::getline(ss, item, ','))
+    {
+        char* end;
+        long v = strtol(item.c_str(), &end, 10);
+        if(item.empty() || *end != '\0' || v < 0 || v > std::numeric_limits<rocblas_int>::max())
+            throw std::invalid_argument("Invalid value for " + name);
+        list.push_back(rocblas_int(v));
+    }
+    if(list.empty())
+        throw std::invalid_argument("Missing required value for " + name);
+
+    std::sort(list.begin(), list.end());
+    list.erase(std::unique(list.begin(), list.end()), list.end());
+    return list;
+}
+
+std::string format_list(const std::vector<rocblas_int>& list)
+{
+    std::stringstream ss;
+    for(rocblas_int x : list)
+        ss << ' ' << x;
+    return ss.str();
+}
+
+// loads the input table (or the defaults) with the given parameters overridden
+void tune_load(const tune_options& opt, const std::vector<std::string>& overrides)
+{
+    std::ofstream file(opt.tmp_file, std::ios::trunc);
+    if(opt.input.empty())
+        file << "rocsolver_tuning 1\n";
+    else
+    {
+        std::ifstream input(opt.input);
+        file << input.rdbuf() << '\n';
+    }
+    for(const auto& line : overrides)
+        file << line << '\n';
+    file.close();
+
+    if(!file || rocsolver_tuning_load(opt.tmp_file.c_str()) != rocblas_status_success)
+        throw std::invalid_argument(
+            "Could not load the tuning table"
+            + (opt.input.empty() ? std::string() : " (check " + opt.input + ")"));
+}
+
+// the table entries corresponding to a candidate setting
+std::vector<std::string> tune_overrides(const tune_target& target, const tune_point& p)
+{
+    std::vector<std::string> overrides;
+    if(target.intervals)
+    {
+        overrides.push_back(target.intervals);
+        overrides.push_back(std::string(target.blksizes) + ' ' + std::to_string(p.first));
+    }
+    else
+    {
+        overrides.push_back(std::string(target.blksizes) + ' ' + std::to_string(p.first));
+        if(target.switchsize)
+            overrides.push_back(std::string(target.switchsize) + ' ' + std::to_string(p.second));
+    }
+    return overrides;
+}
+
+// times the function for a problem of size n with the active tuning table
+double tune_time(const tune_options& opt, const tune_target& target, rocblas_int n)
+{
+    Arguments argus;
+    argus.unit_check = 0;
+    argus.timing = 1;
+    argus.perf = 1;
+    argus.quiet = 1;
+    argus.iters = opt.iters;
+    argus.batch_count = opt.batch_count;
+
+    argus.set<rocblas_int>("n", n);
+    if(target.use_m)
+        argus.set<rocblas_int>("m", n);
+    if(target.use_uplo)
+        argus.set<char>("uplo", opt.uplo);
+    if(target.use_diag)
+        argus.set<char>("diag", opt.diag);
+
+    std::string name = opt.function;
+    if(name.compare(0, 5, "sytrd") == 0 && (opt.precision == 'c' || opt.precision == 'z'))
+        name.replace(0, 5, "hetrd");
+
+    rocsolver_dispatcher::invoke(name, opt.precision, argus);
+    return argus.gpu_time_used;
+}
+
+int main(int argc, char* argv[])
+try
+{
+    tune_options opt;
+    std::string sizes_str, candidates_str, switch_str, output;
+    rocblas_int device_id;
+
+    // take arguments and set default values
+    // clang-format off
+    options_description desc("rocsolver tuning client command line options");
+    desc.add_options()("help,h", "Produces this help message.")
+
+        ("batch_count",
+         value<rocblas_int>(&opt.batch_count)->default_value(1),
+            "Number of matrices in the batch.\n"
+            "                           Only applicable to batch routines.\n"
+            "                           ")
+
+        ("candidates,c",
+         value<std::string>(&candidates_str),
+            "Comma-separated list of candidate block sizes.\n"
+            "                           If not provided, a default list for the given function is used.\n"
+            "                           ")
+
+        ("device",
+         value<rocblas_int>(&device_id)->default_value(0),
+            "Set the default device to be used for subsequent program runs.\n"
+            "                           ")
+
+        ("diag",
+         value<char>(&opt.diag)->default_value('N'),
+            "N = non-unit triangular, U = unit triangular.\n"
+            "                           Only applicable to trtri.\n"
+            "                           ")
+
+        ("function,f",
+         value<std::string>(&opt.function)->default_value("getrf"),
+            "The LAPACK function to tune.\n"
+            "                           ")
+
+        ("input",
+         value<std::string>(&opt.input),
+            "Tuning file used as the starting point.\n"
+            "                           Parameters that are not tuned are copied from this table.\n"
+            "                           ")
+
+        ("iters,i",
+         value<rocblas_int>(&opt.iters)->default_value(10),
+            "Iterations to run inside the GPU timing loop.\n"
+            "                           ")
+
+        ("output,o",
+         value<std::string>(&output),
+            "File where the resulting tuning table is written.\n"
+            "                           If not provided, the tuned entries are only printed.\n"
+            "                           ")
+
+        ("precision,r",
+         value<char>(&opt.precision)->default_value('s'),
+            "Precision to be used in the tests.\n"
+            "                           Options are: s, d, c, z.\n"
+            "                           ")
+
+        ("sizes",
+         value<std::string>(&sizes_str)->default_value("64,128,256,512,1024,2048"),
+            "Comma-separated list of problem sizes (order of the square matrices).\n"
+            "                           ")
+
+        ("switch_candidates",
+         value<std::string>(&switch_str),
+            "Comma-separated list of candidate switch sizes.\n"
+            "                           Only applicable to geqrf and sytrd. Defaults to the candidate block sizes.\n"
+            "                           ")
+
+        ("uplo",
+         value<char>(&opt.uplo)->default_value('U'),
+            "U = upper, L = lower.\n"
+            "                           Only applicable to potrf, trtri and sytrd.\n"
+            "                           ");
+    // clang-format on
+
+    variables_map vm;
+    store(parse_command_line(argc, argv, desc), vm);
+    notify(vm);
+
+    // print help message
+    if(vm.count("help"))
+    {
+        rocsolver_cout << help_str << desc << std::endl;
+        return 0;
+    }
+
+    // set device ID
+    rocblas_int device_count = query_device_property();
+    if(device_count <= device_id)
+        throw std::invalid_argument("Invalid Device ID");
+    set_device(device_id);
+
+    // catch invalid arguments
+    auto match = tune_targets.find(opt.function);
+    if(match == tune_targets.end())
+        throw std::invalid_argument("Function " + opt.function + " cannot be tuned");
+    const tune_target& target = match->second;
+
+    if(opt.precision != 's' && opt.precision != 'd' && opt.precision != 'c' && opt.precision != 'z')
+        throw std::invalid_argument("Invalid value for --precision");
+    if(opt.uplo != 'U' && opt.uplo != 'L')
+        throw std::invalid_argument("Invalid value for --uplo");
+    if(opt.diag != 'N' && opt.diag != 'U')
+        throw std::invalid_argument("Invalid value for --diag");
+    if(opt.batch_count < 1)
+        throw std::invalid_argument("Invalid value for --batch_count");
+    if(opt.iters < 1)
+        throw std::invalid_argument("Invalid value for --iters");
+
+    std::vector<rocblas_int> sizes = parse_list(sizes_str, "--sizes");
+    if(sizes[0] == 0)
+        throw std::invalid_argument("Invalid value for --sizes");
+    std::vector<rocblas_int> cands
+        = parse_list(candidates_str.empty() ? target.candidates : candidates_str, "--candidates");
+    std::vector<rocblas_int> switches
+        = switch_str.empty() ? cands : parse_list(switch_str, "--switch_candidates");
+
+    // the candidate settings
+    std::vector<tune_point> points;
+    for(rocblas_int blk : cands)
+    {
+        if(!target.intervals && blk == 0)
+            throw std::invalid_argument("Invalid value for --candidates");
+        if(target.switchsize)
+        {
+            for(rocblas_int sw : switches)
+                if(sw >= blk)
+                    points.push_back(tune_point(blk, sw));
+        }
+        else
+            points.push_back(tune_point(blk, 0));
+    }
+    if(points.empty())
+        throw std::invalid_argument("No valid combination of block and switch sizes");
+
+    opt.tmp_file = (output.empty() ? std::string("rocsolver-tune") : output) + ".tmp";
+
+    // time every candidate setting with every size
+    // times[i][j] is the time of points[i] with sizes[j]
+    std::vector<std::vector<double>> times(points.size(), std::vector<double>(sizes.size()));
+    for(size_t i = 0; i < points.size(); i++)
+    {
+        tune_load(opt, tune_overrides(target, points[i]));
+
+        for(size_t j = 0; j < sizes.size(); j++)
+        {
+            times[i][j] = tune_time(opt, target, sizes[j]);
+
+            std::stringstream ss;
+            ss << "n = " << sizes[j] << ", " << target.blksizes << " = " << points[i].first;
+            if(target.switchsize)
+                ss << ", " << target.switchsize << " = " << points[i].second;
+            ss << ": " << times[i][j] << " us";
+            rocsolver_cout << ss.str() << std::endl;
+        }
+    }
+    std::remove(opt.tmp_file.c_str());
+
+    // select the best candidates
+    std::vector<std::string> result;
+    if(target.intervals)
+    {
+        // best block size for each size
+        std::vector<rocblas_int> best(sizes.size());
+        for(size_t j = 0; j < sizes.size(); j++)
+        {
+            size_t b = 0;
+            for(size_t i = 1; i < points.size(); i++)
+                if(times[i][j] < times[b][j])
+                    b = i;
+            best[j] = points[b].first;
+        }
+
+        // merge consecutive sizes with the same block size; the limits of the
+        // intervals are placed halfway between the tested sizes
+        std::vector<rocblas_int> intervals, blksizes = {best[0]};
+        for(size_t j = 1; j < sizes.size(); j++)
+        {
+            if(best[j] != blksizes.back())
+            {
+                intervals.push_back((sizes[j - 1] + sizes[j]) / 2 + 1);
+                blksizes.push_back(best[j]);
+            }
+        }
+
+        result.push_back(target.intervals + format_list(intervals));
+        result.push_back(target.blksizes + format_list(blksizes));
+    }
+    else
+    {
+        // minimize the average slowdown with respect to the best candidate of each size
+        std::vector<double> best_time(sizes.size(), std::numeric_limits<double>::max());
+        for(size_t i = 0; i < points.size(); i++)
+            for(size_t j = 0; j < sizes.size(); j++)
+                best_time[j] = std::min(best_time[j], times[i][j]);
+
+        size_t b = 0;
+        double b_slowdown = std::numeric_limits<double>::max();
+        for(size_t i = 0; i < points.size(); i++)
+        {
+            double slowdown = 0;
+            for(size_t j = 0; j < sizes.size(); j++)
+                slowdown += times[i][j] / best_time[j];
+            if(slowdown < b_slowdown)
+            {
+                b = i;
+                b_slowdown = slowdown;
+            }
+        }
+
+        result = tune_overrides(target, points[b]);
+    }
+
+    rocsolver_cout << "\n============================================\n";
+    rocsolver_cout << "Tuned parameters:\n";
+    rocsolver_cout << "============================================\n";
+    for(const auto& line : result)
+        rocsolver_cout << line << '\n';
+    rocsolver_cout << std::endl;
+
+    // write the complete table
+    if(!output.empty())
+    {
+        tune_load(opt, result);
+        std::remove(opt.tmp_file.c_str());
+        if(rocsolver_tuning_write(output.c_str()) != rocblas_status_success)
+            throw std::invalid_argument("Could not write " + output);
+        rocsolver_cout << "Tuning table written to " << output << std::endl;
+    }
+
+    return 0;
+}
+
+catch(const std::invalid_argument& exp)
+{
+    rocsolver_cerr << exp.what() << std::endl;
+    return -1;
+}
@@ -154,6 +154,44 @@ void zgetrs_(char* trans,
              int* ldb,
              int* info);
 
+void sgesv_(int* n, int* nrhs, float* A, int* lda, int* ipiv, float* B, int* ldb, int* info);
+void dgesv_(int* n, int* nrhs, double* A, int* lda, int* ipiv, double* B, int* ldb, int* info);
+void cgesv_(int* n,
+            int* nrhs,
+            rocblas_float_complex* A,
+            int* lda,
+            int* ipiv,
+            rocblas_float_complex* B,
+            int* ldb,
+            int* info);
+void zgesv_(int* n,
+            int* nrhs,
+            rocblas_double_complex* A,
+            int* lda,
+            int* ipiv,
+            rocblas_double_complex* B,
+            int* ldb,
+            int* info);
+
+void sposv_(char* uplo, int* n, int* nrhs, float* A, int* lda, float* B, int* ldb, int* info);
+void dposv_(char* uplo, int* n, int* nrhs, double* A, int* lda, double* B, int* ldb, int* info);
+void cposv_(char* uplo,
+            int* n,
+            int* nrhs,
+            rocblas_float_complex* A,
+            int* lda,
+            rocblas_float_complex* B,
+            int* ldb,
+            int* info);
+void zposv_(char* uplo,
+            int* n,
+            int* nrhs,
+            rocblas_double_complex* A,
+            int* lda,
+            rocblas_double_complex* B,
+            int* ldb,
+            int* info);
+
 void sgels_(char* trans,
             int* m,
             int* n,
@@ -199,6 +237,100 @@ void zgels_(char* trans,
             int* lwork,
             int* info);
 
+void sgeqp3_(int* m,
+             int* n,
+             float* A,
+             int* lda,
+             int* jpvt,
+             float* tau,
+             float* work,
+             int* lwork,
+             int* info);
+void dgeqp3_(int* m,
+             int* n,
+             double* A,
+             int* lda,
+             int* jpvt,
+             double* tau,
+             double* work,
+             int* lwork,
+             int* info);
+void cgeqp3_(int* m,
+             int* n,
+             rocblas_float_complex* A,
+             int* lda,
+             int* jpvt,
+             rocblas_float_complex* tau,
+             rocblas_float_complex* work,
+             int* lwork,
+             float* rwork,
+             int* info);
+void zgeqp3_(int* m,
+             int* n,
+             rocblas_double_complex* A,
+             int* lda,
+             int* jpvt,
+             rocblas_double_complex* tau,
+             rocblas_double_complex* work,
+             int* lwork,
+             double* rwork,
+             int* info);
+
+void sgelsy_(int* m,
+             int* n,
+             int* nrhs,
+             float* A,
+             int* lda,
+             float* B,
+             int* ldb,
+             int* jpvt,
+             float* rcond,
+             int* rank,
+             float* work,
+             int* lwork,
+             int* info);
+void dgelsy_(int* m,
+             int* n,
+             int* nrhs,
+             double* A,
+             int* lda,
+             double* B,
+             int* ldb,
+             int* jpvt,
+             double* rcond,
+             int* rank,
+             double* work,
+             int* lwork,
+             int* info);
+void cgelsy_(int* m,
+             int* n,
+             int* nrhs,
+             rocblas_float_complex* A,
+             int* lda,
+             rocblas_float_complex* B,
+             int* ldb,
+             int* jpvt,
+             float* rcond,
+             int* rank,
+             rocblas_float_complex* work,
+             int* lwork,
+             float* rwork,
+             int* info);
+void zgelsy_(int* m,
+             int* n,
+             int* nrhs,
+             rocblas_double_complex* A,
+             int* lda,
+             rocblas_double_complex* B,
+             int* ldb,
+             int* jpvt,
+             double* rcond,
+             int* rank,
+             rocblas_double_complex* work,
+             int* lwork,
+             double* rwork,
+             int* info);
+
 void sgetri_(int* n, float* A, int* lda, int* ipiv, float* work, int* lwork, int* info);
 void dgetri_(int* n, double* A, int* lda, int* ipiv, double* work, int* lwork, int* info);
 void cgetri_(int* n,
@@ -1463,6 +1595,145 @@ void zsteqr_(char* evect,
              double* work,
              int* info);
 
+void sstedc_(char* evect,
+             int* n,
+             float* D,
+             float* E,
+             float* C,
+             int* ldc,
+             float* work,
+             int* lwork,
+             int* iwork,
+             int* liwork,
+             int* info);
+void dstedc_(char* evect,
+             int* n,
+             double* D,
+             double* E,
+             double* C,
+             int* ldc,
+             double* work,
+             int* lwork,
+             int* iwork,
+             int* liwork,
+             int* info);
+void cstedc_(char* evect,
+             int* n,
+             float* D,
+             float* E,
+             rocblas_float_complex* C,
+             int* ldc,
+             rocblas_float_complex* work,
+             int* lwork,
+             float* rwork,
+             int* lrwork,
+             int* iwork,
+             int* liwork,
+             int* info);
+void zstedc_(char* evect,
+             int* n,
+             double* D,
+             double* E,
+             rocblas_double_complex* C,
+             int* ldc,
+             rocblas_double_complex* work,
+             int* lwork,
+             double* rwork,
+             int* lrwork,
+             int* iwork,
+             int* liwork,
+             int* info);
+
+void sstebz_(char* erange,
+             char* eorder,
+             int* n,
+             float* vl,
+             float* vu,
+             int* il,
+             int* iu,
+             float* abstol,
+             float* D,
+             float* E,
+             int* nev,
+             int* nsplit,
+             float* W,
+             int* iblock,
+             int* isplit,
+             float* work,
+             int* iwork,
+             int* info);
+void dstebz_(char* erange,
+             char* eorder,
+             int* n,
+             double* vl,
+             double* vu,
+             int* il,
+             int* iu,
+             double* abstol,
+             double* D,
+             double* E,
+             int* nev,
+             int* nsplit,
+             double* W,
+             int* iblock,
+             int* isplit,
+             double* work,
+             int* iwork,
+             int* info);
+
+void sstein_(int* n,
+             float* D,
+             float* E,
+             int* nev,
+             float* W,
+             int* iblock,
+             int* isplit,
+             float* Z,
+             int* ldz,
+             float* work,
+             int* iwork,
+             int* ifail,
+             int* info);
+void dstein_(int* n,
+             double* D,
+             double* E,
+             int* nev,
+             double* W,
+             int* iblock,
+             int* isplit,
+             double* Z,
+             int* ldz,
+             double* work,
+             int* iwork,
+             int* ifail,
+             int* info);
+void cstein_(int* n,
+             float* D,
+             float* E,
+             int* nev,
+             float* W,
+             int* iblock,
+             int* isplit,
+             rocblas_float_complex* Z,
+             int* ldz,
+             float* work,
+             int* iwork,
+             int* ifail,
+             int* info);
+void zstein_(int* n,
+             double* D,
+             double* E,
+             int* nev,
+             double* W,
+             int* iblock,
+             int* isplit,
+             rocblas_double_complex* Z,
+             int* ldz,
+             double* work,
+             int* iwork,
+             int* ifail,
+             int* info);
+
 void ssygs2_(int* itype, char* uplo, int* n, float* A, int* lda, float* B, int* ldb, int* info);
 void dsygs2_(int* itype, char* uplo, int* n, double* A, int* lda, double* B, int* ldb, int* info);
 void chegs2_(int* itype,
@@ -1532,94 +1803,34 @@ void zheev_(char* evect,
             double* E,
             int* info);
 
-void ssygv_(int* itype,
-            char* evect,
-            char* uplo,
-            int* n,
-            float* A,
-            int* lda,
-            float* B,
-            int* ldb,
-            float* W,
-            float* work,
-            int* lwork,
-            int* info);
-void dsygv_(int* itype,
-            char* evect,
-            char* uplo,
-            int* n,
-            double* A,
-            int* lda,
-            double* B,
-            int* ldb,
-            double* W,
-            double* work,
-            int* lwork,
-            int* info);
-void chegv_(int* itype,
-            char* evect,
-            char* uplo,
-            int* n,
-            rocblas_float_complex* A,
-            int* lda,
-            rocblas_float_complex* B,
-            int* ldb,
-            float* W,
-            rocblas_float_complex* work,
-            int* lwork,
-            float* rwork,
-            int* info);
-void zhegv_(int* itype,
-            char* evect,
-            char* uplo,
-            int* n,
-            rocblas_double_complex* A,
-            int* lda,
-            rocblas_double_complex* B,
-            int* ldb,
-            double* W,
-            rocblas_double_complex* work,
-            int* lwork,
-            double* rwork,
-            int* info);
-
-void ssygvd_(int* itype,
-             char* evect,
+void ssyevd_(char* evect,
              char* uplo,
              int* n,
              float* A,
              int* lda,
-             float* B,
-             int* ldb,
-             float* W,
+             float* D,
              float* work,
              int* lwork,
              int* iwork,
              int* liwork,
              int* info);
-void dsygvd_(int* itype,
-             char* evect,
+void dsyevd_(char* evect,
              char* uplo,
              int* n,
              double* A,
              int* lda,
-             double* B,
-             int* ldb,
-             double* W,
+             double* D,
              double* work,
              int* lwork,
              int* iwork,
              int* liwork,
              int* info);
-void chegvd_(int* itype,
-             char* evect,
+void cheevd_(char* evect,
              char* uplo,
              int* n,
              rocblas_float_complex* A,
              int* lda,
-             rocblas_float_complex* B,
-             int* ldb,
-             float* W,
+             float* D,
              rocblas_float_complex* work,
              int* lwork,
              float* rwork,
@@ -1627,14 +1838,206 @@ void chegvd_(int* itype,
              int* iwork,
              int* liwork,
              int* info);
-void zhegvd_(int* itype,
-             char* evect,
+void zheevd_(char* evect,
              char* uplo,
              int* n,
              rocblas_double_complex* A,
              int* lda,
-             rocblas_double_complex* B,
-             int* ldb,
+             double* D,
+             rocblas_double_complex* work,
+             int* lwork,
+             double* rwork,
+             int* lrwork,
+             int* iwork,
+             int* liwork,
+             int* info);
+
+void ssyevx_(char* evect,
+             char* erange,
+             char* uplo,
+             int* n,
+             float* A,
+             int* lda,
+             float* vl,
+             float* vu,
+             int* il,
+             int* iu,
+             float* abstol,
+             int* nev,
+             float* W,
+             float* Z,
+             int* ldz,
+             float* work,
+             int* lwork,
+             int* iwork,
+             int* ifail,
+             int* info);
+void dsyevx_(char* evect,
+             char* erange,
+             char* uplo,
+             int* n,
+             double* A,
+             int* lda,
+             double* vl,
+             double* vu,
+             int* il,
+             int* iu,
+             double* abstol,
+             int* nev,
+             double* W,
+             double* Z,
+             int* ldz,
+             double* work,
+             int* lwork,
+             int* iwork,
+             int* ifail,
+             int* info);
+void cheevx_(char* evect,
+             char* erange,
+             char* uplo,
+             int* n,
+             rocblas_float_complex* A,
+             int* lda,
+             float* vl,
+             float* vu,
+             int* il,
+             int* iu,
+             float* abstol,
+             int* nev,
+             float* W,
+             rocblas_float_complex* Z,
+             int* ldz,
+             rocblas_float_complex* work,
+             int* lwork,
+             float* rwork,
+             int* iwork,
+             int* ifail,
+             int* info);
+void zheevx_(char* evect,
+             char* erange,
+             char* uplo,
+             int* n,
+             rocblas_double_complex* A,
+             int* lda,
+             double* vl,
+             double* vu,
+             int* il,
+             int* iu,
+             double* abstol,
+             int* nev,
+             double* W,
+             rocblas_double_complex* Z,
+             int* ldz,
+             rocblas_double_complex* work,
+             int* lwork,
+             double* rwork,
+             int* iwork,
+             int* ifail,
+             int* info);
+
+void ssygv_(int* itype,
+            char* evect,
+            char* uplo,
+            int* n,
+            float* A,
+            int* lda,
+            float* B,
+            int* ldb,
+            float* W,
+            float* work,
+            int* lwork,
+            int* info);
+void dsygv_(int* itype,
+            char* evect,
+            char* uplo,
+            int* n,
+            double* A,
+            int* lda,
+            double* B,
+            int* ldb,
+            double* W,
+            double* work,
+            int* lwork,
+            int* info);
+void chegv_(int* itype,
+            char* evect,
+            char* uplo,
+            int* n,
+            rocblas_float_complex* A,
+            int* lda,
+            rocblas_float_complex* B,
+            int* ldb,
+            float* W,
+            rocblas_float_complex* work,
+            int* lwork,
+            float* rwork,
+            int* info);
+void zhegv_(int* itype,
+            char* evect,
+            char* uplo,
+            int* n,
+            rocblas_double_complex* A,
+            int* lda,
+            rocblas_double_complex* B,
+            int* ldb,
+            double* W,
+            rocblas_double_complex* work,
+            int* lwork,
+            double* rwork,
+            int* info);
+
+void ssygvd_(int* itype,
+             char* evect,
+             char* uplo,
+             int* n,
+             float* A,
+             int* lda,
+             float* B,
+             int* ldb,
+             float* W,
+             float* work,
+             int* lwork,
+             int* iwork,
+             int* liwork,
+             int* info);
+void dsygvd_(int* itype,
+             char* evect,
+             char* uplo,
+             int* n,
+             double* A,
+             int* lda,
+             double* B,
+             int* ldb,
+             double* W,
+             double* work,
+             int* lwork,
+             int* iwork,
+             int* liwork,
+             int* info);
+void chegvd_(int* itype,
+             char* evect,
+             char* uplo,
+             int* n,
+             rocblas_float_complex* A,
+             int* lda,
+             rocblas_float_complex* B,
+             int* ldb,
+             float* W,
+             rocblas_float_complex* work,
+             int* lwork,
+             float* rwork,
+             int* lrwork,
+             int* iwork,
+             int* liwork,
+             int* info);
+void zhegvd_(int* itype,
+             char* evect,
+             char* uplo,
+             int* n,
+             rocblas_double_complex* A,
+             int* lda,
+             rocblas_double_complex* B,
+             int* ldb,
              double* W,
              rocblas_double_complex* work,
              int* lwork,
@@ -4189,6 +4592,144 @@ void cblas_getf2(rocblas_int m,
 }
 
 /*
+// geqp3
+template <>
+void cblas_geqp3<float, float>(rocblas_int m,
+                               rocblas_int n,
+                               float* A,
+                               rocblas_int lda,
+                               rocblas_int* jpvt,
+                               float* ipiv,
+                               float* work,
+                               rocblas_int lwork,
+                               float* rwork)
+{
+    int info;
+    sgeqp3_(&m, &n, A, &lda, jpvt, ipiv, work, &lwork, &info);
+}
+
+template <>
+void cblas_geqp3<double, double>(rocblas_int m,
+                                 rocblas_int n,
+                                 double* A,
+                                 rocblas_int lda,
+                                 rocblas_int* jpvt,
+                                 double* ipiv,
+                                 double* work,
+                                 rocblas_int lwork,
+                                 double* rwork)
+{
+    int info;
+    dgeqp3_(&m, &n, A, &lda, jpvt, ipiv, work, &lwork, &info);
+}
+
+template <>
+void cblas_geqp3<rocblas_float_complex, float>(rocblas_int m,
+                                               rocblas_int n,
+                                               rocblas_float_complex* A,
+                                               rocblas_int lda,
+                                               rocblas_int* jpvt,
+                                               rocblas_float_complex* ipiv,
+                                               rocblas_float_complex* work,
+                                               rocblas_int lwork,
+                                               float* rwork)
+{
+    int info;
+    cgeqp3_(&m, &n, A, &lda, jpvt, ipiv, work, &lwork, rwork, &info);
+}
+
+template <>
+void cblas_geqp3<rocblas_double_complex, double>(rocblas_int m,
+                                                 rocblas_int n,
+                                                 rocblas_double_complex* A,
+                                                 rocblas_int lda,
+                                                 rocblas_int* jpvt,
+                                                 rocblas_double_complex* ipiv,
+                                                 rocblas_double_complex* work,
+                                                 rocblas_int lwork,
+                                                 double* rwork)
+{
+    int info;
+    zgeqp3_(&m, &n, A, &lda, jpvt, ipiv, work, &lwork, rwork, &info);
+}
+
+// gelsy
+template <>
+void cblas_gelsy<float, float>(rocblas_int m,
+                               rocblas_int n,
+                               rocblas_int nrhs,
+                               float* A,
+                               rocblas_int lda,
+                               float* B,
+                               rocblas_int ldb,
+                               rocblas_int* jpvt,
+                               float rcond,
+                               rocblas_int* rank,
+                               float* work,
+                               rocblas_int lwork,
+                               float* rwork)
+{
+    int info;
+    sgelsy_(&m, &n, &nrhs, A, &lda, B, &ldb, jpvt, &rcond, rank, work, &lwork, &info);
+}
+
+template <>
+void cblas_gelsy<double, double>(rocblas_int m,
+                                 rocblas_int n,
+                                 rocblas_int nrhs,
+                                 double* A,
+                                 rocblas_int lda,
+                                 double* B,
+                                 rocblas_int ldb,
+                                 rocblas_int* jpvt,
+                                 double rcond,
+                                 rocblas_int* rank,
+                                 double* work,
+                                 rocblas_int lwork,
+                                 double* rwork)
+{
+    int info;
+    dgelsy_(&m, &n, &nrhs, A, &lda, B, &ldb, jpvt, &rcond, rank, work, &lwork, &info);
+}
+
+template <>
+void cblas_gelsy<rocblas_float_complex, float>(rocblas_int m,
+                                               rocblas_int n,
+                                               rocblas_int nrhs,
+                                               rocblas_float_complex* A,
+                                               rocblas_int lda,
+                                               rocblas_float_complex* B,
+                                               rocblas_int ldb,
+                                               rocblas_int* jpvt,
+                                               float rcond,
+                                               rocblas_int* rank,
+                                               rocblas_float_complex* work,
+                                               rocblas_int lwork,
+                                               float* rwork)
+{
+    int info;
+    cgelsy_(&m, &n, &nrhs, A, &lda, B, &ldb, jpvt, &rcond, rank, work, &lwork, rwork, &info);
+}
+
+template <>
+void cblas_gelsy<rocblas_double_complex, double>(rocblas_int m,
+                                                 rocblas_int n,
+                                                 rocblas_int nrhs,
+                                                 rocblas_double_complex* A,
+                                                 rocblas_int lda,
+                                                 rocblas_double_complex* B,
+                                                 rocblas_int ldb,
+                                                 rocblas_int* jpvt,
+                                                 double rcond,
+                                                 rocblas_int* rank,
+                                                 rocblas_double_complex* work,
+                                                 rocblas_int lwork,
+                                                 double* rwork)
+{
+    int info;
+    zgelsy_(&m, &n, &nrhs, A, &lda, B, &ldb, jpvt, &rcond, rank, work, &lwork, rwork, &info);
+}
+
 // trtri
 template <>
 rocblas_int cblas_trtri<float>(rocblas_fill uplo, rocblas_diagonal diag,
@@ -4378,78 +4919,188 @@ void cblas_getrs<rocblas_double_complex>(rocblas_operation trans,
     zgetrs_(&transC, &n, &nrhs, A, &lda, ipiv, B, &ldb, &info);
 }
 
-// gels
+// gesv
 template <>
-void cblas_gels<float>(rocblas_operation transR,
-                       rocblas_int m,
-                       rocblas_int n,
+void cblas_gesv<float>(rocblas_int n,
                        rocblas_int nrhs,
                        float* A,
                        rocblas_int lda,
+                       rocblas_int* ipiv,
                        float* B,
                        rocblas_int ldb,
-                       float* work,
-                       rocblas_int lwork,
                        rocblas_int* info)
 {
-    char trans = rocblas2char_operation(transR);
-    sgels_(&trans, &m, &n, &nrhs, A, &lda, B, &ldb, work, &lwork, info);
+    sgesv_(&n, &nrhs, A, &lda, ipiv, B, &ldb, info);
 }
 
 template <>
-void cblas_gels<double>(rocblas_operation transR,
-                        rocblas_int m,
-                        rocblas_int n,
+void cblas_gesv<double>(rocblas_int n,
                         rocblas_int nrhs,
                         double* A,
                         rocblas_int lda,
+                        rocblas_int* ipiv,
                         double* B,
                         rocblas_int ldb,
-                        double* work,
-                        rocblas_int lwork,
                         rocblas_int* info)
 {
-    char trans = rocblas2char_operation(transR);
-    dgels_(&trans, &m, &n, &nrhs, A, &lda, B, &ldb, work, &lwork, info);
+    dgesv_(&n, &nrhs, A, &lda, ipiv, B, &ldb, info);
 }
 
 template <>
-void cblas_gels<rocblas_float_complex>(rocblas_operation transR,
-                                       rocblas_int m,
-                                       rocblas_int n,
+void cblas_gesv<rocblas_float_complex>(rocblas_int n,
                                        rocblas_int nrhs,
                                        rocblas_float_complex* A,
                                        rocblas_int lda,
+                                       rocblas_int* ipiv,
                                        rocblas_float_complex* B,
                                        rocblas_int ldb,
-                                       rocblas_float_complex* work,
-                                       rocblas_int lwork,
                                        rocblas_int* info)
 {
-    char trans = rocblas2char_operation(transR);
-    cgels_(&trans, &m, &n, &nrhs, A, &lda, B, &ldb, work, &lwork, info);
+    cgesv_(&n, &nrhs, A, &lda, ipiv, B, &ldb, info);
 }
 
 template <>
-void cblas_gels<rocblas_double_complex>(rocblas_operation transR,
-                                        rocblas_int m,
-                                        rocblas_int n,
+void cblas_gesv<rocblas_double_complex>(rocblas_int n,
                                         rocblas_int nrhs,
                                         rocblas_double_complex* A,
                                         rocblas_int lda,
+                                        rocblas_int* ipiv,
                                         rocblas_double_complex* B,
                                         rocblas_int ldb,
-                                        rocblas_double_complex* work,
-                                        rocblas_int lwork,
                                         rocblas_int* info)
 {
-    char trans = rocblas2char_operation(transR);
-    zgels_(&trans, &m, &n, &nrhs, A, &lda, B, &ldb, work, &lwork, info);
+    zgesv_(&n, &nrhs, A, &lda, ipiv, B, &ldb, info);
 }
 
-// trtri
+// posv
 template <>
-void cblas_trtri<float>(rocblas_fill uplo,
+void cblas_posv<float>(rocblas_fill uplo,
+                       rocblas_int n,
+                       rocblas_int nrhs,
+                       float* A,
+                       rocblas_int lda,
+                       float* B,
+                       rocblas_int ldb,
+                       rocblas_int* info)
+{
+    char uploC = (uplo == rocblas_fill_upper) ? 'U' : 'L';
+    sposv_(&uploC, &n, &nrhs, A, &lda, B, &ldb, info);
+}
+
+template <>
+void cblas_posv<double>(rocblas_fill uplo,
+                        rocblas_int n,
+                        rocblas_int nrhs,
+                        double* A,
+                        rocblas_int lda,
+                        double* B,
+                        rocblas_int ldb,
+                        rocblas_int* info)
+{
+    char uploC = (uplo == rocblas_fill_upper) ? 'U' : 'L';
+    dposv_(&uploC, &n, &nrhs, A, &lda, B, &ldb, info);
+}
+
+template <>
+void cblas_posv<rocblas_float_complex>(rocblas_fill uplo,
+                                       rocblas_int n,
+                                       rocblas_int nrhs,
+                                       rocblas_float_complex* A,
+                                       rocblas_int lda,
+                                       rocblas_float_complex* B,
+                                       rocblas_int ldb,
+                                       rocblas_int* info)
+{
+    char uploC = (uplo == rocblas_fill_upper) ? 'U' : 'L';
+    cposv_(&uploC, &n, &nrhs, A, &lda, B, &ldb, info);
+}
+
+template <>
+void cblas_posv<rocblas_double_complex>(rocblas_fill uplo,
+                                        rocblas_int n,
+                                        rocblas_int nrhs,
+                                        rocblas_double_complex* A,
+                                        rocblas_int lda,
+                                        rocblas_double_complex* B,
+                                        rocblas_int ldb,
+                                        rocblas_int* info)
+{
+    char uploC = (uplo == rocblas_fill_upper) ? 'U' : 'L';
+    zposv_(&uploC, &n, &nrhs, A, &lda, B, &ldb, info);
+}
+
+// gels
+template <>
+void cblas_gels<float>(rocblas_operation transR,
+                       rocblas_int m,
+                       rocblas_int n,
+                       rocblas_int nrhs,
+                       float* A,
+                       rocblas_int lda,
+                       float* B,
+                       rocblas_int ldb,
+                       float* work,
+                       rocblas_int lwork,
+                       rocblas_int* info)
+{
+    char trans = rocblas2char_operation(transR);
+    sgels_(&trans, &m, &n, &nrhs, A, &lda, B, &ldb, work, &lwork, info);
+}
+
+template <>
+void cblas_gels<double>(rocblas_operation transR,
+                        rocblas_int m,
+                        rocblas_int n,
+                        rocblas_int nrhs,
+                        double* A,
+                        rocblas_int lda,
+                        double* B,
+                        rocblas_int ldb,
+                        double* work,
+                        rocblas_int lwork,
+                        rocblas_int* info)
+{
+    char trans = rocblas2char_operation(transR);
+    dgels_(&trans, &m, &n, &nrhs, A, &lda, B, &ldb, work, &lwork, info);
+}
+
+template <>
+void cblas_gels<rocblas_float_complex>(rocblas_operation transR,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       rocblas_int nrhs,
+                                       rocblas_float_complex* A,
+                                       rocblas_int lda,
+                                       rocblas_float_complex* B,
+                                       rocblas_int ldb,
+                                       rocblas_float_complex* work,
+                                       rocblas_int lwork,
+                                       rocblas_int* info)
+{
+    char trans = rocblas2char_operation(transR);
+    cgels_(&trans, &m, &n, &nrhs, A, &lda, B, &ldb, work, &lwork, info);
+}
+
+template <>
+void cblas_gels<rocblas_double_complex>(rocblas_operation transR,
+                                        rocblas_int m,
+                                        rocblas_int n,
+                                        rocblas_int nrhs,
+                                        rocblas_double_complex* A,
+                                        rocblas_int lda,
+                                        rocblas_double_complex* B,
+                                        rocblas_int ldb,
+                                        rocblas_double_complex* work,
+                                        rocblas_int lwork,
+                                        rocblas_int* info)
+{
+    char trans = rocblas2char_operation(transR);
+    zgels_(&trans, &m, &n, &nrhs, A, &lda, B, &ldb, work, &lwork, info);
+}
+
+// trtri
+template <>
+void cblas_trtri<float>(rocblas_fill uplo,
                         rocblas_diagonal diag,
                         rocblas_int n,
                         float* A,
@@ -5256,6 +5907,209 @@ void cblas_steqr<double, rocblas_double_complex>(rocblas_evect evect,
     zsteqr_(&evectC, &n, D, E, C, &ldc, work, &info);
 }
 
+// stedc
+template <>
+void cblas_stedc<float, float>(rocblas_evect evect,
+                               rocblas_int n,
+                               float* D,
+                               float* E,
+                               float* C,
+                               rocblas_int ldc,
+                               float* work,
+                               rocblas_int lwork,
+                               float* rwork,
+                               rocblas_int lrwork,
+                               rocblas_int* iwork,
+                               rocblas_int liwork,
+                               rocblas_int* info)
+{
+    char evectC = rocblas2char_evect(evect);
+    sstedc_(&evectC, &n, D, E, C, &ldc, work, &lwork, iwork, &liwork, info);
+}
+
+template <>
+void cblas_stedc<double, double>(rocblas_evect evect,
+                                 rocblas_int n,
+                                 double* D,
+                                 double* E,
+                                 double* C,
+                                 rocblas_int ldc,
+                                 double* work,
+                                 rocblas_int lwork,
+                                 double* rwork,
+                                 rocblas_int lrwork,
+                                 rocblas_int* iwork,
+                                 rocblas_int liwork,
+                                 rocblas_int* info)
+{
+    char evectC = rocblas2char_evect(evect);
+    dstedc_(&evectC, &n, D, E, C, &ldc, work, &lwork, iwork, &liwork, info);
+}
+
+template <>
+void cblas_stedc<float, rocblas_float_complex>(rocblas_evect evect,
+                                               rocblas_int n,
+                                               float* D,
+                                               float* E,
+                                               rocblas_float_complex* C,
+                                               rocblas_int ldc,
+                                               rocblas_float_complex* work,
+                                               rocblas_int lwork,
+                                               float* rwork,
+                                               rocblas_int lrwork,
+                                               rocblas_int* iwork,
+                                               rocblas_int liwork,
+                                               rocblas_int* info)
+{
+    char evectC = rocblas2char_evect(evect);
+    cstedc_(&evectC, &n, D, E, C, &ldc, work, &lwork, rwork, &lrwork, iwork, &liwork, info);
+}
+
+template <>
+void cblas_stedc<double, rocblas_double_complex>(rocblas_evect evect,
+                                                 rocblas_int n,
+                                                 double* D,
+                                                 double* E,
+                                                 rocblas_double_complex* C,
+                                                 rocblas_int ldc,
+                                                 rocblas_double_complex* work,
+                                                 rocblas_int lwork,
+                                                 double* rwork,
+                                                 rocblas_int lrwork,
+                                                 rocblas_int* iwork,
+                                                 rocblas_int liwork,
+                                                 rocblas_int* info)
+{
+    char evectC = rocblas2char_evect(evect);
+    zstedc_(&evectC, &n, D, E, C, &ldc, work, &lwork, rwork, &lrwork, iwork, &liwork, info);
+}
+
+// stebz
+template <>
+void cblas_stebz<float>(rocblas_erange erange,
+                        rocblas_eorder eorder,
+                        rocblas_int n,
+                        float vl,
+                        float vu,
+                        rocblas_int il,
+                        rocblas_int iu,
+                        float abstol,
+                        float* D,
+                        float* E,
+                        rocblas_int* nev,
+                        rocblas_int* nsplit,
+                        float* W,
+                        rocblas_int* iblock,
+                        rocblas_int* isplit,
+                        float* work,
+                        rocblas_int* iwork,
+                        rocblas_int* info)
+{
+    char erangeC = rocblas2char_erange(erange);
+    char eorderC = rocblas2char_eorder(eorder);
+    sstebz_(&erangeC, &eorderC, &n, &vl, &vu, &il, &iu, &abstol, D, E, nev, nsplit, W, iblock,
+            isplit, work, iwork, info);
+}
+
+template <>
+void cblas_stebz<double>(rocblas_erange erange,
+                         rocblas_eorder eorder,
+                         rocblas_int n,
+                         double vl,
+                         double vu,
+                         rocblas_int il,
+                         rocblas_int iu,
+                         double abstol,
+                         double* D,
+                         double* E,
+                         rocblas_int* nev,
+                         rocblas_int* nsplit,
+                         double* W,
+                         rocblas_int* iblock,
+                         rocblas_int* isplit,
+                         double* work,
+                         rocblas_int* iwork,
+                         rocblas_int* info)
+{
+    char erangeC = rocblas2char_erange(erange);
+    char eorderC = rocblas2char_eorder(eorder);
+    dstebz_(&erangeC, &eorderC, &n, &vl, &vu, &il, &iu, &abstol, D, E, nev, nsplit, W, iblock,
+            isplit, work, iwork, info);
+}
+
+// stein
+template <>
+void cblas_stein<float, float>(rocblas_int n,
+                               float* D,
+                               float* E,
+                               rocblas_int* nev,
+                               float* W,
+                               rocblas_int* iblock,
+                               rocblas_int* isplit,
+                               float* Z,
+                               rocblas_int ldz,
+                               float* work,
+                               rocblas_int* iwork,
+                               rocblas_int* ifail,
+                               rocblas_int* info)
+{
+    sstein_(&n, D, E, nev, W, iblock, isplit, Z, &ldz, work, iwork, ifail, info);
+}
+
+template <>
+void cblas_stein<double, double>(rocblas_int n,
+                                 double* D,
+                                 double* E,
+                                 rocblas_int* nev,
+                                 double* W,
+                                 rocblas_int* iblock,
+                                 rocblas_int* isplit,
+                                 double* Z,
+                                 rocblas_int ldz,
+                                 double* work,
+                                 rocblas_int* iwork,
+                                 rocblas_int* ifail,
+                                 rocblas_int* info)
+{
+    dstein_(&n, D, E, nev, W, iblock, isplit, Z, &ldz, work, iwork, ifail, info);
+}
+
+template <>
+void cblas_stein<float, rocblas_float_complex>(rocblas_int n,
+                                               float* D,
+                                               float* E,
+                                               rocblas_int* nev,
+                                               float* W,
+                                               rocblas_int* iblock,
+                                               rocblas_int* isplit,
+                                               rocblas_float_complex* Z,
+                                               rocblas_int ldz,
+                                               float* work,
+                                               rocblas_int* iwork,
+                                               rocblas_int* ifail,
+                                               rocblas_int* info)
+{
+    cstein_(&n, D, E, nev, W, iblock, isplit, Z, &ldz, work, iwork, ifail, info);
+}
+
+template <>
+void cblas_stein<double, rocblas_double_complex>(rocblas_int n,
+                                                 double* D,
+                                                 double* E,
+                                                 rocblas_int* nev,
+                                                 double* W,
+                                                 rocblas_int* iblock,
+                                                 rocblas_int* isplit,
+                                                 rocblas_double_complex* Z,
+                                                 rocblas_int ldz,
+                                                 double* work,
+                                                 rocblas_int* iwork,
+                                                 rocblas_int* ifail,
+                                                 rocblas_int* info)
+{
+    zstein_(&n, D, E, nev, W, iblock, isplit, Z, &ldz, work, iwork, ifail, info);
+}
+
 // sygs2 & hegs2
 template <>
 void cblas_sygs2_hegs2<float>(rocblas_eform itype,
@@ -5446,6 +6300,210 @@ void cblas_syev_heev<rocblas_double_complex, double>(rocblas_evect evect,
     zheev_(&evectC, &uploC, &n, A, &lda, D, work, &sizeW, E, info);
 }
 
+// syevd & heevd
+template <>
+void cblas_syevd_heevd<float, float>(rocblas_evect evect,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     float* A,
+                                     rocblas_int lda,
+                                     float* D,
+                                     float* work,
+                                     rocblas_int lwork,
+                                     float* rwork,
+                                     rocblas_int lrwork,
+                                     rocblas_int* iwork,
+                                     rocblas_int liwork,
+                                     rocblas_int* info)
+{
+    char evectC = rocblas2char_evect(evect);
+    char uploC = rocblas2char_fill(uplo);
+    ssyevd_(&evectC, &uploC, &n, A, &lda, D, work, &lwork, iwork, &liwork, info);
+}
+
+template <>
+void cblas_syevd_heevd<double, double>(rocblas_evect evect,
+                                       rocblas_fill uplo,
+                                       rocblas_int n,
+                                       double* A,
+                                       rocblas_int lda,
+                                       double* D,
+                                       double* work,
+                                       rocblas_int lwork,
+                                       double* rwork,
+                                       rocblas_int lrwork,
+                                       rocblas_int* iwork,
+                                       rocblas_int liwork,
+                                       rocblas_int* info)
+{
+    char evectC = rocblas2char_evect(evect);
+    char uploC = rocblas2char_fill(uplo);
+    dsyevd_(&evectC, &uploC, &n, A, &lda, D, work, &lwork, iwork, &liwork, info);
+}
+
+template <>
+void cblas_syevd_heevd<rocblas_float_complex, float>(rocblas_evect evect,
+                                                     rocblas_fill uplo,
+                                                     rocblas_int n,
+                                                     rocblas_float_complex* A,
+                                                     rocblas_int lda,
+                                                     float* D,
+                                                     rocblas_float_complex* work,
+                                                     rocblas_int lwork,
+                                                     float* rwork,
+                                                     rocblas_int lrwork,
+                                                     rocblas_int* iwork,
+                                                     rocblas_int liwork,
+                                                     rocblas_int* info)
+{
+    char evectC = rocblas2char_evect(evect);
+    char uploC = rocblas2char_fill(uplo);
+    cheevd_(&evectC, &uploC, &n, A, &lda, D, work, &lwork, rwork, &lrwork, iwork, &liwork,
+            info);
+}
+
+template <>
+void cblas_syevd_heevd<rocblas_double_complex, double>(rocblas_evect evect,
+                                                       rocblas_fill uplo,
+                                                       rocblas_int n,
+                                                       rocblas_double_complex* A,
+                                                       rocblas_int lda,
+                                                       double* D,
+                                                       rocblas_double_complex* work,
+                                                       rocblas_int lwork,
+                                                       double* rwork,
+                                                       rocblas_int lrwork,
+                                                       rocblas_int* iwork,
+                                                       rocblas_int liwork,
+                                                       rocblas_int* info)
+{
+    char evectC = rocblas2char_evect(evect);
+    char uploC = rocblas2char_fill(uplo);
+    zheevd_(&evectC, &uploC, &n, A, &lda, D, work, &lwork, rwork, &lrwork, iwork, &liwork,
+            info);
+}
+
+// syevx & heevx
+template <>
+void cblas_syevx_heevx<float, float>(rocblas_evect evect,
+                                     rocblas_erange erange,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     float* A,
+                                     rocblas_int lda,
+                                     float vl,
+                                     float vu,
+                                     rocblas_int il,
+                                     rocblas_int iu,
+                                     float abstol,
+                                     rocblas_int* nev,
+                                     float* W,
+                                     float* Z,
+                                     rocblas_int ldz,
+                                     float* work,
+                                     rocblas_int lwork,
+                                     float* rwork,
+                                     rocblas_int* iwork,
+                                     rocblas_int* ifail,
+                                     rocblas_int* info)
+{
+    char evectC = rocblas2char_evect(evect);
+    char erangeC = rocblas2char_erange(erange);
+    char uploC = rocblas2char_fill(uplo);
+    ssyevx_(&evectC, &erangeC, &uploC, &n, A, &lda, &vl, &vu, &il, &iu, &abstol, nev, W, Z, &ldz,
+            work, &lwork, iwork, ifail, info);
+}
+
+template <>
+void cblas_syevx_heevx<double, double>(rocblas_evect evect,
+                                       rocblas_erange erange,
+                                       rocblas_fill uplo,
+                                       rocblas_int n,
+                                       double* A,
+                                       rocblas_int lda,
+                                       double vl,
+                                       double vu,
+                                       rocblas_int il,
+                                       rocblas_int iu,
+                                       double abstol,
+                                       rocblas_int* nev,
+                                       double* W,
+                                       double* Z,
+                                       rocblas_int ldz,
+                                       double* work,
+                                       rocblas_int lwork,
+                                       double* rwork,
+                                       rocblas_int* iwork,
+                                       rocblas_int* ifail,
+                                       rocblas_int* info)
+{
+    char evectC = rocblas2char_evect(evect);
+    char erangeC = rocblas2char_erange(erange);
+    char uploC = rocblas2char_fill(uplo);
+    dsyevx_(&evectC, &erangeC, &uploC, &n, A, &lda, &vl, &vu, &il, &iu, &abstol, nev, W, Z, &ldz,
+            work, &lwork, iwork, ifail, info);
+}
+
+template <>
+void cblas_syevx_heevx<rocblas_float_complex, float>(rocblas_evect evect,
+                                                     rocblas_erange erange,
+                                                     rocblas_fill uplo,
+                                                     rocblas_int n,
+                                                     rocblas_float_complex* A,
+                                                     rocblas_int lda,
+                                                     float vl,
+                                                     float vu,
+                                                     rocblas_int il,
+                                                     rocblas_int iu,
+                                                     float abstol,
+                                                     rocblas_int* nev,
+                                                     float* W,
+                                                     rocblas_float_complex* Z,
+                                                     rocblas_int ldz,
+                                                     rocblas_float_complex* work,
+                                                     rocblas_int lwork,
+                                                     float* rwork,
+                                                     rocblas_int* iwork,
+                                                     rocblas_int* ifail,
+                                                     rocblas_int* info)
+{
+    char evectC = rocblas2char_evect(evect);
+    char erangeC = rocblas2char_erange(erange);
+    char uploC = rocblas2char_fill(uplo);
+    cheevx_(&evectC, &erangeC, &uploC, &n, A, &lda, &vl, &vu, &il, &iu, &abstol, nev, W, Z, &ldz,
+            work, &lwork, rwork, iwork, ifail, info);
+}
+
+template <>
+void cblas_syevx_heevx<rocblas_double_complex, double>(rocblas_evect evect,
+                                                       rocblas_erange erange,
+                                                       rocblas_fill uplo,
+                                                       rocblas_int n,
+                                                       rocblas_double_complex* A,
+                                                       rocblas_int lda,
+                                                       double vl,
+                                                       double vu,
+                                                       rocblas_int il,
+                                                       rocblas_int iu,
+                                                       double abstol,
+                                                       rocblas_int* nev,
+                                                       double* W,
+                                                       rocblas_double_complex* Z,
+                                                       rocblas_int ldz,
+                                                       rocblas_double_complex* work,
+                                                       rocblas_int lwork,
+                                                       double* rwork,
+                                                       rocblas_int* iwork,
+                                                       rocblas_int* ifail,
+                                                       rocblas_int* info)
+{
+    char evectC = rocblas2char_evect(evect);
+    char erangeC = rocblas2char_erange(erange);
+    char uploC = rocblas2char_fill(uplo);
+    zheevx_(&evectC, &erangeC, &uploC, &n, A, &lda, &vl, &vu, &il, &iu, &abstol, nev, W, Z, &ldz,
+            work, &lwork, rwork, iwork, ifail, info);
+}
+
 // sygv & hegv
 template <>
 void cblas_sygv_hegv<float, float>(rocblas_eform itype,
@@ -0,0 +1,297 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_bdsqr.hpp"
+#include "testing_gesvd.hpp"
+#include "testing_steqr.hpp"
+#include "testing_sterf.hpp"
+#include "testing_syev_heev.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef int convergence_stats_tuple;
+
+// for checkin_lapack tests
+const vector<int> size_range = {
+    // normal (valid) samples
+    15,
+    20,
+    64};
+
+// for daily_lapack tests
+const vector<int> large_size_range = {152, 640, 1000};
+
+// batch count of the tests that attach a buffer smaller than the batch
+const rocblas_int stats_bc = 3;
+const rocblas_int stats_size = 2;
+
+// marks the entries of a statistics buffer that must not be written
+const rocblas_int stats_sentinel = -1;
+
+// checks the statistics of an instance that converged
+void convergence_check(const rocsolver_convergence_stats& stats, const rocblas_int max_iterations)
+{
+    EXPECT_GT(stats.sweeps, 0);
+    EXPECT_GT(stats.deflations, 0);
+    EXPECT_GT(stats.iterations, 0);
+    EXPECT_LE(stats.iterations, max_iterations);
+    EXPECT_EQ(stats.max_iterations, max_iterations);
+    EXPECT_EQ(stats.hit_limit, 0);
+}
+
+class CONVERGENCE_STATS : public ::TestWithParam<convergence_stats_tuple>
+{
+protected:
+    CONVERGENCE_STATS() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <typename T>
+    void run_sterf(rocblas_local_handle& handle, const rocblas_int n)
+    {
+        double max_error;
+
+        // memory allocations
+        host_strided_batch_vector<T> hD(n, 1, n, 1);
+        host_strided_batch_vector<T> hDRes(n, 1, n, 1);
+        host_strided_batch_vector<T> hE(n, 1, n, 1);
+        host_strided_batch_vector<T> hERes(n, 1, n, 1);
+        host_strided_batch_vector<rocblas_int> hInfo(1, 1, 1, 1);
+        host_strided_batch_vector<rocsolver_convergence_stats> hStats(1, 1, 1, 1);
+        device_strided_batch_vector<T> dD(n, 1, n, 1);
+        device_strided_batch_vector<T> dE(n, 1, n, 1);
+        device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, 1);
+        device_strided_batch_vector<rocsolver_convergence_stats> dStats(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dD.memcheck());
+        CHECK_HIP_ERROR(dE.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+        CHECK_HIP_ERROR(dStats.memcheck());
+
+        EXPECT_ROCBLAS_STATUS(rocsolver_convergence_stats_set(handle, dStats.data(), 1),
+                              rocblas_status_success);
+
+        sterf_getError<T>(handle, n, dD, dE, dInfo, hD, hDRes, hE, hERes, hInfo, &max_error);
+        ROCSOLVER_TEST_CHECK(T, max_error, n);
+
+        CHECK_HIP_ERROR(hStats.transfer_from(dStats));
+        convergence_check(hStats[0][0], 30 * n);
+        EXPECT_EQ(hStats[0][0].iterations, hStats[0][0].sweeps);
+
+        EXPECT_ROCBLAS_STATUS(rocsolver_convergence_stats_set(handle, nullptr, 0),
+                              rocblas_status_success);
+    }
+
+    template <typename T>
+    void run_steqr(rocblas_local_handle& handle, const rocblas_int n)
+    {
+        rocblas_evect evect = rocblas_evect_tridiagonal;
+        rocblas_int ldc = n;
+        double max_error;
+
+        // memory allocations
+        host_strided_batch_vector<T> hD(n, 1, n, 1);
+        host_strided_batch_vector<T> hDRes(n, 1, n, 1);
+        host_strided_batch_vector<T> hE(n, 1, n, 1);
+        host_strided_batch_vector<T> hERes(n, 1, n, 1);
+        host_strided_batch_vector<T> hC(ldc * n, 1, ldc * n, 1);
+        host_strided_batch_vector<T> hCRes(ldc * n, 1, ldc * n, 1);
+        host_strided_batch_vector<rocblas_int> hInfo(1, 1, 1, 1);
+        host_strided_batch_vector<rocsolver_convergence_stats> hStats(1, 1, 1, 1);
+        device_strided_batch_vector<T> dD(n, 1, n, 1);
+        device_strided_batch_vector<T> dE(n, 1, n, 1);
+        device_strided_batch_vector<T> dC(ldc * n, 1, ldc * n, 1);
+        device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, 1);
+        device_strided_batch_vector<rocsolver_convergence_stats> dStats(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dD.memcheck());
+        CHECK_HIP_ERROR(dE.memcheck());
+        CHECK_HIP_ERROR(dC.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+        CHECK_HIP_ERROR(dStats.memcheck());
+
+        EXPECT_ROCBLAS_STATUS(rocsolver_convergence_stats_set(handle, dStats.data(), 1),
+                              rocblas_status_success);
+
+        steqr_getError<T>(handle, evect, n, dD, dE, dC, ldc, dInfo, hD, hDRes, hE, hERes, hC, hCRes,
+                          hInfo, &max_error);
+        ROCSOLVER_TEST_CHECK(T, max_error, n);
+
+        CHECK_HIP_ERROR(hStats.transfer_from(dStats));
+        convergence_check(hStats[0][0], 30 * n);
+        EXPECT_EQ(hStats[0][0].iterations, hStats[0][0].sweeps);
+
+        EXPECT_ROCBLAS_STATUS(rocsolver_convergence_stats_set(handle, nullptr, 0),
+                              rocblas_status_success);
+    }
+
+    template <typename T>
+    void run_bdsqr(rocblas_local_handle& handle, const rocblas_int n)
+    {
+        rocblas_fill uplo = rocblas_fill_upper;
+        rocblas_int nv = n, nu = n, nc = 0;
+        rocblas_int ldv = n, ldu = n, ldc = 1;
+        double max_error, max_errorv;
+
+        // memory allocations
+        host_strided_batch_vector<T> hD(n, 1, n, 1);
+        host_strided_batch_vector<T> hDRes(n, 1, n, 1);
+        host_strided_batch_vector<T> hE(n, 1, n, 1);
+        host_strided_batch_vector<T> hERes(n, 1, n, 1);
+        host_strided_batch_vector<T> hV(ldv * nv, 1, ldv * nv, 1);
+        host_strided_batch_vector<T> hU(ldu * n, 1, ldu * n, 1);
+        host_strided_batch_vector<T> hC(1, 1, 1, 1);
+        host_strided_batch_vector<rocblas_int> hInfo(1, 1, 1, 1);
+        host_strided_batch_vector<rocblas_int> hInfoRes(1, 1, 1, 1);
+        host_strided_batch_vector<rocsolver_convergence_stats> hStats(1, 1, 1, 1);
+        device_strided_batch_vector<T> dD(n, 1, n, 1);
+        device_strided_batch_vector<T> dE(n, 1, n, 1);
+        device_strided_batch_vector<T> dV(ldv * nv, 1, ldv * nv, 1);
+        device_strided_batch_vector<T> dU(ldu * n, 1, ldu * n, 1);
+        device_strided_batch_vector<T> dC(1, 1, 1, 1);
+        device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, 1);
+        device_strided_batch_vector<rocsolver_convergence_stats> dStats(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dD.memcheck());
+        CHECK_HIP_ERROR(dE.memcheck());
+        CHECK_HIP_ERROR(dV.memcheck());
+        CHECK_HIP_ERROR(dU.memcheck());
+        CHECK_HIP_ERROR(dC.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+        CHECK_HIP_ERROR(dStats.memcheck());
+
+        EXPECT_ROCBLAS_STATUS(rocsolver_convergence_stats_set(handle, dStats.data(), 1),
+                              rocblas_status_success);
+
+        bdsqr_getError<T>(handle, uplo, n, nv, nu, nc, dD, dE, dV, ldv, dU, ldu, dC, ldc, dInfo, hD,
+                          hDRes, hE, hERes, hV, hU, hC, hInfo, hInfoRes, &max_error, &max_errorv);
+        ROCSOLVER_TEST_CHECK(T, max_error, 2 * n);
+        ROCSOLVER_TEST_CHECK(T, max_errorv, 2 * n);
+
+        CHECK_HIP_ERROR(hStats.transfer_from(dStats));
+        convergence_check(hStats[0][0], 6 * n * n);
+
+        EXPECT_ROCBLAS_STATUS(rocsolver_convergence_stats_set(handle, nullptr, 0),
+                              rocblas_status_success);
+    }
+
+    // STEQR and BDSQR have no batched APIs; their batched kernels are reached through
+    // SYEV with eigenvectors and GESVD. The buffer is attached with fewer entries than
+    // the batch count, so the last instance must leave its entry untouched.
+    template <typename T>
+    void run_batched(rocblas_local_handle& handle, const rocblas_int n)
+    {
+        rocblas_int lda = n;
+        rocblas_stride stA = lda * n;
+        rocblas_stride stD = n;
+
+        // memory allocations
+        host_strided_batch_vector<T> hA(stA, 1, stA, stats_bc);
+        host_strided_batch_vector<rocsolver_convergence_stats> hStats(stats_bc, 1, stats_bc, 1);
+        device_strided_batch_vector<T> dA(stA, 1, stA, stats_bc);
+        device_strided_batch_vector<T> dD(stD, 1, stD, stats_bc);
+        device_strided_batch_vector<T> dE(stD, 1, stD, stats_bc);
+        device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, stats_bc);
+        device_strided_batch_vector<rocsolver_convergence_stats> dStats(stats_bc, 1, stats_bc, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dD.memcheck());
+        CHECK_HIP_ERROR(dE.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+        CHECK_HIP_ERROR(dStats.memcheck());
+
+        EXPECT_ROCBLAS_STATUS(rocsolver_convergence_stats_set(handle, dStats.data(), stats_size),
+                              rocblas_status_success);
+
+        // SYEV reaches steqr_kernel
+        std::vector<T> A(lda * n * stats_bc);
+        for(rocblas_int b = 0; b < stats_bc; ++b)
+            hStats[0][b].sweeps = stats_sentinel;
+        CHECK_HIP_ERROR(dStats.transfer_from(hStats));
+        syev_heev_initData<true, true, T>(handle, rocblas_evect_original, n, dA, lda, stats_bc, hA,
+                                          A, false);
+        CHECK_ROCBLAS_ERROR(rocsolver_syev_heev(true, handle, rocblas_evect_original,
+                                                rocblas_fill_upper, n, dA.data(), lda, stA,
+                                                dD.data(), stD, dE.data(), stD, dInfo.data(),
+                                                stats_bc));
+
+        CHECK_HIP_ERROR(hStats.transfer_from(dStats));
+        for(rocblas_int b = 0; b < stats_size; ++b)
+            convergence_check(hStats[0][b], 30 * n);
+        EXPECT_EQ(hStats[0][stats_size].sweeps, stats_sentinel);
+
+        // GESVD reaches bdsqrKernel
+        for(rocblas_int b = 0; b < stats_bc; ++b)
+            hStats[0][b].sweeps = stats_sentinel;
+        CHECK_HIP_ERROR(dStats.transfer_from(hStats));
+        gesvd_initData<true, true, T>(handle, rocblas_svect_none, rocblas_svect_none, n, n, dA, lda,
+                                      stats_bc, hA, A, false);
+        CHECK_ROCBLAS_ERROR(rocsolver_gesvd(true, handle, rocblas_svect_none, rocblas_svect_none, n,
+                                            n, dA.data(), lda, stA, dD.data(), stD, (T*)nullptr, 1,
+                                            0, (T*)nullptr, 1, 0, dE.data(), stD,
+                                            rocblas_outofplace, dInfo.data(), stats_bc));
+
+        CHECK_HIP_ERROR(hStats.transfer_from(dStats));
+        for(rocblas_int b = 0; b < stats_size; ++b)
+            convergence_check(hStats[0][b], 6 * n * n);
+        EXPECT_EQ(hStats[0][stats_size].sweeps, stats_sentinel);
+
+        EXPECT_ROCBLAS_STATUS(rocsolver_convergence_stats_set(handle, nullptr, 0),
+                              rocblas_status_success);
+    }
+
+    template <typename T>
+    void run_tests()
+    {
+        rocblas_int n = GetParam();
+        rocblas_local_handle handle;
+
+        run_sterf<T>(handle, n);
+        run_steqr<T>(handle, n);
+        run_bdsqr<T>(handle, n);
+        run_batched<T>(handle, n);
+    }
+};
+
+// convergence statistics API tests
+TEST(CONVERGENCE_STATS_API, set)
+{
+    rocblas_local_handle handle;
+    device_strided_batch_vector<rocsolver_convergence_stats> dStats(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dStats.memcheck());
+
+    EXPECT_ROCBLAS_STATUS(rocsolver_convergence_stats_set(nullptr, dStats.data(), 1),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocsolver_convergence_stats_set(handle, dStats.data(), -1),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(rocsolver_convergence_stats_set(handle, nullptr, 1),
+                          rocblas_status_invalid_pointer);
+
+    // attach, replace and detach
+    EXPECT_ROCBLAS_STATUS(rocsolver_convergence_stats_set(handle, dStats.data(), 1),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_convergence_stats_set(handle, dStats.data(), 1),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_convergence_stats_set(handle, nullptr, 0),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_convergence_stats_set(handle, nullptr, 0),
+                          rocblas_status_success);
+}
+
+// non-batch tests
+
+TEST_P(CONVERGENCE_STATS, __float)
+{
+    run_tests<float>();
+}
+
+TEST_P(CONVERGENCE_STATS, __double)
+{
+    run_tests<double>();
+}
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack, CONVERGENCE_STATS, ValuesIn(large_size_range));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, CONVERGENCE_STATS, ValuesIn(size_range));
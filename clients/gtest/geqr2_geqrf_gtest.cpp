@@ -26,10 +26,15 @@ const vector<vector<int>> matrix_size_range = {
     {-1, 1},
     {20, 5},
     // normal (valid) samples
+    // (with m < n <= 32, the small kernel of geqr2 finishes after m columns)
+    {1, 1},
+    {20, 20},
     {50, 50},
+    {64, 64},
     {70, 100},
     {130, 130},
-    {150, 200}};
+    {150, 200},
+    {256, 270}};
 
 const vector<int> n_size_range = {
     // quick return
@@ -37,7 +42,7 @@ const vector<int> n_size_range = {
     // invalid
     -1,
     // normal (valid) samples
-    16, 20, 130, 150};
+    16, 20, 32, 130, 150};
 
 // for daily_lapack tests
 const vector<vector<int>> large_matrix_size_range = {
@@ -48,6 +53,22 @@ const vector<vector<int>> large_matrix_size_range = {
 
 const vector<int> large_n_size_range = {64, 98, 130, 220, 400};
 
+// tall-skinny matrices, factorized with the reduction tree in geqrf (only used without batches,
+// for at most 32 columns, and at least 16384 rows by default)
+
+// for checkin_lapack tests
+const vector<vector<int>> tsqr_matrix_size_range = {{17000, 17000}};
+
+const vector<int> tsqr_n_size_range = {20, 32};
+
+// for daily_lapack tests
+const vector<vector<int>> large_tsqr_matrix_size_range = {
+    {40000, 40000},
+    {100000, 100010},
+};
+
+const vector<int> large_tsqr_n_size_range = {1, 16, 32};
+
 Arguments geqrf_setup_arguments(geqrf_tuple tup)
 {
     vector<int> matrix_size = std::get<0>(tup);
@@ -95,6 +116,10 @@ class GEQRF : public GEQR2_GEQRF<true>
 {
 };
 
+class GEQRF_TSQR : public GEQR2_GEQRF<true>
+{
+};
+
 // non-batch tests
 
 TEST_P(GEQR2, __float)
@@ -137,6 +162,26 @@ TEST_P(GEQRF, __double_complex)
     run_tests<false, false, rocblas_double_complex>();
 }
 
+TEST_P(GEQRF_TSQR, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(GEQRF_TSQR, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(GEQRF_TSQR, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(GEQRF_TSQR, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
 // batched tests
 
 TEST_P(GEQR2, batched__float)
@@ -258,3 +303,12 @@ INSTANTIATE_TEST_SUITE_P(daily_lapack,
 INSTANTIATE_TEST_SUITE_P(checkin_lapack,
                          GEQRF,
                          Combine(ValuesIn(matrix_size_range), ValuesIn(n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         GEQRF_TSQR,
+                         Combine(ValuesIn(large_tsqr_matrix_size_range),
+                                 ValuesIn(large_tsqr_n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GEQRF_TSQR,
+                         Combine(ValuesIn(tsqr_matrix_size_range), ValuesIn(tsqr_n_size_range)));
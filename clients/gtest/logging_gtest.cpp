@@ -0,0 +1,111 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_geqr2_geqrf.hpp"
+#include "testing_getf2_getrf.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+using namespace std;
+
+// all the logging facilities
+const rocblas_layer_mode_flags all_layer_modes = rocblas_layer_mode_log_trace
+    | rocblas_layer_mode_log_bench | rocblas_layer_mode_log_profile
+    | rocsolver_layer_mode_log_timeline;
+
+// counts the occurrences of pattern in the file at path
+size_t logging_count(const string& path, const string& pattern)
+{
+    ifstream file(path);
+    stringstream buffer;
+    buffer << file.rdbuf();
+    string contents = buffer.str();
+
+    size_t count = 0;
+    for(size_t pos = contents.find(pattern); pos != string::npos;
+        pos = contents.find(pattern, pos + pattern.size()))
+        count++;
+    return count;
+}
+
+// logging API tests
+TEST(LOGGING_API, session)
+{
+    EXPECT_ROCBLAS_STATUS(rocsolver_log_end(), rocblas_status_internal_error);
+    EXPECT_ROCBLAS_STATUS(rocsolver_log_set_layer_mode(all_layer_modes),
+                          rocblas_status_internal_error);
+    EXPECT_ROCBLAS_STATUS(rocsolver_log_set_max_levels(2), rocblas_status_internal_error);
+
+    EXPECT_ROCBLAS_STATUS(rocsolver_log_begin(), rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_log_begin(), rocblas_status_internal_error);
+    EXPECT_ROCBLAS_STATUS(rocsolver_log_set_max_levels(0), rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(rocsolver_log_restore_defaults(), rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_log_end(), rocblas_status_success);
+}
+
+// several threads log their calls while another one changes the layer mode and the maximum
+// depth, and prints the profile; every timeline event that begins a call must have a
+// matching end event, and the session must end once the threads are done
+TEST(LOGGING_API, multithreaded)
+{
+    const int num_threads = 4;
+    const int num_iterations = 5;
+
+    string log_path = ::testing::TempDir() + "rocsolver_logging_test.log";
+    string timeline_path = ::testing::TempDir() + "rocsolver_logging_test.json";
+    setenv("ROCSOLVER_LOG_PATH", log_path.c_str(), 1);
+    setenv("ROCSOLVER_LOG_TIMELINE_PATH", timeline_path.c_str(), 1);
+
+    EXPECT_ROCBLAS_STATUS(rocsolver_log_begin(), rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_log_set_layer_mode(all_layer_modes), rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_log_set_max_levels(4), rocblas_status_success);
+
+    Arguments arg;
+    arg.set<rocblas_int>("m", 100);
+    arg.set<rocblas_int>("n", 100);
+    arg.set<rocblas_int>("lda", 100);
+    arg.batch_count = 1;
+    arg.timing = 0;
+
+    atomic<int> running(num_threads);
+    vector<thread> threads;
+    for(int t = 0; t < num_threads; t++)
+    {
+        // each thread uses its own handle
+        threads.emplace_back([&, arg]() mutable {
+            for(int i = 0; i < num_iterations; i++)
+            {
+                testing_getf2_getrf<false, false, true, double>(arg);
+                testing_geqr2_geqrf<false, false, true, double>(arg);
+            }
+            running--;
+        });
+    }
+
+    for(int i = 0; running > 0; i++)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_log_set_layer_mode(i % 2 ? rocblas_layer_mode_log_profile
+                                                                 : all_layer_modes),
+                              rocblas_status_success);
+        EXPECT_ROCBLAS_STATUS(rocsolver_log_set_max_levels(1 + i % 4), rocblas_status_success);
+        EXPECT_ROCBLAS_STATUS(i % 3 ? rocsolver_log_write_profile() : rocsolver_log_flush_profile(),
+                              rocblas_status_success);
+        this_thread::yield();
+    }
+
+    for(auto& t : threads)
+        t.join();
+
+    EXPECT_ROCBLAS_STATUS(rocsolver_log_end(), rocblas_status_success);
+    unsetenv("ROCSOLVER_LOG_PATH");
+    unsetenv("ROCSOLVER_LOG_TIMELINE_PATH");
+
+    EXPECT_GT(logging_count(timeline_path, "\"ph\": \"B\""), 0u);
+    EXPECT_EQ(logging_count(timeline_path, "\"ph\": \"B\""),
+              logging_count(timeline_path, "\"ph\": \"E\""));
+}
@@ -0,0 +1,287 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_geqr2_geqrf.hpp"
+#include "testing_getf2_getrf.hpp"
+#include "testing_potf2_potrf.hpp"
+#include <fstream>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, int> plan_tuple;
+
+// each matrix_size_range is a {m, n}
+
+// each batch_count_range is the batch count of the batched and strided_batched plans
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // quick return
+    {0, 10},
+    {10, 0},
+    // normal (valid) samples
+    {1, 1},
+    {20, 30},
+    {50, 50},
+    {70, 40}};
+
+const vector<int> batch_count_range = {0, 1, 5};
+
+// for daily_lapack tests
+const vector<vector<int>> large_matrix_size_range = {
+    {300, 300},
+    {640, 320},
+    {1000, 1024},
+};
+
+const vector<int> large_batch_count_range = {3};
+
+template <typename T>
+rocblas_datatype plan_datatype();
+template <>
+rocblas_datatype plan_datatype<float>()
+{
+    return rocblas_datatype_f32_r;
+}
+template <>
+rocblas_datatype plan_datatype<double>()
+{
+    return rocblas_datatype_f64_r;
+}
+template <>
+rocblas_datatype plan_datatype<rocblas_float_complex>()
+{
+    return rocblas_datatype_f32_c;
+}
+template <>
+rocblas_datatype plan_datatype<rocblas_double_complex>()
+{
+    return rocblas_datatype_f64_c;
+}
+
+// the total size of a plan must match the size returned by a device memory size query
+void plan_check(const rocsolver_workspace_plan& plan, const size_t size)
+{
+    EXPECT_EQ(plan.size_total, size);
+
+    size_t sum = 0;
+    for(rocblas_int i = 0; i < plan.num_buffers; ++i)
+    {
+        EXPECT_NE(plan.buffer_names[i], nullptr);
+        sum += plan.buffer_sizes[i];
+    }
+    EXPECT_LE(sum, plan.size_total);
+    EXPECT_NE(plan.algorithm, nullptr);
+}
+
+class PLAN : public ::TestWithParam<plan_tuple>
+{
+protected:
+    PLAN() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        vector<int> matrix_size = std::get<0>(GetParam());
+        rocblas_int m = matrix_size[0];
+        rocblas_int n = matrix_size[1];
+        rocblas_int lda = max(max(m, n), 1);
+        rocblas_stride stA = lda * n;
+        rocblas_stride stP = min(m, n);
+        rocblas_int bc = (BATCHED || STRIDED ? std::get<1>(GetParam()) : 1);
+
+        rocsolver_batch_mode mode = rocsolver_batch_none;
+        if(BATCHED)
+            mode = rocsolver_batch_pointers;
+        else if(STRIDED)
+            mode = rocsolver_batch_strided;
+
+        rocblas_local_handle handle;
+        rocsolver_workspace_plan plan;
+        size_t size;
+
+        // getrf
+        EXPECT_ROCBLAS_STATUS(rocsolver_plan_getrf(plan_datatype<T>(), mode, m, n, bc, &plan),
+                              rocblas_status_success);
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        if(BATCHED)
+            CHECK_ALLOC_QUERY(rocsolver_getf2_getrf(STRIDED, true, handle, m, n,
+                                                    (T* const*)nullptr, lda, stA,
+                                                    (rocblas_int*)nullptr, stP,
+                                                    (rocblas_int*)nullptr, bc));
+        else
+            CHECK_ALLOC_QUERY(rocsolver_getf2_getrf(STRIDED, true, handle, m, n, (T*)nullptr, lda,
+                                                    stA, (rocblas_int*)nullptr, stP,
+                                                    (rocblas_int*)nullptr, bc));
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        plan_check(plan, size);
+
+        // geqrf
+        EXPECT_ROCBLAS_STATUS(rocsolver_plan_geqrf(plan_datatype<T>(), mode, m, n, bc, &plan),
+                              rocblas_status_success);
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        if(BATCHED)
+            CHECK_ALLOC_QUERY(rocsolver_geqr2_geqrf(STRIDED, true, handle, m, n,
+                                                    (T* const*)nullptr, lda, stA, (T*)nullptr,
+                                                    stP, bc));
+        else
+            CHECK_ALLOC_QUERY(rocsolver_geqr2_geqrf(STRIDED, true, handle, m, n, (T*)nullptr, lda,
+                                                    stA, (T*)nullptr, stP, bc));
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        plan_check(plan, size);
+
+        // potrf
+        EXPECT_ROCBLAS_STATUS(rocsolver_plan_potrf(plan_datatype<T>(), mode, rocblas_fill_lower,
+                                                   n, bc, &plan),
+                              rocblas_status_success);
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        if(BATCHED)
+            CHECK_ALLOC_QUERY(rocsolver_potf2_potrf(STRIDED, true, handle, rocblas_fill_lower, n,
+                                                    (T* const*)nullptr, lda, stA,
+                                                    (rocblas_int*)nullptr, bc));
+        else
+            CHECK_ALLOC_QUERY(rocsolver_potf2_potrf(STRIDED, true, handle, rocblas_fill_lower, n,
+                                                    (T*)nullptr, lda, stA, (rocblas_int*)nullptr,
+                                                    bc));
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        plan_check(plan, size);
+    }
+};
+
+// planner API tests
+TEST(PLAN_API, bad_arg)
+{
+    rocsolver_workspace_plan plan;
+
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_plan_getrf(rocblas_datatype_i32_r, rocsolver_batch_none, 10, 10, 1, &plan),
+        rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(rocsolver_plan_getrf(rocblas_datatype_f32_r, rocsolver_batch_mode(0),
+                                               10, 10, 1, &plan),
+                          rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(rocsolver_plan_potrf(rocblas_datatype_f32_r, rocsolver_batch_none,
+                                               rocblas_fill_full, 10, 1, &plan),
+                          rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_plan_getrf(rocblas_datatype_f32_r, rocsolver_batch_none, -1, 10, 1, &plan),
+        rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_plan_geqrf(rocblas_datatype_f32_r, rocsolver_batch_strided, 10, 10, -1, &plan),
+        rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_plan_getrf(rocblas_datatype_f32_r, rocsolver_batch_none, 10, 10, 1, nullptr),
+        rocblas_status_invalid_pointer);
+}
+
+TEST(PLAN_API, algorithm)
+{
+    rocsolver_workspace_plan plan;
+    string path = ::testing::TempDir() + "rocsolver_plan_test.txt";
+
+    // the algorithm follows the tuning table
+    ofstream(path) << "rocsolver_tuning 1\nPOTRF_POTF2_SWITCHSIZE 48\n";
+    EXPECT_ROCBLAS_STATUS(rocsolver_tuning_load(path.c_str()), rocblas_status_success);
+
+    EXPECT_ROCBLAS_STATUS(rocsolver_plan_potrf(rocblas_datatype_f64_r, rocsolver_batch_none,
+                                               rocblas_fill_upper, 47, 1, &plan),
+                          rocblas_status_success);
+    EXPECT_STREQ(plan.algorithm, "potf2");
+    EXPECT_EQ(plan.block_size, 0);
+    EXPECT_ROCBLAS_STATUS(rocsolver_plan_potrf(rocblas_datatype_f64_r, rocsolver_batch_none,
+                                               rocblas_fill_upper, 48, 1, &plan),
+                          rocblas_status_success);
+    EXPECT_STREQ(plan.algorithm, "potrf");
+    EXPECT_EQ(plan.block_size, 48);
+
+    EXPECT_ROCBLAS_STATUS(rocsolver_tuning_restore_defaults(), rocblas_status_success);
+
+    // quick return
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_plan_geqrf(rocblas_datatype_f32_c, rocsolver_batch_pointers, 10, 10, 0, &plan),
+        rocblas_status_success);
+    EXPECT_STREQ(plan.algorithm, "none");
+    EXPECT_EQ(plan.size_total, 0u);
+}
+
+// non-batch tests
+
+TEST_P(PLAN, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(PLAN, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(PLAN, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(PLAN, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// batched tests
+
+TEST_P(PLAN, batched__float)
+{
+    run_tests<true, false, float>();
+}
+
+TEST_P(PLAN, batched__double)
+{
+    run_tests<true, false, double>();
+}
+
+TEST_P(PLAN, batched__float_complex)
+{
+    run_tests<true, false, rocblas_float_complex>();
+}
+
+TEST_P(PLAN, batched__double_complex)
+{
+    run_tests<true, false, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(PLAN, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(PLAN, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(PLAN, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(PLAN, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         PLAN,
+                         Combine(ValuesIn(large_matrix_size_range),
+                                 ValuesIn(large_batch_count_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         PLAN,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(batch_count_range)));
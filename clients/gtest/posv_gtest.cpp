@@ -0,0 +1,191 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_posv.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<int, int, int, int> posv_params_A;
+typedef std::tuple<int, char> posv_params_B;
+
+typedef std::tuple<posv_params_A, posv_params_B> posv_tuple;
+
+// each A_range tuple is a {N, lda, ldb, singular};
+// if singular = 1, then the used matrix for the tests is not positive definite
+
+// each B_range tuple is a {nrhs, uplo}
+
+// case when N = nrhs = 0 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+const vector<posv_params_A> matrix_sizeA_range = {
+    // quick return
+    {0, 1, 1, 0},
+    // invalid
+    {-1, 1, 1, 0},
+    {10, 2, 10, 0},
+    {10, 10, 2, 0},
+    // normal (valid) samples
+    {20, 20, 20, 0},
+    {30, 50, 30, 1},
+    {30, 30, 50, 0},
+    {50, 60, 60, 1},
+    {64, 64, 64, 1},
+    {70, 70, 100, 0},
+};
+const vector<posv_params_B> matrix_sizeB_range = {
+    // quick return
+    {0, 'U'},
+    // invalid
+    {-1, 'U'},
+    // normal (valid) samples
+    {10, 'U'},
+    {20, 'L'},
+    {30, 'U'},
+    {30, 'L'},
+};
+
+// for daily_lapack tests
+const vector<posv_params_A> large_matrix_sizeA_range = {
+    {70, 70, 100, 0},
+    {192, 192, 192, 1},
+    {640, 640, 640, 0},
+    {1000, 1024, 1000, 1},
+};
+const vector<posv_params_B> large_matrix_sizeB_range = {
+    {100, 'U'},
+    {200, 'L'},
+    {500, 'L'},
+    {1000, 'U'},
+};
+
+Arguments posv_setup_arguments(posv_tuple tup)
+{
+    posv_params_A matrix_sizeA = std::get<0>(tup);
+    posv_params_B matrix_sizeB = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("n", std::get<0>(matrix_sizeA));
+    arg.set<rocblas_int>("lda", std::get<1>(matrix_sizeA));
+    arg.set<rocblas_int>("ldb", std::get<2>(matrix_sizeA));
+
+    arg.set<rocblas_int>("nrhs", std::get<0>(matrix_sizeB));
+    arg.set<char>("uplo", std::get<1>(matrix_sizeB));
+
+    // only testing standard use case/defaults for strides
+
+    arg.timing = 0;
+    arg.singular = std::get<3>(matrix_sizeA);
+
+    return arg;
+}
+
+class POSV : public ::TestWithParam<posv_tuple>
+{
+protected:
+    POSV() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = posv_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("n") == 0 && arg.peek<rocblas_int>("nrhs") == 0)
+            testing_posv_bad_arg<BATCHED, STRIDED, T>();
+
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        if(arg.singular == 1)
+            testing_posv<BATCHED, STRIDED, T>(arg);
+
+        arg.singular = 0;
+        testing_posv<BATCHED, STRIDED, T>(arg);
+    }
+};
+
+// non-batch tests
+
+TEST_P(POSV, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(POSV, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(POSV, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(POSV, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// batched tests
+
+TEST_P(POSV, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(POSV, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(POSV, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(POSV, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(POSV, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(POSV, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(POSV, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(POSV, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+// daily_lapack tests normal execution with medium to large sizes
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         POSV,
+                         Combine(ValuesIn(large_matrix_sizeA_range),
+                                 ValuesIn(large_matrix_sizeB_range)));
+
+// checkin_lapack tests normal execution with small sizes, invalid sizes,
+// quick returns, and corner cases
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         POSV,
+                         Combine(ValuesIn(matrix_sizeA_range), ValuesIn(matrix_sizeB_range)));
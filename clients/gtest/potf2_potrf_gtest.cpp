@@ -31,9 +31,12 @@ const vector<vector<int>> matrix_size_range = {
     {-1, 1, 0},
     {10, 2, 0},
     // normal (valid) samples
+    {1, 1, 0},
     {10, 10, 1},
     {20, 30, 0},
+    {32, 32, 1},
     {50, 50, 1},
+    {64, 64, 0},
     {70, 80, 0}};
 
 // for daily_lapack tests
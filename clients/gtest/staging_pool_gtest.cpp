@@ -0,0 +1,251 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_getf2_getrf.hpp"
+#include "testing_potf2_potrf.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef vector<int> staging_pool_tuple;
+
+// each size_range is a {m, n, lda, bc} (POTRF uses the n-by-n leading block)
+
+// for checkin_lapack tests
+const vector<vector<int>> size_range = {
+    // normal (valid) samples
+    {20, 20, 20, 1},
+    {30, 20, 40, 7},
+    {20, 30, 20, 25}};
+
+// for daily_lapack tests
+const vector<vector<int>> large_size_range = {
+    {64, 64, 64, 1000},
+    {200, 150, 210, 60},
+};
+
+class STAGING_POOL : public ::TestWithParam<staging_pool_tuple>
+{
+protected:
+    STAGING_POOL() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <typename T>
+    void run_getrf_tests()
+    {
+        vector<int> size = GetParam();
+        rocblas_int m = size[0];
+        rocblas_int n = size[1];
+        rocblas_int lda = size[2];
+        rocblas_int bc = size[3];
+        // a padded stride, to test the staging of non-contiguous batches
+        rocblas_stride stA = lda * n + 3;
+        rocblas_stride stP = min(m, n);
+        size_t size_A = size_t(lda) * n;
+        size_t size_P = size_t(min(m, n));
+
+        rocblas_local_handle handle;
+
+        // memory allocations
+        host_strided_batch_vector<T> hA(size_A, 1, stA, bc);
+        host_strided_batch_vector<T> hARes(size_A, 1, stA, bc);
+        host_strided_batch_vector<T> hAHost(size_A, 1, stA, bc);
+        host_strided_batch_vector<rocblas_int> hIpiv(size_P, 1, stP, bc);
+        host_strided_batch_vector<rocblas_int> hIpivRes(size_P, 1, stP, bc);
+        host_strided_batch_vector<rocblas_int> hIpivHost(size_P, 1, stP, bc);
+        host_strided_batch_vector<rocblas_int> hInfo(1, 1, 1, bc);
+        host_strided_batch_vector<rocblas_int> hInfoRes(1, 1, 1, bc);
+        host_strided_batch_vector<rocblas_int> hInfoHost(1, 1, 1, bc);
+        device_strided_batch_vector<T> dA(size_A, 1, stA, bc);
+        device_strided_batch_vector<rocblas_int> dIpiv(size_P, 1, stP, bc);
+        device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, bc);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+
+        // reference: the same batch factorized from device memory
+        getf2_getrf_initData<true, true, T>(handle, m, n, dA, lda, stA, dIpiv, stP, dInfo, bc, hA,
+                                            hIpiv, hInfo, false);
+        CHECK_ROCBLAS_ERROR(rocsolver_getf2_getrf(true, true, handle, m, n, dA.data(), lda, stA,
+                                                  dIpiv.data(), stP, dInfo.data(), bc));
+        CHECK_HIP_ERROR(hARes.transfer_from(dA));
+        CHECK_HIP_ERROR(hIpivRes.transfer_from(dIpiv));
+        CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+
+        // without a pool, and with a pool small enough to split the batch in several
+        // sub-batches
+        for(int pooled = 0; pooled < 2; ++pooled)
+        {
+            if(pooled)
+                EXPECT_ROCBLAS_STATUS(rocsolver_staging_pool_create(handle, 3 * size_A * sizeof(T)),
+                                      rocblas_status_success);
+
+            hAHost.copy_from(hA);
+            CHECK_ROCBLAS_ERROR(rocsolver_getrf_host(handle, m, n, hAHost.data(), lda, stA,
+                                                     hIpivHost.data(), stP, hInfoHost.data(), bc));
+
+            for(rocblas_int b = 0; b < bc; ++b)
+            {
+                double err = norm_error('F', m, n, lda, hARes[b], hAHost[b]);
+                ROCSOLVER_TEST_CHECK(T, err, min(m, n));
+                EXPECT_EQ(hInfoHost[b][0], hInfoRes[b][0]) << "where b = " << b;
+                for(rocblas_int i = 0; i < min(m, n); ++i)
+                    EXPECT_EQ(hIpivHost[b][i], hIpivRes[b][i]) << "where b = " << b;
+            }
+
+            if(pooled)
+                EXPECT_ROCBLAS_STATUS(rocsolver_staging_pool_destroy(handle),
+                                      rocblas_status_success);
+        }
+    }
+
+    template <typename T>
+    void run_potrf_tests()
+    {
+        vector<int> size = GetParam();
+        rocblas_int n = size[1];
+        rocblas_int lda = size[2];
+        rocblas_int bc = size[3];
+        // a padded stride, to test the staging of non-contiguous batches
+        rocblas_stride stA = lda * n + 3;
+        size_t size_A = size_t(lda) * n;
+
+        rocblas_local_handle handle;
+
+        // memory allocations
+        host_strided_batch_vector<T> hA(size_A, 1, stA, bc);
+        host_strided_batch_vector<T> hATmp(size_A, 1, stA, bc);
+        host_strided_batch_vector<T> hARes(size_A, 1, stA, bc);
+        host_strided_batch_vector<T> hAHost(size_A, 1, stA, bc);
+        host_strided_batch_vector<rocblas_int> hInfo(1, 1, 1, bc);
+        host_strided_batch_vector<rocblas_int> hInfoRes(1, 1, 1, bc);
+        host_strided_batch_vector<rocblas_int> hInfoHost(1, 1, 1, bc);
+        device_strided_batch_vector<T> dA(size_A, 1, stA, bc);
+        device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, bc);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+
+        for(rocblas_fill uplo : {rocblas_fill_upper, rocblas_fill_lower})
+        {
+            // reference: the same batch (with some matrices that are not positive definite)
+            // factorized from device memory
+            potf2_potrf_initData<true, true, T>(handle, uplo, n, dA, lda, stA, dInfo, bc, hA,
+                                                hATmp, hInfo, true);
+            CHECK_ROCBLAS_ERROR(rocsolver_potf2_potrf(true, true, handle, uplo, n, dA.data(), lda,
+                                                      stA, dInfo.data(), bc));
+            CHECK_HIP_ERROR(hARes.transfer_from(dA));
+            CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+
+            // without a pool, and with a pool small enough to split the batch in several
+            // sub-batches
+            for(int pooled = 0; pooled < 2; ++pooled)
+            {
+                if(pooled)
+                    EXPECT_ROCBLAS_STATUS(
+                        rocsolver_staging_pool_create(handle, 3 * size_A * sizeof(T)),
+                        rocblas_status_success);
+
+                hAHost.copy_from(hA);
+                CHECK_ROCBLAS_ERROR(rocsolver_potrf_host(handle, uplo, n, hAHost.data(), lda, stA,
+                                                         hInfoHost.data(), bc));
+
+                for(rocblas_int b = 0; b < bc; ++b)
+                {
+                    // only the leading block of a matrix that is not positive definite is
+                    // factorized
+                    rocblas_int nn = hInfoRes[b][0] == 0 ? n : hInfoRes[b][0];
+                    double err = norm_error('F', nn, nn, lda, hARes[b], hAHost[b]);
+                    ROCSOLVER_TEST_CHECK(T, err, n);
+                    EXPECT_EQ(hInfoHost[b][0], hInfoRes[b][0]) << "where b = " << b;
+                }
+
+                if(pooled)
+                    EXPECT_ROCBLAS_STATUS(rocsolver_staging_pool_destroy(handle),
+                                          rocblas_status_success);
+            }
+        }
+    }
+
+    template <typename T>
+    void run_tests()
+    {
+        run_getrf_tests<T>();
+        run_potrf_tests<T>();
+    }
+};
+
+// staging pool API tests
+TEST(STAGING_POOL_API, create_destroy)
+{
+    rocblas_local_handle handle;
+
+    EXPECT_ROCBLAS_STATUS(rocsolver_staging_pool_create(nullptr, 0), rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocsolver_staging_pool_destroy(nullptr), rocblas_status_invalid_handle);
+
+    // no pool attached
+    EXPECT_ROCBLAS_STATUS(rocsolver_staging_pool_destroy(handle), rocblas_status_invalid_value);
+
+    EXPECT_ROCBLAS_STATUS(rocsolver_staging_pool_create(handle, 0), rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_staging_pool_create(handle, 0), rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(rocsolver_staging_pool_destroy(handle), rocblas_status_success);
+}
+
+TEST(STAGING_POOL_API, quick_return)
+{
+    rocblas_local_handle handle;
+    rocblas_int info[2] = {-1, -1};
+
+    // the info of empty matrices is set in host memory
+    EXPECT_ROCBLAS_STATUS(rocsolver_dgetrf_strided_batched_host(handle, 0, 0, nullptr, 1, 0,
+                                                                nullptr, 0, info, 2),
+                          rocblas_status_success);
+    EXPECT_EQ(info[0], 0);
+    EXPECT_EQ(info[1], 0);
+
+    info[0] = info[1] = -1;
+    EXPECT_ROCBLAS_STATUS(rocsolver_dpotrf_strided_batched_host(handle, rocblas_fill_upper, 0,
+                                                                nullptr, 1, 0, info, 2),
+                          rocblas_status_success);
+    EXPECT_EQ(info[0], 0);
+    EXPECT_EQ(info[1], 0);
+
+    // bad arguments
+    EXPECT_ROCBLAS_STATUS(rocsolver_dgetrf_strided_batched_host(handle, 10, 10, nullptr, 10, 100,
+                                                                nullptr, 10, info, 2),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_dpotrf_strided_batched_host(handle, rocblas_fill_upper, 10,
+                                                                nullptr, 5, 100, info, 2),
+                          rocblas_status_invalid_size);
+}
+
+// strided_batched tests (in host memory)
+
+TEST_P(STAGING_POOL, __float)
+{
+    run_tests<float>();
+}
+
+TEST_P(STAGING_POOL, __double)
+{
+    run_tests<double>();
+}
+
+TEST_P(STAGING_POOL, __float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(STAGING_POOL, __double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack, STAGING_POOL, ValuesIn(large_size_range));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, STAGING_POOL, ValuesIn(size_range));
@@ -0,0 +1,119 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_stebz.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<double>> stebz_tuple;
+
+// each size_range vector is a {N}
+
+// each op_range vector is a {e, o, vl, vu, il, iu}
+// if e = 0, then erange = 'A'
+// if e = 1, then erange = 'V'
+// if e = 2, then erange = 'I'
+// if o = 0, then eorder = 'B'
+// if o = 1, then eorder = 'E'
+
+// case when N == 0 and erange == A will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+const vector<vector<double>> op_range = {
+    // all eigenvalues
+    {0, 0, 0, 0, 0, 0},
+    {0, 1, 0, 0, 0, 0},
+    // eigenvalues in a half-open interval
+    {1, 0, -5.5, 5.5, 0, 0},
+    {1, 1, 0.5, 12.5, 0, 0},
+    // invalid interval
+    {1, 1, 5, 5, 0, 0},
+    // eigenvalues by index
+    {2, 0, 0, 0, 1, 5},
+    {2, 1, 0, 0, 3, 10},
+    // invalid indices
+    {2, 1, 0, 0, 0, 5}};
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // quick return
+    {0},
+    // invalid
+    {-1},
+    // normal (valid) samples
+    {12},
+    {20},
+    {35},
+    {64}};
+
+// for daily_lapack tests
+const vector<vector<int>> large_matrix_size_range = {{192}, {256}, {300}};
+
+Arguments stebz_setup_arguments(stebz_tuple tup)
+{
+    vector<int> size = std::get<0>(tup);
+    vector<double> op = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("n", size[0]);
+
+    arg.set<char>("erange", (op[0] == 0 ? 'A' : (op[0] == 1 ? 'V' : 'I')));
+    arg.set<char>("eorder", (op[1] == 0 ? 'B' : 'E'));
+    arg.set<double>("vl", op[2]);
+    arg.set<double>("vu", op[3]);
+    arg.set<rocblas_int>("il", op[4]);
+    arg.set<rocblas_int>("iu", op[5]);
+
+    // use the default absolute tolerance
+    arg.set<double>("abstol", 0);
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class STEBZ : public ::TestWithParam<stebz_tuple>
+{
+protected:
+    STEBZ() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = stebz_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("n") == 0 && arg.peek<char>("erange") == 'A')
+            testing_stebz_bad_arg<T>();
+
+        testing_stebz<T>(arg);
+    }
+};
+
+// non-batch tests
+
+TEST_P(STEBZ, __float)
+{
+    run_tests<float>();
+}
+
+TEST_P(STEBZ, __double)
+{
+    run_tests<double>();
+}
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         STEBZ,
+                         Combine(ValuesIn(large_matrix_size_range), ValuesIn(op_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         STEBZ,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(op_range)));
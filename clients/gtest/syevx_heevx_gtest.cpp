@@ -0,0 +1,206 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_syevx_heevx.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<rocsolver_op_char>, vector<double>> syevx_heevx_tuple;
+
+// each size_range vector is a {n, lda, ldz}
+
+// each op_range vector is a {evect, uplo}
+
+// each range_range vector is a {e, vl, vu, il, iu}
+// if e = 0, then erange = 'A'
+// if e = 1, then erange = 'V'
+// if e = 2, then erange = 'I'
+
+// case when n == 0, evect == N, uplo = L and erange == A will also execute the bad
+// arguments test (null handle, null pointers and invalid values)
+
+const vector<vector<rocsolver_op_char>> op_range = {{'N', 'L'}, {'N', 'U'}, {'V', 'L'}, {'V', 'U'}};
+
+const vector<vector<double>> range_range = {
+    // all eigenvalues
+    {0, 0, 0, 0, 0},
+    // eigenvalues in a half-open interval
+    {1, 395.5, 405.5, 0, 0},
+    // invalid interval
+    {1, 10, 5, 0, 0},
+    // eigenvalues by index
+    {2, 0, 0, 1, 5},
+    {2, 0, 0, 3, 10}};
+
+// for checkin_lapack tests
+const vector<vector<int>> size_range = {
+    // quick return
+    {0, 1, 1},
+    // invalid
+    {-1, 1, 1},
+    {10, 5, 10},
+    {10, 10, 5},
+    // normal (valid) samples
+    {12, 12, 12},
+    {20, 30, 20},
+    {35, 35, 40},
+    {50, 60, 50}};
+
+// for daily_lapack tests
+const vector<vector<int>> large_size_range
+    = {{192, 192, 192}, {256, 270, 256}, {300, 300, 310}};
+
+Arguments syevx_heevx_setup_arguments(syevx_heevx_tuple tup)
+{
+    vector<int> size = std::get<0>(tup);
+    vector<rocsolver_op_char> op = std::get<1>(tup);
+    vector<double> range = std::get<2>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("n", size[0]);
+    arg.set<rocblas_int>("lda", size[1]);
+    arg.set<rocblas_int>("ldz", size[2]);
+
+    arg.set<char>("evect", op[0]);
+    arg.set<char>("uplo", op[1]);
+
+    arg.set<char>("erange", (range[0] == 0 ? 'A' : (range[0] == 1 ? 'V' : 'I')));
+    arg.set<double>("vl", range[1]);
+    arg.set<double>("vu", range[2]);
+    arg.set<rocblas_int>("il", range[3]);
+    arg.set<rocblas_int>("iu", range[4]);
+
+    // use the default absolute tolerance
+    arg.set<double>("abstol", 0);
+
+    // only testing standard use case/defaults for strides
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class SYEVX_HEEVX : public ::TestWithParam<syevx_heevx_tuple>
+{
+protected:
+    SYEVX_HEEVX() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = syevx_heevx_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("n") == 0 && arg.peek<char>("evect") == 'N'
+           && arg.peek<char>("uplo") == 'L' && arg.peek<char>("erange") == 'A')
+            testing_syevx_heevx_bad_arg<BATCHED, STRIDED, T>();
+
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        testing_syevx_heevx<BATCHED, STRIDED, T>(arg);
+    }
+};
+
+class SYEVX : public SYEVX_HEEVX
+{
+};
+
+class HEEVX : public SYEVX_HEEVX
+{
+};
+
+// non-batch tests
+
+TEST_P(SYEVX, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(SYEVX, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(HEEVX, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(HEEVX, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// batched tests
+
+TEST_P(SYEVX, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(SYEVX, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(HEEVX, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(HEEVX, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(SYEVX, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(SYEVX, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(HEEVX, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(HEEVX, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+// daily_lapack tests normal execution with medium to large sizes
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         SYEVX,
+                         Combine(ValuesIn(large_size_range),
+                                 ValuesIn(op_range),
+                                 ValuesIn(range_range)));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         HEEVX,
+                         Combine(ValuesIn(large_size_range),
+                                 ValuesIn(op_range),
+                                 ValuesIn(range_range)));
+
+// checkin_lapack tests normal execution with small sizes, invalid sizes,
+// quick returns, and corner cases
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         SYEVX,
+                         Combine(ValuesIn(size_range), ValuesIn(op_range), ValuesIn(range_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         HEEVX,
+                         Combine(ValuesIn(size_range), ValuesIn(op_range), ValuesIn(range_range)));
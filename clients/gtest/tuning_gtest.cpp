@@ -0,0 +1,360 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_geqr2_geqrf.hpp"
+#include "testing_getf2_getrf.hpp"
+#include "testing_getf2_getrf_npvt.hpp"
+#include <atomic>
+#include <climits>
+#include <fstream>
+#include <thread>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, int> tuning_tuple;
+
+// each matrix_size_range is a {m, n, lda}
+
+// each blk_size_range is the block size (and switch size) forced by the tuning file
+
+// each getrf_variant_range is the variant of getrf forced by the tuning file
+// (0 = right-looking, 1 = left-looking, 2 = recursive, 3 = left-looking with tournament
+// pivoting of the panels; wide matrices never use the left-looking variant and fall back to
+// the right-looking one, and batched problems never use tournament pivoting)
+const vector<int> getrf_variant_range = {0, 1, 2, 3};
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // normal (valid) samples
+    {50, 50, 50},
+    {70, 40, 100},
+    {40, 70, 40}};
+
+const vector<int> blk_size_range = {1, 8, 20};
+
+// for daily_lapack tests
+const vector<vector<int>> large_matrix_size_range = {
+    {300, 300, 300},
+    {640, 320, 700},
+};
+
+const vector<int> large_blk_size_range = {32, 96};
+
+Arguments tuning_setup_arguments(tuning_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("m", matrix_size[0]);
+    arg.set<rocblas_int>("n", matrix_size[1]);
+    arg.set<rocblas_int>("lda", matrix_size[2]);
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+// writes a tuning file that uses the same block size for all the problem sizes
+string tuning_write_file(int blk)
+{
+    string path = ::testing::TempDir() + "rocsolver_tuning_test.txt";
+    ofstream file(path);
+    file << "# generated by rocsolver-test\n";
+    file << "rocsolver_tuning 1\n";
+    file << "GETRF_INTERVALS\n";
+    file << "GETRF_BLKSIZES " << blk << '\n';
+    file << "GETRF_BATCH_INTERVALS\n";
+    file << "GETRF_BATCH_BLKSIZES " << blk << '\n';
+    file << "GEQxF_GEQx2_SWITCHSIZE " << blk << '\n';
+    file << "GEQxF_GEQx2_BLOCKSIZE " << blk << '\n';
+    return path;
+}
+
+// writes a tuning file that forces the given getrf variant with the given block size
+string tuning_write_getrf_file(int variant, int blk)
+{
+    string path = ::testing::TempDir() + "rocsolver_tuning_getrf_test.txt";
+    ofstream file(path);
+    file << "# generated by rocsolver-test\n";
+    file << "rocsolver_tuning 1\n";
+    file << "GETRF_INTERVALS\n";
+    file << "GETRF_BLKSIZES " << blk << '\n';
+    file << "GETRF_BATCH_INTERVALS\n";
+    file << "GETRF_BATCH_BLKSIZES " << blk << '\n';
+    file << "GETRF_NPVT_INTERVALS\n";
+    file << "GETRF_NPVT_BLKSIZES " << blk << '\n';
+    file << "GETRF_NPVT_BATCH_INTERVALS\n";
+    file << "GETRF_NPVT_BATCH_BLKSIZES " << blk << '\n';
+    file << "GETRF_RECURSIVE_MIN_SIZE 0\n";
+    file << "GETRF_RECURSIVE_MAX_SIZE " << (variant == 2 ? INT_MAX : 0) << '\n';
+    file << "GETRF_LEFT_LOOKING_RATIO " << (variant == 1 || variant == 3 ? 1 : 0) << '\n';
+    file << "GETRF_TOURNAMENT_SWITCHSIZE " << (variant == 3 ? 1 : 0) << '\n';
+    file << "GETRF_TOURNAMENT_TILE_ROWS 1\n";
+    return path;
+}
+
+class TUNING : public ::TestWithParam<tuning_tuple>
+{
+protected:
+    TUNING() {}
+    virtual void SetUp() {}
+    virtual void TearDown()
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_tuning_restore_defaults(), rocblas_status_success);
+    }
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = tuning_setup_arguments(GetParam());
+        string path = tuning_write_file(std::get<1>(GetParam()));
+
+        EXPECT_ROCBLAS_STATUS(rocsolver_tuning_load(path.c_str()), rocblas_status_success);
+
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        testing_getf2_getrf<BATCHED, STRIDED, true, T>(arg);
+        testing_geqr2_geqrf<BATCHED, STRIDED, true, T>(arg);
+    }
+};
+
+class TUNING_GETRF : public ::TestWithParam<tuning_tuple>
+{
+protected:
+    TUNING_GETRF() {}
+    virtual void SetUp() {}
+    virtual void TearDown()
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_tuning_restore_defaults(), rocblas_status_success);
+    }
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        // use a block size that gives several panels (and levels of recursion)
+        vector<int> matrix_size = std::get<0>(GetParam());
+        int blk = (min(matrix_size[0], matrix_size[1]) < 100 ? 8 : 32);
+
+        Arguments arg = tuning_setup_arguments(GetParam());
+        string path = tuning_write_getrf_file(std::get<1>(GetParam()), blk);
+
+        EXPECT_ROCBLAS_STATUS(rocsolver_tuning_load(path.c_str()), rocblas_status_success);
+
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        testing_getf2_getrf<BATCHED, STRIDED, true, T>(arg);
+        testing_getf2_getrf_npvt<BATCHED, STRIDED, true, T>(arg);
+    }
+};
+
+// tuning API tests
+TEST(TUNING_API, load_write)
+{
+    string path = ::testing::TempDir() + "rocsolver_tuning_api.txt";
+
+    EXPECT_ROCBLAS_STATUS(rocsolver_tuning_load(nullptr), rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_tuning_write(nullptr), rocblas_status_invalid_pointer);
+
+    // a table written by the library can be loaded back
+    EXPECT_ROCBLAS_STATUS(rocsolver_tuning_write(path.c_str()), rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_tuning_load(path.c_str()), rocblas_status_success);
+
+    // missing header
+    ofstream(path) << "GETRF_INTERVALS 10\nGETRF_BLKSIZES 1 32\n";
+    EXPECT_ROCBLAS_STATUS(rocsolver_tuning_load(path.c_str()), rocblas_status_invalid_value);
+
+    // unsupported version
+    ofstream(path) << "rocsolver_tuning 0\n";
+    EXPECT_ROCBLAS_STATUS(rocsolver_tuning_load(path.c_str()), rocblas_status_invalid_value);
+
+    // unknown parameter
+    ofstream(path) << "rocsolver_tuning 1\nGETRF_BLOCKSIZE 32\n";
+    EXPECT_ROCBLAS_STATUS(rocsolver_tuning_load(path.c_str()), rocblas_status_invalid_value);
+
+    // inconsistent interval table
+    ofstream(path) << "rocsolver_tuning 1\nGETRF_INTERVALS 10 20\nGETRF_BLKSIZES 1 32\n";
+    EXPECT_ROCBLAS_STATUS(rocsolver_tuning_load(path.c_str()), rocblas_status_invalid_value);
+    ofstream(path) << "rocsolver_tuning 1\nGETRF_INTERVALS 20 10\nGETRF_BLKSIZES 1 32 64\n";
+    EXPECT_ROCBLAS_STATUS(rocsolver_tuning_load(path.c_str()), rocblas_status_invalid_value);
+
+    // invalid values
+    ofstream(path) << "rocsolver_tuning 1\nPOTRF_POTF2_SWITCHSIZE 0\n";
+    EXPECT_ROCBLAS_STATUS(rocsolver_tuning_load(path.c_str()), rocblas_status_invalid_value);
+    ofstream(path) << "rocsolver_tuning 1\nGETRI_TINY_SIZE 65\n";
+    EXPECT_ROCBLAS_STATUS(rocsolver_tuning_load(path.c_str()), rocblas_status_invalid_value);
+    ofstream(path) << "rocsolver_tuning 1\nGEQxF_GEQx2_SWITCHSIZE 16\nGEQxF_GEQx2_BLOCKSIZE 32\n";
+    EXPECT_ROCBLAS_STATUS(rocsolver_tuning_load(path.c_str()), rocblas_status_invalid_value);
+    ofstream(path) << "rocsolver_tuning 1\nGETRF_RECURSIVE_MIN_SIZE 64\n"
+                   << "GETRF_RECURSIVE_MAX_SIZE 32\n";
+    EXPECT_ROCBLAS_STATUS(rocsolver_tuning_load(path.c_str()), rocblas_status_invalid_value);
+    ofstream(path) << "rocsolver_tuning 1\nGETRF_LEFT_LOOKING_RATIO -1\n";
+    EXPECT_ROCBLAS_STATUS(rocsolver_tuning_load(path.c_str()), rocblas_status_invalid_value);
+    ofstream(path) << "rocsolver_tuning 1\nGETRF_TOURNAMENT_TILE_ROWS 0\n";
+    EXPECT_ROCBLAS_STATUS(rocsolver_tuning_load(path.c_str()), rocblas_status_invalid_value);
+    ofstream(path) << "rocsolver_tuning 1\nTHIN_SVD_SWITCH 0.5\n";
+    EXPECT_ROCBLAS_STATUS(rocsolver_tuning_load(path.c_str()), rocblas_status_invalid_value);
+
+    // partial tables are valid
+    ofstream(path) << "rocsolver_tuning 1 # version\nPOTRF_POTF2_SWITCHSIZE 32\n";
+    EXPECT_ROCBLAS_STATUS(rocsolver_tuning_load(path.c_str()), rocblas_status_success);
+
+    EXPECT_ROCBLAS_STATUS(rocsolver_tuning_restore_defaults(), rocblas_status_success);
+}
+
+// a call keeps using the table that was active when it started, even if another thread
+// loads a table with different block sizes (and workspace requirements) meanwhile
+TEST(TUNING_API, concurrent_load)
+{
+    string path = tuning_write_file(8);
+    atomic<bool> done(false);
+
+    thread loader([&]() {
+        while(!done)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_tuning_load(path.c_str()), rocblas_status_success);
+            EXPECT_ROCBLAS_STATUS(rocsolver_tuning_restore_defaults(), rocblas_status_success);
+        }
+    });
+
+    Arguments arg = tuning_setup_arguments(tuning_tuple({300, 300, 300}, 0));
+    arg.batch_count = 1;
+    for(int i = 0; i < 10; i++)
+    {
+        testing_getf2_getrf<false, false, true, double>(arg);
+        testing_geqr2_geqrf<false, false, true, double>(arg);
+    }
+
+    done = true;
+    loader.join();
+
+    EXPECT_ROCBLAS_STATUS(rocsolver_tuning_restore_defaults(), rocblas_status_success);
+}
+
+// non-batch tests
+
+TEST_P(TUNING, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(TUNING, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(TUNING, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(TUNING, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// batched tests
+
+TEST_P(TUNING, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(TUNING, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(TUNING, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(TUNING, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(TUNING, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(TUNING, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(TUNING, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(TUNING, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         TUNING,
+                         Combine(ValuesIn(large_matrix_size_range), ValuesIn(large_blk_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         TUNING,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(blk_size_range)));
+
+// getrf variant tests
+
+TEST_P(TUNING_GETRF, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(TUNING_GETRF, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(TUNING_GETRF, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(TUNING_GETRF, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+TEST_P(TUNING_GETRF, batched__float)
+{
+    run_tests<true, false, float>();
+}
+
+TEST_P(TUNING_GETRF, batched__double_complex)
+{
+    run_tests<true, false, rocblas_double_complex>();
+}
+
+TEST_P(TUNING_GETRF, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(TUNING_GETRF, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         TUNING_GETRF,
+                         Combine(ValuesIn(large_matrix_size_range), ValuesIn(getrf_variant_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         TUNING_GETRF,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(getrf_variant_range)));
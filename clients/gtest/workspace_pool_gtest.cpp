@@ -0,0 +1,169 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_getf2_getrf.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef vector<int> workspace_pool_tuple;
+
+// each matrix_size_range is a {m, n, lda}
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // normal (valid) samples
+    {50, 50, 50},
+    {70, 40, 100},
+    {40, 70, 40}};
+
+// for daily_lapack tests
+const vector<vector<int>> large_matrix_size_range = {
+    {300, 300, 300},
+    {640, 320, 700},
+};
+
+class WORKSPACE_POOL : public ::TestWithParam<workspace_pool_tuple>
+{
+protected:
+    WORKSPACE_POOL() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <typename T>
+    void run_tests()
+    {
+        vector<int> matrix_size = GetParam();
+        rocblas_int m = matrix_size[0];
+        rocblas_int n = matrix_size[1];
+        rocblas_int lda = matrix_size[2];
+        rocblas_stride stA = lda * n;
+        rocblas_stride stP = min(m, n);
+        rocblas_int bc = 1;
+        size_t size_A = size_t(lda) * n;
+        size_t size_P = size_t(min(m, n));
+
+        rocblas_local_handle handle;
+        rocsolver_workspace_pool_stats stats;
+        double max_error;
+
+        // memory allocations
+        host_strided_batch_vector<T> hA(size_A, 1, stA, bc);
+        host_strided_batch_vector<T> hARes(size_A, 1, stA, bc);
+        host_strided_batch_vector<rocblas_int> hIpiv(size_P, 1, stP, bc);
+        host_strided_batch_vector<rocblas_int> hIpivRes(size_P, 1, stP, bc);
+        host_strided_batch_vector<rocblas_int> hInfo(1, 1, 1, bc);
+        host_strided_batch_vector<rocblas_int> hInfoRes(1, 1, 1, bc);
+        device_strided_batch_vector<T> dA(size_A, 1, stA, bc);
+        device_strided_batch_vector<rocblas_int> dIpiv(size_P, 1, stP, bc);
+        device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, bc);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+
+        EXPECT_ROCBLAS_STATUS(rocsolver_workspace_pool_create(handle), rocblas_status_success);
+
+        // the first call allocates the workspace; the following calls reuse it
+        for(int i = 0; i < 3; ++i)
+        {
+            getf2_getrf_getError<false, true, T>(handle, m, n, dA, lda, stA, dIpiv, stP, dInfo,
+                                                 bc, hA, hARes, hIpiv, hIpivRes, hInfo, hInfoRes,
+                                                 &max_error, false);
+            ROCSOLVER_TEST_CHECK(T, max_error, min(m, n));
+        }
+
+        // the workspace is also reused after the stream of the handle is replaced, and the
+        // previous stream destroyed, without synchronization
+        for(int i = 0; i < 2; ++i)
+        {
+            hipStream_t stream, old_stream;
+            CHECK_HIP_ERROR(hipStreamCreate(&stream));
+            EXPECT_ROCBLAS_STATUS(rocblas_get_stream(handle, &old_stream), rocblas_status_success);
+            EXPECT_ROCBLAS_STATUS(rocblas_set_stream(handle, stream), rocblas_status_success);
+            if(old_stream)
+                CHECK_HIP_ERROR(hipStreamDestroy(old_stream));
+
+            getf2_getrf_getError<false, true, T>(handle, m, n, dA, lda, stA, dIpiv, stP, dInfo,
+                                                 bc, hA, hARes, hIpiv, hIpivRes, hInfo, hInfoRes,
+                                                 &max_error, false);
+            ROCSOLVER_TEST_CHECK(T, max_error, min(m, n));
+        }
+
+        EXPECT_ROCBLAS_STATUS(rocsolver_workspace_pool_get_stats(handle, &stats),
+                              rocblas_status_success);
+        EXPECT_EQ(stats.misses, 1u);
+        EXPECT_EQ(stats.hits, 4u);
+        EXPECT_GT(stats.peak_bytes, 0u);
+        EXPECT_GE(stats.reserved_bytes, stats.peak_bytes);
+
+        EXPECT_ROCBLAS_STATUS(rocsolver_workspace_pool_destroy(handle), rocblas_status_success);
+
+        hipStream_t stream;
+        EXPECT_ROCBLAS_STATUS(rocblas_get_stream(handle, &stream), rocblas_status_success);
+        EXPECT_ROCBLAS_STATUS(rocblas_set_stream(handle, 0), rocblas_status_success);
+        CHECK_HIP_ERROR(hipStreamDestroy(stream));
+    }
+};
+
+// workspace pool API tests
+TEST(WORKSPACE_POOL_API, create_destroy)
+{
+    rocblas_local_handle handle;
+    rocsolver_workspace_pool_stats stats;
+
+    EXPECT_ROCBLAS_STATUS(rocsolver_workspace_pool_create(nullptr), rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocsolver_workspace_pool_destroy(nullptr),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocsolver_workspace_pool_get_stats(nullptr, &stats),
+                          rocblas_status_invalid_handle);
+
+    // no pool attached
+    EXPECT_ROCBLAS_STATUS(rocsolver_workspace_pool_destroy(handle), rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(rocsolver_workspace_pool_get_stats(handle, &stats),
+                          rocblas_status_invalid_value);
+
+    EXPECT_ROCBLAS_STATUS(rocsolver_workspace_pool_create(handle), rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_workspace_pool_create(handle), rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(rocsolver_workspace_pool_get_stats(handle, nullptr),
+                          rocblas_status_invalid_pointer);
+
+    // a new pool is empty
+    EXPECT_ROCBLAS_STATUS(rocsolver_workspace_pool_get_stats(handle, &stats),
+                          rocblas_status_success);
+    EXPECT_EQ(stats.hits, 0u);
+    EXPECT_EQ(stats.misses, 0u);
+    EXPECT_EQ(stats.reserved_bytes, 0u);
+
+    EXPECT_ROCBLAS_STATUS(rocsolver_workspace_pool_destroy(handle), rocblas_status_success);
+}
+
+// non-batch tests
+
+TEST_P(WORKSPACE_POOL, __float)
+{
+    run_tests<float>();
+}
+
+TEST_P(WORKSPACE_POOL, __double)
+{
+    run_tests<double>();
+}
+
+TEST_P(WORKSPACE_POOL, __float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(WORKSPACE_POOL, __double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack, WORKSPACE_POOL, ValuesIn(large_matrix_size_range));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, WORKSPACE_POOL, ValuesIn(matrix_size_range));
@@ -137,6 +137,26 @@ void cblas_getrs(rocblas_operation trans,
                  T* B,
                  rocblas_int ldb);
 
+template <typename T>
+void cblas_gesv(rocblas_int n,
+                rocblas_int nrhs,
+                T* A,
+                rocblas_int lda,
+                rocblas_int* ipiv,
+                T* B,
+                rocblas_int ldb,
+                rocblas_int* info);
+
+template <typename T>
+void cblas_posv(rocblas_fill uplo,
+                rocblas_int n,
+                rocblas_int nrhs,
+                T* A,
+                rocblas_int lda,
+                T* B,
+                rocblas_int ldb,
+                rocblas_int* info);
+
 template <typename T>
 void cblas_gels(rocblas_operation transR,
                 rocblas_int m,
@@ -150,6 +170,21 @@ void cblas_gels(rocblas_operation transR,
                 rocblas_int lwork,
                 rocblas_int* info);
 
+template <typename T, typename S>
+void cblas_gelsy(rocblas_int m,
+                 rocblas_int n,
+                 rocblas_int nrhs,
+                 T* A,
+                 rocblas_int lda,
+                 T* B,
+                 rocblas_int ldb,
+                 rocblas_int* jpvt,
+                 S rcond,
+                 rocblas_int* rank,
+                 T* work,
+                 rocblas_int lwork,
+                 S* rwork);
+
 template <typename T>
 void cblas_getri(rocblas_int n,
                  T* A,
@@ -261,6 +296,17 @@ void cblas_geqr2(rocblas_int m, rocblas_int n, T* A, rocblas_int lda, T* ipiv, T
 template <typename T>
 void cblas_geqrf(rocblas_int m, rocblas_int n, T* A, rocblas_int lda, T* ipiv, T* work, rocblas_int sizeW);
 
+template <typename T, typename S>
+void cblas_geqp3(rocblas_int m,
+                 rocblas_int n,
+                 T* A,
+                 rocblas_int lda,
+                 rocblas_int* jpvt,
+                 T* ipiv,
+                 T* work,
+                 rocblas_int lwork,
+                 S* rwork);
+
 template <typename T>
 void cblas_geql2(rocblas_int m, rocblas_int n, T* A, rocblas_int lda, T* ipiv, T* work);
 
@@ -530,6 +576,56 @@ void cblas_sterf(rocblas_int n, T* D, T* E);
 template <typename S, typename T>
 void cblas_steqr(rocblas_evect evect, rocblas_int n, S* D, S* E, T* C, rocblas_int ldc, S* work);
 
+template <typename S, typename T>
+void cblas_stedc(rocblas_evect evect,
+                 rocblas_int n,
+                 S* D,
+                 S* E,
+                 T* C,
+                 rocblas_int ldc,
+                 T* work,
+                 rocblas_int lwork,
+                 S* rwork,
+                 rocblas_int lrwork,
+                 rocblas_int* iwork,
+                 rocblas_int liwork,
+                 rocblas_int* info);
+
+template <typename T>
+void cblas_stebz(rocblas_erange erange,
+                 rocblas_eorder eorder,
+                 rocblas_int n,
+                 T vl,
+                 T vu,
+                 rocblas_int il,
+                 rocblas_int iu,
+                 T abstol,
+                 T* D,
+                 T* E,
+                 rocblas_int* nev,
+                 rocblas_int* nsplit,
+                 T* W,
+                 rocblas_int* iblock,
+                 rocblas_int* isplit,
+                 T* work,
+                 rocblas_int* iwork,
+                 rocblas_int* info);
+
+template <typename S, typename T>
+void cblas_stein(rocblas_int n,
+                 S* D,
+                 S* E,
+                 rocblas_int* nev,
+                 S* W,
+                 rocblas_int* iblock,
+                 rocblas_int* isplit,
+                 T* Z,
+                 rocblas_int ldz,
+                 S* work,
+                 rocblas_int* iwork,
+                 rocblas_int* ifail,
+                 rocblas_int* info);
+
 template <typename T>
 void cblas_sygs2_hegs2(rocblas_eform itype,
                        rocblas_fill uplo,
@@ -559,6 +655,44 @@ void cblas_syev_heev(rocblas_evect evect,
                      rocblas_int size_w,
                      rocblas_int* info);
 
+template <typename T, typename S>
+void cblas_syevd_heevd(rocblas_evect evect,
+                       rocblas_fill uplo,
+                       rocblas_int n,
+                       T* A,
+                       rocblas_int lda,
+                       S* D,
+                       T* work,
+                       rocblas_int lwork,
+                       S* rwork,
+                       rocblas_int lrwork,
+                       rocblas_int* iwork,
+                       rocblas_int liwork,
+                       rocblas_int* info);
+
+template <typename T, typename S>
+void cblas_syevx_heevx(rocblas_evect evect,
+                       rocblas_erange erange,
+                       rocblas_fill uplo,
+                       rocblas_int n,
+                       T* A,
+                       rocblas_int lda,
+                       S vl,
+                       S vu,
+                       rocblas_int il,
+                       rocblas_int iu,
+                       S abstol,
+                       rocblas_int* nev,
+                       S* W,
+                       T* Z,
+                       rocblas_int ldz,
+                       T* work,
+                       rocblas_int lwork,
+                       S* rwork,
+                       rocblas_int* iwork,
+                       rocblas_int* ifail,
+                       rocblas_int* info);
+
 template <typename S, typename T>
 void cblas_sygv_hegv(rocblas_eform itype,
                      rocblas_evect evect,
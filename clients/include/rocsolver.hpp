@@ -1216,6 +1216,168 @@ inline rocblas_status rocsolver_steqr(rocblas_handle handle,
 }
 /********************************************************/
 
+/******************** STEDC ********************/
+inline rocblas_status rocsolver_stedc(rocblas_handle handle,
+                                      rocblas_evect evect,
+                                      rocblas_int n,
+                                      float* D,
+                                      float* E,
+                                      float* C,
+                                      rocblas_int ldc,
+                                      rocblas_int* info)
+{
+    return rocsolver_sstedc(handle, evect, n, D, E, C, ldc, info);
+}
+
+inline rocblas_status rocsolver_stedc(rocblas_handle handle,
+                                      rocblas_evect evect,
+                                      rocblas_int n,
+                                      double* D,
+                                      double* E,
+                                      double* C,
+                                      rocblas_int ldc,
+                                      rocblas_int* info)
+{
+    return rocsolver_dstedc(handle, evect, n, D, E, C, ldc, info);
+}
+
+inline rocblas_status rocsolver_stedc(rocblas_handle handle,
+                                      rocblas_evect evect,
+                                      rocblas_int n,
+                                      float* D,
+                                      float* E,
+                                      rocblas_float_complex* C,
+                                      rocblas_int ldc,
+                                      rocblas_int* info)
+{
+    return rocsolver_cstedc(handle, evect, n, D, E, C, ldc, info);
+}
+
+inline rocblas_status rocsolver_stedc(rocblas_handle handle,
+                                      rocblas_evect evect,
+                                      rocblas_int n,
+                                      double* D,
+                                      double* E,
+                                      rocblas_double_complex* C,
+                                      rocblas_int ldc,
+                                      rocblas_int* info)
+{
+    return rocsolver_zstedc(handle, evect, n, D, E, C, ldc, info);
+}
+/********************************************************/
+
+/******************** STEBZ ********************/
+inline rocblas_status rocsolver_stebz(rocblas_handle handle,
+                                      rocblas_erange erange,
+                                      rocblas_eorder eorder,
+                                      rocblas_int n,
+                                      float vl,
+                                      float vu,
+                                      rocblas_int il,
+                                      rocblas_int iu,
+                                      float abstol,
+                                      float* D,
+                                      float* E,
+                                      rocblas_int* nev,
+                                      rocblas_int* nsplit,
+                                      float* W,
+                                      rocblas_int* iblock,
+                                      rocblas_int* isplit,
+                                      rocblas_int* info)
+{
+    return rocsolver_sstebz(handle, erange, eorder, n, vl, vu, il, iu, abstol, D, E, nev, nsplit, W,
+                            iblock, isplit, info);
+}
+
+inline rocblas_status rocsolver_stebz(rocblas_handle handle,
+                                      rocblas_erange erange,
+                                      rocblas_eorder eorder,
+                                      rocblas_int n,
+                                      double vl,
+                                      double vu,
+                                      rocblas_int il,
+                                      rocblas_int iu,
+                                      double abstol,
+                                      double* D,
+                                      double* E,
+                                      rocblas_int* nev,
+                                      rocblas_int* nsplit,
+                                      double* W,
+                                      rocblas_int* iblock,
+                                      rocblas_int* isplit,
+                                      rocblas_int* info)
+{
+    return rocsolver_dstebz(handle, erange, eorder, n, vl, vu, il, iu, abstol, D, E, nev, nsplit, W,
+                            iblock, isplit, info);
+}
+/********************************************************/
+
+/******************** STEIN ********************/
+inline rocblas_status rocsolver_stein(rocblas_handle handle,
+                                      rocblas_int n,
+                                      float* D,
+                                      float* E,
+                                      rocblas_int* nev,
+                                      float* W,
+                                      rocblas_int* iblock,
+                                      rocblas_int* isplit,
+                                      float* Z,
+                                      rocblas_int ldz,
+                                      rocblas_int* ifail,
+                                      rocblas_int* info)
+{
+    return rocsolver_sstein(handle, n, D, E, nev, W, iblock, isplit, Z, ldz, ifail, info);
+}
+
+inline rocblas_status rocsolver_stein(rocblas_handle handle,
+                                      rocblas_int n,
+                                      double* D,
+                                      double* E,
+                                      rocblas_int* nev,
+                                      double* W,
+                                      rocblas_int* iblock,
+                                      rocblas_int* isplit,
+                                      double* Z,
+                                      rocblas_int ldz,
+                                      rocblas_int* ifail,
+                                      rocblas_int* info)
+{
+    return rocsolver_dstein(handle, n, D, E, nev, W, iblock, isplit, Z, ldz, ifail, info);
+}
+
+inline rocblas_status rocsolver_stein(rocblas_handle handle,
+                                      rocblas_int n,
+                                      float* D,
+                                      float* E,
+                                      rocblas_int* nev,
+                                      float* W,
+                                      rocblas_int* iblock,
+                                      rocblas_int* isplit,
+                                      rocblas_float_complex* Z,
+                                      rocblas_int ldz,
+                                      rocblas_int* ifail,
+                                      rocblas_int* info)
+{
+    return rocsolver_cstein(handle, n, D, E, nev, W, iblock, isplit, Z, ldz, ifail, info);
+}
+
+inline rocblas_status rocsolver_stein(rocblas_handle handle,
+                                      rocblas_int n,
+                                      double* D,
+                                      double* E,
+                                      rocblas_int* nev,
+                                      double* W,
+                                      rocblas_int* iblock,
+                                      rocblas_int* isplit,
+                                      rocblas_double_complex* Z,
+                                      rocblas_int ldz,
+                                      rocblas_int* ifail,
+                                      rocblas_int* info)
+{
+    return rocsolver_zstein(handle, n, D, E, nev, W, iblock, isplit, Z, ldz, ifail, info);
+}
+/********************************************************/
+
 /******************** POTF2_POTRF ********************/
 // normal and strided_batched
 inline rocblas_status rocsolver_potf2_potrf(bool STRIDED,
@@ -1660,6 +1822,112 @@ inline rocblas_status rocsolver_getf2_getrf(bool STRIDED,
 }
 /********************************************************/
 
+/******************** GETRF_POTRF_HOST ********************/
+inline rocblas_status rocsolver_getrf_host(rocblas_handle handle,
+                                           rocblas_int m,
+                                           rocblas_int n,
+                                           float* A,
+                                           rocblas_int lda,
+                                           rocblas_stride stA,
+                                           rocblas_int* ipiv,
+                                           rocblas_stride stP,
+                                           rocblas_int* info,
+                                           rocblas_int bc)
+{
+    return rocsolver_sgetrf_strided_batched_host(handle, m, n, A, lda, stA, ipiv, stP, info, bc);
+}
+
+inline rocblas_status rocsolver_getrf_host(rocblas_handle handle,
+                                           rocblas_int m,
+                                           rocblas_int n,
+                                           double* A,
+                                           rocblas_int lda,
+                                           rocblas_stride stA,
+                                           rocblas_int* ipiv,
+                                           rocblas_stride stP,
+                                           rocblas_int* info,
+                                           rocblas_int bc)
+{
+    return rocsolver_dgetrf_strided_batched_host(handle, m, n, A, lda, stA, ipiv, stP, info, bc);
+}
+
+inline rocblas_status rocsolver_getrf_host(rocblas_handle handle,
+                                           rocblas_int m,
+                                           rocblas_int n,
+                                           rocblas_float_complex* A,
+                                           rocblas_int lda,
+                                           rocblas_stride stA,
+                                           rocblas_int* ipiv,
+                                           rocblas_stride stP,
+                                           rocblas_int* info,
+                                           rocblas_int bc)
+{
+    return rocsolver_cgetrf_strided_batched_host(handle, m, n, A, lda, stA, ipiv, stP, info, bc);
+}
+
+inline rocblas_status rocsolver_getrf_host(rocblas_handle handle,
+                                           rocblas_int m,
+                                           rocblas_int n,
+                                           rocblas_double_complex* A,
+                                           rocblas_int lda,
+                                           rocblas_stride stA,
+                                           rocblas_int* ipiv,
+                                           rocblas_stride stP,
+                                           rocblas_int* info,
+                                           rocblas_int bc)
+{
+    return rocsolver_zgetrf_strided_batched_host(handle, m, n, A, lda, stA, ipiv, stP, info, bc);
+}
+
+inline rocblas_status rocsolver_potrf_host(rocblas_handle handle,
+                                           rocblas_fill uplo,
+                                           rocblas_int n,
+                                           float* A,
+                                           rocblas_int lda,
+                                           rocblas_stride stA,
+                                           rocblas_int* info,
+                                           rocblas_int bc)
+{
+    return rocsolver_spotrf_strided_batched_host(handle, uplo, n, A, lda, stA, info, bc);
+}
+
+inline rocblas_status rocsolver_potrf_host(rocblas_handle handle,
+                                           rocblas_fill uplo,
+                                           rocblas_int n,
+                                           double* A,
+                                           rocblas_int lda,
+                                           rocblas_stride stA,
+                                           rocblas_int* info,
+                                           rocblas_int bc)
+{
+    return rocsolver_dpotrf_strided_batched_host(handle, uplo, n, A, lda, stA, info, bc);
+}
+
+inline rocblas_status rocsolver_potrf_host(rocblas_handle handle,
+                                           rocblas_fill uplo,
+                                           rocblas_int n,
+                                           rocblas_float_complex* A,
+                                           rocblas_int lda,
+                                           rocblas_stride stA,
+                                           rocblas_int* info,
+                                           rocblas_int bc)
+{
+    return rocsolver_cpotrf_strided_batched_host(handle, uplo, n, A, lda, stA, info, bc);
+}
+
+inline rocblas_status rocsolver_potrf_host(rocblas_handle handle,
+                                           rocblas_fill uplo,
+                                           rocblas_int n,
+                                           rocblas_double_complex* A,
+                                           rocblas_int lda,
+                                           rocblas_stride stA,
+                                           rocblas_int* info,
+                                           rocblas_int bc)
+{
+    return rocsolver_zpotrf_strided_batched_host(handle, uplo, n, A, lda, stA, info, bc);
+}
+/********************************************************/
+
 /******************** GESVD ********************/
 // normal and strided_batched
 inline rocblas_status rocsolver_gesvd(bool STRIDED,
@@ -1888,6 +2156,250 @@ inline rocblas_status rocsolver_gesvd(bool STRIDED,
 }
 /********************************************************/
 
+/******************** GESVDJ ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_gesvdj(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_svect leftv,
+                                       rocblas_svect rightv,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       float* A,
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       float abstol,
+                                       float* residual,
+                                       rocblas_int max_sweeps,
+                                       rocblas_int* n_sweeps,
+                                       float* S,
+                                       rocblas_stride stS,
+                                       float* U,
+                                       rocblas_int ldu,
+                                       rocblas_stride stU,
+                                       float* V,
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return STRIDED ? rocsolver_sgesvdj_strided_batched(handle, leftv, rightv, m, n, A, lda, stA,
+                                                       abstol, residual, max_sweeps, n_sweeps, S,
+                                                       stS, U, ldu, stU, V, ldv, stV, info, bc)
+                   : rocsolver_sgesvdj(handle, leftv, rightv, m, n, A, lda, abstol, residual,
+                                       max_sweeps, n_sweeps, S, U, ldu, V, ldv, info);
+}
+
+inline rocblas_status rocsolver_gesvdj(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_svect leftv,
+                                       rocblas_svect rightv,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       double* A,
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       double abstol,
+                                       double* residual,
+                                       rocblas_int max_sweeps,
+                                       rocblas_int* n_sweeps,
+                                       double* S,
+                                       rocblas_stride stS,
+                                       double* U,
+                                       rocblas_int ldu,
+                                       rocblas_stride stU,
+                                       double* V,
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return STRIDED ? rocsolver_dgesvdj_strided_batched(handle, leftv, rightv, m, n, A, lda, stA,
+                                                       abstol, residual, max_sweeps, n_sweeps, S,
+                                                       stS, U, ldu, stU, V, ldv, stV, info, bc)
+                   : rocsolver_dgesvdj(handle, leftv, rightv, m, n, A, lda, abstol, residual,
+                                       max_sweeps, n_sweeps, S, U, ldu, V, ldv, info);
+}
+
+inline rocblas_status rocsolver_gesvdj(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_svect leftv,
+                                       rocblas_svect rightv,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       rocblas_float_complex* A,
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       float abstol,
+                                       float* residual,
+                                       rocblas_int max_sweeps,
+                                       rocblas_int* n_sweeps,
+                                       float* S,
+                                       rocblas_stride stS,
+                                       rocblas_float_complex* U,
+                                       rocblas_int ldu,
+                                       rocblas_stride stU,
+                                       rocblas_float_complex* V,
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return STRIDED ? rocsolver_cgesvdj_strided_batched(handle, leftv, rightv, m, n, A, lda, stA,
+                                                       abstol, residual, max_sweeps, n_sweeps, S,
+                                                       stS, U, ldu, stU, V, ldv, stV, info, bc)
+                   : rocsolver_cgesvdj(handle, leftv, rightv, m, n, A, lda, abstol, residual,
+                                       max_sweeps, n_sweeps, S, U, ldu, V, ldv, info);
+}
+
+inline rocblas_status rocsolver_gesvdj(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_svect leftv,
+                                       rocblas_svect rightv,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       rocblas_double_complex* A,
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       double abstol,
+                                       double* residual,
+                                       rocblas_int max_sweeps,
+                                       rocblas_int* n_sweeps,
+                                       double* S,
+                                       rocblas_stride stS,
+                                       rocblas_double_complex* U,
+                                       rocblas_int ldu,
+                                       rocblas_stride stU,
+                                       rocblas_double_complex* V,
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return STRIDED ? rocsolver_zgesvdj_strided_batched(handle, leftv, rightv, m, n, A, lda, stA,
+                                                       abstol, residual, max_sweeps, n_sweeps, S,
+                                                       stS, U, ldu, stU, V, ldv, stV, info, bc)
+                   : rocsolver_zgesvdj(handle, leftv, rightv, m, n, A, lda, abstol, residual,
+                                       max_sweeps, n_sweeps, S, U, ldu, V, ldv, info);
+}
+
+// batched
+inline rocblas_status rocsolver_gesvdj(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_svect leftv,
+                                       rocblas_svect rightv,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       float* const A[],
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       float abstol,
+                                       float* residual,
+                                       rocblas_int max_sweeps,
+                                       rocblas_int* n_sweeps,
+                                       float* S,
+                                       rocblas_stride stS,
+                                       float* U,
+                                       rocblas_int ldu,
+                                       rocblas_stride stU,
+                                       float* V,
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return rocsolver_sgesvdj_batched(handle, leftv, rightv, m, n, A, lda, abstol, residual,
+                                     max_sweeps, n_sweeps, S, stS, U, ldu, stU, V, ldv, stV, info,
+                                     bc);
+}
+
+inline rocblas_status rocsolver_gesvdj(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_svect leftv,
+                                       rocblas_svect rightv,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       double* const A[],
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       double abstol,
+                                       double* residual,
+                                       rocblas_int max_sweeps,
+                                       rocblas_int* n_sweeps,
+                                       double* S,
+                                       rocblas_stride stS,
+                                       double* U,
+                                       rocblas_int ldu,
+                                       rocblas_stride stU,
+                                       double* V,
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return rocsolver_dgesvdj_batched(handle, leftv, rightv, m, n, A, lda, abstol, residual,
+                                     max_sweeps, n_sweeps, S, stS, U, ldu, stU, V, ldv, stV, info,
+                                     bc);
+}
+
+inline rocblas_status rocsolver_gesvdj(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_svect leftv,
+                                       rocblas_svect rightv,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       rocblas_float_complex* const A[],
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       float abstol,
+                                       float* residual,
+                                       rocblas_int max_sweeps,
+                                       rocblas_int* n_sweeps,
+                                       float* S,
+                                       rocblas_stride stS,
+                                       rocblas_float_complex* U,
+                                       rocblas_int ldu,
+                                       rocblas_stride stU,
+                                       rocblas_float_complex* V,
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return rocsolver_cgesvdj_batched(handle, leftv, rightv, m, n, A, lda, abstol, residual,
+                                     max_sweeps, n_sweeps, S, stS, U, ldu, stU, V, ldv, stV, info,
+                                     bc);
+}
+
+inline rocblas_status rocsolver_gesvdj(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_svect leftv,
+                                       rocblas_svect rightv,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       rocblas_double_complex* const A[],
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       double abstol,
+                                       double* residual,
+                                       rocblas_int max_sweeps,
+                                       rocblas_int* n_sweeps,
+                                       double* S,
+                                       rocblas_stride stS,
+                                       rocblas_double_complex* U,
+                                       rocblas_int ldu,
+                                       rocblas_stride stU,
+                                       rocblas_double_complex* V,
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return rocsolver_zgesvdj_batched(handle, leftv, rightv, m, n, A, lda, abstol, residual,
+                                     max_sweeps, n_sweeps, S, stS, U, ldu, stU, V, ldv, stV, info,
+                                     bc);
+}
+/********************************************************/
+
 /******************** GETRS ********************/
 // normal and strided_batched
 inline rocblas_status rocsolver_getrs(bool STRIDED,
@@ -2044,418 +2556,722 @@ inline rocblas_status rocsolver_getrs(bool STRIDED,
 }
 /********************************************************/
 
-/******************** GETRI_OUTOFPLACE ********************/
+/******************** GESV ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_getri_outofplace(bool STRIDED,
-                                                 rocblas_handle handle,
-                                                 rocblas_int n,
-                                                 float* A,
-                                                 rocblas_int lda,
-                                                 rocblas_stride stA,
-                                                 rocblas_int* ipiv,
-                                                 rocblas_stride stP,
-                                                 float* C,
-                                                 rocblas_int ldc,
-                                                 rocblas_stride stC,
-                                                 rocblas_int* info,
-                                                 rocblas_int bc)
+inline rocblas_status rocsolver_gesv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     float* A,
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     float* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
 {
-    return STRIDED ? rocsolver_sgetri_outofplace_strided_batched(handle, n, A, lda, stA, ipiv, stP,
-                                                                 C, ldc, stC, info, bc)
-                   : rocsolver_sgetri_outofplace(handle, n, A, lda, ipiv, C, ldc, info);
+    return STRIDED ? rocsolver_sgesv_strided_batched(handle, n, nrhs, A, lda, stA, ipiv, stP, B,
+                                                     ldb, stB, info, bc)
+                   : rocsolver_sgesv(handle, n, nrhs, A, lda, ipiv, B, ldb, info);
 }
 
-inline rocblas_status rocsolver_getri_outofplace(bool STRIDED,
-                                                 rocblas_handle handle,
-                                                 rocblas_int n,
-                                                 double* A,
-                                                 rocblas_int lda,
-                                                 rocblas_stride stA,
-                                                 rocblas_int* ipiv,
-                                                 rocblas_stride stP,
-                                                 double* C,
-                                                 rocblas_int ldc,
-                                                 rocblas_stride stC,
-                                                 rocblas_int* info,
-                                                 rocblas_int bc)
+inline rocblas_status rocsolver_gesv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     double* A,
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     double* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
 {
-    return STRIDED ? rocsolver_dgetri_outofplace_strided_batched(handle, n, A, lda, stA, ipiv, stP,
-                                                                 C, ldc, stC, info, bc)
-                   : rocsolver_dgetri_outofplace(handle, n, A, lda, ipiv, C, ldc, info);
+    return STRIDED ? rocsolver_dgesv_strided_batched(handle, n, nrhs, A, lda, stA, ipiv, stP, B,
+                                                     ldb, stB, info, bc)
+                   : rocsolver_dgesv(handle, n, nrhs, A, lda, ipiv, B, ldb, info);
 }
 
-inline rocblas_status rocsolver_getri_outofplace(bool STRIDED,
-                                                 rocblas_handle handle,
-                                                 rocblas_int n,
-                                                 rocblas_float_complex* A,
-                                                 rocblas_int lda,
-                                                 rocblas_stride stA,
-                                                 rocblas_int* ipiv,
-                                                 rocblas_stride stP,
-                                                 rocblas_float_complex* C,
-                                                 rocblas_int ldc,
-                                                 rocblas_stride stC,
-                                                 rocblas_int* info,
-                                                 rocblas_int bc)
+inline rocblas_status rocsolver_gesv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_float_complex* A,
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     rocblas_float_complex* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
 {
-    return STRIDED ? rocsolver_cgetri_outofplace_strided_batched(handle, n, A, lda, stA, ipiv, stP,
-                                                                 C, ldc, stC, info, bc)
-                   : rocsolver_cgetri_outofplace(handle, n, A, lda, ipiv, C, ldc, info);
+    return STRIDED ? rocsolver_cgesv_strided_batched(handle, n, nrhs, A, lda, stA, ipiv, stP, B,
+                                                     ldb, stB, info, bc)
+                   : rocsolver_cgesv(handle, n, nrhs, A, lda, ipiv, B, ldb, info);
 }
 
-inline rocblas_status rocsolver_getri_outofplace(bool STRIDED,
-                                                 rocblas_handle handle,
-                                                 rocblas_int n,
-                                                 rocblas_double_complex* A,
-                                                 rocblas_int lda,
-                                                 rocblas_stride stA,
-                                                 rocblas_int* ipiv,
-                                                 rocblas_stride stP,
-                                                 rocblas_double_complex* C,
-                                                 rocblas_int ldc,
-                                                 rocblas_stride stC,
-                                                 rocblas_int* info,
-                                                 rocblas_int bc)
+inline rocblas_status rocsolver_gesv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_double_complex* A,
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     rocblas_double_complex* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
 {
-    return STRIDED ? rocsolver_zgetri_outofplace_strided_batched(handle, n, A, lda, stA, ipiv, stP,
-                                                                 C, ldc, stC, info, bc)
-                   : rocsolver_zgetri_outofplace(handle, n, A, lda, ipiv, C, ldc, info);
+    return STRIDED ? rocsolver_zgesv_strided_batched(handle, n, nrhs, A, lda, stA, ipiv, stP, B,
+                                                     ldb, stB, info, bc)
+                   : rocsolver_zgesv(handle, n, nrhs, A, lda, ipiv, B, ldb, info);
 }
 
 // batched
-inline rocblas_status rocsolver_getri_outofplace(bool STRIDED,
-                                                 rocblas_handle handle,
-                                                 rocblas_int n,
-                                                 float* const A[],
-                                                 rocblas_int lda,
-                                                 rocblas_stride stA,
-                                                 rocblas_int* ipiv,
-                                                 rocblas_stride stP,
-                                                 float* const C[],
-                                                 rocblas_int ldc,
-                                                 rocblas_stride stC,
-                                                 rocblas_int* info,
-                                                 rocblas_int bc)
-{
-    return rocsolver_sgetri_outofplace_batched(handle, n, A, lda, ipiv, stP, C, ldc, info, bc);
-}
-
-inline rocblas_status rocsolver_getri_outofplace(bool STRIDED,
-                                                 rocblas_handle handle,
-                                                 rocblas_int n,
-                                                 double* const A[],
-                                                 rocblas_int lda,
-                                                 rocblas_stride stA,
-                                                 rocblas_int* ipiv,
-                                                 rocblas_stride stP,
-                                                 double* const C[],
-                                                 rocblas_int ldc,
-                                                 rocblas_stride stC,
-                                                 rocblas_int* info,
-                                                 rocblas_int bc)
+inline rocblas_status rocsolver_gesv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     float* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     float* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
 {
-    return rocsolver_dgetri_outofplace_batched(handle, n, A, lda, ipiv, stP, C, ldc, info, bc);
+    return rocsolver_sgesv_batched(handle, n, nrhs, A, lda, ipiv, stP, B, ldb, info, bc);
 }
 
-inline rocblas_status rocsolver_getri_outofplace(bool STRIDED,
-                                                 rocblas_handle handle,
-                                                 rocblas_int n,
-                                                 rocblas_float_complex* const A[],
-                                                 rocblas_int lda,
-                                                 rocblas_stride stA,
-                                                 rocblas_int* ipiv,
-                                                 rocblas_stride stP,
-                                                 rocblas_float_complex* const C[],
-                                                 rocblas_int ldc,
-                                                 rocblas_stride stC,
-                                                 rocblas_int* info,
-                                                 rocblas_int bc)
+inline rocblas_status rocsolver_gesv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     double* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     double* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
 {
-    return rocsolver_cgetri_outofplace_batched(handle, n, A, lda, ipiv, stP, C, ldc, info, bc);
+    return rocsolver_dgesv_batched(handle, n, nrhs, A, lda, ipiv, stP, B, ldb, info, bc);
 }
 
-inline rocblas_status rocsolver_getri_outofplace(bool STRIDED,
-                                                 rocblas_handle handle,
-                                                 rocblas_int n,
-                                                 rocblas_double_complex* const A[],
-                                                 rocblas_int lda,
-                                                 rocblas_stride stA,
-                                                 rocblas_int* ipiv,
-                                                 rocblas_stride stP,
-                                                 rocblas_double_complex* const C[],
-                                                 rocblas_int ldc,
-                                                 rocblas_stride stC,
-                                                 rocblas_int* info,
-                                                 rocblas_int bc)
+inline rocblas_status rocsolver_gesv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_float_complex* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     rocblas_float_complex* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
 {
-    return rocsolver_zgetri_outofplace_batched(handle, n, A, lda, ipiv, stP, C, ldc, info, bc);
+    return rocsolver_cgesv_batched(handle, n, nrhs, A, lda, ipiv, stP, B, ldb, info, bc);
+}
+
+inline rocblas_status rocsolver_gesv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_double_complex* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     rocblas_double_complex* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    return rocsolver_zgesv_batched(handle, n, nrhs, A, lda, ipiv, stP, B, ldb, info, bc);
 }
 /********************************************************/
 
-/******************** GETRI ********************/
+/******************** POSV ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_getri(bool STRIDED,
-                                      rocblas_handle handle,
-                                      rocblas_int n,
-                                      float* A,
-                                      rocblas_int lda,
-                                      rocblas_stride stA,
-                                      rocblas_int* ipiv,
-                                      rocblas_stride stP,
-                                      rocblas_int* info,
-                                      rocblas_int bc)
+inline rocblas_status rocsolver_posv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     float* A,
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     float* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
 {
-    return STRIDED ? rocsolver_sgetri_strided_batched(handle, n, A, lda, stA, ipiv, stP, info, bc)
-                   : rocsolver_sgetri(handle, n, A, lda, ipiv, info);
+    return STRIDED ? rocsolver_sposv_strided_batched(handle, uplo, n, nrhs, A, lda, stA, B, ldb,
+                                                     stB, info, bc)
+                   : rocsolver_sposv(handle, uplo, n, nrhs, A, lda, B, ldb, info);
 }
 
-inline rocblas_status rocsolver_getri(bool STRIDED,
-                                      rocblas_handle handle,
-                                      rocblas_int n,
-                                      double* A,
-                                      rocblas_int lda,
-                                      rocblas_stride stA,
-                                      rocblas_int* ipiv,
-                                      rocblas_stride stP,
-                                      rocblas_int* info,
-                                      rocblas_int bc)
+inline rocblas_status rocsolver_posv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     double* A,
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     double* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
 {
-    return STRIDED ? rocsolver_dgetri_strided_batched(handle, n, A, lda, stA, ipiv, stP, info, bc)
-                   : rocsolver_dgetri(handle, n, A, lda, ipiv, info);
+    return STRIDED ? rocsolver_dposv_strided_batched(handle, uplo, n, nrhs, A, lda, stA, B, ldb,
+                                                     stB, info, bc)
+                   : rocsolver_dposv(handle, uplo, n, nrhs, A, lda, B, ldb, info);
 }
 
-inline rocblas_status rocsolver_getri(bool STRIDED,
-                                      rocblas_handle handle,
-                                      rocblas_int n,
-                                      rocblas_float_complex* A,
-                                      rocblas_int lda,
-                                      rocblas_stride stA,
-                                      rocblas_int* ipiv,
-                                      rocblas_stride stP,
-                                      rocblas_int* info,
-                                      rocblas_int bc)
+inline rocblas_status rocsolver_posv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_float_complex* A,
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_float_complex* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
 {
-    return STRIDED ? rocsolver_cgetri_strided_batched(handle, n, A, lda, stA, ipiv, stP, info, bc)
-                   : rocsolver_cgetri(handle, n, A, lda, ipiv, info);
+    return STRIDED ? rocsolver_cposv_strided_batched(handle, uplo, n, nrhs, A, lda, stA, B, ldb,
+                                                     stB, info, bc)
+                   : rocsolver_cposv(handle, uplo, n, nrhs, A, lda, B, ldb, info);
 }
 
-inline rocblas_status rocsolver_getri(bool STRIDED,
-                                      rocblas_handle handle,
-                                      rocblas_int n,
-                                      rocblas_double_complex* A,
-                                      rocblas_int lda,
-                                      rocblas_stride stA,
-                                      rocblas_int* ipiv,
-                                      rocblas_stride stP,
-                                      rocblas_int* info,
-                                      rocblas_int bc)
+inline rocblas_status rocsolver_posv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_double_complex* A,
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_double_complex* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
 {
-    return STRIDED ? rocsolver_zgetri_strided_batched(handle, n, A, lda, stA, ipiv, stP, info, bc)
-                   : rocsolver_zgetri(handle, n, A, lda, ipiv, info);
+    return STRIDED ? rocsolver_zposv_strided_batched(handle, uplo, n, nrhs, A, lda, stA, B, ldb,
+                                                     stB, info, bc)
+                   : rocsolver_zposv(handle, uplo, n, nrhs, A, lda, B, ldb, info);
 }
 
 // batched
-inline rocblas_status rocsolver_getri(bool STRIDED,
-                                      rocblas_handle handle,
-                                      rocblas_int n,
-                                      float* const A[],
-                                      rocblas_int lda,
-                                      rocblas_stride stA,
-                                      rocblas_int* ipiv,
-                                      rocblas_stride stP,
-                                      rocblas_int* info,
-                                      rocblas_int bc)
+inline rocblas_status rocsolver_posv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     float* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     float* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
 {
-    return rocsolver_sgetri_batched(handle, n, A, lda, ipiv, stP, info, bc);
+    return rocsolver_sposv_batched(handle, uplo, n, nrhs, A, lda, B, ldb, info, bc);
 }
 
-inline rocblas_status rocsolver_getri(bool STRIDED,
-                                      rocblas_handle handle,
-                                      rocblas_int n,
-                                      double* const A[],
-                                      rocblas_int lda,
-                                      rocblas_stride stA,
-                                      rocblas_int* ipiv,
-                                      rocblas_stride stP,
-                                      rocblas_int* info,
-                                      rocblas_int bc)
+inline rocblas_status rocsolver_posv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     double* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     double* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
 {
-    return rocsolver_dgetri_batched(handle, n, A, lda, ipiv, stP, info, bc);
+    return rocsolver_dposv_batched(handle, uplo, n, nrhs, A, lda, B, ldb, info, bc);
 }
 
-inline rocblas_status rocsolver_getri(bool STRIDED,
-                                      rocblas_handle handle,
-                                      rocblas_int n,
-                                      rocblas_float_complex* const A[],
-                                      rocblas_int lda,
-                                      rocblas_stride stA,
-                                      rocblas_int* ipiv,
-                                      rocblas_stride stP,
-                                      rocblas_int* info,
-                                      rocblas_int bc)
+inline rocblas_status rocsolver_posv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_float_complex* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_float_complex* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
 {
-    return rocsolver_cgetri_batched(handle, n, A, lda, ipiv, stP, info, bc);
+    return rocsolver_cposv_batched(handle, uplo, n, nrhs, A, lda, B, ldb, info, bc);
 }
 
-inline rocblas_status rocsolver_getri(bool STRIDED,
-                                      rocblas_handle handle,
-                                      rocblas_int n,
-                                      rocblas_double_complex* const A[],
-                                      rocblas_int lda,
-                                      rocblas_stride stA,
-                                      rocblas_int* ipiv,
-                                      rocblas_stride stP,
-                                      rocblas_int* info,
-                                      rocblas_int bc)
+inline rocblas_status rocsolver_posv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_double_complex* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_double_complex* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
 {
-    return rocsolver_zgetri_batched(handle, n, A, lda, ipiv, stP, info, bc);
+    return rocsolver_zposv_batched(handle, uplo, n, nrhs, A, lda, B, ldb, info, bc);
 }
 /********************************************************/
 
-/******************** TRTRI ********************/
+/******************** GETRI_OUTOFPLACE ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_trtri(bool STRIDED,
-                                      rocblas_handle handle,
-                                      rocblas_fill uplo,
-                                      rocblas_diagonal diag,
-                                      rocblas_int n,
-                                      float* A,
-                                      rocblas_int lda,
-                                      rocblas_stride stA,
-                                      rocblas_int* info,
-                                      rocblas_int bc)
-{
-    return STRIDED ? rocsolver_strtri_strided_batched(handle, uplo, diag, n, A, lda, stA, info, bc)
-                   : rocsolver_strtri(handle, uplo, diag, n, A, lda, info);
+inline rocblas_status rocsolver_getri_outofplace(bool STRIDED,
+                                                 rocblas_handle handle,
+                                                 rocblas_int n,
+                                                 float* A,
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 rocblas_int* ipiv,
+                                                 rocblas_stride stP,
+                                                 float* C,
+                                                 rocblas_int ldc,
+                                                 rocblas_stride stC,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    return STRIDED ? rocsolver_sgetri_outofplace_strided_batched(handle, n, A, lda, stA, ipiv, stP,
+                                                                 C, ldc, stC, info, bc)
+                   : rocsolver_sgetri_outofplace(handle, n, A, lda, ipiv, C, ldc, info);
 }
 
-inline rocblas_status rocsolver_trtri(bool STRIDED,
+inline rocblas_status rocsolver_getri_outofplace(bool STRIDED,
+                                                 rocblas_handle handle,
+                                                 rocblas_int n,
+                                                 double* A,
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 rocblas_int* ipiv,
+                                                 rocblas_stride stP,
+                                                 double* C,
+                                                 rocblas_int ldc,
+                                                 rocblas_stride stC,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    return STRIDED ? rocsolver_dgetri_outofplace_strided_batched(handle, n, A, lda, stA, ipiv, stP,
+                                                                 C, ldc, stC, info, bc)
+                   : rocsolver_dgetri_outofplace(handle, n, A, lda, ipiv, C, ldc, info);
+}
+
+inline rocblas_status rocsolver_getri_outofplace(bool STRIDED,
+                                                 rocblas_handle handle,
+                                                 rocblas_int n,
+                                                 rocblas_float_complex* A,
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 rocblas_int* ipiv,
+                                                 rocblas_stride stP,
+                                                 rocblas_float_complex* C,
+                                                 rocblas_int ldc,
+                                                 rocblas_stride stC,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    return STRIDED ? rocsolver_cgetri_outofplace_strided_batched(handle, n, A, lda, stA, ipiv, stP,
+                                                                 C, ldc, stC, info, bc)
+                   : rocsolver_cgetri_outofplace(handle, n, A, lda, ipiv, C, ldc, info);
+}
+
+inline rocblas_status rocsolver_getri_outofplace(bool STRIDED,
+                                                 rocblas_handle handle,
+                                                 rocblas_int n,
+                                                 rocblas_double_complex* A,
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 rocblas_int* ipiv,
+                                                 rocblas_stride stP,
+                                                 rocblas_double_complex* C,
+                                                 rocblas_int ldc,
+                                                 rocblas_stride stC,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    return STRIDED ? rocsolver_zgetri_outofplace_strided_batched(handle, n, A, lda, stA, ipiv, stP,
+                                                                 C, ldc, stC, info, bc)
+                   : rocsolver_zgetri_outofplace(handle, n, A, lda, ipiv, C, ldc, info);
+}
+
+// batched
+inline rocblas_status rocsolver_getri_outofplace(bool STRIDED,
+                                                 rocblas_handle handle,
+                                                 rocblas_int n,
+                                                 float* const A[],
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 rocblas_int* ipiv,
+                                                 rocblas_stride stP,
+                                                 float* const C[],
+                                                 rocblas_int ldc,
+                                                 rocblas_stride stC,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    return rocsolver_sgetri_outofplace_batched(handle, n, A, lda, ipiv, stP, C, ldc, info, bc);
+}
+
+inline rocblas_status rocsolver_getri_outofplace(bool STRIDED,
+                                                 rocblas_handle handle,
+                                                 rocblas_int n,
+                                                 double* const A[],
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 rocblas_int* ipiv,
+                                                 rocblas_stride stP,
+                                                 double* const C[],
+                                                 rocblas_int ldc,
+                                                 rocblas_stride stC,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    return rocsolver_dgetri_outofplace_batched(handle, n, A, lda, ipiv, stP, C, ldc, info, bc);
+}
+
+inline rocblas_status rocsolver_getri_outofplace(bool STRIDED,
+                                                 rocblas_handle handle,
+                                                 rocblas_int n,
+                                                 rocblas_float_complex* const A[],
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 rocblas_int* ipiv,
+                                                 rocblas_stride stP,
+                                                 rocblas_float_complex* const C[],
+                                                 rocblas_int ldc,
+                                                 rocblas_stride stC,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    return rocsolver_cgetri_outofplace_batched(handle, n, A, lda, ipiv, stP, C, ldc, info, bc);
+}
+
+inline rocblas_status rocsolver_getri_outofplace(bool STRIDED,
+                                                 rocblas_handle handle,
+                                                 rocblas_int n,
+                                                 rocblas_double_complex* const A[],
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 rocblas_int* ipiv,
+                                                 rocblas_stride stP,
+                                                 rocblas_double_complex* const C[],
+                                                 rocblas_int ldc,
+                                                 rocblas_stride stC,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    return rocsolver_zgetri_outofplace_batched(handle, n, A, lda, ipiv, stP, C, ldc, info, bc);
+}
+/********************************************************/
+
+/******************** GETRI ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_getri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int n,
+                                      float* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return STRIDED ? rocsolver_sgetri_strided_batched(handle, n, A, lda, stA, ipiv, stP, info, bc)
+                   : rocsolver_sgetri(handle, n, A, lda, ipiv, info);
+}
+
+inline rocblas_status rocsolver_getri(bool STRIDED,
                                       rocblas_handle handle,
-                                      rocblas_fill uplo,
-                                      rocblas_diagonal diag,
                                       rocblas_int n,
                                       double* A,
                                       rocblas_int lda,
                                       rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
                                       rocblas_int* info,
                                       rocblas_int bc)
 {
-    return STRIDED ? rocsolver_dtrtri_strided_batched(handle, uplo, diag, n, A, lda, stA, info, bc)
-                   : rocsolver_dtrtri(handle, uplo, diag, n, A, lda, info);
+    return STRIDED ? rocsolver_dgetri_strided_batched(handle, n, A, lda, stA, ipiv, stP, info, bc)
+                   : rocsolver_dgetri(handle, n, A, lda, ipiv, info);
 }
 
-inline rocblas_status rocsolver_trtri(bool STRIDED,
+inline rocblas_status rocsolver_getri(bool STRIDED,
                                       rocblas_handle handle,
-                                      rocblas_fill uplo,
-                                      rocblas_diagonal diag,
                                       rocblas_int n,
                                       rocblas_float_complex* A,
                                       rocblas_int lda,
                                       rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
                                       rocblas_int* info,
                                       rocblas_int bc)
 {
-    return STRIDED ? rocsolver_ctrtri_strided_batched(handle, uplo, diag, n, A, lda, stA, info, bc)
-                   : rocsolver_ctrtri(handle, uplo, diag, n, A, lda, info);
+    return STRIDED ? rocsolver_cgetri_strided_batched(handle, n, A, lda, stA, ipiv, stP, info, bc)
+                   : rocsolver_cgetri(handle, n, A, lda, ipiv, info);
 }
 
-inline rocblas_status rocsolver_trtri(bool STRIDED,
+inline rocblas_status rocsolver_getri(bool STRIDED,
                                       rocblas_handle handle,
-                                      rocblas_fill uplo,
-                                      rocblas_diagonal diag,
                                       rocblas_int n,
                                       rocblas_double_complex* A,
                                       rocblas_int lda,
                                       rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
                                       rocblas_int* info,
                                       rocblas_int bc)
 {
-    return STRIDED ? rocsolver_ztrtri_strided_batched(handle, uplo, diag, n, A, lda, stA, info, bc)
-                   : rocsolver_ztrtri(handle, uplo, diag, n, A, lda, info);
+    return STRIDED ? rocsolver_zgetri_strided_batched(handle, n, A, lda, stA, ipiv, stP, info, bc)
+                   : rocsolver_zgetri(handle, n, A, lda, ipiv, info);
 }
 
 // batched
-inline rocblas_status rocsolver_trtri(bool STRIDED,
+inline rocblas_status rocsolver_getri(bool STRIDED,
                                       rocblas_handle handle,
-                                      rocblas_fill uplo,
-                                      rocblas_diagonal diag,
                                       rocblas_int n,
                                       float* const A[],
                                       rocblas_int lda,
                                       rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
                                       rocblas_int* info,
                                       rocblas_int bc)
 {
-    return rocsolver_strtri_batched(handle, uplo, diag, n, A, lda, info, bc);
+    return rocsolver_sgetri_batched(handle, n, A, lda, ipiv, stP, info, bc);
 }
 
-inline rocblas_status rocsolver_trtri(bool STRIDED,
+inline rocblas_status rocsolver_getri(bool STRIDED,
                                       rocblas_handle handle,
-                                      rocblas_fill uplo,
-                                      rocblas_diagonal diag,
                                       rocblas_int n,
                                       double* const A[],
                                       rocblas_int lda,
                                       rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
                                       rocblas_int* info,
                                       rocblas_int bc)
 {
-    return rocsolver_dtrtri_batched(handle, uplo, diag, n, A, lda, info, bc);
+    return rocsolver_dgetri_batched(handle, n, A, lda, ipiv, stP, info, bc);
 }
 
-inline rocblas_status rocsolver_trtri(bool STRIDED,
+inline rocblas_status rocsolver_getri(bool STRIDED,
                                       rocblas_handle handle,
-                                      rocblas_fill uplo,
-                                      rocblas_diagonal diag,
                                       rocblas_int n,
                                       rocblas_float_complex* const A[],
                                       rocblas_int lda,
                                       rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
                                       rocblas_int* info,
                                       rocblas_int bc)
 {
-    return rocsolver_ctrtri_batched(handle, uplo, diag, n, A, lda, info, bc);
+    return rocsolver_cgetri_batched(handle, n, A, lda, ipiv, stP, info, bc);
 }
 
-inline rocblas_status rocsolver_trtri(bool STRIDED,
+inline rocblas_status rocsolver_getri(bool STRIDED,
                                       rocblas_handle handle,
-                                      rocblas_fill uplo,
-                                      rocblas_diagonal diag,
                                       rocblas_int n,
                                       rocblas_double_complex* const A[],
                                       rocblas_int lda,
                                       rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
                                       rocblas_int* info,
                                       rocblas_int bc)
 {
-    return rocsolver_ztrtri_batched(handle, uplo, diag, n, A, lda, info, bc);
+    return rocsolver_zgetri_batched(handle, n, A, lda, ipiv, stP, info, bc);
 }
 /********************************************************/
 
-/******************** GEQR2_GEQRF ********************/
+/******************** TRTRI ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
-                                            bool GEQRF,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            float* A,
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            float* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_trtri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_diagonal diag,
+                                      rocblas_int n,
+                                      float* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    if(STRIDED)
-        return GEQRF ? rocsolver_sgeqrf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
-                     : rocsolver_sgeqr2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
-    else
-        return GEQRF ? rocsolver_sgeqrf(handle, m, n, A, lda, ipiv)
-                     : rocsolver_sgeqr2(handle, m, n, A, lda, ipiv);
+    return STRIDED ? rocsolver_strtri_strided_batched(handle, uplo, diag, n, A, lda, stA, info, bc)
+                   : rocsolver_strtri(handle, uplo, diag, n, A, lda, info);
 }
 
-inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
-                                            bool GEQRF,
+inline rocblas_status rocsolver_trtri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_diagonal diag,
+                                      rocblas_int n,
+                                      double* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return STRIDED ? rocsolver_dtrtri_strided_batched(handle, uplo, diag, n, A, lda, stA, info, bc)
+                   : rocsolver_dtrtri(handle, uplo, diag, n, A, lda, info);
+}
+
+inline rocblas_status rocsolver_trtri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_diagonal diag,
+                                      rocblas_int n,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return STRIDED ? rocsolver_ctrtri_strided_batched(handle, uplo, diag, n, A, lda, stA, info, bc)
+                   : rocsolver_ctrtri(handle, uplo, diag, n, A, lda, info);
+}
+
+inline rocblas_status rocsolver_trtri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_diagonal diag,
+                                      rocblas_int n,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return STRIDED ? rocsolver_ztrtri_strided_batched(handle, uplo, diag, n, A, lda, stA, info, bc)
+                   : rocsolver_ztrtri(handle, uplo, diag, n, A, lda, info);
+}
+
+// batched
+inline rocblas_status rocsolver_trtri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_diagonal diag,
+                                      rocblas_int n,
+                                      float* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return rocsolver_strtri_batched(handle, uplo, diag, n, A, lda, info, bc);
+}
+
+inline rocblas_status rocsolver_trtri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_diagonal diag,
+                                      rocblas_int n,
+                                      double* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return rocsolver_dtrtri_batched(handle, uplo, diag, n, A, lda, info, bc);
+}
+
+inline rocblas_status rocsolver_trtri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_diagonal diag,
+                                      rocblas_int n,
+                                      rocblas_float_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return rocsolver_ctrtri_batched(handle, uplo, diag, n, A, lda, info, bc);
+}
+
+inline rocblas_status rocsolver_trtri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_diagonal diag,
+                                      rocblas_int n,
+                                      rocblas_double_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return rocsolver_ztrtri_batched(handle, uplo, diag, n, A, lda, info, bc);
+}
+/********************************************************/
+
+/******************** GEQR2_GEQRF ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
+                                            bool GEQRF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            float* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return GEQRF ? rocsolver_sgeqrf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
+                     : rocsolver_sgeqr2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+    else
+        return GEQRF ? rocsolver_sgeqrf(handle, m, n, A, lda, ipiv)
+                     : rocsolver_sgeqr2(handle, m, n, A, lda, ipiv);
+}
+
+inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
+                                            bool GEQRF,
                                             rocblas_handle handle,
                                             rocblas_int m,
                                             rocblas_int n,
@@ -2640,684 +3456,1524 @@ inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
                                             rocblas_stride stP,
                                             rocblas_int bc)
 {
-    return GEQRF ? rocsolver_zgeqrf_ptr_batched(handle, m, n, A, lda, ipiv, bc)
-                 : rocblas_status_not_implemented;
+    return GEQRF ? rocsolver_zgeqrf_ptr_batched(handle, m, n, A, lda, ipiv, bc)
+                 : rocblas_status_not_implemented;
+}
+/********************************************************/
+
+/******************** GEQP3 ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_geqp3(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      float* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      float* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_sgeqp3_strided_batched(handle, m, n, A, lda, stA, jpvt, stJ, ipiv, stP,
+                                                bc);
+    else
+        return rocsolver_sgeqp3(handle, m, n, A, lda, jpvt, ipiv);
+}
+
+inline rocblas_status rocsolver_geqp3(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      double* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      double* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_dgeqp3_strided_batched(handle, m, n, A, lda, stA, jpvt, stJ, ipiv, stP,
+                                                bc);
+    else
+        return rocsolver_dgeqp3(handle, m, n, A, lda, jpvt, ipiv);
+}
+
+inline rocblas_status rocsolver_geqp3(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      rocblas_float_complex* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_cgeqp3_strided_batched(handle, m, n, A, lda, stA, jpvt, stJ, ipiv, stP,
+                                                bc);
+    else
+        return rocsolver_cgeqp3(handle, m, n, A, lda, jpvt, ipiv);
+}
+
+inline rocblas_status rocsolver_geqp3(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      rocblas_double_complex* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_zgeqp3_strided_batched(handle, m, n, A, lda, stA, jpvt, stJ, ipiv, stP,
+                                                bc);
+    else
+        return rocsolver_zgeqp3(handle, m, n, A, lda, jpvt, ipiv);
+}
+
+// batched
+inline rocblas_status rocsolver_geqp3(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      float* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      float* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int bc)
+{
+    return rocsolver_sgeqp3_batched(handle, m, n, A, lda, jpvt, stJ, ipiv, stP, bc);
+}
+
+inline rocblas_status rocsolver_geqp3(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      double* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      double* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int bc)
+{
+    return rocsolver_dgeqp3_batched(handle, m, n, A, lda, jpvt, stJ, ipiv, stP, bc);
+}
+
+inline rocblas_status rocsolver_geqp3(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_float_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      rocblas_float_complex* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int bc)
+{
+    return rocsolver_cgeqp3_batched(handle, m, n, A, lda, jpvt, stJ, ipiv, stP, bc);
+}
+
+inline rocblas_status rocsolver_geqp3(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_double_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      rocblas_double_complex* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int bc)
+{
+    return rocsolver_zgeqp3_batched(handle, m, n, A, lda, jpvt, stJ, ipiv, stP, bc);
+}
+/********************************************************/
+
+/******************** GEQL2_GEQLF ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_geql2_geqlf(bool STRIDED,
+                                            bool GEQLF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            float* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return GEQLF ? rocsolver_sgeqlf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
+                     : rocsolver_sgeql2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+    else
+        return GEQLF ? rocsolver_sgeqlf(handle, m, n, A, lda, ipiv)
+                     : rocsolver_sgeql2(handle, m, n, A, lda, ipiv);
+}
+
+inline rocblas_status rocsolver_geql2_geqlf(bool STRIDED,
+                                            bool GEQLF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            double* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return GEQLF ? rocsolver_dgeqlf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
+                     : rocsolver_dgeql2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+    else
+        return GEQLF ? rocsolver_dgeqlf(handle, m, n, A, lda, ipiv)
+                     : rocsolver_dgeql2(handle, m, n, A, lda, ipiv);
+}
+
+inline rocblas_status rocsolver_geql2_geqlf(bool STRIDED,
+                                            bool GEQLF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_float_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_float_complex* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return GEQLF ? rocsolver_cgeqlf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
+                     : rocsolver_cgeql2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+    else
+        return GEQLF ? rocsolver_cgeqlf(handle, m, n, A, lda, ipiv)
+                     : rocsolver_cgeql2(handle, m, n, A, lda, ipiv);
+}
+
+inline rocblas_status rocsolver_geql2_geqlf(bool STRIDED,
+                                            bool GEQLF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_double_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_double_complex* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return GEQLF ? rocsolver_zgeqlf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
+                     : rocsolver_zgeql2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+    else
+        return GEQLF ? rocsolver_zgeqlf(handle, m, n, A, lda, ipiv)
+                     : rocsolver_zgeql2(handle, m, n, A, lda, ipiv);
+}
+
+// batched
+inline rocblas_status rocsolver_geql2_geqlf(bool STRIDED,
+                                            bool GEQLF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            float* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    return GEQLF ? rocsolver_sgeqlf_batched(handle, m, n, A, lda, ipiv, stP, bc)
+                 : rocsolver_sgeql2_batched(handle, m, n, A, lda, ipiv, stP, bc);
+}
+
+inline rocblas_status rocsolver_geql2_geqlf(bool STRIDED,
+                                            bool GEQLF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            double* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    return GEQLF ? rocsolver_dgeqlf_batched(handle, m, n, A, lda, ipiv, stP, bc)
+                 : rocsolver_dgeql2_batched(handle, m, n, A, lda, ipiv, stP, bc);
+}
+
+inline rocblas_status rocsolver_geql2_geqlf(bool STRIDED,
+                                            bool GEQLF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_float_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_float_complex* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    return GEQLF ? rocsolver_cgeqlf_batched(handle, m, n, A, lda, ipiv, stP, bc)
+                 : rocsolver_cgeql2_batched(handle, m, n, A, lda, ipiv, stP, bc);
+}
+
+inline rocblas_status rocsolver_geql2_geqlf(bool STRIDED,
+                                            bool GEQLF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_double_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_double_complex* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    return GEQLF ? rocsolver_zgeqlf_batched(handle, m, n, A, lda, ipiv, stP, bc)
+                 : rocsolver_zgeql2_batched(handle, m, n, A, lda, ipiv, stP, bc);
+}
+/********************************************************/
+
+/******************** GELQ2_GELQF ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_gelq2_gelqf(bool STRIDED,
+                                            bool GELQF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            float* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return GELQF ? rocsolver_sgelqf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
+                     : rocsolver_sgelq2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+    else
+        return GELQF ? rocsolver_sgelqf(handle, m, n, A, lda, ipiv)
+                     : rocsolver_sgelq2(handle, m, n, A, lda, ipiv);
+}
+
+inline rocblas_status rocsolver_gelq2_gelqf(bool STRIDED,
+                                            bool GELQF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            double* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return GELQF ? rocsolver_dgelqf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
+                     : rocsolver_dgelq2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+    else
+        return GELQF ? rocsolver_dgelqf(handle, m, n, A, lda, ipiv)
+                     : rocsolver_dgelq2(handle, m, n, A, lda, ipiv);
+}
+
+inline rocblas_status rocsolver_gelq2_gelqf(bool STRIDED,
+                                            bool GELQF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_float_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_float_complex* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return GELQF ? rocsolver_cgelqf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
+                     : rocsolver_cgelq2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+    else
+        return GELQF ? rocsolver_cgelqf(handle, m, n, A, lda, ipiv)
+                     : rocsolver_cgelq2(handle, m, n, A, lda, ipiv);
+}
+
+inline rocblas_status rocsolver_gelq2_gelqf(bool STRIDED,
+                                            bool GELQF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_double_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_double_complex* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return GELQF ? rocsolver_zgelqf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
+                     : rocsolver_zgelq2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+    else
+        return GELQF ? rocsolver_zgelqf(handle, m, n, A, lda, ipiv)
+                     : rocsolver_zgelq2(handle, m, n, A, lda, ipiv);
+}
+
+// batched
+inline rocblas_status rocsolver_gelq2_gelqf(bool STRIDED,
+                                            bool GELQF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            float* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    return GELQF ? rocsolver_sgelqf_batched(handle, m, n, A, lda, ipiv, stP, bc)
+                 : rocsolver_sgelq2_batched(handle, m, n, A, lda, ipiv, stP, bc);
+}
+
+inline rocblas_status rocsolver_gelq2_gelqf(bool STRIDED,
+                                            bool GELQF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            double* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    return GELQF ? rocsolver_dgelqf_batched(handle, m, n, A, lda, ipiv, stP, bc)
+                 : rocsolver_dgelq2_batched(handle, m, n, A, lda, ipiv, stP, bc);
+}
+
+inline rocblas_status rocsolver_gelq2_gelqf(bool STRIDED,
+                                            bool GELQF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_float_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_float_complex* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    return GELQF ? rocsolver_cgelqf_batched(handle, m, n, A, lda, ipiv, stP, bc)
+                 : rocsolver_cgelq2_batched(handle, m, n, A, lda, ipiv, stP, bc);
+}
+
+inline rocblas_status rocsolver_gelq2_gelqf(bool STRIDED,
+                                            bool GELQF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_double_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_double_complex* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    return GELQF ? rocsolver_zgelqf_batched(handle, m, n, A, lda, ipiv, stP, bc)
+                 : rocsolver_zgelq2_batched(handle, m, n, A, lda, ipiv, stP, bc);
+}
+/********************************************************/
+
+/******************** GELS ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_gels(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_operation trans,
+                                     rocblas_int m,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     float* A,
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     float* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_sgels_strided_batched(handle, trans, m, n, nrhs, A, lda, stA, B, ldb, stB,
+                                               info, bc);
+    else
+        return rocsolver_sgels(handle, trans, m, n, nrhs, A, lda, B, ldb, info);
+}
+
+inline rocblas_status rocsolver_gels(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_operation trans,
+                                     rocblas_int m,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     double* A,
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     double* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_dgels_strided_batched(handle, trans, m, n, nrhs, A, lda, stA, B, ldb, stB,
+                                               info, bc);
+    else
+        return rocsolver_dgels(handle, trans, m, n, nrhs, A, lda, B, ldb, info);
+}
+
+inline rocblas_status rocsolver_gels(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_operation trans,
+                                     rocblas_int m,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_float_complex* A,
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_float_complex* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_cgels_strided_batched(handle, trans, m, n, nrhs, A, lda, stA, B, ldb, stB,
+                                               info, bc);
+    else
+        return rocsolver_cgels(handle, trans, m, n, nrhs, A, lda, B, ldb, info);
+}
+
+inline rocblas_status rocsolver_gels(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_operation trans,
+                                     rocblas_int m,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_double_complex* A,
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_double_complex* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_zgels_strided_batched(handle, trans, m, n, nrhs, A, lda, stA, B, ldb, stB,
+                                               info, bc);
+    else
+        return rocsolver_zgels(handle, trans, m, n, nrhs, A, lda, B, ldb, info);
+}
+
+// batched
+inline rocblas_status rocsolver_gels(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_operation trans,
+                                     rocblas_int m,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     float* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     float* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    return rocsolver_sgels_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, info, bc);
+}
+
+inline rocblas_status rocsolver_gels(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_operation trans,
+                                     rocblas_int m,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     double* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     double* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    return rocsolver_dgels_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, info, bc);
+}
+
+inline rocblas_status rocsolver_gels(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_operation trans,
+                                     rocblas_int m,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_float_complex* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_float_complex* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    return rocsolver_cgels_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, info, bc);
+}
+
+inline rocblas_status rocsolver_gels(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_operation trans,
+                                     rocblas_int m,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_double_complex* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_double_complex* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    return rocsolver_zgels_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, info, bc);
+}
+/********************************************************/
+
+/******************** GELSY ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_gelsy(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      float* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      float rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_sgelsy_strided_batched(handle, m, n, nrhs, A, lda, stA, B, ldb, stB, jpvt,
+                                                stJ, rcond, rank, bc);
+    else
+        return rocsolver_sgelsy(handle, m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank);
+}
+
+inline rocblas_status rocsolver_gelsy(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      double* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      double rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_dgelsy_strided_batched(handle, m, n, nrhs, A, lda, stA, B, ldb, stB, jpvt,
+                                                stJ, rcond, rank, bc);
+    else
+        return rocsolver_dgelsy(handle, m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank);
+}
+
+inline rocblas_status rocsolver_gelsy(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_float_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      float rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_cgelsy_strided_batched(handle, m, n, nrhs, A, lda, stA, B, ldb, stB, jpvt,
+                                                stJ, rcond, rank, bc);
+    else
+        return rocsolver_cgelsy(handle, m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank);
+}
+
+inline rocblas_status rocsolver_gelsy(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_double_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      double rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_zgelsy_strided_batched(handle, m, n, nrhs, A, lda, stA, B, ldb, stB, jpvt,
+                                                stJ, rcond, rank, bc);
+    else
+        return rocsolver_zgelsy(handle, m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank);
+}
+
+// batched
+inline rocblas_status rocsolver_gelsy(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      float* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      float rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
+{
+    return rocsolver_sgelsy_batched(handle, m, n, nrhs, A, lda, B, ldb, jpvt, stJ, rcond, rank, bc);
+}
+
+inline rocblas_status rocsolver_gelsy(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      double* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      double rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
+{
+    return rocsolver_dgelsy_batched(handle, m, n, nrhs, A, lda, B, ldb, jpvt, stJ, rcond, rank, bc);
+}
+
+inline rocblas_status rocsolver_gelsy(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_float_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_float_complex* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      float rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
+{
+    return rocsolver_cgelsy_batched(handle, m, n, nrhs, A, lda, B, ldb, jpvt, stJ, rcond, rank, bc);
+}
+
+inline rocblas_status rocsolver_gelsy(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_double_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_double_complex* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      double rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
+{
+    return rocsolver_zgelsy_batched(handle, m, n, nrhs, A, lda, B, ldb, jpvt, stJ, rcond, rank, bc);
 }
 /********************************************************/
 
-/******************** GEQL2_GEQLF ********************/
+/******************** GEBD2_GEBRD ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_geql2_geqlf(bool STRIDED,
-                                            bool GEQLF,
+inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
+                                            bool GEBRD,
                                             rocblas_handle handle,
                                             rocblas_int m,
                                             rocblas_int n,
                                             float* A,
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            float* ipiv,
+                                            float* D,
+                                            rocblas_stride stD,
+                                            float* E,
+                                            rocblas_stride stE,
+                                            float* tauq,
+                                            rocblas_stride stQ,
+                                            float* taup,
                                             rocblas_stride stP,
                                             rocblas_int bc)
 {
     if(STRIDED)
-        return GEQLF ? rocsolver_sgeqlf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
-                     : rocsolver_sgeql2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+        return GEBRD ? rocsolver_sgebrd_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
+                                                        tauq, stQ, taup, stP, bc)
+                     : rocsolver_sgebd2_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
+                                                        tauq, stQ, taup, stP, bc);
     else
-        return GEQLF ? rocsolver_sgeqlf(handle, m, n, A, lda, ipiv)
-                     : rocsolver_sgeql2(handle, m, n, A, lda, ipiv);
+        return GEBRD ? rocsolver_sgebrd(handle, m, n, A, lda, D, E, tauq, taup)
+                     : rocsolver_sgebd2(handle, m, n, A, lda, D, E, tauq, taup);
 }
 
-inline rocblas_status rocsolver_geql2_geqlf(bool STRIDED,
-                                            bool GEQLF,
+inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
+                                            bool GEBRD,
                                             rocblas_handle handle,
                                             rocblas_int m,
                                             rocblas_int n,
                                             double* A,
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            double* ipiv,
+                                            double* D,
+                                            rocblas_stride stD,
+                                            double* E,
+                                            rocblas_stride stE,
+                                            double* tauq,
+                                            rocblas_stride stQ,
+                                            double* taup,
                                             rocblas_stride stP,
                                             rocblas_int bc)
 {
     if(STRIDED)
-        return GEQLF ? rocsolver_dgeqlf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
-                     : rocsolver_dgeql2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+        return GEBRD ? rocsolver_dgebrd_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
+                                                        tauq, stQ, taup, stP, bc)
+                     : rocsolver_dgebd2_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
+                                                        tauq, stQ, taup, stP, bc);
     else
-        return GEQLF ? rocsolver_dgeqlf(handle, m, n, A, lda, ipiv)
-                     : rocsolver_dgeql2(handle, m, n, A, lda, ipiv);
+        return GEBRD ? rocsolver_dgebrd(handle, m, n, A, lda, D, E, tauq, taup)
+                     : rocsolver_dgebd2(handle, m, n, A, lda, D, E, tauq, taup);
 }
 
-inline rocblas_status rocsolver_geql2_geqlf(bool STRIDED,
-                                            bool GEQLF,
+inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
+                                            bool GEBRD,
                                             rocblas_handle handle,
                                             rocblas_int m,
                                             rocblas_int n,
                                             rocblas_float_complex* A,
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            rocblas_float_complex* ipiv,
+                                            float* D,
+                                            rocblas_stride stD,
+                                            float* E,
+                                            rocblas_stride stE,
+                                            rocblas_float_complex* tauq,
+                                            rocblas_stride stQ,
+                                            rocblas_float_complex* taup,
                                             rocblas_stride stP,
                                             rocblas_int bc)
 {
     if(STRIDED)
-        return GEQLF ? rocsolver_cgeqlf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
-                     : rocsolver_cgeql2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+        return GEBRD ? rocsolver_cgebrd_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
+                                                        tauq, stQ, taup, stP, bc)
+                     : rocsolver_cgebd2_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
+                                                        tauq, stQ, taup, stP, bc);
     else
-        return GEQLF ? rocsolver_cgeqlf(handle, m, n, A, lda, ipiv)
-                     : rocsolver_cgeql2(handle, m, n, A, lda, ipiv);
+        return GEBRD ? rocsolver_cgebrd(handle, m, n, A, lda, D, E, tauq, taup)
+                     : rocsolver_cgebd2(handle, m, n, A, lda, D, E, tauq, taup);
 }
 
-inline rocblas_status rocsolver_geql2_geqlf(bool STRIDED,
-                                            bool GEQLF,
+inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
+                                            bool GEBRD,
                                             rocblas_handle handle,
                                             rocblas_int m,
                                             rocblas_int n,
                                             rocblas_double_complex* A,
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            rocblas_double_complex* ipiv,
+                                            double* D,
+                                            rocblas_stride stD,
+                                            double* E,
+                                            rocblas_stride stE,
+                                            rocblas_double_complex* tauq,
+                                            rocblas_stride stQ,
+                                            rocblas_double_complex* taup,
                                             rocblas_stride stP,
                                             rocblas_int bc)
 {
     if(STRIDED)
-        return GEQLF ? rocsolver_zgeqlf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
-                     : rocsolver_zgeql2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+        return GEBRD ? rocsolver_zgebrd_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
+                                                        tauq, stQ, taup, stP, bc)
+                     : rocsolver_zgebd2_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
+                                                        tauq, stQ, taup, stP, bc);
     else
-        return GEQLF ? rocsolver_zgeqlf(handle, m, n, A, lda, ipiv)
-                     : rocsolver_zgeql2(handle, m, n, A, lda, ipiv);
+        return GEBRD ? rocsolver_zgebrd(handle, m, n, A, lda, D, E, tauq, taup)
+                     : rocsolver_zgebd2(handle, m, n, A, lda, D, E, tauq, taup);
 }
 
 // batched
-inline rocblas_status rocsolver_geql2_geqlf(bool STRIDED,
-                                            bool GEQLF,
+inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
+                                            bool GEBRD,
                                             rocblas_handle handle,
                                             rocblas_int m,
                                             rocblas_int n,
                                             float* const A[],
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            float* ipiv,
+                                            float* D,
+                                            rocblas_stride stD,
+                                            float* E,
+                                            rocblas_stride stE,
+                                            float* tauq,
+                                            rocblas_stride stQ,
+                                            float* taup,
                                             rocblas_stride stP,
                                             rocblas_int bc)
 {
-    return GEQLF ? rocsolver_sgeqlf_batched(handle, m, n, A, lda, ipiv, stP, bc)
-                 : rocsolver_sgeql2_batched(handle, m, n, A, lda, ipiv, stP, bc);
+    return GEBRD
+        ? rocsolver_sgebrd_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc)
+        : rocsolver_sgebd2_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc);
 }
 
-inline rocblas_status rocsolver_geql2_geqlf(bool STRIDED,
-                                            bool GEQLF,
+inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
+                                            bool GEBRD,
                                             rocblas_handle handle,
                                             rocblas_int m,
                                             rocblas_int n,
                                             double* const A[],
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            double* ipiv,
+                                            double* D,
+                                            rocblas_stride stD,
+                                            double* E,
+                                            rocblas_stride stE,
+                                            double* tauq,
+                                            rocblas_stride stQ,
+                                            double* taup,
                                             rocblas_stride stP,
                                             rocblas_int bc)
 {
-    return GEQLF ? rocsolver_dgeqlf_batched(handle, m, n, A, lda, ipiv, stP, bc)
-                 : rocsolver_dgeql2_batched(handle, m, n, A, lda, ipiv, stP, bc);
+    return GEBRD
+        ? rocsolver_dgebrd_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc)
+        : rocsolver_dgebd2_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc);
 }
 
-inline rocblas_status rocsolver_geql2_geqlf(bool STRIDED,
-                                            bool GEQLF,
+inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
+                                            bool GEBRD,
                                             rocblas_handle handle,
                                             rocblas_int m,
                                             rocblas_int n,
                                             rocblas_float_complex* const A[],
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            rocblas_float_complex* ipiv,
+                                            float* D,
+                                            rocblas_stride stD,
+                                            float* E,
+                                            rocblas_stride stE,
+                                            rocblas_float_complex* tauq,
+                                            rocblas_stride stQ,
+                                            rocblas_float_complex* taup,
                                             rocblas_stride stP,
                                             rocblas_int bc)
 {
-    return GEQLF ? rocsolver_cgeqlf_batched(handle, m, n, A, lda, ipiv, stP, bc)
-                 : rocsolver_cgeql2_batched(handle, m, n, A, lda, ipiv, stP, bc);
+    return GEBRD
+        ? rocsolver_cgebrd_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc)
+        : rocsolver_cgebd2_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc);
 }
 
-inline rocblas_status rocsolver_geql2_geqlf(bool STRIDED,
-                                            bool GEQLF,
+inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
+                                            bool GEBRD,
                                             rocblas_handle handle,
                                             rocblas_int m,
                                             rocblas_int n,
                                             rocblas_double_complex* const A[],
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            rocblas_double_complex* ipiv,
+                                            double* D,
+                                            rocblas_stride stD,
+                                            double* E,
+                                            rocblas_stride stE,
+                                            rocblas_double_complex* tauq,
+                                            rocblas_stride stQ,
+                                            rocblas_double_complex* taup,
                                             rocblas_stride stP,
                                             rocblas_int bc)
 {
-    return GEQLF ? rocsolver_zgeqlf_batched(handle, m, n, A, lda, ipiv, stP, bc)
-                 : rocsolver_zgeql2_batched(handle, m, n, A, lda, ipiv, stP, bc);
+    return GEBRD
+        ? rocsolver_zgebrd_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc)
+        : rocsolver_zgebd2_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc);
 }
 /********************************************************/
 
-/******************** GELQ2_GELQF ********************/
+/******************** SYTD2/SYTRD_HETD2/HETRD ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_gelq2_gelqf(bool STRIDED,
-                                            bool GELQF,
+inline rocblas_status rocsolver_sytxx_hetxx(bool STRIDED,
+                                            bool SYTRD,
                                             rocblas_handle handle,
-                                            rocblas_int m,
+                                            rocblas_fill uplo,
                                             rocblas_int n,
                                             float* A,
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            float* ipiv,
+                                            float* D,
+                                            rocblas_stride stD,
+                                            float* E,
+                                            rocblas_stride stE,
+                                            float* tau,
                                             rocblas_stride stP,
                                             rocblas_int bc)
 {
     if(STRIDED)
-        return GELQF ? rocsolver_sgelqf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
-                     : rocsolver_sgelq2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+        return SYTRD ? rocsolver_ssytrd_strided_batched(handle, uplo, n, A, lda, stA, D, stD, E,
+                                                        stE, tau, stP, bc)
+                     : rocsolver_ssytd2_strided_batched(handle, uplo, n, A, lda, stA, D, stD, E,
+                                                        stE, tau, stP, bc);
     else
-        return GELQF ? rocsolver_sgelqf(handle, m, n, A, lda, ipiv)
-                     : rocsolver_sgelq2(handle, m, n, A, lda, ipiv);
+        return SYTRD ? rocsolver_ssytrd(handle, uplo, n, A, lda, D, E, tau)
+                     : rocsolver_ssytd2(handle, uplo, n, A, lda, D, E, tau);
 }
 
-inline rocblas_status rocsolver_gelq2_gelqf(bool STRIDED,
-                                            bool GELQF,
+inline rocblas_status rocsolver_sytxx_hetxx(bool STRIDED,
+                                            bool SYTRD,
                                             rocblas_handle handle,
-                                            rocblas_int m,
+                                            rocblas_fill uplo,
                                             rocblas_int n,
                                             double* A,
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            double* ipiv,
+                                            double* D,
+                                            rocblas_stride stD,
+                                            double* E,
+                                            rocblas_stride stE,
+                                            double* tau,
                                             rocblas_stride stP,
                                             rocblas_int bc)
 {
     if(STRIDED)
-        return GELQF ? rocsolver_dgelqf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
-                     : rocsolver_dgelq2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+        return SYTRD ? rocsolver_dsytrd_strided_batched(handle, uplo, n, A, lda, stA, D, stD, E,
+                                                        stE, tau, stP, bc)
+                     : rocsolver_dsytd2_strided_batched(handle, uplo, n, A, lda, stA, D, stD, E,
+                                                        stE, tau, stP, bc);
     else
-        return GELQF ? rocsolver_dgelqf(handle, m, n, A, lda, ipiv)
-                     : rocsolver_dgelq2(handle, m, n, A, lda, ipiv);
+        return SYTRD ? rocsolver_dsytrd(handle, uplo, n, A, lda, D, E, tau)
+                     : rocsolver_dsytd2(handle, uplo, n, A, lda, D, E, tau);
 }
 
-inline rocblas_status rocsolver_gelq2_gelqf(bool STRIDED,
-                                            bool GELQF,
+inline rocblas_status rocsolver_sytxx_hetxx(bool STRIDED,
+                                            bool SYTRD,
                                             rocblas_handle handle,
-                                            rocblas_int m,
+                                            rocblas_fill uplo,
                                             rocblas_int n,
                                             rocblas_float_complex* A,
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            rocblas_float_complex* ipiv,
+                                            float* D,
+                                            rocblas_stride stD,
+                                            float* E,
+                                            rocblas_stride stE,
+                                            rocblas_float_complex* tau,
                                             rocblas_stride stP,
                                             rocblas_int bc)
 {
     if(STRIDED)
-        return GELQF ? rocsolver_cgelqf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
-                     : rocsolver_cgelq2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+        return SYTRD ? rocsolver_chetrd_strided_batched(handle, uplo, n, A, lda, stA, D, stD, E,
+                                                        stE, tau, stP, bc)
+                     : rocsolver_chetd2_strided_batched(handle, uplo, n, A, lda, stA, D, stD, E,
+                                                        stE, tau, stP, bc);
     else
-        return GELQF ? rocsolver_cgelqf(handle, m, n, A, lda, ipiv)
-                     : rocsolver_cgelq2(handle, m, n, A, lda, ipiv);
+        return SYTRD ? rocsolver_chetrd(handle, uplo, n, A, lda, D, E, tau)
+                     : rocsolver_chetd2(handle, uplo, n, A, lda, D, E, tau);
 }
 
-inline rocblas_status rocsolver_gelq2_gelqf(bool STRIDED,
-                                            bool GELQF,
+inline rocblas_status rocsolver_sytxx_hetxx(bool STRIDED,
+                                            bool SYTRD,
                                             rocblas_handle handle,
-                                            rocblas_int m,
+                                            rocblas_fill uplo,
                                             rocblas_int n,
                                             rocblas_double_complex* A,
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            rocblas_double_complex* ipiv,
+                                            double* D,
+                                            rocblas_stride stD,
+                                            double* E,
+                                            rocblas_stride stE,
+                                            rocblas_double_complex* tau,
                                             rocblas_stride stP,
                                             rocblas_int bc)
 {
-    if(STRIDED)
-        return GELQF ? rocsolver_zgelqf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
-                     : rocsolver_zgelq2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+    if(STRIDED)
+        return SYTRD ? rocsolver_zhetrd_strided_batched(handle, uplo, n, A, lda, stA, D, stD, E,
+                                                        stE, tau, stP, bc)
+                     : rocsolver_zhetd2_strided_batched(handle, uplo, n, A, lda, stA, D, stD, E,
+                                                        stE, tau, stP, bc);
     else
-        return GELQF ? rocsolver_zgelqf(handle, m, n, A, lda, ipiv)
-                     : rocsolver_zgelq2(handle, m, n, A, lda, ipiv);
+        return SYTRD ? rocsolver_zhetrd(handle, uplo, n, A, lda, D, E, tau)
+                     : rocsolver_zhetd2(handle, uplo, n, A, lda, D, E, tau);
 }
 
 // batched
-inline rocblas_status rocsolver_gelq2_gelqf(bool STRIDED,
-                                            bool GELQF,
+inline rocblas_status rocsolver_sytxx_hetxx(bool STRIDED,
+                                            bool SYTRD,
                                             rocblas_handle handle,
-                                            rocblas_int m,
+                                            rocblas_fill uplo,
                                             rocblas_int n,
                                             float* const A[],
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            float* ipiv,
+                                            float* D,
+                                            rocblas_stride stD,
+                                            float* E,
+                                            rocblas_stride stE,
+                                            float* tau,
                                             rocblas_stride stP,
                                             rocblas_int bc)
 {
-    return GELQF ? rocsolver_sgelqf_batched(handle, m, n, A, lda, ipiv, stP, bc)
-                 : rocsolver_sgelq2_batched(handle, m, n, A, lda, ipiv, stP, bc);
+    return SYTRD ? rocsolver_ssytrd_batched(handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, bc)
+                 : rocsolver_ssytd2_batched(handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, bc);
 }
 
-inline rocblas_status rocsolver_gelq2_gelqf(bool STRIDED,
-                                            bool GELQF,
+inline rocblas_status rocsolver_sytxx_hetxx(bool STRIDED,
+                                            bool SYTRD,
                                             rocblas_handle handle,
-                                            rocblas_int m,
+                                            rocblas_fill uplo,
                                             rocblas_int n,
                                             double* const A[],
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            double* ipiv,
+                                            double* D,
+                                            rocblas_stride stD,
+                                            double* E,
+                                            rocblas_stride stE,
+                                            double* tau,
                                             rocblas_stride stP,
                                             rocblas_int bc)
 {
-    return GELQF ? rocsolver_dgelqf_batched(handle, m, n, A, lda, ipiv, stP, bc)
-                 : rocsolver_dgelq2_batched(handle, m, n, A, lda, ipiv, stP, bc);
+    return SYTRD ? rocsolver_dsytrd_batched(handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, bc)
+                 : rocsolver_dsytd2_batched(handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, bc);
 }
 
-inline rocblas_status rocsolver_gelq2_gelqf(bool STRIDED,
-                                            bool GELQF,
+inline rocblas_status rocsolver_sytxx_hetxx(bool STRIDED,
+                                            bool SYTRD,
                                             rocblas_handle handle,
-                                            rocblas_int m,
+                                            rocblas_fill uplo,
                                             rocblas_int n,
                                             rocblas_float_complex* const A[],
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            rocblas_float_complex* ipiv,
+                                            float* D,
+                                            rocblas_stride stD,
+                                            float* E,
+                                            rocblas_stride stE,
+                                            rocblas_float_complex* tau,
                                             rocblas_stride stP,
                                             rocblas_int bc)
 {
-    return GELQF ? rocsolver_cgelqf_batched(handle, m, n, A, lda, ipiv, stP, bc)
-                 : rocsolver_cgelq2_batched(handle, m, n, A, lda, ipiv, stP, bc);
+    return SYTRD ? rocsolver_chetrd_batched(handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, bc)
+                 : rocsolver_chetd2_batched(handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, bc);
 }
 
-inline rocblas_status rocsolver_gelq2_gelqf(bool STRIDED,
-                                            bool GELQF,
+inline rocblas_status rocsolver_sytxx_hetxx(bool STRIDED,
+                                            bool SYTRD,
                                             rocblas_handle handle,
-                                            rocblas_int m,
+                                            rocblas_fill uplo,
                                             rocblas_int n,
                                             rocblas_double_complex* const A[],
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            rocblas_double_complex* ipiv,
+                                            double* D,
+                                            rocblas_stride stD,
+                                            double* E,
+                                            rocblas_stride stE,
+                                            rocblas_double_complex* tau,
                                             rocblas_stride stP,
                                             rocblas_int bc)
 {
-    return GELQF ? rocsolver_zgelqf_batched(handle, m, n, A, lda, ipiv, stP, bc)
-                 : rocsolver_zgelq2_batched(handle, m, n, A, lda, ipiv, stP, bc);
-}
-/********************************************************/
-
-/******************** GELS ********************/
-// normal and strided_batched
-inline rocblas_status rocsolver_gels(bool STRIDED,
-                                     rocblas_handle handle,
-                                     rocblas_operation trans,
-                                     rocblas_int m,
-                                     rocblas_int n,
-                                     rocblas_int nrhs,
-                                     float* A,
-                                     rocblas_int lda,
-                                     rocblas_stride stA,
-                                     float* B,
-                                     rocblas_int ldb,
-                                     rocblas_stride stB,
-                                     rocblas_int* info,
-                                     rocblas_int bc)
-{
-    if(STRIDED)
-        return rocsolver_sgels_strided_batched(handle, trans, m, n, nrhs, A, lda, stA, B, ldb, stB,
-                                               info, bc);
-    else
-        return rocsolver_sgels(handle, trans, m, n, nrhs, A, lda, B, ldb, info);
-}
-
-inline rocblas_status rocsolver_gels(bool STRIDED,
-                                     rocblas_handle handle,
-                                     rocblas_operation trans,
-                                     rocblas_int m,
-                                     rocblas_int n,
-                                     rocblas_int nrhs,
-                                     double* A,
-                                     rocblas_int lda,
-                                     rocblas_stride stA,
-                                     double* B,
-                                     rocblas_int ldb,
-                                     rocblas_stride stB,
-                                     rocblas_int* info,
-                                     rocblas_int bc)
-{
-    if(STRIDED)
-        return rocsolver_dgels_strided_batched(handle, trans, m, n, nrhs, A, lda, stA, B, ldb, stB,
-                                               info, bc);
-    else
-        return rocsolver_dgels(handle, trans, m, n, nrhs, A, lda, B, ldb, info);
-}
-
-inline rocblas_status rocsolver_gels(bool STRIDED,
-                                     rocblas_handle handle,
-                                     rocblas_operation trans,
-                                     rocblas_int m,
-                                     rocblas_int n,
-                                     rocblas_int nrhs,
-                                     rocblas_float_complex* A,
-                                     rocblas_int lda,
-                                     rocblas_stride stA,
-                                     rocblas_float_complex* B,
-                                     rocblas_int ldb,
-                                     rocblas_stride stB,
-                                     rocblas_int* info,
-                                     rocblas_int bc)
-{
-    if(STRIDED)
-        return rocsolver_cgels_strided_batched(handle, trans, m, n, nrhs, A, lda, stA, B, ldb, stB,
-                                               info, bc);
-    else
-        return rocsolver_cgels(handle, trans, m, n, nrhs, A, lda, B, ldb, info);
-}
-
-inline rocblas_status rocsolver_gels(bool STRIDED,
-                                     rocblas_handle handle,
-                                     rocblas_operation trans,
-                                     rocblas_int m,
-                                     rocblas_int n,
-                                     rocblas_int nrhs,
-                                     rocblas_double_complex* A,
-                                     rocblas_int lda,
-                                     rocblas_stride stA,
-                                     rocblas_double_complex* B,
-                                     rocblas_int ldb,
-                                     rocblas_stride stB,
-                                     rocblas_int* info,
-                                     rocblas_int bc)
-{
-    if(STRIDED)
-        return rocsolver_zgels_strided_batched(handle, trans, m, n, nrhs, A, lda, stA, B, ldb, stB,
-                                               info, bc);
-    else
-        return rocsolver_zgels(handle, trans, m, n, nrhs, A, lda, B, ldb, info);
-}
-
-// batched
-inline rocblas_status rocsolver_gels(bool STRIDED,
-                                     rocblas_handle handle,
-                                     rocblas_operation trans,
-                                     rocblas_int m,
-                                     rocblas_int n,
-                                     rocblas_int nrhs,
-                                     float* const A[],
-                                     rocblas_int lda,
-                                     rocblas_stride stA,
-                                     float* const B[],
-                                     rocblas_int ldb,
-                                     rocblas_stride stB,
-                                     rocblas_int* info,
-                                     rocblas_int bc)
-{
-    return rocsolver_sgels_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, info, bc);
-}
-
-inline rocblas_status rocsolver_gels(bool STRIDED,
-                                     rocblas_handle handle,
-                                     rocblas_operation trans,
-                                     rocblas_int m,
-                                     rocblas_int n,
-                                     rocblas_int nrhs,
-                                     double* const A[],
-                                     rocblas_int lda,
-                                     rocblas_stride stA,
-                                     double* const B[],
-                                     rocblas_int ldb,
-                                     rocblas_stride stB,
-                                     rocblas_int* info,
-                                     rocblas_int bc)
-{
-    return rocsolver_dgels_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, info, bc);
-}
-
-inline rocblas_status rocsolver_gels(bool STRIDED,
-                                     rocblas_handle handle,
-                                     rocblas_operation trans,
-                                     rocblas_int m,
-                                     rocblas_int n,
-                                     rocblas_int nrhs,
-                                     rocblas_float_complex* const A[],
-                                     rocblas_int lda,
-                                     rocblas_stride stA,
-                                     rocblas_float_complex* const B[],
-                                     rocblas_int ldb,
-                                     rocblas_stride stB,
-                                     rocblas_int* info,
-                                     rocblas_int bc)
-{
-    return rocsolver_cgels_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, info, bc);
-}
-
-inline rocblas_status rocsolver_gels(bool STRIDED,
-                                     rocblas_handle handle,
-                                     rocblas_operation trans,
-                                     rocblas_int m,
-                                     rocblas_int n,
-                                     rocblas_int nrhs,
-                                     rocblas_double_complex* const A[],
-                                     rocblas_int lda,
-                                     rocblas_stride stA,
-                                     rocblas_double_complex* const B[],
-                                     rocblas_int ldb,
-                                     rocblas_stride stB,
-                                     rocblas_int* info,
-                                     rocblas_int bc)
-{
-    return rocsolver_zgels_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, info, bc);
+    return SYTRD ? rocsolver_zhetrd_batched(handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, bc)
+                 : rocsolver_zhetd2_batched(handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, bc);
 }
 /********************************************************/
 
-/******************** GEBD2_GEBRD ********************/
+/******************** SYGS2/SYGST_HEGS2/HEGST ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
-                                            bool GEBRD,
+inline rocblas_status rocsolver_sygsx_hegsx(bool STRIDED,
+                                            bool SYGST,
                                             rocblas_handle handle,
-                                            rocblas_int m,
+                                            rocblas_eform itype,
+                                            rocblas_fill uplo,
                                             rocblas_int n,
                                             float* A,
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            float* D,
-                                            rocblas_stride stD,
-                                            float* E,
-                                            rocblas_stride stE,
-                                            float* tauq,
-                                            rocblas_stride stQ,
-                                            float* taup,
-                                            rocblas_stride stP,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* B,
+                                            rocblas_int ldb,
+                                            rocblas_stride stB,
                                             rocblas_int bc)
 {
     if(STRIDED)
-        return GEBRD ? rocsolver_sgebrd_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
-                                                        tauq, stQ, taup, stP, bc)
-                     : rocsolver_sgebd2_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
-                                                        tauq, stQ, taup, stP, bc);
+        return SYGST
+            ? rocsolver_ssygst_strided_batched(handle, itype, uplo, n, A, lda, stA, B, ldb, stB, bc)
+            : rocsolver_ssygs2_strided_batched(handle, itype, uplo, n, A, lda, stA, B, ldb, stB, bc);
     else
-        return GEBRD ? rocsolver_sgebrd(handle, m, n, A, lda, D, E, tauq, taup)
-                     : rocsolver_sgebd2(handle, m, n, A, lda, D, E, tauq, taup);
+        return SYGST ? rocsolver_ssygst(handle, itype, uplo, n, A, lda, B, ldb)
+                     : rocsolver_ssygs2(handle, itype, uplo, n, A, lda, B, ldb);
 }
 
-inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
-                                            bool GEBRD,
+inline rocblas_status rocsolver_sygsx_hegsx(bool STRIDED,
+                                            bool SYGST,
                                             rocblas_handle handle,
-                                            rocblas_int m,
+                                            rocblas_eform itype,
+                                            rocblas_fill uplo,
                                             rocblas_int n,
                                             double* A,
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            double* D,
-                                            rocblas_stride stD,
-                                            double* E,
-                                            rocblas_stride stE,
-                                            double* tauq,
-                                            rocblas_stride stQ,
-                                            double* taup,
-                                            rocblas_stride stP,
+                                            double* B,
+                                            rocblas_int ldb,
+                                            rocblas_stride stB,
                                             rocblas_int bc)
 {
     if(STRIDED)
-        return GEBRD ? rocsolver_dgebrd_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
-                                                        tauq, stQ, taup, stP, bc)
-                     : rocsolver_dgebd2_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
-                                                        tauq, stQ, taup, stP, bc);
+        return SYGST
+            ? rocsolver_dsygst_strided_batched(handle, itype, uplo, n, A, lda, stA, B, ldb, stB, bc)
+            : rocsolver_dsygs2_strided_batched(handle, itype, uplo, n, A, lda, stA, B, ldb, stB, bc);
     else
-        return GEBRD ? rocsolver_dgebrd(handle, m, n, A, lda, D, E, tauq, taup)
-                     : rocsolver_dgebd2(handle, m, n, A, lda, D, E, tauq, taup);
+        return SYGST ? rocsolver_dsygst(handle, itype, uplo, n, A, lda, B, ldb)
+                     : rocsolver_dsygs2(handle, itype, uplo, n, A, lda, B, ldb);
 }
 
-inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
-                                            bool GEBRD,
+inline rocblas_status rocsolver_sygsx_hegsx(bool STRIDED,
+                                            bool SYGST,
                                             rocblas_handle handle,
-                                            rocblas_int m,
+                                            rocblas_eform itype,
+                                            rocblas_fill uplo,
                                             rocblas_int n,
                                             rocblas_float_complex* A,
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            float* D,
-                                            rocblas_stride stD,
-                                            float* E,
-                                            rocblas_stride stE,
-                                            rocblas_float_complex* tauq,
-                                            rocblas_stride stQ,
-                                            rocblas_float_complex* taup,
-                                            rocblas_stride stP,
+                                            rocblas_float_complex* B,
+                                            rocblas_int ldb,
+                                            rocblas_stride stB,
                                             rocblas_int bc)
 {
     if(STRIDED)
-        return GEBRD ? rocsolver_cgebrd_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
-                                                        tauq, stQ, taup, stP, bc)
-                     : rocsolver_cgebd2_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
-                                                        tauq, stQ, taup, stP, bc);
+        return SYGST
+            ? rocsolver_chegst_strided_batched(handle, itype, uplo, n, A, lda, stA, B, ldb, stB, bc)
+            : rocsolver_chegs2_strided_batched(handle, itype, uplo, n, A, lda, stA, B, ldb, stB, bc);
     else
-        return GEBRD ? rocsolver_cgebrd(handle, m, n, A, lda, D, E, tauq, taup)
-                     : rocsolver_cgebd2(handle, m, n, A, lda, D, E, tauq, taup);
+        return SYGST ? rocsolver_chegst(handle, itype, uplo, n, A, lda, B, ldb)
+                     : rocsolver_chegs2(handle, itype, uplo, n, A, lda, B, ldb);
 }
 
-inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
-                                            bool GEBRD,
+inline rocblas_status rocsolver_sygsx_hegsx(bool STRIDED,
+                                            bool SYGST,
                                             rocblas_handle handle,
-                                            rocblas_int m,
+                                            rocblas_eform itype,
+                                            rocblas_fill uplo,
                                             rocblas_int n,
                                             rocblas_double_complex* A,
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            double* D,
-                                            rocblas_stride stD,
-                                            double* E,
-                                            rocblas_stride stE,
-                                            rocblas_double_complex* tauq,
-                                            rocblas_stride stQ,
-                                            rocblas_double_complex* taup,
-                                            rocblas_stride stP,
+                                            rocblas_double_complex* B,
+                                            rocblas_int ldb,
+                                            rocblas_stride stB,
                                             rocblas_int bc)
 {
     if(STRIDED)
-        return GEBRD ? rocsolver_zgebrd_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
-                                                        tauq, stQ, taup, stP, bc)
-                     : rocsolver_zgebd2_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
-                                                        tauq, stQ, taup, stP, bc);
+        return SYGST
+            ? rocsolver_zhegst_strided_batched(handle, itype, uplo, n, A, lda, stA, B, ldb, stB, bc)
+            : rocsolver_zhegs2_strided_batched(handle, itype, uplo, n, A, lda, stA, B, ldb, stB, bc);
     else
-        return GEBRD ? rocsolver_zgebrd(handle, m, n, A, lda, D, E, tauq, taup)
-                     : rocsolver_zgebd2(handle, m, n, A, lda, D, E, tauq, taup);
+        return SYGST ? rocsolver_zhegst(handle, itype, uplo, n, A, lda, B, ldb)
+                     : rocsolver_zhegs2(handle, itype, uplo, n, A, lda, B, ldb);
+}
+
+// batched
+inline rocblas_status rocsolver_sygsx_hegsx(bool STRIDED,
+                                            bool SYGST,
+                                            rocblas_handle handle,
+                                            rocblas_eform itype,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            float* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* const B[],
+                                            rocblas_int ldb,
+                                            rocblas_stride stB,
+                                            rocblas_int bc)
+{
+    return SYGST ? rocsolver_ssygst_batched(handle, itype, uplo, n, A, lda, B, ldb, bc)
+                 : rocsolver_ssygs2_batched(handle, itype, uplo, n, A, lda, B, ldb, bc);
+}
+
+inline rocblas_status rocsolver_sygsx_hegsx(bool STRIDED,
+                                            bool SYGST,
+                                            rocblas_handle handle,
+                                            rocblas_eform itype,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            double* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* const B[],
+                                            rocblas_int ldb,
+                                            rocblas_stride stB,
+                                            rocblas_int bc)
+{
+    return SYGST ? rocsolver_dsygst_batched(handle, itype, uplo, n, A, lda, B, ldb, bc)
+                 : rocsolver_dsygs2_batched(handle, itype, uplo, n, A, lda, B, ldb, bc);
+}
+
+inline rocblas_status rocsolver_sygsx_hegsx(bool STRIDED,
+                                            bool SYGST,
+                                            rocblas_handle handle,
+                                            rocblas_eform itype,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_float_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_float_complex* const B[],
+                                            rocblas_int ldb,
+                                            rocblas_stride stB,
+                                            rocblas_int bc)
+{
+    return SYGST ? rocsolver_chegst_batched(handle, itype, uplo, n, A, lda, B, ldb, bc)
+                 : rocsolver_chegs2_batched(handle, itype, uplo, n, A, lda, B, ldb, bc);
+}
+
+inline rocblas_status rocsolver_sygsx_hegsx(bool STRIDED,
+                                            bool SYGST,
+                                            rocblas_handle handle,
+                                            rocblas_eform itype,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_double_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_double_complex* const B[],
+                                            rocblas_int ldb,
+                                            rocblas_stride stB,
+                                            rocblas_int bc)
+{
+    return SYGST ? rocsolver_zhegst_batched(handle, itype, uplo, n, A, lda, B, ldb, bc)
+                 : rocsolver_zhegs2_batched(handle, itype, uplo, n, A, lda, B, ldb, bc);
+}
+/********************************************************/
+
+/******************** SYEV/HEEV ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_syev_heev(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_evect evect,
+                                          rocblas_fill uplo,
+                                          rocblas_int n,
+                                          float* A,
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          float* D,
+                                          rocblas_stride stD,
+                                          float* E,
+                                          rocblas_stride stE,
+                                          rocblas_int* info,
+                                          rocblas_int bc)
+{
+    return STRIDED ? rocsolver_ssyev_strided_batched(handle, evect, uplo, n, A, lda, stA, D, stD, E,
+                                                     stE, info, bc)
+                   : rocsolver_ssyev(handle, evect, uplo, n, A, lda, D, E, info);
+}
+
+inline rocblas_status rocsolver_syev_heev(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_evect evect,
+                                          rocblas_fill uplo,
+                                          rocblas_int n,
+                                          double* A,
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          double* D,
+                                          rocblas_stride stD,
+                                          double* E,
+                                          rocblas_stride stE,
+                                          rocblas_int* info,
+                                          rocblas_int bc)
+{
+    return STRIDED ? rocsolver_dsyev_strided_batched(handle, evect, uplo, n, A, lda, stA, D, stD, E,
+                                                     stE, info, bc)
+                   : rocsolver_dsyev(handle, evect, uplo, n, A, lda, D, E, info);
+}
+
+inline rocblas_status rocsolver_syev_heev(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_evect evect,
+                                          rocblas_fill uplo,
+                                          rocblas_int n,
+                                          rocblas_float_complex* A,
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          float* D,
+                                          rocblas_stride stD,
+                                          float* E,
+                                          rocblas_stride stE,
+                                          rocblas_int* info,
+                                          rocblas_int bc)
+{
+    return STRIDED ? rocsolver_cheev_strided_batched(handle, evect, uplo, n, A, lda, stA, D, stD, E,
+                                                     stE, info, bc)
+                   : rocsolver_cheev(handle, evect, uplo, n, A, lda, D, E, info);
+}
+
+inline rocblas_status rocsolver_syev_heev(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_evect evect,
+                                          rocblas_fill uplo,
+                                          rocblas_int n,
+                                          rocblas_double_complex* A,
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          double* D,
+                                          rocblas_stride stD,
+                                          double* E,
+                                          rocblas_stride stE,
+                                          rocblas_int* info,
+                                          rocblas_int bc)
+{
+    return STRIDED ? rocsolver_zheev_strided_batched(handle, evect, uplo, n, A, lda, stA, D, stD, E,
+                                                     stE, info, bc)
+                   : rocsolver_zheev(handle, evect, uplo, n, A, lda, D, E, info);
 }
 
 // batched
-inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
-                                            bool GEBRD,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            float* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            float* D,
-                                            rocblas_stride stD,
-                                            float* E,
-                                            rocblas_stride stE,
-                                            float* tauq,
-                                            rocblas_stride stQ,
-                                            float* taup,
-                                            rocblas_stride stP,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_syev_heev(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_evect evect,
+                                          rocblas_fill uplo,
+                                          rocblas_int n,
+                                          float* const A[],
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          float* D,
+                                          rocblas_stride stD,
+                                          float* E,
+                                          rocblas_stride stE,
+                                          rocblas_int* info,
+                                          rocblas_int bc)
 {
-    return GEBRD
-        ? rocsolver_sgebrd_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc)
-        : rocsolver_sgebd2_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc);
+    return rocsolver_ssyev_batched(handle, evect, uplo, n, A, lda, D, stD, E, stE, info, bc);
 }
 
-inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
-                                            bool GEBRD,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            double* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            double* D,
-                                            rocblas_stride stD,
-                                            double* E,
-                                            rocblas_stride stE,
-                                            double* tauq,
-                                            rocblas_stride stQ,
-                                            double* taup,
-                                            rocblas_stride stP,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_syev_heev(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_evect evect,
+                                          rocblas_fill uplo,
+                                          rocblas_int n,
+                                          double* const A[],
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          double* D,
+                                          rocblas_stride stD,
+                                          double* E,
+                                          rocblas_stride stE,
+                                          rocblas_int* info,
+                                          rocblas_int bc)
 {
-    return GEBRD
-        ? rocsolver_dgebrd_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc)
-        : rocsolver_dgebd2_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc);
+    return rocsolver_dsyev_batched(handle, evect, uplo, n, A, lda, D, stD, E, stE, info, bc);
 }
 
-inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
-                                            bool GEBRD,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            rocblas_float_complex* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            float* D,
-                                            rocblas_stride stD,
-                                            float* E,
-                                            rocblas_stride stE,
-                                            rocblas_float_complex* tauq,
-                                            rocblas_stride stQ,
-                                            rocblas_float_complex* taup,
-                                            rocblas_stride stP,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_syev_heev(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_evect evect,
+                                          rocblas_fill uplo,
+                                          rocblas_int n,
+                                          rocblas_float_complex* const A[],
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          float* D,
+                                          rocblas_stride stD,
+                                          float* E,
+                                          rocblas_stride stE,
+                                          rocblas_int* info,
+                                          rocblas_int bc)
 {
-    return GEBRD
-        ? rocsolver_cgebrd_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc)
-        : rocsolver_cgebd2_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc);
+    return rocsolver_cheev_batched(handle, evect, uplo, n, A, lda, D, stD, E, stE, info, bc);
 }
 
-inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
-                                            bool GEBRD,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            rocblas_double_complex* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            double* D,
-                                            rocblas_stride stD,
-                                            double* E,
-                                            rocblas_stride stE,
-                                            rocblas_double_complex* tauq,
-                                            rocblas_stride stQ,
-                                            rocblas_double_complex* taup,
-                                            rocblas_stride stP,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_syev_heev(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_evect evect,
+                                          rocblas_fill uplo,
+                                          rocblas_int n,
+                                          rocblas_double_complex* const A[],
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          double* D,
+                                          rocblas_stride stD,
+                                          double* E,
+                                          rocblas_stride stE,
+                                          rocblas_int* info,
+                                          rocblas_int bc)
 {
-    return GEBRD
-        ? rocsolver_zgebrd_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc)
-        : rocsolver_zgebd2_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc);
+    return rocsolver_zheev_batched(handle, evect, uplo, n, A, lda, D, stD, E, stE, info, bc);
 }
 /********************************************************/
 
-/******************** SYTD2/SYTRD_HETD2/HETRD ********************/
+/******************** SYEVD/HEEVD ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_sytxx_hetxx(bool STRIDED,
-                                            bool SYTRD,
+inline rocblas_status rocsolver_syevd_heevd(bool STRIDED,
                                             rocblas_handle handle,
+                                            rocblas_evect evect,
                                             rocblas_fill uplo,
                                             rocblas_int n,
                                             float* A,
@@ -3327,23 +4983,17 @@ inline rocblas_status rocsolver_sytxx_hetxx(bool STRIDED,
                                             rocblas_stride stD,
                                             float* E,
                                             rocblas_stride stE,
-                                            float* tau,
-                                            rocblas_stride stP,
+                                            rocblas_int* info,
                                             rocblas_int bc)
 {
-    if(STRIDED)
-        return SYTRD ? rocsolver_ssytrd_strided_batched(handle, uplo, n, A, lda, stA, D, stD, E,
-                                                        stE, tau, stP, bc)
-                     : rocsolver_ssytd2_strided_batched(handle, uplo, n, A, lda, stA, D, stD, E,
-                                                        stE, tau, stP, bc);
-    else
-        return SYTRD ? rocsolver_ssytrd(handle, uplo, n, A, lda, D, E, tau)
-                     : rocsolver_ssytd2(handle, uplo, n, A, lda, D, E, tau);
+    return STRIDED ? rocsolver_ssyevd_strided_batched(handle, evect, uplo, n, A, lda, stA, D, stD,
+                                                      E, stE, info, bc)
+                   : rocsolver_ssyevd(handle, evect, uplo, n, A, lda, D, E, info);
 }
 
-inline rocblas_status rocsolver_sytxx_hetxx(bool STRIDED,
-                                            bool SYTRD,
+inline rocblas_status rocsolver_syevd_heevd(bool STRIDED,
                                             rocblas_handle handle,
+                                            rocblas_evect evect,
                                             rocblas_fill uplo,
                                             rocblas_int n,
                                             double* A,
@@ -3353,23 +5003,17 @@ inline rocblas_status rocsolver_sytxx_hetxx(bool STRIDED,
                                             rocblas_stride stD,
                                             double* E,
                                             rocblas_stride stE,
-                                            double* tau,
-                                            rocblas_stride stP,
+                                            rocblas_int* info,
                                             rocblas_int bc)
 {
-    if(STRIDED)
-        return SYTRD ? rocsolver_dsytrd_strided_batched(handle, uplo, n, A, lda, stA, D, stD, E,
-                                                        stE, tau, stP, bc)
-                     : rocsolver_dsytd2_strided_batched(handle, uplo, n, A, lda, stA, D, stD, E,
-                                                        stE, tau, stP, bc);
-    else
-        return SYTRD ? rocsolver_dsytrd(handle, uplo, n, A, lda, D, E, tau)
-                     : rocsolver_dsytd2(handle, uplo, n, A, lda, D, E, tau);
+    return STRIDED ? rocsolver_dsyevd_strided_batched(handle, evect, uplo, n, A, lda, stA, D, stD,
+                                                      E, stE, info, bc)
+                   : rocsolver_dsyevd(handle, evect, uplo, n, A, lda, D, E, info);
 }
 
-inline rocblas_status rocsolver_sytxx_hetxx(bool STRIDED,
-                                            bool SYTRD,
+inline rocblas_status rocsolver_syevd_heevd(bool STRIDED,
                                             rocblas_handle handle,
+                                            rocblas_evect evect,
                                             rocblas_fill uplo,
                                             rocblas_int n,
                                             rocblas_float_complex* A,
@@ -3379,23 +5023,17 @@ inline rocblas_status rocsolver_sytxx_hetxx(bool STRIDED,
                                             rocblas_stride stD,
                                             float* E,
                                             rocblas_stride stE,
-                                            rocblas_float_complex* tau,
-                                            rocblas_stride stP,
+                                            rocblas_int* info,
                                             rocblas_int bc)
 {
-    if(STRIDED)
-        return SYTRD ? rocsolver_chetrd_strided_batched(handle, uplo, n, A, lda, stA, D, stD, E,
-                                                        stE, tau, stP, bc)
-                     : rocsolver_chetd2_strided_batched(handle, uplo, n, A, lda, stA, D, stD, E,
-                                                        stE, tau, stP, bc);
-    else
-        return SYTRD ? rocsolver_chetrd(handle, uplo, n, A, lda, D, E, tau)
-                     : rocsolver_chetd2(handle, uplo, n, A, lda, D, E, tau);
+    return STRIDED ? rocsolver_cheevd_strided_batched(handle, evect, uplo, n, A, lda, stA, D, stD,
+                                                      E, stE, info, bc)
+                   : rocsolver_cheevd(handle, evect, uplo, n, A, lda, D, E, info);
 }
 
-inline rocblas_status rocsolver_sytxx_hetxx(bool STRIDED,
-                                            bool SYTRD,
+inline rocblas_status rocsolver_syevd_heevd(bool STRIDED,
                                             rocblas_handle handle,
+                                            rocblas_evect evect,
                                             rocblas_fill uplo,
                                             rocblas_int n,
                                             rocblas_double_complex* A,
@@ -3405,24 +5043,18 @@ inline rocblas_status rocsolver_sytxx_hetxx(bool STRIDED,
                                             rocblas_stride stD,
                                             double* E,
                                             rocblas_stride stE,
-                                            rocblas_double_complex* tau,
-                                            rocblas_stride stP,
+                                            rocblas_int* info,
                                             rocblas_int bc)
 {
-    if(STRIDED)
-        return SYTRD ? rocsolver_zhetrd_strided_batched(handle, uplo, n, A, lda, stA, D, stD, E,
-                                                        stE, tau, stP, bc)
-                     : rocsolver_zhetd2_strided_batched(handle, uplo, n, A, lda, stA, D, stD, E,
-                                                        stE, tau, stP, bc);
-    else
-        return SYTRD ? rocsolver_zhetrd(handle, uplo, n, A, lda, D, E, tau)
-                     : rocsolver_zhetd2(handle, uplo, n, A, lda, D, E, tau);
+    return STRIDED ? rocsolver_zheevd_strided_batched(handle, evect, uplo, n, A, lda, stA, D, stD,
+                                                      E, stE, info, bc)
+                   : rocsolver_zheevd(handle, evect, uplo, n, A, lda, D, E, info);
 }
 
 // batched
-inline rocblas_status rocsolver_sytxx_hetxx(bool STRIDED,
-                                            bool SYTRD,
+inline rocblas_status rocsolver_syevd_heevd(bool STRIDED,
                                             rocblas_handle handle,
+                                            rocblas_evect evect,
                                             rocblas_fill uplo,
                                             rocblas_int n,
                                             float* const A[],
@@ -3432,17 +5064,15 @@ inline rocblas_status rocsolver_sytxx_hetxx(bool STRIDED,
                                             rocblas_stride stD,
                                             float* E,
                                             rocblas_stride stE,
-                                            float* tau,
-                                            rocblas_stride stP,
+                                            rocblas_int* info,
                                             rocblas_int bc)
 {
-    return SYTRD ? rocsolver_ssytrd_batched(handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, bc)
-                 : rocsolver_ssytd2_batched(handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, bc);
+    return rocsolver_ssyevd_batched(handle, evect, uplo, n, A, lda, D, stD, E, stE, info, bc);
 }
 
-inline rocblas_status rocsolver_sytxx_hetxx(bool STRIDED,
-                                            bool SYTRD,
+inline rocblas_status rocsolver_syevd_heevd(bool STRIDED,
                                             rocblas_handle handle,
+                                            rocblas_evect evect,
                                             rocblas_fill uplo,
                                             rocblas_int n,
                                             double* const A[],
@@ -3452,17 +5082,15 @@ inline rocblas_status rocsolver_sytxx_hetxx(bool STRIDED,
                                             rocblas_stride stD,
                                             double* E,
                                             rocblas_stride stE,
-                                            double* tau,
-                                            rocblas_stride stP,
+                                            rocblas_int* info,
                                             rocblas_int bc)
 {
-    return SYTRD ? rocsolver_dsytrd_batched(handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, bc)
-                 : rocsolver_dsytd2_batched(handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, bc);
+    return rocsolver_dsyevd_batched(handle, evect, uplo, n, A, lda, D, stD, E, stE, info, bc);
 }
 
-inline rocblas_status rocsolver_sytxx_hetxx(bool STRIDED,
-                                            bool SYTRD,
+inline rocblas_status rocsolver_syevd_heevd(bool STRIDED,
                                             rocblas_handle handle,
+                                            rocblas_evect evect,
                                             rocblas_fill uplo,
                                             rocblas_int n,
                                             rocblas_float_complex* const A[],
@@ -3472,17 +5100,15 @@ inline rocblas_status rocsolver_sytxx_hetxx(bool STRIDED,
                                             rocblas_stride stD,
                                             float* E,
                                             rocblas_stride stE,
-                                            rocblas_float_complex* tau,
-                                            rocblas_stride stP,
+                                            rocblas_int* info,
                                             rocblas_int bc)
 {
-    return SYTRD ? rocsolver_chetrd_batched(handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, bc)
-                 : rocsolver_chetd2_batched(handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, bc);
+    return rocsolver_cheevd_batched(handle, evect, uplo, n, A, lda, D, stD, E, stE, info, bc);
 }
 
-inline rocblas_status rocsolver_sytxx_hetxx(bool STRIDED,
-                                            bool SYTRD,
+inline rocblas_status rocsolver_syevd_heevd(bool STRIDED,
                                             rocblas_handle handle,
+                                            rocblas_evect evect,
                                             rocblas_fill uplo,
                                             rocblas_int n,
                                             rocblas_double_complex* const A[],
@@ -3492,336 +5118,442 @@ inline rocblas_status rocsolver_sytxx_hetxx(bool STRIDED,
                                             rocblas_stride stD,
                                             double* E,
                                             rocblas_stride stE,
-                                            rocblas_double_complex* tau,
-                                            rocblas_stride stP,
+                                            rocblas_int* info,
                                             rocblas_int bc)
 {
-    return SYTRD ? rocsolver_zhetrd_batched(handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, bc)
-                 : rocsolver_zhetd2_batched(handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, bc);
+    return rocsolver_zheevd_batched(handle, evect, uplo, n, A, lda, D, stD, E, stE, info, bc);
 }
 /********************************************************/
 
-/******************** SYGS2/SYGST_HEGS2/HEGST ********************/
+/******************** SYEVX/HEEVX ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_sygsx_hegsx(bool STRIDED,
-                                            bool SYGST,
+inline rocblas_status rocsolver_syevx_heevx(bool STRIDED,
                                             rocblas_handle handle,
-                                            rocblas_eform itype,
+                                            rocblas_evect evect,
+                                            rocblas_erange erange,
                                             rocblas_fill uplo,
                                             rocblas_int n,
                                             float* A,
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            float* B,
-                                            rocblas_int ldb,
-                                            rocblas_stride stB,
+                                            float vl,
+                                            float vu,
+                                            rocblas_int il,
+                                            rocblas_int iu,
+                                            float abstol,
+                                            rocblas_int* nev,
+                                            float* W,
+                                            rocblas_stride stW,
+                                            float* Z,
+                                            rocblas_int ldz,
+                                            rocblas_stride stZ,
+                                            rocblas_int* ifail,
+                                            rocblas_stride stF,
+                                            rocblas_int* info,
                                             rocblas_int bc)
 {
-    if(STRIDED)
-        return SYGST
-            ? rocsolver_ssygst_strided_batched(handle, itype, uplo, n, A, lda, stA, B, ldb, stB, bc)
-            : rocsolver_ssygs2_strided_batched(handle, itype, uplo, n, A, lda, stA, B, ldb, stB, bc);
-    else
-        return SYGST ? rocsolver_ssygst(handle, itype, uplo, n, A, lda, B, ldb)
-                     : rocsolver_ssygs2(handle, itype, uplo, n, A, lda, B, ldb);
+    return STRIDED ? rocsolver_ssyevx_strided_batched(handle, evect, erange, uplo, n, A, lda, stA,
+                                                      vl, vu, il, iu, abstol, nev, W, stW, Z, ldz,
+                                                      stZ, ifail, stF, info, bc)
+                   : rocsolver_ssyevx(handle, evect, erange, uplo, n, A, lda, vl, vu, il, iu,
+                                      abstol, nev, W, Z, ldz, ifail, info);
 }
 
-inline rocblas_status rocsolver_sygsx_hegsx(bool STRIDED,
-                                            bool SYGST,
+inline rocblas_status rocsolver_syevx_heevx(bool STRIDED,
                                             rocblas_handle handle,
-                                            rocblas_eform itype,
+                                            rocblas_evect evect,
+                                            rocblas_erange erange,
                                             rocblas_fill uplo,
                                             rocblas_int n,
                                             double* A,
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            double* B,
-                                            rocblas_int ldb,
-                                            rocblas_stride stB,
+                                            double vl,
+                                            double vu,
+                                            rocblas_int il,
+                                            rocblas_int iu,
+                                            double abstol,
+                                            rocblas_int* nev,
+                                            double* W,
+                                            rocblas_stride stW,
+                                            double* Z,
+                                            rocblas_int ldz,
+                                            rocblas_stride stZ,
+                                            rocblas_int* ifail,
+                                            rocblas_stride stF,
+                                            rocblas_int* info,
                                             rocblas_int bc)
 {
-    if(STRIDED)
-        return SYGST
-            ? rocsolver_dsygst_strided_batched(handle, itype, uplo, n, A, lda, stA, B, ldb, stB, bc)
-            : rocsolver_dsygs2_strided_batched(handle, itype, uplo, n, A, lda, stA, B, ldb, stB, bc);
-    else
-        return SYGST ? rocsolver_dsygst(handle, itype, uplo, n, A, lda, B, ldb)
-                     : rocsolver_dsygs2(handle, itype, uplo, n, A, lda, B, ldb);
+    return STRIDED ? rocsolver_dsyevx_strided_batched(handle, evect, erange, uplo, n, A, lda, stA,
+                                                      vl, vu, il, iu, abstol, nev, W, stW, Z, ldz,
+                                                      stZ, ifail, stF, info, bc)
+                   : rocsolver_dsyevx(handle, evect, erange, uplo, n, A, lda, vl, vu, il, iu,
+                                      abstol, nev, W, Z, ldz, ifail, info);
 }
-
-inline rocblas_status rocsolver_sygsx_hegsx(bool STRIDED,
-                                            bool SYGST,
+
+inline rocblas_status rocsolver_syevx_heevx(bool STRIDED,
                                             rocblas_handle handle,
-                                            rocblas_eform itype,
+                                            rocblas_evect evect,
+                                            rocblas_erange erange,
                                             rocblas_fill uplo,
                                             rocblas_int n,
                                             rocblas_float_complex* A,
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            rocblas_float_complex* B,
-                                            rocblas_int ldb,
-                                            rocblas_stride stB,
+                                            float vl,
+                                            float vu,
+                                            rocblas_int il,
+                                            rocblas_int iu,
+                                            float abstol,
+                                            rocblas_int* nev,
+                                            float* W,
+                                            rocblas_stride stW,
+                                            rocblas_float_complex* Z,
+                                            rocblas_int ldz,
+                                            rocblas_stride stZ,
+                                            rocblas_int* ifail,
+                                            rocblas_stride stF,
+                                            rocblas_int* info,
                                             rocblas_int bc)
 {
-    if(STRIDED)
-        return SYGST
-            ? rocsolver_chegst_strided_batched(handle, itype, uplo, n, A, lda, stA, B, ldb, stB, bc)
-            : rocsolver_chegs2_strided_batched(handle, itype, uplo, n, A, lda, stA, B, ldb, stB, bc);
-    else
-        return SYGST ? rocsolver_chegst(handle, itype, uplo, n, A, lda, B, ldb)
-                     : rocsolver_chegs2(handle, itype, uplo, n, A, lda, B, ldb);
+    return STRIDED ? rocsolver_cheevx_strided_batched(handle, evect, erange, uplo, n, A, lda, stA,
+                                                      vl, vu, il, iu, abstol, nev, W, stW, Z, ldz,
+                                                      stZ, ifail, stF, info, bc)
+                   : rocsolver_cheevx(handle, evect, erange, uplo, n, A, lda, vl, vu, il, iu,
+                                      abstol, nev, W, Z, ldz, ifail, info);
 }
 
-inline rocblas_status rocsolver_sygsx_hegsx(bool STRIDED,
-                                            bool SYGST,
+inline rocblas_status rocsolver_syevx_heevx(bool STRIDED,
                                             rocblas_handle handle,
-                                            rocblas_eform itype,
+                                            rocblas_evect evect,
+                                            rocblas_erange erange,
                                             rocblas_fill uplo,
                                             rocblas_int n,
                                             rocblas_double_complex* A,
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            rocblas_double_complex* B,
-                                            rocblas_int ldb,
-                                            rocblas_stride stB,
+                                            double vl,
+                                            double vu,
+                                            rocblas_int il,
+                                            rocblas_int iu,
+                                            double abstol,
+                                            rocblas_int* nev,
+                                            double* W,
+                                            rocblas_stride stW,
+                                            rocblas_double_complex* Z,
+                                            rocblas_int ldz,
+                                            rocblas_stride stZ,
+                                            rocblas_int* ifail,
+                                            rocblas_stride stF,
+                                            rocblas_int* info,
                                             rocblas_int bc)
 {
-    if(STRIDED)
-        return SYGST
-            ? rocsolver_zhegst_strided_batched(handle, itype, uplo, n, A, lda, stA, B, ldb, stB, bc)
-            : rocsolver_zhegs2_strided_batched(handle, itype, uplo, n, A, lda, stA, B, ldb, stB, bc);
-    else
-        return SYGST ? rocsolver_zhegst(handle, itype, uplo, n, A, lda, B, ldb)
-                     : rocsolver_zhegs2(handle, itype, uplo, n, A, lda, B, ldb);
+    return STRIDED ? rocsolver_zheevx_strided_batched(handle, evect, erange, uplo, n, A, lda, stA,
+                                                      vl, vu, il, iu, abstol, nev, W, stW, Z, ldz,
+                                                      stZ, ifail, stF, info, bc)
+                   : rocsolver_zheevx(handle, evect, erange, uplo, n, A, lda, vl, vu, il, iu,
+                                      abstol, nev, W, Z, ldz, ifail, info);
 }
 
 // batched
-inline rocblas_status rocsolver_sygsx_hegsx(bool STRIDED,
-                                            bool SYGST,
+inline rocblas_status rocsolver_syevx_heevx(bool STRIDED,
                                             rocblas_handle handle,
-                                            rocblas_eform itype,
+                                            rocblas_evect evect,
+                                            rocblas_erange erange,
                                             rocblas_fill uplo,
                                             rocblas_int n,
                                             float* const A[],
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            float* const B[],
-                                            rocblas_int ldb,
-                                            rocblas_stride stB,
+                                            float vl,
+                                            float vu,
+                                            rocblas_int il,
+                                            rocblas_int iu,
+                                            float abstol,
+                                            rocblas_int* nev,
+                                            float* W,
+                                            rocblas_stride stW,
+                                            float* const Z[],
+                                            rocblas_int ldz,
+                                            rocblas_stride stZ,
+                                            rocblas_int* ifail,
+                                            rocblas_stride stF,
+                                            rocblas_int* info,
                                             rocblas_int bc)
 {
-    return SYGST ? rocsolver_ssygst_batched(handle, itype, uplo, n, A, lda, B, ldb, bc)
-                 : rocsolver_ssygs2_batched(handle, itype, uplo, n, A, lda, B, ldb, bc);
+    return rocsolver_ssyevx_batched(handle, evect, erange, uplo, n, A, lda, vl, vu, il, iu, abstol,
+                                    nev, W, stW, Z, ldz, ifail, stF, info, bc);
 }
 
-inline rocblas_status rocsolver_sygsx_hegsx(bool STRIDED,
-                                            bool SYGST,
+inline rocblas_status rocsolver_syevx_heevx(bool STRIDED,
                                             rocblas_handle handle,
-                                            rocblas_eform itype,
+                                            rocblas_evect evect,
+                                            rocblas_erange erange,
                                             rocblas_fill uplo,
                                             rocblas_int n,
                                             double* const A[],
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            double* const B[],
-                                            rocblas_int ldb,
-                                            rocblas_stride stB,
+                                            double vl,
+                                            double vu,
+                                            rocblas_int il,
+                                            rocblas_int iu,
+                                            double abstol,
+                                            rocblas_int* nev,
+                                            double* W,
+                                            rocblas_stride stW,
+                                            double* const Z[],
+                                            rocblas_int ldz,
+                                            rocblas_stride stZ,
+                                            rocblas_int* ifail,
+                                            rocblas_stride stF,
+                                            rocblas_int* info,
                                             rocblas_int bc)
 {
-    return SYGST ? rocsolver_dsygst_batched(handle, itype, uplo, n, A, lda, B, ldb, bc)
-                 : rocsolver_dsygs2_batched(handle, itype, uplo, n, A, lda, B, ldb, bc);
+    return rocsolver_dsyevx_batched(handle, evect, erange, uplo, n, A, lda, vl, vu, il, iu, abstol,
+                                    nev, W, stW, Z, ldz, ifail, stF, info, bc);
 }
 
-inline rocblas_status rocsolver_sygsx_hegsx(bool STRIDED,
-                                            bool SYGST,
+inline rocblas_status rocsolver_syevx_heevx(bool STRIDED,
                                             rocblas_handle handle,
-                                            rocblas_eform itype,
+                                            rocblas_evect evect,
+                                            rocblas_erange erange,
                                             rocblas_fill uplo,
                                             rocblas_int n,
                                             rocblas_float_complex* const A[],
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            rocblas_float_complex* const B[],
-                                            rocblas_int ldb,
-                                            rocblas_stride stB,
+                                            float vl,
+                                            float vu,
+                                            rocblas_int il,
+                                            rocblas_int iu,
+                                            float abstol,
+                                            rocblas_int* nev,
+                                            float* W,
+                                            rocblas_stride stW,
+                                            rocblas_float_complex* const Z[],
+                                            rocblas_int ldz,
+                                            rocblas_stride stZ,
+                                            rocblas_int* ifail,
+                                            rocblas_stride stF,
+                                            rocblas_int* info,
                                             rocblas_int bc)
 {
-    return SYGST ? rocsolver_chegst_batched(handle, itype, uplo, n, A, lda, B, ldb, bc)
-                 : rocsolver_chegs2_batched(handle, itype, uplo, n, A, lda, B, ldb, bc);
+    return rocsolver_cheevx_batched(handle, evect, erange, uplo, n, A, lda, vl, vu, il, iu, abstol,
+                                    nev, W, stW, Z, ldz, ifail, stF, info, bc);
 }
 
-inline rocblas_status rocsolver_sygsx_hegsx(bool STRIDED,
-                                            bool SYGST,
+inline rocblas_status rocsolver_syevx_heevx(bool STRIDED,
                                             rocblas_handle handle,
-                                            rocblas_eform itype,
+                                            rocblas_evect evect,
+                                            rocblas_erange erange,
                                             rocblas_fill uplo,
                                             rocblas_int n,
                                             rocblas_double_complex* const A[],
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            rocblas_double_complex* const B[],
-                                            rocblas_int ldb,
-                                            rocblas_stride stB,
+                                            double vl,
+                                            double vu,
+                                            rocblas_int il,
+                                            rocblas_int iu,
+                                            double abstol,
+                                            rocblas_int* nev,
+                                            double* W,
+                                            rocblas_stride stW,
+                                            rocblas_double_complex* const Z[],
+                                            rocblas_int ldz,
+                                            rocblas_stride stZ,
+                                            rocblas_int* ifail,
+                                            rocblas_stride stF,
+                                            rocblas_int* info,
                                             rocblas_int bc)
 {
-    return SYGST ? rocsolver_zhegst_batched(handle, itype, uplo, n, A, lda, B, ldb, bc)
-                 : rocsolver_zhegs2_batched(handle, itype, uplo, n, A, lda, B, ldb, bc);
+    return rocsolver_zheevx_batched(handle, evect, erange, uplo, n, A, lda, vl, vu, il, iu, abstol,
+                                    nev, W, stW, Z, ldz, ifail, stF, info, bc);
 }
 /********************************************************/
 
-/******************** SYEV/HEEV ********************/
+/******************** SYEVJ/HEEVJ ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_syev_heev(bool STRIDED,
-                                          rocblas_handle handle,
-                                          rocblas_evect evect,
-                                          rocblas_fill uplo,
-                                          rocblas_int n,
-                                          float* A,
-                                          rocblas_int lda,
-                                          rocblas_stride stA,
-                                          float* D,
-                                          rocblas_stride stD,
-                                          float* E,
-                                          rocblas_stride stE,
-                                          rocblas_int* info,
-                                          rocblas_int bc)
+inline rocblas_status rocsolver_syevj_heevj(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_evect evect,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            float* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float abstol,
+                                            float* residual,
+                                            rocblas_int max_sweeps,
+                                            rocblas_int* n_sweeps,
+                                            float* W,
+                                            rocblas_stride stW,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
 {
-    return STRIDED ? rocsolver_ssyev_strided_batched(handle, evect, uplo, n, A, lda, stA, D, stD, E,
-                                                     stE, info, bc)
-                   : rocsolver_ssyev(handle, evect, uplo, n, A, lda, D, E, info);
+    return STRIDED ? rocsolver_ssyevj_strided_batched(handle, evect, uplo, n, A, lda, stA, abstol,
+                                                      residual, max_sweeps, n_sweeps, W, stW, info,
+                                                      bc)
+                   : rocsolver_ssyevj(handle, evect, uplo, n, A, lda, abstol, residual, max_sweeps,
+                                      n_sweeps, W, info);
 }
 
-inline rocblas_status rocsolver_syev_heev(bool STRIDED,
-                                          rocblas_handle handle,
-                                          rocblas_evect evect,
-                                          rocblas_fill uplo,
-                                          rocblas_int n,
-                                          double* A,
-                                          rocblas_int lda,
-                                          rocblas_stride stA,
-                                          double* D,
-                                          rocblas_stride stD,
-                                          double* E,
-                                          rocblas_stride stE,
-                                          rocblas_int* info,
-                                          rocblas_int bc)
+inline rocblas_status rocsolver_syevj_heevj(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_evect evect,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            double* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double abstol,
+                                            double* residual,
+                                            rocblas_int max_sweeps,
+                                            rocblas_int* n_sweeps,
+                                            double* W,
+                                            rocblas_stride stW,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
 {
-    return STRIDED ? rocsolver_dsyev_strided_batched(handle, evect, uplo, n, A, lda, stA, D, stD, E,
-                                                     stE, info, bc)
-                   : rocsolver_dsyev(handle, evect, uplo, n, A, lda, D, E, info);
+    return STRIDED ? rocsolver_dsyevj_strided_batched(handle, evect, uplo, n, A, lda, stA, abstol,
+                                                      residual, max_sweeps, n_sweeps, W, stW, info,
+                                                      bc)
+                   : rocsolver_dsyevj(handle, evect, uplo, n, A, lda, abstol, residual, max_sweeps,
+                                      n_sweeps, W, info);
 }
 
-inline rocblas_status rocsolver_syev_heev(bool STRIDED,
-                                          rocblas_handle handle,
-                                          rocblas_evect evect,
-                                          rocblas_fill uplo,
-                                          rocblas_int n,
-                                          rocblas_float_complex* A,
-                                          rocblas_int lda,
-                                          rocblas_stride stA,
-                                          float* D,
-                                          rocblas_stride stD,
-                                          float* E,
-                                          rocblas_stride stE,
-                                          rocblas_int* info,
-                                          rocblas_int bc)
+inline rocblas_status rocsolver_syevj_heevj(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_evect evect,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_float_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float abstol,
+                                            float* residual,
+                                            rocblas_int max_sweeps,
+                                            rocblas_int* n_sweeps,
+                                            float* W,
+                                            rocblas_stride stW,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
 {
-    return STRIDED ? rocsolver_cheev_strided_batched(handle, evect, uplo, n, A, lda, stA, D, stD, E,
-                                                     stE, info, bc)
-                   : rocsolver_cheev(handle, evect, uplo, n, A, lda, D, E, info);
+    return STRIDED ? rocsolver_cheevj_strided_batched(handle, evect, uplo, n, A, lda, stA, abstol,
+                                                      residual, max_sweeps, n_sweeps, W, stW, info,
+                                                      bc)
+                   : rocsolver_cheevj(handle, evect, uplo, n, A, lda, abstol, residual, max_sweeps,
+                                      n_sweeps, W, info);
 }
 
-inline rocblas_status rocsolver_syev_heev(bool STRIDED,
-                                          rocblas_handle handle,
-                                          rocblas_evect evect,
-                                          rocblas_fill uplo,
-                                          rocblas_int n,
-                                          rocblas_double_complex* A,
-                                          rocblas_int lda,
-                                          rocblas_stride stA,
-                                          double* D,
-                                          rocblas_stride stD,
-                                          double* E,
-                                          rocblas_stride stE,
-                                          rocblas_int* info,
-                                          rocblas_int bc)
+inline rocblas_status rocsolver_syevj_heevj(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_evect evect,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_double_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double abstol,
+                                            double* residual,
+                                            rocblas_int max_sweeps,
+                                            rocblas_int* n_sweeps,
+                                            double* W,
+                                            rocblas_stride stW,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
 {
-    return STRIDED ? rocsolver_zheev_strided_batched(handle, evect, uplo, n, A, lda, stA, D, stD, E,
-                                                     stE, info, bc)
-                   : rocsolver_zheev(handle, evect, uplo, n, A, lda, D, E, info);
+    return STRIDED ? rocsolver_zheevj_strided_batched(handle, evect, uplo, n, A, lda, stA, abstol,
+                                                      residual, max_sweeps, n_sweeps, W, stW, info,
+                                                      bc)
+                   : rocsolver_zheevj(handle, evect, uplo, n, A, lda, abstol, residual, max_sweeps,
+                                      n_sweeps, W, info);
 }
 
 // batched
-inline rocblas_status rocsolver_syev_heev(bool STRIDED,
-                                          rocblas_handle handle,
-                                          rocblas_evect evect,
-                                          rocblas_fill uplo,
-                                          rocblas_int n,
-                                          float* const A[],
-                                          rocblas_int lda,
-                                          rocblas_stride stA,
-                                          float* D,
-                                          rocblas_stride stD,
-                                          float* E,
-                                          rocblas_stride stE,
-                                          rocblas_int* info,
-                                          rocblas_int bc)
+inline rocblas_status rocsolver_syevj_heevj(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_evect evect,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            float* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float abstol,
+                                            float* residual,
+                                            rocblas_int max_sweeps,
+                                            rocblas_int* n_sweeps,
+                                            float* W,
+                                            rocblas_stride stW,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
 {
-    return rocsolver_ssyev_batched(handle, evect, uplo, n, A, lda, D, stD, E, stE, info, bc);
+    return rocsolver_ssyevj_batched(handle, evect, uplo, n, A, lda, abstol, residual, max_sweeps,
+                                    n_sweeps, W, stW, info, bc);
 }
 
-inline rocblas_status rocsolver_syev_heev(bool STRIDED,
-                                          rocblas_handle handle,
-                                          rocblas_evect evect,
-                                          rocblas_fill uplo,
-                                          rocblas_int n,
-                                          double* const A[],
-                                          rocblas_int lda,
-                                          rocblas_stride stA,
-                                          double* D,
-                                          rocblas_stride stD,
-                                          double* E,
-                                          rocblas_stride stE,
-                                          rocblas_int* info,
-                                          rocblas_int bc)
+inline rocblas_status rocsolver_syevj_heevj(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_evect evect,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            double* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double abstol,
+                                            double* residual,
+                                            rocblas_int max_sweeps,
+                                            rocblas_int* n_sweeps,
+                                            double* W,
+                                            rocblas_stride stW,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
 {
-    return rocsolver_dsyev_batched(handle, evect, uplo, n, A, lda, D, stD, E, stE, info, bc);
+    return rocsolver_dsyevj_batched(handle, evect, uplo, n, A, lda, abstol, residual, max_sweeps,
+                                    n_sweeps, W, stW, info, bc);
 }
 
-inline rocblas_status rocsolver_syev_heev(bool STRIDED,
-                                          rocblas_handle handle,
-                                          rocblas_evect evect,
-                                          rocblas_fill uplo,
-                                          rocblas_int n,
-                                          rocblas_float_complex* const A[],
-                                          rocblas_int lda,
-                                          rocblas_stride stA,
-                                          float* D,
-                                          rocblas_stride stD,
-                                          float* E,
-                                          rocblas_stride stE,
-                                          rocblas_int* info,
-                                          rocblas_int bc)
+inline rocblas_status rocsolver_syevj_heevj(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_evect evect,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_float_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float abstol,
+                                            float* residual,
+                                            rocblas_int max_sweeps,
+                                            rocblas_int* n_sweeps,
+                                            float* W,
+                                            rocblas_stride stW,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
 {
-    return rocsolver_cheev_batched(handle, evect, uplo, n, A, lda, D, stD, E, stE, info, bc);
+    return rocsolver_cheevj_batched(handle, evect, uplo, n, A, lda, abstol, residual, max_sweeps,
+                                    n_sweeps, W, stW, info, bc);
 }
 
-inline rocblas_status rocsolver_syev_heev(bool STRIDED,
-                                          rocblas_handle handle,
-                                          rocblas_evect evect,
-                                          rocblas_fill uplo,
-                                          rocblas_int n,
-                                          rocblas_double_complex* const A[],
-                                          rocblas_int lda,
-                                          rocblas_stride stA,
-                                          double* D,
-                                          rocblas_stride stD,
-                                          double* E,
-                                          rocblas_stride stE,
-                                          rocblas_int* info,
-                                          rocblas_int bc)
+inline rocblas_status rocsolver_syevj_heevj(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_evect evect,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_double_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double abstol,
+                                            double* residual,
+                                            rocblas_int max_sweeps,
+                                            rocblas_int* n_sweeps,
+                                            double* W,
+                                            rocblas_stride stW,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
 {
-    return rocsolver_zheev_batched(handle, evect, uplo, n, A, lda, D, stD, E, stE, info, bc);
+    return rocsolver_zheevj_batched(handle, evect, uplo, n, A, lda, abstol, residual, max_sweeps,
+                                    n_sweeps, W, stW, info, bc);
 }
 /********************************************************/
 
@@ -7,8 +7,10 @@
 #include "rocblas.h"
 #include "rocblascommon/program_options.hpp"
 #include "rocsolver_ostream.hpp"
+#include <map>
 #include <set>
 #include <sstream>
+#include <vector>
 
 using variables_map = roc::variables_map;
 using variable_value = roc::variable_value;
@@ -20,6 +22,17 @@ class Arguments : private std::map<std::string, variable_value>
     // names of arguments that have not yet been used by tests
     std::set<std::string> to_consume;
 
+    // values of the arguments used by tests (as text, for the benchmark reports)
+    std::map<std::string, std::string> used;
+
+    template <typename T>
+    void record_used(const std::string& name, const T& val)
+    {
+        std::stringstream ss;
+        ss << val;
+        used[name] = ss.str();
+    }
+
 public:
     // test options
     rocblas_int norm_check = 0;
@@ -29,6 +42,13 @@ public:
     rocblas_int singular = 0;
     rocblas_int iters = 5;
     rocblas_int batch_count = 1;
+    rocblas_int quiet = 0;
+
+    // results of the last timed test (times in microseconds)
+    double gpu_time_used = 0;
+    double cpu_time_used = 0;
+    double max_error = 0;
+    std::vector<double> gpu_time_samples;
 
     // get and set function arguments
     template <typename T>
@@ -43,7 +63,10 @@ public:
         to_consume.erase(name);
         auto val = find(name);
         if(val != end() && !val->second.empty())
+        {
+            record_used(name, val->second.as<T>());
             return val->second.as<T>();
+        }
         else
             throw std::invalid_argument("No value provided for " + name);
     }
@@ -54,9 +77,15 @@ public:
         to_consume.erase(name);
         auto val = find(name);
         if(val != end() && !val->second.empty() && !val->second.defaulted())
+        {
+            record_used(name, val->second.as<T>());
             return val->second.as<T>();
+        }
         else
+        {
+            record_used(name, default_value);
             return default_value;
+        }
     }
 
     template <typename T>
@@ -86,14 +115,25 @@ public:
         to_consume.erase("perf");
         to_consume.erase("singular");
         to_consume.erase("device");
+        to_consume.erase("format");
+        to_consume.erase("replay");
+        to_consume.erase("peak_gflops");
+        to_consume.erase("peak_gbs");
     }
 
     void clear()
     {
         to_consume.clear();
+        used.clear();
         base::clear();
     }
 
+    // arguments used by the last test, with the values they took
+    const std::map<std::string, std::string>& used_values() const
+    {
+        return used;
+    }
+
     // validate function arguments
     void validate_precision(const std::string name) const
     {
@@ -194,6 +234,28 @@ public:
             throw std::invalid_argument("Invalid value for " + name);
     }
 
+    void validate_erange(const std::string name) const
+    {
+        auto val = find(name);
+        if(val == end())
+            return;
+
+        char erange = val->second.as<char>();
+        if(erange != 'A' && erange != 'V' && erange != 'I')
+            throw std::invalid_argument("Invalid value for " + name);
+    }
+
+    void validate_eorder(const std::string name) const
+    {
+        auto val = find(name);
+        if(val == end())
+            return;
+
+        char eorder = val->second.as<char>();
+        if(eorder != 'B' && eorder != 'E')
+            throw std::invalid_argument("Invalid value for " + name);
+    }
+
     void validate_itype(const std::string name) const
     {
         auto val = find(name);
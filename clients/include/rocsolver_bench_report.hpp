@@ -0,0 +1,456 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "clientcommon.hpp"
+#include "rocsolver_arguments.hpp"
+#include "rocsolver_flops.hpp"
+#include "rocsolver_ostream.hpp"
+#include "rocsolver_test.hpp"
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/*
+ * ===========================================================================
+ *    Machine-readable (JSON and CSV) reports of rocsolver-bench results.
+ *    Each record holds the function, the full set of arguments it used, every
+ *    per-iteration GPU time and their statistics, and the achieved rates of the
+ *    flop and byte models in rocsolver_flops.hpp, also relative to the peak rates
+ *    of the device if they are given. When replaying a trace, a record
+ *    also holds the number of occurrences of its command line, and its share of
+ *    the total time weighted by these occurrences.
+ * ===========================================================================
+ */
+
+enum rocsolver_bench_format
+{
+    rocsolver_bench_format_text,
+    rocsolver_bench_format_json,
+    rocsolver_bench_format_csv,
+};
+
+inline rocsolver_bench_format rocsolver_bench_parse_format(const std::string& format)
+{
+    if(format == "text")
+        return rocsolver_bench_format_text;
+    else if(format == "json")
+        return rocsolver_bench_format_json;
+    else if(format == "csv")
+        return rocsolver_bench_format_csv;
+    else
+        throw std::invalid_argument("Invalid value for format");
+}
+
+struct rocsolver_bench_stats
+{
+    size_t count = 0;
+    double mean = 0;
+    double min = 0;
+    double median = 0;
+    double p95 = 0;
+    double max = 0;
+    double stddev = 0;
+
+    rocsolver_bench_stats() = default;
+
+    explicit rocsolver_bench_stats(std::vector<double> samples)
+    {
+        count = samples.size();
+        if(count == 0)
+            return;
+
+        std::sort(samples.begin(), samples.end());
+        min = samples.front();
+        max = samples.back();
+        median = (count % 2) ? samples[count / 2]
+                             : 0.5 * (samples[count / 2 - 1] + samples[count / 2]);
+        // nearest-rank percentile
+        p95 = samples[size_t(std::ceil(0.95 * count)) - 1];
+
+        for(double s : samples)
+            mean += s;
+        mean /= count;
+
+        // sample standard deviation
+        if(count > 1)
+        {
+            for(double s : samples)
+                stddev += (s - mean) * (s - mean);
+            stddev = std::sqrt(stddev / (count - 1));
+        }
+    }
+};
+
+// peak rates of the device (0 if unknown), to relate the achieved rates to the roofline
+struct rocsolver_bench_peak
+{
+    double gflops = 0;
+    double gbytes = 0;
+};
+
+struct rocsolver_bench_record
+{
+    std::string function;
+    char precision;
+    rocblas_int batch_count;
+    rocblas_int iters;
+    std::map<std::string, std::string> arguments;
+    std::vector<double> samples;
+    rocsolver_bench_stats stats;
+    // cpu time and error are only available if the corresponding checks were requested
+    bool has_cpu_time;
+    double cpu_time;
+    bool has_error;
+    double error;
+    // flops and bytes are only available if the function has a model
+    bool has_model;
+    double flops;
+    double bytes;
+    // number of times the command appears in a replayed trace, and the command itself
+    rocblas_int occurrences = 1;
+    std::string command;
+
+    rocsolver_bench_record(const std::string& function, char precision, const Arguments& argus)
+        : function(function)
+        , precision(precision)
+        , iters(argus.iters)
+        , arguments(argus.used_values())
+        , samples(argus.gpu_time_samples)
+        , stats(argus.gpu_time_samples)
+        , has_cpu_time(!argus.perf && !argus.gpu_time_samples.empty())
+        , cpu_time(argus.cpu_time_used)
+        , has_error(argus.norm_check && !argus.gpu_time_samples.empty())
+        , error(argus.max_error)
+        , flops(0)
+        , bytes(0)
+    {
+        // batch_count is only meaningful for the batched functions
+        batch_count = (function.find("batched") != std::string::npos) ? argus.batch_count : 1;
+        has_model = rocsolver_bench_model(function, precision, batch_count, arguments, &flops,
+                                          &bytes);
+    }
+
+    // achieved rates with the mean time, in GFLOP/s and GB/s (times are in microseconds)
+    double gflops() const
+    {
+        return stats.mean > 0 ? flops / stats.mean / 1e3 : 0;
+    }
+    double gbytes() const
+    {
+        return stats.mean > 0 ? bytes / stats.mean / 1e3 : 0;
+    }
+
+    // flops per byte moved
+    double intensity() const
+    {
+        return bytes > 0 ? flops / bytes : 0;
+    }
+
+    // fraction of the peak compute rate and of the peak bandwidth (0 if unknown)
+    double peak_gflops_fraction(const rocsolver_bench_peak& peak) const
+    {
+        return has_model && peak.gflops > 0 ? gflops() / peak.gflops : 0;
+    }
+    double peak_gbytes_fraction(const rocsolver_bench_peak& peak) const
+    {
+        return has_model && peak.gbytes > 0 ? gbytes() / peak.gbytes : 0;
+    }
+
+    /*! \brief Classifies the performance with respect to the roofline: a function is
+        compute or memory bound depending on which side of the ridge point its intensity lies,
+        unless it reaches less than a tenth of both peaks, in which case its time is dominated
+        by kernel launches and synchronizations. Returns nullptr if the peaks are unknown. */
+    const char* bound(const rocsolver_bench_peak& peak) const
+    {
+        if(!has_model || peak.gflops <= 0 || peak.gbytes <= 0 || stats.mean <= 0)
+            return nullptr;
+        if(std::max(peak_gflops_fraction(peak), peak_gbytes_fraction(peak)) < 0.1)
+            return "launch";
+        return intensity() >= peak.gflops / peak.gbytes ? "compute" : "memory";
+    }
+
+    // mean time multiplied by the number of occurrences
+    double weighted_time() const
+    {
+        return occurrences * stats.mean;
+    }
+};
+
+inline double rocsolver_bench_total_time(const std::vector<rocsolver_bench_record>& records)
+{
+    double total = 0;
+    for(const rocsolver_bench_record& rec : records)
+        total += rec.weighted_time();
+    return total;
+}
+
+inline double rocsolver_bench_share(const rocsolver_bench_record& rec, double total)
+{
+    return total > 0 ? rec.weighted_time() / total : 0;
+}
+
+/*! \brief Returns true if the value fully matches the JSON number grammar */
+inline bool rocsolver_bench_json_is_number(const std::string& val)
+{
+    auto digits = [&](size_t i) {
+        while(i < val.size() && std::isdigit((unsigned char)val[i]))
+            i++;
+        return i;
+    };
+
+    size_t i = 0;
+    if(i < val.size() && val[i] == '-')
+        i++;
+    // integer part: 0, or a non-zero digit followed by any digits
+    if(i < val.size() && val[i] == '0')
+        i++;
+    else if(i < val.size() && std::isdigit((unsigned char)val[i]))
+        i = digits(i);
+    else
+        return false;
+    // optional fraction
+    if(i < val.size() && val[i] == '.')
+    {
+        size_t j = digits(i + 1);
+        if(j == i + 1)
+            return false;
+        i = j;
+    }
+    // optional exponent
+    if(i < val.size() && (val[i] == 'e' || val[i] == 'E'))
+    {
+        i++;
+        if(i < val.size() && (val[i] == '+' || val[i] == '-'))
+            i++;
+        size_t j = digits(i);
+        if(j == i)
+            return false;
+        i = j;
+    }
+    return i == val.size();
+}
+
+/*! \brief Formats a value as a JSON string, escaping quotes, backslashes and control
+    characters */
+inline std::string rocsolver_bench_json_string(const std::string& val)
+{
+    std::string s = "\"";
+    for(char c : val)
+    {
+        switch(c)
+        {
+        case '"': s += "\\\""; break;
+        case '\\': s += "\\\\"; break;
+        case '\b': s += "\\b"; break;
+        case '\f': s += "\\f"; break;
+        case '\n': s += "\\n"; break;
+        case '\r': s += "\\r"; break;
+        case '\t': s += "\\t"; break;
+        default:
+            if((unsigned char)c < 0x20)
+            {
+                char code[7];
+                std::snprintf(code, sizeof(code), "\\u%04x", (unsigned char)c);
+                s += code;
+            }
+            else
+                s += c;
+        }
+    }
+    return s + '"';
+}
+
+/*! \brief Formats a value as a JSON number if it is numeric, or as a JSON string otherwise */
+inline std::string rocsolver_bench_json_value(const std::string& val)
+{
+    return rocsolver_bench_json_is_number(val) ? val : rocsolver_bench_json_string(val);
+}
+
+/*! \brief Formats a double as a JSON number, or as null if it is not finite (NaN and
+    infinities have no JSON representation) */
+inline std::string rocsolver_bench_json_number(double val)
+{
+    if(!std::isfinite(val))
+        return "null";
+
+    std::stringstream ss;
+    ss << std::setprecision(10) << val;
+    return ss.str();
+}
+
+inline void rocsolver_bench_write_json(rocsolver_ostream& os,
+                                       const std::vector<rocsolver_bench_record>& records,
+                                       const rocsolver_bench_peak& peak = {})
+{
+    double total = rocsolver_bench_total_time(records);
+    rocblas_int calls = 0;
+    for(const rocsolver_bench_record& rec : records)
+        calls += rec.occurrences;
+
+    std::stringstream ss;
+    ss << std::setprecision(10);
+    ss << "{\n  \"summary\": {\"records\": " << records.size() << ", \"calls\": " << calls
+       << ", \"total_weighted_time_us\": " << rocsolver_bench_json_number(total) << "},\n";
+    ss << "  \"results\": [";
+    for(size_t r = 0; r < records.size(); r++)
+    {
+        const rocsolver_bench_record& rec = records[r];
+        ss << (r ? ",\n" : "\n") << "    {\n";
+        if(!rec.command.empty())
+            ss << "      \"command\": " << rocsolver_bench_json_string(rec.command) << ",\n";
+        ss << "      \"function\": \"" << rec.function << "\",\n";
+        ss << "      \"precision\": \"" << rec.precision << "\",\n";
+        ss << "      \"batch_count\": " << rec.batch_count << ",\n";
+        ss << "      \"iters\": " << rec.iters << ",\n";
+        ss << "      \"occurrences\": " << rec.occurrences << ",\n";
+
+        ss << "      \"arguments\": {";
+        bool first = true;
+        for(auto& arg : rec.arguments)
+        {
+            ss << (first ? "" : ", ") << rocsolver_bench_json_string(arg.first) << ": "
+               << rocsolver_bench_json_value(arg.second);
+            first = false;
+        }
+        ss << "},\n";
+
+        ss << "      \"gpu_time_us\": {\"samples\": [";
+        for(size_t i = 0; i < rec.samples.size(); i++)
+            ss << (i ? ", " : "") << rocsolver_bench_json_number(rec.samples[i]);
+        ss << "], \"mean\": " << rocsolver_bench_json_number(rec.stats.mean)
+           << ", \"min\": " << rocsolver_bench_json_number(rec.stats.min)
+           << ", \"median\": " << rocsolver_bench_json_number(rec.stats.median)
+           << ", \"p95\": " << rocsolver_bench_json_number(rec.stats.p95)
+           << ", \"max\": " << rocsolver_bench_json_number(rec.stats.max)
+           << ", \"stddev\": " << rocsolver_bench_json_number(rec.stats.stddev) << "},\n";
+        ss << "      \"weighted_time_us\": " << rocsolver_bench_json_number(rec.weighted_time())
+           << ",\n";
+        ss << "      \"share\": " << rocsolver_bench_json_number(rocsolver_bench_share(rec, total))
+           << ",\n";
+
+        ss << "      \"cpu_time_us\": ";
+        if(rec.has_cpu_time)
+            ss << rocsolver_bench_json_number(rec.cpu_time);
+        else
+            ss << "null";
+        ss << ",\n      \"error\": ";
+        if(rec.has_error)
+            ss << rocsolver_bench_json_number(rec.error);
+        else
+            ss << "null";
+
+        if(rec.has_model)
+            ss << ",\n      \"flops\": " << rocsolver_bench_json_number(rec.flops)
+               << ",\n      \"bytes\": " << rocsolver_bench_json_number(rec.bytes)
+               << ",\n      \"gflops\": " << rocsolver_bench_json_number(rec.gflops())
+               << ",\n      \"gbytes_per_s\": " << rocsolver_bench_json_number(rec.gbytes())
+               << ",\n      \"intensity\": " << rocsolver_bench_json_number(rec.intensity());
+        else
+            ss << ",\n      \"flops\": null,\n      \"bytes\": null,\n      \"gflops\": null,\n"
+               << "      \"gbytes_per_s\": null,\n      \"intensity\": null";
+
+        ss << ",\n      \"peak_gflops_pct\": ";
+        if(rec.has_model && peak.gflops > 0)
+            ss << rocsolver_bench_json_number(100 * rec.peak_gflops_fraction(peak));
+        else
+            ss << "null";
+        ss << ",\n      \"peak_gbytes_pct\": ";
+        if(rec.has_model && peak.gbytes > 0)
+            ss << rocsolver_bench_json_number(100 * rec.peak_gbytes_fraction(peak));
+        else
+            ss << "null";
+        const char* bound = rec.bound(peak);
+        ss << ",\n      \"bound\": " << (bound ? '"' + std::string(bound) + '"' : "null");
+        ss << "\n    }";
+    }
+    ss << "\n  ]\n}\n";
+
+    os << ss.str();
+    os.flush();
+}
+
+inline void rocsolver_bench_write_csv(rocsolver_ostream& os,
+                                      const std::vector<rocsolver_bench_record>& records,
+                                      const rocsolver_bench_peak& peak = {})
+{
+    double total = rocsolver_bench_total_time(records);
+
+    std::stringstream ss;
+    ss << std::setprecision(10);
+    ss << "function,precision,batch_count,iters,occurrences,arguments,samples,mean_us,min_us,"
+          "median_us,p95_us,max_us,stddev_us,weighted_time_us,share,cpu_time_us,error,flops,"
+          "bytes,gflops,gbytes_per_s,intensity,peak_gflops_pct,peak_gbytes_pct,bound\n";
+    for(const rocsolver_bench_record& rec : records)
+    {
+        ss << rec.function << ',' << rec.precision << ',' << rec.batch_count << ',' << rec.iters
+           << ',' << rec.occurrences << ',';
+
+        // arguments and samples are space-separated lists within a single field
+        ss << '"';
+        bool first = true;
+        for(auto& arg : rec.arguments)
+        {
+            ss << (first ? "" : " ") << arg.first << '=' << arg.second;
+            first = false;
+        }
+        ss << "\",\"";
+        for(size_t i = 0; i < rec.samples.size(); i++)
+            ss << (i ? " " : "") << rec.samples[i];
+        ss << "\",";
+
+        ss << rec.stats.mean << ',' << rec.stats.min << ',' << rec.stats.median << ','
+           << rec.stats.p95 << ',' << rec.stats.max << ',' << rec.stats.stddev << ','
+           << rec.weighted_time() << ',' << rocsolver_bench_share(rec, total) << ',';
+        if(rec.has_cpu_time)
+            ss << rec.cpu_time;
+        ss << ',';
+        if(rec.has_error)
+            ss << rec.error;
+        ss << ',';
+        if(rec.has_model)
+            ss << rec.flops << ',' << rec.bytes << ',' << rec.gflops() << ',' << rec.gbytes() << ','
+               << rec.intensity();
+        else
+            ss << ",,,,";
+        ss << ',';
+        if(rec.has_model && peak.gflops > 0)
+            ss << 100 * rec.peak_gflops_fraction(peak);
+        ss << ',';
+        if(rec.has_model && peak.gbytes > 0)
+            ss << 100 * rec.peak_gbytes_fraction(peak);
+        ss << ',';
+        if(rec.bound(peak))
+            ss << rec.bound(peak);
+        ss << '\n';
+    }
+
+    os << ss.str();
+    os.flush();
+}
+
+/*! \brief Prints the achieved rates of a record, and their relation to the peaks if known */
+inline void rocsolver_bench_print_roofline(const rocsolver_bench_record& rec,
+                                           const rocsolver_bench_peak& peak)
+{
+    if(!rec.has_model || rec.stats.mean <= 0)
+        return;
+
+    const char* bound = rec.bound(peak);
+    rocsolver_cout << "\n============================================\n";
+    rocsolver_cout << "Roofline:\n";
+    rocsolver_cout << "============================================\n";
+    rocsolver_bench_output("gflops", "gbytes_per_s", "intensity", "%peak_gflops", "%peak_gbytes",
+                           "bound");
+    rocsolver_bench_output(rec.gflops(), rec.gbytes(), rec.intensity(),
+                           100 * rec.peak_gflops_fraction(peak),
+                           100 * rec.peak_gbytes_fraction(peak), bound ? bound : "-");
+    rocsolver_cout << std::endl;
+}
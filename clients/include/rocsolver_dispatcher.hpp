@@ -13,9 +13,13 @@
 #include "testing_gebd2_gebrd.hpp"
 #include "testing_gelq2_gelqf.hpp"
 #include "testing_gels.hpp"
+#include "testing_gelsy.hpp"
 #include "testing_geql2_geqlf.hpp"
+#include "testing_geqp3.hpp"
 #include "testing_geqr2_geqrf.hpp"
+#include "testing_gesv.hpp"
 #include "testing_gesvd.hpp"
+#include "testing_gesvdj.hpp"
 #include "testing_getf2_getrf.hpp"
 #include "testing_getf2_getrf_npvt.hpp"
 #include "testing_getri.hpp"
@@ -39,10 +43,17 @@
 #include "testing_ormtr_unmtr.hpp"
 #include "testing_ormxl_unmxl.hpp"
 #include "testing_ormxr_unmxr.hpp"
+#include "testing_posv.hpp"
 #include "testing_potf2_potrf.hpp"
+#include "testing_stebz.hpp"
+#include "testing_stedc.hpp"
+#include "testing_stein.hpp"
 #include "testing_steqr.hpp"
 #include "testing_sterf.hpp"
 #include "testing_syev_heev.hpp"
+#include "testing_syevd_heevd.hpp"
+#include "testing_syevj_heevj.hpp"
+#include "testing_syevx_heevx.hpp"
 #include "testing_sygsx_hegsx.hpp"
 #include "testing_sygv_hegv.hpp"
 #include "testing_sytxx_hetxx.hpp"
@@ -76,6 +87,8 @@ class rocsolver_dispatcher
             {"labrd", testing_labrd<T>},
             {"bdsqr", testing_bdsqr<T>},
             {"steqr", testing_steqr<T>},
+            {"stedc", testing_stedc<T>},
+            {"stein", testing_stein<T>},
             // potrf
             {"potf2", testing_potf2_potrf<false, false, 0, T>},
             {"potf2_batched", testing_potf2_potrf<true, true, 0, T>},
@@ -105,6 +118,10 @@ class rocsolver_dispatcher
             {"geqrf_batched", testing_geqr2_geqrf<true, true, 1, T>},
             {"geqrf_strided_batched", testing_geqr2_geqrf<false, true, 1, T>},
             {"geqrf_ptr_batched", testing_geqr2_geqrf<true, false, 1, T>},
+            // geqp3
+            {"geqp3", testing_geqp3<false, false, T>},
+            {"geqp3_batched", testing_geqp3<true, true, T>},
+            {"geqp3_strided_batched", testing_geqp3<false, true, T>},
             // geqlf
             {"geql2", testing_geql2_geqlf<false, false, 0, T>},
             {"geql2_batched", testing_geql2_geqlf<true, true, 0, T>},
@@ -127,6 +144,10 @@ class rocsolver_dispatcher
             {"gesvd", testing_gesvd<false, false, T>},
             {"gesvd_batched", testing_gesvd<true, true, T>},
             {"gesvd_strided_batched", testing_gesvd<false, true, T>},
+            // gesvdj
+            {"gesvdj", testing_gesvdj<false, false, T>},
+            {"gesvdj_batched", testing_gesvdj<true, true, T>},
+            {"gesvdj_strided_batched", testing_gesvdj<false, true, T>},
             // getri
             {"getri", testing_getri<false, false, T>},
             {"getri_batched", testing_getri<true, true, T>},
@@ -139,10 +160,22 @@ class rocsolver_dispatcher
             {"getri_outofplace", testing_getri_outofplace<false, false, T>},
             {"getri_outofplace_batched", testing_getri_outofplace<true, true, T>},
             {"getri_outofplace_strided_batched", testing_getri_outofplace<false, true, T>},
+            // gesv
+            {"gesv", testing_gesv<false, false, T>},
+            {"gesv_batched", testing_gesv<true, true, T>},
+            {"gesv_strided_batched", testing_gesv<false, true, T>},
+            // posv
+            {"posv", testing_posv<false, false, T>},
+            {"posv_batched", testing_posv<true, true, T>},
+            {"posv_strided_batched", testing_posv<false, true, T>},
             // gels
             {"gels", testing_gels<false, false, T>},
             {"gels_batched", testing_gels<true, true, T>},
             {"gels_strided_batched", testing_gels<false, true, T>},
+            // gelsy
+            {"gelsy", testing_gelsy<false, false, T>},
+            {"gelsy_batched", testing_gelsy<true, true, T>},
+            {"gelsy_strided_batched", testing_gelsy<false, true, T>},
             // gebrd
             {"gebd2", testing_gebd2_gebrd<false, false, 0, T>},
             {"gebd2_batched", testing_gebd2_gebrd<true, true, 0, T>},
@@ -169,6 +202,7 @@ class rocsolver_dispatcher
         // Map for functions that support only single and double precisions
         static const func_map map_real = {
             {"sterf", testing_sterf<T>},
+            {"stebz", testing_stebz<T>},
             // orgxx
             {"org2r", testing_orgxr_ungxr<T, 0>},
             {"orgqr", testing_orgxr_ungxr<T, 1>},
@@ -205,6 +239,18 @@ class rocsolver_dispatcher
             {"syev", testing_syev_heev<false, false, T>},
             {"syev_batched", testing_syev_heev<true, true, T>},
             {"syev_strided_batched", testing_syev_heev<false, true, T>},
+            // syevd
+            {"syevd", testing_syevd_heevd<false, false, T>},
+            {"syevd_batched", testing_syevd_heevd<true, true, T>},
+            {"syevd_strided_batched", testing_syevd_heevd<false, true, T>},
+            // syevx
+            {"syevx", testing_syevx_heevx<false, false, T>},
+            {"syevx_batched", testing_syevx_heevx<true, true, T>},
+            {"syevx_strided_batched", testing_syevx_heevx<false, true, T>},
+            // syevj
+            {"syevj", testing_syevj_heevj<false, false, T>},
+            {"syevj_batched", testing_syevj_heevj<true, true, T>},
+            {"syevj_strided_batched", testing_syevj_heevj<false, true, T>},
             // sygv
             {"sygv", testing_sygv_hegv<false, false, T>},
             {"sygv_batched", testing_sygv_hegv<true, true, T>},
@@ -264,6 +310,18 @@ class rocsolver_dispatcher
             {"heev", testing_syev_heev<false, false, T>},
             {"heev_batched", testing_syev_heev<true, true, T>},
             {"heev_strided_batched", testing_syev_heev<false, true, T>},
+            // heevd
+            {"heevd", testing_syevd_heevd<false, false, T>},
+            {"heevd_batched", testing_syevd_heevd<true, true, T>},
+            {"heevd_strided_batched", testing_syevd_heevd<false, true, T>},
+            // heevx
+            {"heevx", testing_syevx_heevx<false, false, T>},
+            {"heevx_batched", testing_syevx_heevx<true, true, T>},
+            {"heevx_strided_batched", testing_syevx_heevx<false, true, T>},
+            // heevj
+            {"heevj", testing_syevj_heevj<false, false, T>},
+            {"heevj_batched", testing_syevj_heevj<true, true, T>},
+            {"heevj_strided_batched", testing_syevj_heevj<false, true, T>},
             // hegv
             {"hegv", testing_sygv_hegv<false, false, T>},
             {"hegv_batched", testing_sygv_hegv<true, true, T>},
@@ -285,6 +343,7 @@ public:
     static void invoke(const std::string& name, char precision, Arguments& argus)
     {
         rocblas_status status;
+        rocsolver_bench_samples().clear();
 
         if(precision == 's')
             status = run_function<float>(name.c_str(), argus);
@@ -317,5 +376,7 @@ public:
             msg += precision;
             throw std::invalid_argument(msg);
         }
+
+        argus.gpu_time_samples = rocsolver_bench_samples();
     }
 };
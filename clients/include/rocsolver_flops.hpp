@@ -0,0 +1,459 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+
+/*
+ * ===========================================================================
+ *    Operation count and memory traffic models of the benchmarked functions.
+ *    The flop counts follow the formulas of LAPACK Working Note 41 where they
+ *    exist; the eigenvalue and singular value problems use nominal counts, and
+ *    the auxiliary functions their leading order terms. A complex multiplication
+ *    counts as 6 flops and a complex addition as 2 flops. The byte counts are the
+ *    minimal traffic: every matrix is read (and written, if it is an output) once.
+ * ===========================================================================
+ */
+
+struct rocsolver_bench_cost
+{
+    double fmuls = 0;
+    double fadds = 0;
+    // number of matrix elements read and written
+    double elems = 0;
+    // extra bytes not proportional to the precision (e.g. pivot indices)
+    double extra_bytes = 0;
+
+    rocsolver_bench_cost& operator+=(const rocsolver_bench_cost& other)
+    {
+        fmuls += other.fmuls;
+        fadds += other.fadds;
+        elems += other.elems;
+        extra_bytes += other.extra_bytes;
+        return *this;
+    }
+};
+
+// LU factorization of an m-by-n matrix
+inline rocsolver_bench_cost rocsolver_cost_getrf(double m, double n)
+{
+    rocsolver_bench_cost c;
+    if(m >= n)
+    {
+        c.fmuls = 0.5 * m * n * n - n * n * n / 6 + 0.5 * m * n - 0.5 * n * n + 2 * n / 3;
+        c.fadds = 0.5 * m * n * n - n * n * n / 6 - 0.5 * m * n + n / 6;
+    }
+    else
+    {
+        c.fmuls = 0.5 * n * m * m - m * m * m / 6 + 0.5 * n * m - 0.5 * m * m + 2 * m / 3;
+        c.fadds = 0.5 * n * m * m - m * m * m / 6 - 0.5 * n * m + m / 6;
+    }
+    c.elems = 2 * m * n;
+    return c;
+}
+
+// solution of a system with an LU-factorized matrix of order n
+inline rocsolver_bench_cost rocsolver_cost_getrs(double n, double nrhs)
+{
+    rocsolver_bench_cost c;
+    c.fmuls = nrhs * n * n;
+    c.fadds = nrhs * (n * n - n);
+    c.elems = n * n + 2 * n * nrhs;
+    return c;
+}
+
+// Cholesky factorization of a matrix of order n
+inline rocsolver_bench_cost rocsolver_cost_potrf(double n)
+{
+    rocsolver_bench_cost c;
+    c.fmuls = n * n * n / 6 + 0.5 * n * n + n / 3;
+    c.fadds = n * n * n / 6 - n / 6;
+    c.elems = n * (n + 1);
+    return c;
+}
+
+// solution of a system with a Cholesky-factorized matrix of order n
+inline rocsolver_bench_cost rocsolver_cost_potrs(double n, double nrhs)
+{
+    rocsolver_bench_cost c;
+    c.fmuls = nrhs * (n * n + n);
+    c.fadds = nrhs * (n * n - n);
+    c.elems = 0.5 * n * (n + 1) + 2 * n * nrhs;
+    return c;
+}
+
+// QR factorization of an m-by-n matrix (also used for QL, and for LQ with m and n swapped)
+inline rocsolver_bench_cost rocsolver_cost_geqrf(double m, double n)
+{
+    rocsolver_bench_cost c;
+    if(m >= n)
+    {
+        c.fmuls = m * n * n - n * n * n / 3 + m * n + 0.5 * n * n + 23 * n / 6;
+        c.fadds = m * n * n - n * n * n / 3 + 0.5 * n * n + 5 * n / 6;
+    }
+    else
+    {
+        c.fmuls = n * m * m - m * m * m / 3 + 2 * n * m - 0.5 * m * m + 23 * m / 6;
+        c.fadds = n * m * m - m * m * m / 3 + n * m - 0.5 * m * m + 5 * m / 6;
+    }
+    c.elems = 2 * m * n + (m < n ? m : n);
+    return c;
+}
+
+// inversion of a triangular matrix of order n
+inline rocsolver_bench_cost rocsolver_cost_trtri(double n)
+{
+    rocsolver_bench_cost c;
+    c.fmuls = n * n * n / 6 + 0.5 * n * n + n / 3;
+    c.fadds = n * n * n / 6 - 0.5 * n * n + n / 3;
+    c.elems = n * (n + 1);
+    return c;
+}
+
+// inversion of an LU-factorized matrix of order n
+inline rocsolver_bench_cost rocsolver_cost_getri(double n)
+{
+    rocsolver_bench_cost c;
+    c.fmuls = 2 * n * n * n / 3 + 0.5 * n * n + 5 * n / 6;
+    c.fadds = 2 * n * n * n / 3 - 1.5 * n * n + 5 * n / 6;
+    c.elems = 2 * n * n;
+    return c;
+}
+
+// least squares solution with a QR-factorized m-by-n matrix (m >= n)
+inline rocsolver_bench_cost rocsolver_cost_geqrs(double m, double n, double nrhs)
+{
+    rocsolver_bench_cost c;
+    c.fmuls = nrhs * n * (2 * m - 0.5 * n + 2.5);
+    c.fadds = nrhs * n * (2 * m - 0.5 * n + 0.5);
+    c.elems = m * n + 2 * m * nrhs;
+    return c;
+}
+
+// generation of the m-by-n matrix Q of a QR factorization with k reflectors
+// (also used for QL, and for LQ with m and n swapped)
+inline rocsolver_bench_cost rocsolver_cost_orgqr(double m, double n, double k)
+{
+    rocsolver_bench_cost c;
+    c.fmuls = k * (2 * m * n + 2 * n - 5.0 / 3 + k * (2 * k / 3 - (m + n) - 1));
+    c.fadds = k * (n - m + 1.0 / 3 + 2 * m * n + k * (2 * k / 3 - (m + n)));
+    c.elems = 2 * m * n + k;
+    return c;
+}
+
+// application of the Q of a QR factorization with k reflectors to an m-by-n matrix
+// (also used for QL and LQ)
+inline rocsolver_bench_cost rocsolver_cost_ormqr(bool left, double m, double n, double k)
+{
+    rocsolver_bench_cost c;
+    if(left)
+    {
+        c.fmuls = 2 * n * m * k - n * k * k + 2 * n * k;
+        c.fadds = 2 * n * m * k - n * k * k + n * k;
+    }
+    else
+    {
+        c.fmuls = 2 * n * m * k - m * k * k + m * k + n * k - 0.5 * k * k + 0.5 * k;
+        c.fadds = 2 * n * m * k - m * k * k + m * k;
+    }
+    c.elems = (left ? m : n) * k + k + 2 * m * n;
+    return c;
+}
+
+// bidiagonal reduction of an m-by-n matrix
+inline rocsolver_bench_cost rocsolver_cost_gebrd(double m, double n)
+{
+    rocsolver_bench_cost c;
+    double mx = (m >= n ? m : n);
+    double mn = (m >= n ? n : m);
+    c.fmuls = mn * (mn * (2 * mx - 2 * mn / 3 + 2) + 20.0 / 3);
+    c.fadds = mn * (mn * (2 * mx - 2 * mn / 3 + 1) - mx + 5.0 / 3);
+    c.elems = 2 * m * n + 2 * mn;
+    return c;
+}
+
+// tridiagonal reduction of a symmetric/hermitian matrix of order n
+inline rocsolver_bench_cost rocsolver_cost_sytrd(double n)
+{
+    rocsolver_bench_cost c;
+    c.fmuls = n * (n * (2 * n / 3 + 2.5) - 1.0 / 6);
+    c.fadds = n * (n * (2 * n / 3 + 1) - 8.0 / 3);
+    c.elems = n * (n + 1) + 2 * n;
+    return c;
+}
+
+// reduction of a symmetric-definite generalized eigenproblem of order n to standard form
+inline rocsolver_bench_cost rocsolver_cost_sygst(double n)
+{
+    rocsolver_bench_cost c;
+    c.fmuls = 0.5 * n * n * n;
+    c.fadds = 0.5 * n * n * n;
+    c.elems = 1.5 * n * (n + 1);
+    return c;
+}
+
+// triangular solve of order m with n right-hand sides
+inline rocsolver_bench_cost rocsolver_cost_trsm(double m, double n)
+{
+    rocsolver_bench_cost c;
+    c.fmuls = 0.5 * n * m * (m + 1);
+    c.fadds = 0.5 * n * m * (m - 1);
+    c.elems = 0.5 * m * (m + 1) + 2 * m * n;
+    return c;
+}
+
+// An iterative method does data-dependent work, so the eigenvalue and singular value problems
+// use the nominal counts of the QR algorithm (Golub and Van Loan, Matrix Computations), which
+// makes the rates of different algorithms for the same problem comparable.
+inline rocsolver_bench_cost rocsolver_cost_nominal(double flops, double elems)
+{
+    rocsolver_bench_cost c;
+    c.fmuls = 0.5 * flops;
+    c.fadds = 0.5 * flops;
+    c.elems = elems;
+    return c;
+}
+
+// eigenvalues (and eigenvectors) of a symmetric tridiagonal matrix of order n
+inline rocsolver_bench_cost rocsolver_cost_steqr(double n, bool evect)
+{
+    return rocsolver_cost_nominal(evect ? 6 * n * n * n : 30 * n * n,
+                                  2 * n + (evect ? 2 * n * n : 0));
+}
+
+// eigenvalues (and eigenvectors) of a symmetric/hermitian matrix of order n
+inline rocsolver_bench_cost rocsolver_cost_syev(double n, bool evect)
+{
+    return rocsolver_cost_nominal(evect ? 9 * n * n * n : 4 * n * n * n / 3, 2 * n * n + n);
+}
+
+// singular values (and vectors) of an m-by-n matrix; full_u means that all the m
+// left singular vectors are computed, otherwise only the first min(m,n)
+inline rocsolver_bench_cost rocsolver_cost_gesvd(double m, double n, bool vectors, bool full_u)
+{
+    double mx = (m >= n ? m : n);
+    double mn = (m >= n ? n : m);
+    double flops;
+    if(!vectors)
+        flops = 4 * mx * mn * mn - 4 * mn * mn * mn / 3;
+    else if(full_u)
+        flops = 4 * mx * mx * mn + 8 * mx * mn * mn + 9 * mn * mn * mn;
+    else
+        flops = 14 * mx * mn * mn + 8 * mn * mn * mn;
+    double elems = m * n + mn + (vectors ? (full_u ? mx * mx : mx * mn) + mn * mn : 0);
+    return rocsolver_cost_nominal(flops, elems);
+}
+
+/*! \brief Computes the number of floating point operations and the number of bytes moved by a
+    call to the given function with the given arguments (as recorded by Arguments::used_values).
+    Returns false if there is no model for the function. */
+inline bool rocsolver_bench_model(const std::string& function,
+                                  char precision,
+                                  int batch_count,
+                                  const std::map<std::string, std::string>& args,
+                                  double* flops,
+                                  double* bytes)
+{
+    auto arg = [&args](const char* name, double dflt) {
+        auto it = args.find(name);
+        return it != args.end() ? std::atof(it->second.c_str()) : dflt;
+    };
+    auto flag = [&args](const char* name, char dflt) {
+        auto it = args.find(name);
+        return it != args.end() && !it->second.empty() ? it->second[0] : dflt;
+    };
+
+    // the batched and strided_batched versions share the model of the normal function
+    std::string name = function;
+    for(const char* suffix : {"_strided_batched", "_ptr_batched", "_batched", "_npvt"})
+    {
+        size_t len = strlen(suffix);
+        if(name.size() > len && name.compare(name.size() - len, len, suffix) == 0)
+            name.erase(name.size() - len);
+    }
+
+    // the complex functions share the model of the real ones
+    if(name.compare(0, 2, "un") == 0)
+        name.replace(0, 2, "or");
+    else if(name.compare(0, 2, "he") == 0)
+        name.replace(0, 2, "sy");
+
+    double m = arg("m", 0);
+    double n = arg("n", m);
+    if(!args.count("m"))
+        m = n;
+    double k = arg("k", m < n ? m : n);
+    double nrhs = arg("nrhs", n);
+    double sizeP = sizeof(int) * (m < n ? m : n);
+    bool left = (flag("side", 'L') == 'L');
+    bool evect = (flag("evect", 'N') != 'N');
+
+    rocsolver_bench_cost c;
+    if(name == "getf2" || name == "getrf")
+    {
+        c = rocsolver_cost_getrf(m, n);
+        if(function.find("_npvt") == std::string::npos)
+            c.extra_bytes = sizeP;
+    }
+    else if(name == "getrs")
+    {
+        c = rocsolver_cost_getrs(n, nrhs);
+        c.extra_bytes = sizeof(int) * n;
+    }
+    else if(name == "gesv")
+    {
+        c = rocsolver_cost_getrf(n, n);
+        c += rocsolver_cost_getrs(n, nrhs);
+        c.elems = 2 * n * n + 2 * n * nrhs;
+        c.extra_bytes = sizeof(int) * n;
+    }
+    else if(name == "potf2" || name == "potrf")
+        c = rocsolver_cost_potrf(n);
+    else if(name == "posv")
+    {
+        c = rocsolver_cost_potrf(n);
+        c += rocsolver_cost_potrs(n, nrhs);
+        c.elems = n * (n + 1) + 2 * n * nrhs;
+    }
+    else if(name == "geqr2" || name == "geqrf" || name == "geql2" || name == "geqlf")
+        c = rocsolver_cost_geqrf(m, n);
+    else if(name == "gelq2" || name == "gelqf")
+        c = rocsolver_cost_geqrf(n, m);
+    else if(name == "geqp3")
+    {
+        // the column norms are computed once and then downdated
+        c = rocsolver_cost_geqrf(m, n);
+        c.fmuls += 2 * m * n;
+        c.fadds += m * n;
+        c.extra_bytes = sizeof(int) * n;
+    }
+    else if(name == "gels")
+    {
+        // QR for overdetermined systems and LQ for underdetermined ones
+        double mx = (m >= n ? m : n);
+        double mn = (m >= n ? n : m);
+        c = rocsolver_cost_geqrf(mx, mn);
+        c += rocsolver_cost_geqrs(mx, mn, nrhs);
+        c.elems = 2 * m * n + 2 * mx * nrhs;
+    }
+    else if(name == "gelsy")
+    {
+        // pivoted QR, LQ of the (full rank) triangular factor, and both back-transformations
+        double mn = (m >= n ? n : m);
+        double mx = (m >= n ? m : n);
+        c = rocsolver_cost_geqrf(m, n);
+        c += rocsolver_cost_geqrf(n, mn);
+        c += rocsolver_cost_geqrs(m, mn, nrhs);
+        c += rocsolver_cost_geqrs(n, mn, nrhs);
+        c.elems = 2 * m * n + 2 * mx * nrhs;
+        c.extra_bytes = sizeof(int) * (n + 1);
+    }
+    else if(name == "trtri")
+        c = rocsolver_cost_trtri(n);
+    else if(name == "getri" || name == "getri_outofplace")
+    {
+        c = rocsolver_cost_getri(n);
+        c.extra_bytes = sizeof(int) * n;
+    }
+    else if(name == "org2r" || name == "orgqr" || name == "org2l" || name == "orgql")
+        c = rocsolver_cost_orgqr(m, n, k);
+    else if(name == "orgl2" || name == "orglq")
+        c = rocsolver_cost_orgqr(n, m, k);
+    else if(name == "orgbr")
+    {
+        if(flag("storev", 'C') == 'C')
+            c = rocsolver_cost_orgqr(m, n, (k < n ? k : n));
+        else
+            c = rocsolver_cost_orgqr(n, m, (k < m ? k : m));
+    }
+    else if(name == "orgtr")
+        c = rocsolver_cost_orgqr(n - 1, n - 1, n - 1);
+    else if(name == "orm2r" || name == "ormqr" || name == "orm2l" || name == "ormql"
+            || name == "orml2" || name == "ormlq")
+        c = rocsolver_cost_ormqr(left, m, n, k);
+    else if(name == "ormbr")
+    {
+        double nq = (left ? m : n);
+        c = rocsolver_cost_ormqr(left, m, n, (k < nq ? k : nq));
+    }
+    else if(name == "ormtr")
+        c = rocsolver_cost_ormqr(left, m, n, (left ? m : n) - 1);
+    else if(name == "gebd2" || name == "gebrd")
+        c = rocsolver_cost_gebrd(m, n);
+    else if(name == "sytd2" || name == "sytrd")
+        c = rocsolver_cost_sytrd(n);
+    else if(name == "sygs2" || name == "sygst")
+        c = rocsolver_cost_sygst(n);
+    else if(name == "syev" || name == "syevd" || name == "syevj" || name == "syevx")
+        c = rocsolver_cost_syev(n, evect);
+    else if(name == "sygv")
+    {
+        // Cholesky factorization, reduction to standard form, eigensolver and back-transformation
+        c = rocsolver_cost_potrf(n);
+        c += rocsolver_cost_sygst(n);
+        c += rocsolver_cost_syev(n, evect);
+        if(evect)
+            c += rocsolver_cost_trsm(n, n);
+        c.elems = 2 * n * n + n;
+    }
+    else if(name == "gesvd" || name == "gesvdj")
+    {
+        char left_svect = flag("left_svect", 'N');
+        char right_svect = flag("right_svect", 'N');
+        bool vectors = (left_svect != 'N' || right_svect != 'N');
+        bool full = (m >= n ? left_svect == 'A' : right_svect == 'A');
+        c = rocsolver_cost_gesvd(m, n, vectors, full);
+    }
+    else if(name == "sterf" || name == "stebz")
+        c = rocsolver_cost_steqr(n, false);
+    else if(name == "steqr" || name == "stedc")
+        c = rocsolver_cost_steqr(n, flag("evect", 'N') != 'N');
+    else if(name == "stein")
+        c = rocsolver_cost_nominal(10 * n * n, 3 * n + n * n);
+    else if(name == "bdsqr")
+    {
+        // every rotation of the implicit QR sweeps is applied to the rows and columns of U, V and C
+        double nv = arg("nv", 0), nu = arg("nu", 0), nc = arg("nc", 0);
+        c = rocsolver_cost_nominal(30 * n * n + 3 * n * n * (nv + nu + nc),
+                                   2 * n + 2 * n * (nv + nu + nc));
+    }
+    // auxiliary functions, with their leading order counts
+    else if(name == "larf")
+    {
+        double len = (left ? m : n);
+        c = rocsolver_cost_nominal(4 * m * n, 2 * m * n + len);
+    }
+    else if(name == "larfg")
+        c = rocsolver_cost_nominal(3 * n, 2 * n);
+    else if(name == "larft")
+        c = rocsolver_cost_nominal(k * k * n, n * k + k * k);
+    else if(name == "larfb")
+        c = rocsolver_cost_nominal(4 * m * n * k + (left ? n : m) * k * k,
+                                   (left ? m : n) * k + k * k + 2 * m * n);
+    else if(name == "labrd")
+        c = rocsolver_cost_nominal(8 * m * n * k, 2 * m * n + 2 * (m + n) * k);
+    else if(name == "latrd")
+        c = rocsolver_cost_nominal(4 * n * n * k, n * n + 2 * n * k);
+    else if(name == "lacgv")
+        c = rocsolver_cost_nominal(0, 2 * n);
+    else if(name == "laswp")
+    {
+        double k1 = arg("k1", 1), k2 = arg("k2", 1);
+        c = rocsolver_cost_nominal(0, 4 * n * (k2 - k1 + 1));
+        c.extra_bytes = sizeof(int) * (k2 - k1 + 1);
+    }
+    else
+        return false;
+
+    bool cplx = (precision == 'c' || precision == 'z');
+    double esize = (precision == 's' ? 4 : precision == 'd' || precision == 'c' ? 8 : 16);
+
+    *flops = batch_count * (cplx ? 6 * c.fmuls + 2 * c.fadds : c.fmuls + c.fadds);
+    *bytes = batch_count * (esize * c.elems + c.extra_bytes);
+    return true;
+}
@@ -8,6 +8,7 @@
 #include <ios>
 #include <limits>
 #include <sstream>
+#include <vector>
 
 // If USE_ROCBLAS_REALLOC_ON_DEMAND is false, automatic reallocation is disable and we will manually
 // reallocate workspace
@@ -57,6 +58,20 @@ inline void rocsolver_bench_output(T arg, Ts... args)
     rocsolver_bench_output(args...);
 }
 
+// per-iteration GPU times (in microseconds) of the timed calls of the current test;
+// the dispatcher moves them into Arguments::gpu_time_samples for the benchmark reports
+inline std::vector<double>& rocsolver_bench_samples()
+{
+    static std::vector<double> samples;
+    return samples;
+}
+
+inline double rocsolver_bench_sample(double time)
+{
+    rocsolver_bench_samples().push_back(time);
+    return time;
+}
+
 template <typename T, std::enable_if_t<!is_complex<T>, int> = 0>
 inline T sconj(T scalar)
 {
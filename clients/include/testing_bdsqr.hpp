@@ -394,7 +394,7 @@ void bdsqr_getPerfData(const rocblas_handle handle,
         start = get_time_us_sync(stream);
         rocsolver_bdsqr(handle, uplo, n, nv, nu, nc, dD.data(), dE.data(), dV.data(), ldv,
                         dU.data(), ldu, dC.data(), ldc, dInfo.data());
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        *gpu_time_used += rocsolver_bench_sample(get_time_us_sync(stream) - start);
     }
     *gpu_time_used /= hot_calls;
 }
@@ -429,7 +429,7 @@ void testing_bdsqr(Arguments& argus)
                                               (rocblas_int*)nullptr),
                               rocblas_status_invalid_value);
 
-        if(argus.timing)
+        if(argus.timing && !argus.quiet)
             ROCSOLVER_BENCH_INFORM(2);
 
         return;
@@ -481,7 +481,7 @@ void testing_bdsqr(Arguments& argus)
                                               (rocblas_int*)nullptr),
                               rocblas_status_invalid_size);
 
-        if(argus.timing)
+        if(argus.timing && !argus.quiet)
             ROCSOLVER_BENCH_INFORM(1);
 
         return;
@@ -520,7 +520,7 @@ void testing_bdsqr(Arguments& argus)
                                               (T*)nullptr, ldv, (T*)nullptr, ldu, (T*)nullptr, ldc,
                                               dInfo.data()),
                               rocblas_status_success);
-        if(argus.timing)
+        if(argus.timing && !argus.quiet)
             ROCSOLVER_BENCH_INFORM(0);
 
         return;
@@ -581,7 +581,10 @@ void testing_bdsqr(Arguments& argus)
     }
 
     // output results for rocsolver-bench
-    if(argus.timing)
+    argus.gpu_time_used = gpu_time_used;
+    argus.cpu_time_used = cpu_time_used;
+    argus.max_error = std::max(max_error, max_errorv);
+    if(argus.timing && !argus.quiet)
     {
         if(!argus.perf)
         {
@@ -396,7 +396,7 @@ void gebd2_gebrd_getPerfData(const rocblas_handle handle,
         start = get_time_us_sync(stream);
         rocsolver_gebd2_gebrd(STRIDED, GEBRD, handle, m, n, dA.data(), lda, stA, dD.data(), stD,
                               dE.data(), stE, dTauq.data(), stQ, dTaup.data(), stP, bc);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        *gpu_time_used += rocsolver_bench_sample(get_time_us_sync(stream) - start);
     }
     *gpu_time_used /= hot_calls;
 }
@@ -451,7 +451,7 @@ void testing_gebd2_gebrd(Arguments& argus)
                                                         stE, (T*)nullptr, stQ, (T*)nullptr, stP, bc),
                                   rocblas_status_invalid_size);
 
-        if(argus.timing)
+        if(argus.timing && !argus.quiet)
             ROCSOLVER_BENCH_INFORM(1);
 
         return;
@@ -507,7 +507,7 @@ void testing_gebd2_gebrd(Arguments& argus)
                                                         lda, stA, dD.data(), stD, dE.data(), stE,
                                                         dTauq.data(), stQ, dTaup.data(), stP, bc),
                                   rocblas_status_success);
-            if(argus.timing)
+            if(argus.timing && !argus.quiet)
                 ROCSOLVER_BENCH_INFORM(0);
 
             return;
@@ -558,7 +558,7 @@ void testing_gebd2_gebrd(Arguments& argus)
                                                         lda, stA, dD.data(), stD, dE.data(), stE,
                                                         dTauq.data(), stQ, dTaup.data(), stP, bc),
                                   rocblas_status_success);
-            if(argus.timing)
+            if(argus.timing && !argus.quiet)
                 ROCSOLVER_BENCH_INFORM(0);
 
             return;
@@ -583,7 +583,10 @@ void testing_gebd2_gebrd(Arguments& argus)
         ROCSOLVER_TEST_CHECK(T, max_error, m * n);
 
     // output results for rocsolver-bench
-    if(argus.timing)
+    argus.gpu_time_used = gpu_time_used;
+    argus.cpu_time_used = cpu_time_used;
+    argus.max_error = max_error;
+    if(argus.timing && !argus.quiet)
     {
         if(!argus.perf)
         {
@@ -332,7 +332,7 @@ void gels_getPerfData(const rocblas_handle handle,
         start = get_time_us_sync(stream);
         rocsolver_gels(STRIDED, handle, trans, m, n, nrhs, dA.data(), lda, stA, dB.data(), ldb, stB,
                        dInfo.data(), bc);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        *gpu_time_used += rocsolver_bench_sample(get_time_us_sync(stream) - start);
     }
     *gpu_time_used /= hot_calls;
 }
@@ -373,7 +373,7 @@ void testing_gels(Arguments& argus)
                                                  (rocblas_int*)nullptr, bc),
                                   rocblas_status_invalid_value);
 
-        if(argus.timing)
+        if(argus.timing && !argus.quiet)
             ROCSOLVER_BENCH_INFORM(2);
 
         return;
@@ -401,7 +401,7 @@ void testing_gels(Arguments& argus)
                                                  (rocblas_int*)nullptr, bc),
                                   rocblas_status_invalid_size);
 
-        if(argus.timing)
+        if(argus.timing && !argus.quiet)
             ROCSOLVER_BENCH_INFORM(1);
 
         return;
@@ -448,7 +448,7 @@ void testing_gels(Arguments& argus)
             EXPECT_ROCBLAS_STATUS(rocsolver_gels(STRIDED, handle, trans, m, n, nrhs, dA.data(), lda,
                                                  stA, dB.data(), ldb, stB, dInfo.data(), bc),
                                   rocblas_status_success);
-            if(argus.timing)
+            if(argus.timing && !argus.quiet)
                 ROCSOLVER_BENCH_INFORM(0);
 
             return;
@@ -489,7 +489,7 @@ void testing_gels(Arguments& argus)
             EXPECT_ROCBLAS_STATUS(rocsolver_gels(STRIDED, handle, trans, m, n, nrhs, dA.data(), lda,
                                                  stA, dB.data(), ldb, stB, dInfo.data(), bc),
                                   rocblas_status_success);
-            if(argus.timing)
+            if(argus.timing && !argus.quiet)
                 ROCSOLVER_BENCH_INFORM(0);
 
             return;
@@ -512,7 +512,10 @@ void testing_gels(Arguments& argus)
         ROCSOLVER_TEST_CHECK(T, max_error, max(m, n));
 
     // output results for rocsolver-bench
-    if(argus.timing)
+    argus.gpu_time_used = gpu_time_used;
+    argus.cpu_time_used = cpu_time_used;
+    argus.max_error = max_error;
+    if(argus.timing && !argus.quiet)
     {
         if(!argus.perf)
         {
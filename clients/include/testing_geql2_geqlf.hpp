@@ -239,7 +239,7 @@ void geql2_geqlf_getPerfData(const rocblas_handle handle,
         start = get_time_us_sync(stream);
         rocsolver_geql2_geqlf(STRIDED, GEQLF, handle, m, n, dA.data(), lda, stA, dIpiv.data(), stP,
                               bc);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        *gpu_time_used += rocsolver_bench_sample(get_time_us_sync(stream) - start);
     }
     *gpu_time_used /= hot_calls;
 }
@@ -284,7 +284,7 @@ void testing_geql2_geqlf(Arguments& argus)
                                                         lda, stA, (T*)nullptr, stP, bc),
                                   rocblas_status_invalid_size);
 
-        if(argus.timing)
+        if(argus.timing && !argus.quiet)
             ROCSOLVER_BENCH_INFORM(1);
 
         return;
@@ -325,7 +325,7 @@ void testing_geql2_geqlf(Arguments& argus)
             EXPECT_ROCBLAS_STATUS(rocsolver_geql2_geqlf(STRIDED, GEQLF, handle, m, n, dA.data(),
                                                         lda, stA, dIpiv.data(), stP, bc),
                                   rocblas_status_success);
-            if(argus.timing)
+            if(argus.timing && !argus.quiet)
                 ROCSOLVER_BENCH_INFORM(0);
 
             return;
@@ -362,7 +362,7 @@ void testing_geql2_geqlf(Arguments& argus)
             EXPECT_ROCBLAS_STATUS(rocsolver_geql2_geqlf(STRIDED, GEQLF, handle, m, n, dA.data(),
                                                         lda, stA, dIpiv.data(), stP, bc),
                                   rocblas_status_success);
-            if(argus.timing)
+            if(argus.timing && !argus.quiet)
                 ROCSOLVER_BENCH_INFORM(0);
 
             return;
@@ -387,7 +387,10 @@ void testing_geql2_geqlf(Arguments& argus)
         ROCSOLVER_TEST_CHECK(T, max_error, m);
 
     // output results for rocsolver-bench
-    if(argus.timing)
+    argus.gpu_time_used = gpu_time_used;
+    argus.cpu_time_used = cpu_time_used;
+    argus.max_error = max_error;
+    if(argus.timing && !argus.quiet)
     {
         if(!argus.perf)
         {
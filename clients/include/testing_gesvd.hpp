@@ -450,7 +450,7 @@ void gesvd_getPerfData(const rocblas_handle handle,
         rocsolver_gesvd(STRIDED, handle, left_svect, right_svect, m, n, dA.data(), lda, stA,
                         dS.data(), stS, dU.data(), ldu, stU, dV.data(), ldv, stV, dE.data(), stE,
                         fa, dinfo.data(), bc);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        *gpu_time_used += rocsolver_bench_sample(get_time_us_sync(stream) - start);
     }
     *gpu_time_used /= hot_calls;
 }
@@ -498,7 +498,7 @@ void testing_gesvd(Arguments& argus)
                                                   (rocblas_int*)nullptr, bc),
                                   rocblas_status_invalid_value);
 
-        if(argus.timing)
+        if(argus.timing && !argus.quiet)
             ROCSOLVER_BENCH_INFORM(2);
 
         return;
@@ -622,7 +622,7 @@ void testing_gesvd(Arguments& argus)
                                                   (rocblas_int*)nullptr, bc),
                                   rocblas_status_invalid_size);
 
-        if(argus.timing)
+        if(argus.timing && !argus.quiet)
             ROCSOLVER_BENCH_INFORM(1);
 
         return;
@@ -710,7 +710,7 @@ void testing_gesvd(Arguments& argus)
                                                   dV.data(), ldv, stV, dE.data(), stE, fa,
                                                   dinfo.data(), bc),
                                   rocblas_status_success);
-            if(argus.timing)
+            if(argus.timing && !argus.quiet)
                 ROCSOLVER_BENCH_INFORM(0);
 
             return;
@@ -752,7 +752,7 @@ void testing_gesvd(Arguments& argus)
                                                   dV.data(), ldv, stV, dE.data(), stE, fa,
                                                   dinfo.data(), bc),
                                   rocblas_status_success);
-            if(argus.timing)
+            if(argus.timing && !argus.quiet)
                 ROCSOLVER_BENCH_INFORM(0);
 
             return;
@@ -788,7 +788,10 @@ void testing_gesvd(Arguments& argus)
     }
 
     // output results for rocsolver-bench
-    if(argus.timing)
+    argus.gpu_time_used = gpu_time_used;
+    argus.cpu_time_used = cpu_time_used;
+    argus.max_error = std::max(max_error, max_errorv);
+    if(argus.timing && !argus.quiet)
     {
         if(svects)
             max_error = (max_error >= max_errorv) ? max_error : max_errorv;
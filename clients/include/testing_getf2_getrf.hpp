@@ -313,7 +313,7 @@ void getf2_getrf_getPerfData(const rocblas_handle handle,
         start = get_time_us_sync(stream);
         rocsolver_getf2_getrf(STRIDED, GETRF, handle, m, n, dA.data(), lda, stA, dIpiv.data(), stP,
                               dInfo.data(), bc);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        *gpu_time_used += rocsolver_bench_sample(get_time_us_sync(stream) - start);
     }
     *gpu_time_used /= hot_calls;
 }
@@ -361,7 +361,7 @@ void testing_getf2_getrf(Arguments& argus)
                                                         (rocblas_int*)nullptr, bc),
                                   rocblas_status_invalid_size);
 
-        if(argus.timing)
+        if(argus.timing && !argus.quiet)
             ROCSOLVER_BENCH_INFORM(1);
 
         return;
@@ -409,7 +409,7 @@ void testing_getf2_getrf(Arguments& argus)
             EXPECT_ROCBLAS_STATUS(rocsolver_getf2_getrf(STRIDED, GETRF, handle, m, n, dA.data(), lda,
                                                         stA, dIpiv.data(), stP, dInfo.data(), bc),
                                   rocblas_status_success);
-            if(argus.timing)
+            if(argus.timing && !argus.quiet)
                 ROCSOLVER_BENCH_INFORM(0);
 
             return;
@@ -452,7 +452,7 @@ void testing_getf2_getrf(Arguments& argus)
             EXPECT_ROCBLAS_STATUS(rocsolver_getf2_getrf(STRIDED, GETRF, handle, m, n, dA.data(), lda,
                                                         stA, dIpiv.data(), stP, dInfo.data(), bc),
                                   rocblas_status_success);
-            if(argus.timing)
+            if(argus.timing && !argus.quiet)
                 ROCSOLVER_BENCH_INFORM(0);
 
             return;
@@ -477,7 +477,10 @@ void testing_getf2_getrf(Arguments& argus)
         ROCSOLVER_TEST_CHECK(T, max_error, min(m, n));
 
     // output results for rocsolver-bench
-    if(argus.timing)
+    argus.gpu_time_used = gpu_time_used;
+    argus.cpu_time_used = cpu_time_used;
+    argus.max_error = max_error;
+    if(argus.timing && !argus.quiet)
     {
         if(!argus.perf)
         {
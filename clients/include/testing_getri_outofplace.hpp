@@ -318,7 +318,7 @@ void getri_outofplace_getPerfData(const rocblas_handle handle,
         start = get_time_us_sync(stream);
         rocsolver_getri_outofplace(STRIDED, handle, n, dA.data(), lda, stA, dIpiv.data(), stP,
                                    dC.data(), ldc, stC, dInfo.data(), bc);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        *gpu_time_used += rocsolver_bench_sample(get_time_us_sync(stream) - start);
     }
     *gpu_time_used /= hot_calls;
 }
@@ -367,7 +367,7 @@ void testing_getri_outofplace(Arguments& argus)
                                                              ldc, stC, (rocblas_int*)nullptr, bc),
                                   rocblas_status_invalid_size);
 
-        if(argus.timing)
+        if(argus.timing && !argus.quiet)
             ROCSOLVER_BENCH_INFORM(1);
 
         return;
@@ -418,7 +418,7 @@ void testing_getri_outofplace(Arguments& argus)
                                                              stA, dIpiv.data(), stP, dC.data(), ldc,
                                                              stC, dInfo.data(), bc),
                                   rocblas_status_success);
-            if(argus.timing)
+            if(argus.timing && !argus.quiet)
                 ROCSOLVER_BENCH_INFORM(0);
 
             return;
@@ -464,7 +464,7 @@ void testing_getri_outofplace(Arguments& argus)
                                                              stA, dIpiv.data(), stP, dC.data(), ldc,
                                                              stC, dInfo.data(), bc),
                                   rocblas_status_success);
-            if(argus.timing)
+            if(argus.timing && !argus.quiet)
                 ROCSOLVER_BENCH_INFORM(0);
 
             return;
@@ -489,7 +489,10 @@ void testing_getri_outofplace(Arguments& argus)
         ROCSOLVER_TEST_CHECK(T, max_error, n);
 
     // output results for rocsolver-bench
-    if(argus.timing)
+    argus.gpu_time_used = gpu_time_used;
+    argus.cpu_time_used = cpu_time_used;
+    argus.max_error = max_error;
+    if(argus.timing && !argus.quiet)
     {
         if(!argus.perf)
         {
@@ -279,7 +279,7 @@ void getrs_getPerfData(const rocblas_handle handle,
         start = get_time_us_sync(stream);
         rocsolver_getrs(STRIDED, handle, trans, m, nrhs, dA.data(), lda, stA, dIpiv.data(), stP,
                         dB.data(), ldb, stB, bc);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        *gpu_time_used += rocsolver_bench_sample(get_time_us_sync(stream) - start);
     }
     *gpu_time_used /= hot_calls;
 }
@@ -330,7 +330,7 @@ void testing_getrs(Arguments& argus)
                                                   stB, bc),
                                   rocblas_status_invalid_size);
 
-        if(argus.timing)
+        if(argus.timing && !argus.quiet)
             ROCSOLVER_BENCH_INFORM(1);
 
         return;
@@ -376,7 +376,7 @@ void testing_getrs(Arguments& argus)
             EXPECT_ROCBLAS_STATUS(rocsolver_getrs(STRIDED, handle, trans, m, nrhs, dA.data(), lda,
                                                   stA, dIpiv.data(), stP, dB.data(), ldb, stB, bc),
                                   rocblas_status_success);
-            if(argus.timing)
+            if(argus.timing && !argus.quiet)
                 ROCSOLVER_BENCH_INFORM(0);
 
             return;
@@ -417,7 +417,7 @@ void testing_getrs(Arguments& argus)
             EXPECT_ROCBLAS_STATUS(rocsolver_getrs(STRIDED, handle, trans, m, nrhs, dA.data(), lda,
                                                   stA, dIpiv.data(), stP, dB.data(), ldb, stB, bc),
                                   rocblas_status_success);
-            if(argus.timing)
+            if(argus.timing && !argus.quiet)
                 ROCSOLVER_BENCH_INFORM(0);
 
             return;
@@ -441,7 +441,10 @@ void testing_getrs(Arguments& argus)
         ROCSOLVER_TEST_CHECK(T, max_error, m);
 
     // output results for rocsolver-bench
-    if(argus.timing)
+    argus.gpu_time_used = gpu_time_used;
+    argus.cpu_time_used = cpu_time_used;
+    argus.max_error = max_error;
+    if(argus.timing && !argus.quiet)
     {
         if(!argus.perf)
         {
@@ -276,7 +276,7 @@ void labrd_getPerfData(const rocblas_handle handle,
         start = get_time_us_sync(stream);
         rocsolver_labrd(handle, m, n, nb, dA.data(), lda, dD.data(), dE.data(), dTauq.data(),
                         dTaup.data(), dX.data(), ldx, dY.data(), ldy);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        *gpu_time_used += rocsolver_bench_sample(get_time_us_sync(stream) - start);
     }
     *gpu_time_used /= hot_calls;
 }
@@ -323,7 +323,7 @@ void testing_labrd(Arguments& argus)
                                               ldx, (T*)nullptr, ldy),
                               rocblas_status_invalid_size);
 
-        if(argus.timing)
+        if(argus.timing && !argus.quiet)
             ROCSOLVER_BENCH_INFORM(1);
 
         return;
@@ -382,7 +382,7 @@ void testing_labrd(Arguments& argus)
                                               dE.data(), dTauq.data(), dTaup.data(), dX.data(), ldx,
                                               dY.data(), ldy),
                               rocblas_status_success);
-        if(argus.timing)
+        if(argus.timing && !argus.quiet)
             ROCSOLVER_BENCH_INFORM(0);
 
         return;
@@ -405,7 +405,10 @@ void testing_labrd(Arguments& argus)
         ROCSOLVER_TEST_CHECK(T, max_error, nb * max(m, n));
 
     // output results for rocsolver-bench
-    if(argus.timing)
+    argus.gpu_time_used = gpu_time_used;
+    argus.cpu_time_used = cpu_time_used;
+    argus.max_error = max_error;
+    if(argus.timing && !argus.quiet)
     {
         if(!argus.perf)
         {
@@ -135,7 +135,7 @@ void lacgv_getPerfData(const rocblas_handle handle,
 
         start = get_time_us_sync(stream);
         rocsolver_lacgv(handle, n, dA.data(), inc);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        *gpu_time_used += rocsolver_bench_sample(get_time_us_sync(stream) - start);
     }
     *gpu_time_used /= hot_calls;
 }
@@ -166,7 +166,7 @@ void testing_lacgv(Arguments& argus)
         EXPECT_ROCBLAS_STATUS(rocsolver_lacgv(handle, n, (T*)nullptr, inc),
                               rocblas_status_invalid_size);
 
-        if(argus.timing)
+        if(argus.timing && !argus.quiet)
             ROCSOLVER_BENCH_INFORM(1);
 
         return;
@@ -195,7 +195,7 @@ void testing_lacgv(Arguments& argus)
     {
         EXPECT_ROCBLAS_STATUS(rocsolver_lacgv(handle, n, dA.data(), inc), rocblas_status_success);
 
-        if(argus.timing)
+        if(argus.timing && !argus.quiet)
             ROCSOLVER_BENCH_INFORM(0);
 
         return;
@@ -216,7 +216,10 @@ void testing_lacgv(Arguments& argus)
         ROCSOLVER_TEST_CHECK(T, max_error, 0);
 
     // output results for rocsolver-bench
-    if(argus.timing)
+    argus.gpu_time_used = gpu_time_used;
+    argus.cpu_time_used = cpu_time_used;
+    argus.max_error = max_error;
+    if(argus.timing && !argus.quiet)
     {
         if(!argus.perf)
         {
@@ -205,7 +205,7 @@ void larf_getPerfData(const rocblas_handle handle,
 
         start = get_time_us_sync(stream);
         rocsolver_larf(handle, side, m, n, dx.data(), inc, dt.data(), dA.data(), lda);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        *gpu_time_used += rocsolver_bench_sample(get_time_us_sync(stream) - start);
     }
     *gpu_time_used /= hot_calls;
 }
@@ -231,7 +231,7 @@ void testing_larf(Arguments& argus)
             rocsolver_larf(handle, side, m, n, (T*)nullptr, inc, (T*)nullptr, (T*)nullptr, lda),
             rocblas_status_invalid_value);
 
-        if(argus.timing)
+        if(argus.timing && !argus.quiet)
             ROCSOLVER_BENCH_INFORM(2);
 
         return;
@@ -254,7 +254,7 @@ void testing_larf(Arguments& argus)
             rocsolver_larf(handle, side, m, n, (T*)nullptr, inc, (T*)nullptr, (T*)nullptr, lda),
             rocblas_status_invalid_size);
 
-        if(argus.timing)
+        if(argus.timing && !argus.quiet)
             ROCSOLVER_BENCH_INFORM(1);
 
         return;
@@ -294,7 +294,7 @@ void testing_larf(Arguments& argus)
             rocsolver_larf(handle, side, m, n, dx.data(), inc, dt.data(), dA.data(), lda),
             rocblas_status_success);
 
-        if(argus.timing)
+        if(argus.timing && !argus.quiet)
             ROCSOLVER_BENCH_INFORM(0);
 
         return;
@@ -315,7 +315,10 @@ void testing_larf(Arguments& argus)
         ROCSOLVER_TEST_CHECK(T, max_error, size_x);
 
     // output results for rocsolver-bench
-    if(argus.timing)
+    argus.gpu_time_used = gpu_time_used;
+    argus.cpu_time_used = cpu_time_used;
+    argus.max_error = max_error;
+    if(argus.timing && !argus.quiet)
     {
         if(!argus.perf)
         {
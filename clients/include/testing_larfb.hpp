@@ -335,7 +335,7 @@ void larfb_getPerfData(const rocblas_handle handle,
         start = get_time_us_sync(stream);
         rocsolver_larfb(handle, side, trans, direct, storev, m, n, k, dV.data(), ldv, dT.data(),
                         ldt, dA.data(), lda);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        *gpu_time_used += rocsolver_bench_sample(get_time_us_sync(stream) - start);
     }
     *gpu_time_used /= hot_calls;
 }
@@ -369,7 +369,7 @@ void testing_larfb(Arguments& argus)
                                               (T*)nullptr, ldv, (T*)nullptr, ldt, (T*)nullptr, lda),
                               rocblas_status_invalid_value);
 
-        if(argus.timing)
+        if(argus.timing && !argus.quiet)
             ROCSOLVER_BENCH_INFORM(2);
 
         return;
@@ -398,7 +398,7 @@ void testing_larfb(Arguments& argus)
                                               (T*)nullptr, ldv, (T*)nullptr, ldt, (T*)nullptr, lda),
                               rocblas_status_invalid_size);
 
-        if(argus.timing)
+        if(argus.timing && !argus.quiet)
             ROCSOLVER_BENCH_INFORM(1);
 
         return;
@@ -438,7 +438,7 @@ void testing_larfb(Arguments& argus)
                                               dV.data(), ldv, dT.data(), ldt, dA.data(), lda),
                               rocblas_status_success);
 
-        if(argus.timing)
+        if(argus.timing && !argus.quiet)
             ROCSOLVER_BENCH_INFORM(0);
 
         return;
@@ -461,7 +461,10 @@ void testing_larfb(Arguments& argus)
         ROCSOLVER_TEST_CHECK(T, max_error, s);
 
     // output results for rocsolver-bench
-    if(argus.timing)
+    argus.gpu_time_used = gpu_time_used;
+    argus.cpu_time_used = cpu_time_used;
+    argus.max_error = max_error;
+    if(argus.timing && !argus.quiet)
     {
         if(!argus.perf)
         {
@@ -177,7 +177,7 @@ void laswp_getPerfData(const rocblas_handle handle,
 
         start = get_time_us_sync(stream);
         rocsolver_laswp(handle, n, dA.data(), lda, k1, k2, dIpiv.data(), inc);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        *gpu_time_used += rocsolver_bench_sample(get_time_us_sync(stream) - start);
     }
     *gpu_time_used /= hot_calls;
 }
@@ -213,7 +213,7 @@ void testing_laswp(Arguments& argus)
             rocsolver_laswp(handle, n, (T*)nullptr, lda, k1, k2, (rocblas_int*)nullptr, inc),
             rocblas_status_invalid_size);
 
-        if(argus.timing)
+        if(argus.timing && !argus.quiet)
             ROCSOLVER_BENCH_INFORM(1);
 
         return;
@@ -248,7 +248,7 @@ void testing_laswp(Arguments& argus)
         EXPECT_ROCBLAS_STATUS(rocsolver_laswp(handle, n, dA.data(), lda, k1, k2, dIpiv.data(), inc),
                               rocblas_status_success);
 
-        if(argus.timing)
+        if(argus.timing && !argus.quiet)
             ROCSOLVER_BENCH_INFORM(0);
 
         return;
@@ -269,7 +269,10 @@ void testing_laswp(Arguments& argus)
         ROCSOLVER_TEST_CHECK(T, max_error, 0);
 
     // output results for rocsolver-bench
-    if(argus.timing)
+    argus.gpu_time_used = gpu_time_used;
+    argus.cpu_time_used = cpu_time_used;
+    argus.max_error = max_error;
+    if(argus.timing && !argus.quiet)
     {
         if(!argus.perf)
         {
@@ -237,7 +237,7 @@ void latrd_getPerfData(const rocblas_handle handle,
 
         start = get_time_us_sync(stream);
         rocsolver_latrd(handle, uplo, n, k, dA.data(), lda, dE.data(), dTau.data(), dW.data(), ldw);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        *gpu_time_used += rocsolver_bench_sample(get_time_us_sync(stream) - start);
     }
     *gpu_time_used /= hot_calls;
 }
@@ -265,7 +265,7 @@ void testing_latrd(Arguments& argus)
                                               (T*)nullptr, (T*)nullptr, ldw),
                               rocblas_status_invalid_value);
 
-        if(argus.timing)
+        if(argus.timing && !argus.quiet)
             ROCSOLVER_BENCH_INFORM(2);
 
         return;
@@ -289,7 +289,7 @@ void testing_latrd(Arguments& argus)
                                               (T*)nullptr, (T*)nullptr, ldw),
                               rocblas_status_invalid_size);
 
-        if(argus.timing)
+        if(argus.timing && !argus.quiet)
             ROCSOLVER_BENCH_INFORM(1);
 
         return;
@@ -333,7 +333,7 @@ void testing_latrd(Arguments& argus)
         EXPECT_ROCBLAS_STATUS(rocsolver_latrd(handle, uplo, n, k, dA.data(), lda, dE.data(),
                                               dTau.data(), dW.data(), ldw),
                               rocblas_status_success);
-        if(argus.timing)
+        if(argus.timing && !argus.quiet)
             ROCSOLVER_BENCH_INFORM(0);
 
         return;
@@ -355,7 +355,10 @@ void testing_latrd(Arguments& argus)
         ROCSOLVER_TEST_CHECK(T, max_error, k * n);
 
     // output results for rocsolver-bench
-    if(argus.timing)
+    argus.gpu_time_used = gpu_time_used;
+    argus.cpu_time_used = cpu_time_used;
+    argus.max_error = max_error;
+    if(argus.timing && !argus.quiet)
     {
         if(!argus.perf)
         {
@@ -280,7 +280,7 @@ void ormbr_unmbr_getPerfData(const rocblas_handle handle,
         start = get_time_us_sync(stream);
         rocsolver_ormbr_unmbr(handle, storev, side, trans, m, n, k, dA.data(), lda, dIpiv.data(),
                               dC.data(), ldc);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        *gpu_time_used += rocsolver_bench_sample(get_time_us_sync(stream) - start);
     }
     *gpu_time_used /= hot_calls;
 }
@@ -324,7 +324,7 @@ void testing_ormbr_unmbr(Arguments& argus)
                                                     (T*)nullptr, lda, (T*)nullptr, (T*)nullptr, ldc),
                               rocblas_status_invalid_value);
 
-        if(argus.timing)
+        if(argus.timing && !argus.quiet)
             ROCSOLVER_BENCH_INFORM(2);
 
         return;
@@ -350,7 +350,7 @@ void testing_ormbr_unmbr(Arguments& argus)
                                                     (T*)nullptr, lda, (T*)nullptr, (T*)nullptr, ldc),
                               rocblas_status_invalid_size);
 
-        if(argus.timing)
+        if(argus.timing && !argus.quiet)
             ROCSOLVER_BENCH_INFORM(1);
 
         return;
@@ -390,7 +390,7 @@ void testing_ormbr_unmbr(Arguments& argus)
                                                     lda, dIpiv.data(), dC.data(), ldc),
                               rocblas_status_success);
 
-        if(argus.timing)
+        if(argus.timing && !argus.quiet)
             ROCSOLVER_BENCH_INFORM(0);
 
         return;
@@ -413,7 +413,10 @@ void testing_ormbr_unmbr(Arguments& argus)
         ROCSOLVER_TEST_CHECK(T, max_error, s);
 
     // output results for rocsolver-bench
-    if(argus.timing)
+    argus.gpu_time_used = gpu_time_used;
+    argus.cpu_time_used = cpu_time_used;
+    argus.max_error = max_error;
+    if(argus.timing && !argus.quiet)
     {
         if(!argus.perf)
         {
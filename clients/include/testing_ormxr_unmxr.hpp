@@ -251,7 +251,7 @@ void ormxr_unmxr_getPerfData(const rocblas_handle handle,
         start = get_time_us_sync(stream);
         rocsolver_ormxr_unmxr(MQR, handle, side, trans, m, n, k, dA.data(), lda, dIpiv.data(),
                               dC.data(), ldc);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        *gpu_time_used += rocsolver_bench_sample(get_time_us_sync(stream) - start);
     }
     *gpu_time_used /= hot_calls;
 }
@@ -293,7 +293,7 @@ void testing_ormxr_unmxr(Arguments& argus)
                                                     lda, (T*)nullptr, (T*)nullptr, ldc),
                               rocblas_status_invalid_value);
 
-        if(argus.timing)
+        if(argus.timing && !argus.quiet)
             ROCSOLVER_BENCH_INFORM(2);
 
         return;
@@ -317,7 +317,7 @@ void testing_ormxr_unmxr(Arguments& argus)
                                                     lda, (T*)nullptr, (T*)nullptr, ldc),
                               rocblas_status_invalid_size);
 
-        if(argus.timing)
+        if(argus.timing && !argus.quiet)
             ROCSOLVER_BENCH_INFORM(1);
 
         return;
@@ -357,7 +357,7 @@ void testing_ormxr_unmxr(Arguments& argus)
                                                     lda, dIpiv.data(), dC.data(), ldc),
                               rocblas_status_success);
 
-        if(argus.timing)
+        if(argus.timing && !argus.quiet)
             ROCSOLVER_BENCH_INFORM(0);
 
         return;
@@ -381,7 +381,10 @@ void testing_ormxr_unmxr(Arguments& argus)
         ROCSOLVER_TEST_CHECK(T, max_error, s);
 
     // output results for rocsolver-bench
-    if(argus.timing)
+    argus.gpu_time_used = gpu_time_used;
+    argus.cpu_time_used = cpu_time_used;
+    argus.max_error = max_error;
+    if(argus.timing && !argus.quiet)
     {
         if(!argus.perf)
         {
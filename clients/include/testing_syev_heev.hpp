@@ -322,7 +322,7 @@ void syev_heev_getPerfData(const rocblas_handle handle,
         start = get_time_us_sync(stream);
         rocsolver_syev_heev(STRIDED, handle, evect, uplo, n, dA.data(), lda, stA, dD.data(), stD,
                             dE.data(), stE, dinfo.data(), bc);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        *gpu_time_used += rocsolver_bench_sample(get_time_us_sync(stream) - start);
     }
     *gpu_time_used /= hot_calls;
 }
@@ -361,7 +361,7 @@ void testing_syev_heev(Arguments& argus)
                                                       (rocblas_int*)nullptr, bc),
                                   rocblas_status_invalid_value);
 
-        if(argus.timing)
+        if(argus.timing && !argus.quiet)
             ROCSOLVER_BENCH_INFORM(2);
 
         return;
@@ -391,7 +391,7 @@ void testing_syev_heev(Arguments& argus)
                                                       (rocblas_int*)nullptr, bc),
                                   rocblas_status_invalid_size);
 
-        if(argus.timing)
+        if(argus.timing && !argus.quiet)
             ROCSOLVER_BENCH_INFORM(1);
 
         return;
@@ -448,7 +448,7 @@ void testing_syev_heev(Arguments& argus)
                                                       lda, stA, dD.data(), stD, dE.data(), stE,
                                                       dinfo.data(), bc),
                                   rocblas_status_success);
-            if(argus.timing)
+            if(argus.timing && !argus.quiet)
                 ROCSOLVER_BENCH_INFORM(0);
 
             return;
@@ -487,7 +487,7 @@ void testing_syev_heev(Arguments& argus)
                                                       lda, stA, dD.data(), stD, dE.data(), stE,
                                                       dinfo.data(), bc),
                                   rocblas_status_success);
-            if(argus.timing)
+            if(argus.timing && !argus.quiet)
                 ROCSOLVER_BENCH_INFORM(0);
 
             return;
@@ -516,7 +516,10 @@ void testing_syev_heev(Arguments& argus)
         ROCSOLVER_TEST_CHECK(T, max_error, n);
 
     // output results for rocsolver-bench
-    if(argus.timing)
+    argus.gpu_time_used = gpu_time_used;
+    argus.cpu_time_used = cpu_time_used;
+    argus.max_error = max_error;
+    if(argus.timing && !argus.quiet)
     {
         if(!argus.perf)
         {
@@ -0,0 +1,647 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "clientcommon.hpp"
+#include "lapack_host_reference.hpp"
+#include "norm.hpp"
+#include "rocsolver.hpp"
+#include "rocsolver_arguments.hpp"
+#include "rocsolver_test.hpp"
+
+template <bool STRIDED, typename T, typename S, typename SS, typename U>
+void syevj_heevj_checkBadArgs(const rocblas_handle handle,
+                              const rocblas_evect evect,
+                              const rocblas_fill uplo,
+                              const rocblas_int n,
+                              T dA,
+                              const rocblas_int lda,
+                              const rocblas_stride stA,
+                              const SS abstol,
+                              S dResidual,
+                              const rocblas_int max_sweeps,
+                              U dSweeps,
+                              S dW,
+                              const rocblas_stride stW,
+                              U dinfo,
+                              const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_syevj_heevj(STRIDED, nullptr, evect, uplo, n, dA, lda, stA,
+                                                abstol, dResidual, max_sweeps, dSweeps, dW, stW,
+                                                dinfo, bc),
+                          rocblas_status_invalid_handle);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(rocsolver_syevj_heevj(STRIDED, handle, rocblas_evect(-1), uplo, n, dA,
+                                                lda, stA, abstol, dResidual, max_sweeps, dSweeps,
+                                                dW, stW, dinfo, bc),
+                          rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(rocsolver_syevj_heevj(STRIDED, handle, evect, rocblas_fill_full, n, dA,
+                                                lda, stA, abstol, dResidual, max_sweeps, dSweeps,
+                                                dW, stW, dinfo, bc),
+                          rocblas_status_invalid_value);
+
+    // sizes (only check batch_count if applicable)
+    EXPECT_ROCBLAS_STATUS(rocsolver_syevj_heevj(STRIDED, handle, evect, uplo, n, dA, lda, stA,
+                                                abstol, dResidual, 0, dSweeps, dW, stW, dinfo, bc),
+                          rocblas_status_invalid_size);
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_syevj_heevj(STRIDED, handle, evect, uplo, n, dA, lda, stA,
+                                                    abstol, dResidual, max_sweeps, dSweeps, dW,
+                                                    stW, dinfo, -1),
+                              rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_syevj_heevj(STRIDED, handle, evect, uplo, n, (T) nullptr, lda,
+                                                stA, abstol, dResidual, max_sweeps, dSweeps, dW,
+                                                stW, dinfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_syevj_heevj(STRIDED, handle, evect, uplo, n, dA, lda, stA,
+                                                abstol, (S) nullptr, max_sweeps, dSweeps, dW, stW,
+                                                dinfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_syevj_heevj(STRIDED, handle, evect, uplo, n, dA, lda, stA,
+                                                abstol, dResidual, max_sweeps, (U) nullptr, dW,
+                                                stW, dinfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_syevj_heevj(STRIDED, handle, evect, uplo, n, dA, lda, stA,
+                                                abstol, dResidual, max_sweeps, dSweeps,
+                                                (S) nullptr, stW, dinfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_syevj_heevj(STRIDED, handle, evect, uplo, n, dA, lda, stA,
+                                                abstol, dResidual, max_sweeps, dSweeps, dW, stW,
+                                                (U) nullptr, bc),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_syevj_heevj(STRIDED, handle, evect, uplo, 0, (T) nullptr, lda,
+                                                stA, abstol, dResidual, max_sweeps, dSweeps,
+                                                (S) nullptr, stW, dinfo, bc),
+                          rocblas_status_success);
+
+    // quick return with zero batch_count if applicable
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_syevj_heevj(STRIDED, handle, evect, uplo, n, dA, lda, stA,
+                                                    abstol, (S) nullptr, max_sweeps, (U) nullptr,
+                                                    dW, stW, (U) nullptr, 0),
+                              rocblas_status_success);
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_syevj_heevj_bad_arg()
+{
+    using S = decltype(std::real(T{}));
+
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_evect evect = rocblas_evect_none;
+    rocblas_fill uplo = rocblas_fill_lower;
+    rocblas_int n = 1;
+    rocblas_int lda = 1;
+    rocblas_stride stA = 1;
+    S abstol = 0;
+    rocblas_int max_sweeps = 100;
+    rocblas_stride stW = 1;
+    rocblas_int bc = 1;
+
+    if(BATCHED)
+    {
+        // memory allocations
+        device_batch_vector<T> dA(1, 1, 1);
+        device_strided_batch_vector<S> dResidual(1, 1, 1, 1);
+        device_strided_batch_vector<rocblas_int> dSweeps(1, 1, 1, 1);
+        device_strided_batch_vector<S> dW(1, 1, 1, 1);
+        device_strided_batch_vector<rocblas_int> dinfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dResidual.memcheck());
+        CHECK_HIP_ERROR(dSweeps.memcheck());
+        CHECK_HIP_ERROR(dW.memcheck());
+        CHECK_HIP_ERROR(dinfo.memcheck());
+
+        // check bad arguments
+        syevj_heevj_checkBadArgs<STRIDED>(handle, evect, uplo, n, dA.data(), lda, stA, abstol,
+                                          dResidual.data(), max_sweeps, dSweeps.data(), dW.data(),
+                                          stW, dinfo.data(), bc);
+    }
+    else
+    {
+        // memory allocations
+        device_strided_batch_vector<T> dA(1, 1, 1, 1);
+        device_strided_batch_vector<S> dResidual(1, 1, 1, 1);
+        device_strided_batch_vector<rocblas_int> dSweeps(1, 1, 1, 1);
+        device_strided_batch_vector<S> dW(1, 1, 1, 1);
+        device_strided_batch_vector<rocblas_int> dinfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dResidual.memcheck());
+        CHECK_HIP_ERROR(dSweeps.memcheck());
+        CHECK_HIP_ERROR(dW.memcheck());
+        CHECK_HIP_ERROR(dinfo.memcheck());
+
+        // check bad arguments
+        syevj_heevj_checkBadArgs<STRIDED>(handle, evect, uplo, n, dA.data(), lda, stA, abstol,
+                                          dResidual.data(), max_sweeps, dSweeps.data(), dW.data(),
+                                          stW, dinfo.data(), bc);
+    }
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void syevj_heevj_initData(const rocblas_handle handle,
+                          const rocblas_evect evect,
+                          const rocblas_int n,
+                          Td& dA,
+                          const rocblas_int lda,
+                          const rocblas_int bc,
+                          Th& hA,
+                          std::vector<T>& A,
+                          bool test = true)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+
+        // scale A to avoid singularities
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            for(rocblas_int i = 0; i < n; i++)
+            {
+                for(rocblas_int j = 0; j < n; j++)
+                {
+                    if(i == j)
+                        hA[b][i + j * lda] += 400;
+                    else
+                        hA[b][i + j * lda] -= 4;
+                }
+            }
+
+            // make copy of original data to test vectors if required
+            if(test && evect == rocblas_evect_original)
+            {
+                for(rocblas_int i = 0; i < n; i++)
+                {
+                    for(rocblas_int j = 0; j < n; j++)
+                        A[b * lda * n + i + j * lda] = hA[b][i + j * lda];
+                }
+            }
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+    }
+}
+
+template <bool STRIDED, typename T, typename Sd, typename Td, typename Id, typename Sh, typename Th, typename Ih>
+void syevj_heevj_getError(const rocblas_handle handle,
+                          const rocblas_evect evect,
+                          const rocblas_fill uplo,
+                          const rocblas_int n,
+                          Td& dA,
+                          const rocblas_int lda,
+                          const rocblas_stride stA,
+                          const double abstol,
+                          Sd& dResidual,
+                          const rocblas_int max_sweeps,
+                          Id& dSweeps,
+                          Sd& dW,
+                          const rocblas_stride stW,
+                          Id& dinfo,
+                          const rocblas_int bc,
+                          Th& hA,
+                          Th& hAres,
+                          Sh& hResidualRes,
+                          Ih& hSweepsRes,
+                          Sh& hW,
+                          Sh& hWres,
+                          Ih& hinfo,
+                          Ih& hinfoRes,
+                          double* max_err)
+{
+    constexpr bool COMPLEX = is_complex<T>;
+    using S = decltype(std::real(T{}));
+
+    rocblas_int lwork = (COMPLEX ? 2 * n + n * n : 1 + 6 * n + 2 * n * n);
+    rocblas_int lrwork = (COMPLEX ? 1 + 5 * n + 2 * n * n : 0);
+    rocblas_int liwork = 3 + 5 * n;
+    std::vector<T> work(lwork);
+    std::vector<S> rwork(lrwork);
+    std::vector<rocblas_int> iwork(liwork);
+    std::vector<T> A(lda * n * bc);
+
+    // input data initialization
+    syevj_heevj_initData<true, true, T>(handle, evect, n, dA, lda, bc, hA, A);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_syevj_heevj(STRIDED, handle, evect, uplo, n, dA.data(), lda, stA,
+                                              abstol, dResidual.data(), max_sweeps, dSweeps.data(),
+                                              dW.data(), stW, dinfo.data(), bc));
+
+    CHECK_HIP_ERROR(hResidualRes.transfer_from(dResidual));
+    CHECK_HIP_ERROR(hSweepsRes.transfer_from(dSweeps));
+    CHECK_HIP_ERROR(hWres.transfer_from(dW));
+    CHECK_HIP_ERROR(hinfoRes.transfer_from(dinfo));
+    if(evect == rocblas_evect_original)
+        CHECK_HIP_ERROR(hAres.transfer_from(dA));
+
+    // CPU lapack
+    // (the eigenvalues of the reference are computed with the divide-and-conquer method)
+    for(rocblas_int b = 0; b < bc; ++b)
+        cblas_syevd_heevd<T>(rocblas_evect_none, uplo, n, hA[b], lda, hW[b], work.data(), lwork,
+                             rwork.data(), lrwork, iwork.data(), liwork, hinfo[b]);
+
+    // Check info and sweeps for non-convergence
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        if(hinfo[b][0] != hinfoRes[b][0])
+            *max_err += 1;
+        if(hSweepsRes[b][0] < 0 || hSweepsRes[b][0] > max_sweeps)
+            *max_err += 1;
+        if(hResidualRes[b][0] < 0)
+            *max_err += 1;
+    }
+
+    // (We expect the used input matrices to always converge. Testing
+    // implicitly the equivalent non-converged matrix is very complicated and it boils
+    // down to essentially run the algorithm again and until convergence is achieved).
+
+    double err = 0;
+
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        if(hinfoRes[b][0] != 0)
+            continue;
+
+        // the eigenvalues can always be compared with LAPACK
+        // error is ||hW - hWRes|| / ||hW||
+        // using frobenius norm
+        err = norm_error('F', 1, n, 1, hW[b], hWres[b]);
+        *max_err = err > *max_err ? err : *max_err;
+
+        if(evect == rocblas_evect_original)
+        {
+            // need to implicitly test eigenvectors due to non-uniqueness of
+            // eigenvectors under scaling
+
+            // multiply A with each of the n eigenvectors and divide by corresponding
+            // eigenvalues
+            T alpha;
+            T beta = 0;
+            for(int j = 0; j < n; j++)
+            {
+                alpha = T(1) / hWres[b][j];
+                cblas_symv_hemv(uplo, n, alpha, A.data() + b * lda * n, lda, hAres[b] + j * lda, 1,
+                                beta, hA[b] + j * lda, 1);
+            }
+
+            // error is ||hA - hARes|| / ||hA||
+            // using frobenius norm
+            err = norm_error('F', n, n, lda, hA[b], hAres[b]);
+            *max_err = err > *max_err ? err : *max_err;
+        }
+    }
+}
+
+template <bool STRIDED, typename T, typename Sd, typename Td, typename Id, typename Sh, typename Th, typename Ih>
+void syevj_heevj_getPerfData(const rocblas_handle handle,
+                             const rocblas_evect evect,
+                             const rocblas_fill uplo,
+                             const rocblas_int n,
+                             Td& dA,
+                             const rocblas_int lda,
+                             const rocblas_stride stA,
+                             const double abstol,
+                             Sd& dResidual,
+                             const rocblas_int max_sweeps,
+                             Id& dSweeps,
+                             Sd& dW,
+                             const rocblas_stride stW,
+                             Id& dinfo,
+                             const rocblas_int bc,
+                             Th& hA,
+                             Sh& hW,
+                             Ih& hinfo,
+                             double* gpu_time_used,
+                             double* cpu_time_used,
+                             const rocblas_int hot_calls,
+                             const bool perf)
+{
+    constexpr bool COMPLEX = is_complex<T>;
+    using S = decltype(std::real(T{}));
+
+    rocblas_int lwork = (COMPLEX ? 2 * n + n * n : 1 + 6 * n + 2 * n * n);
+    rocblas_int lrwork = (COMPLEX ? 1 + 5 * n + 2 * n * n : 0);
+    rocblas_int liwork = 3 + 5 * n;
+    std::vector<T> work(lwork);
+    std::vector<S> rwork(lrwork);
+    std::vector<rocblas_int> iwork(liwork);
+    std::vector<T> A;
+
+    if(!perf)
+    {
+        syevj_heevj_initData<true, false, T>(handle, evect, n, dA, lda, bc, hA, A, 0);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int b = 0; b < bc; ++b)
+            cblas_syevd_heevd<T>(evect, uplo, n, hA[b], lda, hW[b], work.data(), lwork,
+                                 rwork.data(), lrwork, iwork.data(), liwork, hinfo[b]);
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    syevj_heevj_initData<true, false, T>(handle, evect, n, dA, lda, bc, hA, A, 0);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        syevj_heevj_initData<false, true, T>(handle, evect, n, dA, lda, bc, hA, A, 0);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_syevj_heevj(STRIDED, handle, evect, uplo, n, dA.data(), lda,
+                                                  stA, abstol, dResidual.data(), max_sweeps,
+                                                  dSweeps.data(), dW.data(), stW, dinfo.data(), bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        syevj_heevj_initData<false, true, T>(handle, evect, n, dA, lda, bc, hA, A, 0);
+
+        start = get_time_us_sync(stream);
+        rocsolver_syevj_heevj(STRIDED, handle, evect, uplo, n, dA.data(), lda, stA, abstol,
+                              dResidual.data(), max_sweeps, dSweeps.data(), dW.data(), stW,
+                              dinfo.data(), bc);
+        *gpu_time_used += rocsolver_bench_sample(get_time_us_sync(stream) - start);
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_syevj_heevj(Arguments& argus)
+{
+    using S = decltype(std::real(T{}));
+
+    // get arguments
+    rocblas_local_handle handle;
+    char evectC = argus.get<char>("evect");
+    char uploC = argus.get<char>("uplo");
+    rocblas_int n = argus.get<rocblas_int>("n");
+    rocblas_int lda = argus.get<rocblas_int>("lda", n);
+    rocblas_stride stA = argus.get<rocblas_stride>("strideA", lda * n);
+    double abstol = argus.get<double>("abstol", 0);
+    rocblas_int max_sweeps = argus.get<rocblas_int>("max_sweeps", 100);
+    rocblas_stride stW = argus.get<rocblas_stride>("strideW", n);
+
+    rocblas_evect evect = char2rocblas_evect(evectC);
+    rocblas_fill uplo = char2rocblas_fill(uploC);
+    rocblas_int bc = argus.batch_count;
+    rocblas_int hot_calls = argus.iters;
+
+    // check non-supported values
+    if(uplo == rocblas_fill_full || evect == rocblas_evect_tridiagonal)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_syevj_heevj(STRIDED, handle, evect, uplo, n,
+                                                        (T* const*)nullptr, lda, stA, abstol,
+                                                        (S*)nullptr, max_sweeps,
+                                                        (rocblas_int*)nullptr, (S*)nullptr, stW,
+                                                        (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_value);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_syevj_heevj(STRIDED, handle, evect, uplo, n,
+                                                        (T*)nullptr, lda, stA, abstol, (S*)nullptr,
+                                                        max_sweeps, (rocblas_int*)nullptr,
+                                                        (S*)nullptr, stW, (rocblas_int*)nullptr,
+                                                        bc),
+                                  rocblas_status_invalid_value);
+
+        if(argus.timing && !argus.quiet)
+            ROCSOLVER_BENCH_INFORM(2);
+
+        return;
+    }
+
+    // determine sizes
+    size_t size_A = size_t(lda) * n;
+    size_t size_W = n;
+    size_t size_Ares = (argus.unit_check || argus.norm_check) ? size_A : 0;
+    size_t size_Wres = (argus.unit_check || argus.norm_check) ? size_W : 0;
+
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || lda < n || max_sweeps <= 0 || bc < 0);
+    if(invalid_size)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_syevj_heevj(STRIDED, handle, evect, uplo, n,
+                                                        (T* const*)nullptr, lda, stA, abstol,
+                                                        (S*)nullptr, max_sweeps,
+                                                        (rocblas_int*)nullptr, (S*)nullptr, stW,
+                                                        (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_syevj_heevj(STRIDED, handle, evect, uplo, n,
+                                                        (T*)nullptr, lda, stA, abstol, (S*)nullptr,
+                                                        max_sweeps, (rocblas_int*)nullptr,
+                                                        (S*)nullptr, stW, (rocblas_int*)nullptr,
+                                                        bc),
+                                  rocblas_status_invalid_size);
+
+        if(argus.timing && !argus.quiet)
+            ROCSOLVER_BENCH_INFORM(1);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(!USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        if(BATCHED)
+            CHECK_ALLOC_QUERY(rocsolver_syevj_heevj(STRIDED, handle, evect, uplo, n,
+                                                    (T* const*)nullptr, lda, stA, abstol,
+                                                    (S*)nullptr, max_sweeps, (rocblas_int*)nullptr,
+                                                    (S*)nullptr, stW, (rocblas_int*)nullptr, bc));
+        else
+            CHECK_ALLOC_QUERY(rocsolver_syevj_heevj(STRIDED, handle, evect, uplo, n, (T*)nullptr,
+                                                    lda, stA, abstol, (S*)nullptr, max_sweeps,
+                                                    (rocblas_int*)nullptr, (S*)nullptr, stW,
+                                                    (rocblas_int*)nullptr, bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations (all cases)
+    // host
+    host_strided_batch_vector<S> hResidualRes(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hSweepsRes(1, 1, 1, bc);
+    host_strided_batch_vector<S> hW(size_W, 1, stW, bc);
+    host_strided_batch_vector<S> hWres(size_Wres, 1, stW, bc);
+    host_strided_batch_vector<rocblas_int> hinfo(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hinfoRes(1, 1, 1, bc);
+    // device
+    device_strided_batch_vector<S> dResidual(1, 1, 1, bc);
+    device_strided_batch_vector<rocblas_int> dSweeps(1, 1, 1, bc);
+    device_strided_batch_vector<S> dW(size_W, 1, stW, bc);
+    device_strided_batch_vector<rocblas_int> dinfo(1, 1, 1, bc);
+    CHECK_HIP_ERROR(dResidual.memcheck());
+    CHECK_HIP_ERROR(dSweeps.memcheck());
+    if(size_W)
+        CHECK_HIP_ERROR(dW.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+
+    if(BATCHED)
+    {
+        // memory allocations
+        host_batch_vector<T> hA(size_A, 1, bc);
+        host_batch_vector<T> hAres(size_Ares, 1, bc);
+        device_batch_vector<T> dA(size_A, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+
+        // check quick return
+        if(n == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_syevj_heevj(STRIDED, handle, evect, uplo, n, dA.data(),
+                                                        lda, stA, abstol, dResidual.data(),
+                                                        max_sweeps, dSweeps.data(), dW.data(), stW,
+                                                        dinfo.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing && !argus.quiet)
+                ROCSOLVER_BENCH_INFORM(0);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+        {
+            syevj_heevj_getError<STRIDED, T>(handle, evect, uplo, n, dA, lda, stA, abstol,
+                                             dResidual, max_sweeps, dSweeps, dW, stW, dinfo, bc,
+                                             hA, hAres, hResidualRes, hSweepsRes, hW, hWres, hinfo,
+                                             hinfoRes, &max_error);
+        }
+
+        // collect performance data
+        if(argus.timing)
+        {
+            syevj_heevj_getPerfData<STRIDED, T>(handle, evect, uplo, n, dA, lda, stA, abstol,
+                                                dResidual, max_sweeps, dSweeps, dW, stW, dinfo, bc,
+                                                hA, hW, hinfo, &gpu_time_used, &cpu_time_used,
+                                                hot_calls, argus.perf);
+        }
+    }
+
+    else
+    {
+        // memory allocations
+        host_strided_batch_vector<T> hA(size_A, 1, stA, bc);
+        host_strided_batch_vector<T> hAres(size_Ares, 1, stA, bc);
+        device_strided_batch_vector<T> dA(size_A, 1, stA, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+
+        // check quick return
+        if(n == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_syevj_heevj(STRIDED, handle, evect, uplo, n, dA.data(),
+                                                        lda, stA, abstol, dResidual.data(),
+                                                        max_sweeps, dSweeps.data(), dW.data(), stW,
+                                                        dinfo.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing && !argus.quiet)
+                ROCSOLVER_BENCH_INFORM(0);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+        {
+            syevj_heevj_getError<STRIDED, T>(handle, evect, uplo, n, dA, lda, stA, abstol,
+                                             dResidual, max_sweeps, dSweeps, dW, stW, dinfo, bc,
+                                             hA, hAres, hResidualRes, hSweepsRes, hW, hWres, hinfo,
+                                             hinfoRes, &max_error);
+        }
+
+        // collect performance data
+        if(argus.timing)
+        {
+            syevj_heevj_getPerfData<STRIDED, T>(handle, evect, uplo, n, dA, lda, stA, abstol,
+                                                dResidual, max_sweeps, dSweeps, dW, stW, dinfo, bc,
+                                                hA, hW, hinfo, &gpu_time_used, &cpu_time_used,
+                                                hot_calls, argus.perf);
+        }
+    }
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, n);
+
+    // output results for rocsolver-bench
+    argus.gpu_time_used = gpu_time_used;
+    argus.cpu_time_used = cpu_time_used;
+    argus.max_error = max_error;
+    if(argus.timing && !argus.quiet)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_cout << "\n============================================\n";
+            rocsolver_cout << "Arguments:\n";
+            rocsolver_cout << "============================================\n";
+            if(BATCHED)
+            {
+                rocsolver_bench_output("evect", "uplo", "n", "lda", "abstol", "max_sweeps",
+                                       "strideW", "batch_c");
+                rocsolver_bench_output(evectC, uploC, n, lda, abstol, max_sweeps, stW, bc);
+            }
+            else if(STRIDED)
+            {
+                rocsolver_bench_output("evect", "uplo", "n", "lda", "strideA", "abstol",
+                                       "max_sweeps", "strideW", "batch_c");
+                rocsolver_bench_output(evectC, uploC, n, lda, stA, abstol, max_sweeps, stW, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("evect", "uplo", "n", "lda", "abstol", "max_sweeps");
+                rocsolver_bench_output(evectC, uploC, n, lda, abstol, max_sweeps);
+            }
+            rocsolver_cout << "\n============================================\n";
+            rocsolver_cout << "Results:\n";
+            rocsolver_cout << "============================================\n";
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_cout << std::endl;
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
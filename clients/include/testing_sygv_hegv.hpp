@@ -457,7 +457,7 @@ void sygv_hegv_getPerfData(const rocblas_handle handle,
         start = get_time_us_sync(stream);
         rocsolver_sygv_hegv(STRIDED, handle, itype, evect, uplo, n, dA.data(), lda, stA, dB.data(),
                             ldb, stB, dD.data(), stD, dE.data(), stE, dInfo.data(), bc);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        *gpu_time_used += rocsolver_bench_sample(get_time_us_sync(stream) - start);
     }
     *gpu_time_used /= hot_calls;
 }
@@ -505,7 +505,7 @@ void testing_sygv_hegv(Arguments& argus)
                                                       (rocblas_int*)nullptr, bc),
                                   rocblas_status_invalid_size);
 
-        if(argus.timing)
+        if(argus.timing && !argus.quiet)
             ROCSOLVER_BENCH_INFORM(2);
 
         return;
@@ -538,7 +538,7 @@ void testing_sygv_hegv(Arguments& argus)
                                                       (rocblas_int*)nullptr, bc),
                                   rocblas_status_invalid_size);
 
-        if(argus.timing)
+        if(argus.timing && !argus.quiet)
             ROCSOLVER_BENCH_INFORM(1);
 
         return;
@@ -596,7 +596,7 @@ void testing_sygv_hegv(Arguments& argus)
                                                       dD.data(), stD, dE.data(), stE, dInfo.data(),
                                                       bc),
                                   rocblas_status_success);
-            if(argus.timing)
+            if(argus.timing && !argus.quiet)
                 ROCSOLVER_BENCH_INFORM(0);
 
             return;
@@ -649,7 +649,7 @@ void testing_sygv_hegv(Arguments& argus)
                                                       dD.data(), stD, dE.data(), stE, dInfo.data(),
                                                       bc),
                                   rocblas_status_success);
-            if(argus.timing)
+            if(argus.timing && !argus.quiet)
                 ROCSOLVER_BENCH_INFORM(0);
 
             return;
@@ -675,7 +675,10 @@ void testing_sygv_hegv(Arguments& argus)
         ROCSOLVER_TEST_CHECK(T, max_error, n);
 
     // output results for rocsolver-bench
-    if(argus.timing)
+    argus.gpu_time_used = gpu_time_used;
+    argus.cpu_time_used = cpu_time_used;
+    argus.max_error = max_error;
+    if(argus.timing && !argus.quiet)
     {
         if(!argus.perf)
         {
@@ -375,7 +375,7 @@ void sytxx_hetxx_getPerfData(const rocblas_handle handle,
         start = get_time_us_sync(stream);
         rocsolver_sytxx_hetxx(STRIDED, SYTRD, handle, uplo, n, dA.data(), lda, stA, dD.data(), stD,
                               dE.data(), stE, dTau.data(), stP, bc);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        *gpu_time_used += rocsolver_bench_sample(get_time_us_sync(stream) - start);
     }
     *gpu_time_used /= hot_calls;
 }
@@ -415,7 +415,7 @@ void testing_sytxx_hetxx(Arguments& argus)
                                                         (S*)nullptr, stE, (T*)nullptr, stP, bc),
                                   rocblas_status_invalid_value);
 
-        if(argus.timing)
+        if(argus.timing && !argus.quiet)
             ROCSOLVER_BENCH_INFORM(2);
 
         return;
@@ -445,7 +445,7 @@ void testing_sytxx_hetxx(Arguments& argus)
                                                         (S*)nullptr, stE, (T*)nullptr, stP, bc),
                                   rocblas_status_invalid_size);
 
-        if(argus.timing)
+        if(argus.timing && !argus.quiet)
             ROCSOLVER_BENCH_INFORM(1);
 
         return;
@@ -501,7 +501,7 @@ void testing_sytxx_hetxx(Arguments& argus)
                                                         lda, stA, dD.data(), stD, dE.data(), stE,
                                                         dTau.data(), stP, bc),
                                   rocblas_status_success);
-            if(argus.timing)
+            if(argus.timing && !argus.quiet)
                 ROCSOLVER_BENCH_INFORM(0);
 
             return;
@@ -536,7 +536,7 @@ void testing_sytxx_hetxx(Arguments& argus)
                                                         lda, stA, dD.data(), stD, dE.data(), stE,
                                                         dTau.data(), stP, bc),
                                   rocblas_status_success);
-            if(argus.timing)
+            if(argus.timing && !argus.quiet)
                 ROCSOLVER_BENCH_INFORM(0);
 
             return;
@@ -561,7 +561,10 @@ void testing_sytxx_hetxx(Arguments& argus)
         ROCSOLVER_TEST_CHECK(T, max_error, n);
 
     // output results for rocsolver-bench
-    if(argus.timing)
+    argus.gpu_time_used = gpu_time_used;
+    argus.cpu_time_used = cpu_time_used;
+    argus.max_error = max_error;
+    if(argus.timing && !argus.quiet)
     {
         if(!argus.perf)
         {
@@ -9,6 +9,98 @@
 #include "rocblas_test.hpp"
 #include <cinttypes>
 #include <cstdio>
+#include <map>
+
+/* ============================================================================================
+ */
+/*! \brief  cache of device allocations. While it is enabled, the memory of destroyed device
+ * vectors is kept and reused by later device vectors of the same or a slightly smaller size
+ * (used to run many tests in one process without allocating new buffers for each one) */
+class d_vector_pool
+{
+    // free blocks by size, and size of every block owned by the pool
+    static std::multimap<size_t, void*>& free_blocks()
+    {
+        static std::multimap<size_t, void*> blocks;
+        return blocks;
+    }
+    static std::map<void*, size_t>& owned_blocks()
+    {
+        static std::map<void*, size_t> blocks;
+        return blocks;
+    }
+    static bool& enabled()
+    {
+        static bool enabled = false;
+        return enabled;
+    }
+
+public:
+    static void enable()
+    {
+        enabled() = true;
+    }
+
+    // disable the pool and free all the cached blocks
+    static void disable()
+    {
+        enabled() = false;
+        release();
+    }
+
+    // free the cached blocks (the blocks in use are freed when they are returned)
+    static void release()
+    {
+        for(auto& b : free_blocks())
+        {
+            owned_blocks().erase(b.second);
+            (hipFree)(b.second);
+        }
+        free_blocks().clear();
+    }
+
+    static hipError_t allocate(void** d, size_t bytes)
+    {
+        if(!enabled())
+            return (hipMalloc)(d, bytes);
+
+        // reuse a free block if it is not much larger than needed
+        auto it = free_blocks().lower_bound(bytes);
+        if(it != free_blocks().end() && it->first <= 2 * bytes)
+        {
+            *d = it->second;
+            free_blocks().erase(it);
+            return hipSuccess;
+        }
+
+        hipError_t err = (hipMalloc)(d, bytes);
+        if(err != hipSuccess)
+        {
+            // retry after returning the cached blocks to the device
+            release();
+            err = (hipMalloc)(d, bytes);
+        }
+        if(err == hipSuccess)
+            owned_blocks()[*d] = bytes;
+        return err;
+    }
+
+    static hipError_t deallocate(void* d)
+    {
+        auto it = owned_blocks().find(d);
+        if(it == owned_blocks().end())
+            return (hipFree)(d);
+
+        if(!enabled())
+        {
+            owned_blocks().erase(it);
+            return (hipFree)(d);
+        }
+
+        free_blocks().emplace(it->second, d);
+        return hipSuccess;
+    }
+};
 
 /* ============================================================================================
  */
@@ -48,7 +140,7 @@ public:
     T* device_vector_setup()
     {
         T* d;
-        if((hipMalloc)(&d, bytes) != hipSuccess)
+        if(d_vector_pool::allocate((void**)&d, bytes) != hipSuccess)
         {
             rocsolver_cerr << "Error allocating " << bytes << " bytes (" << (bytes >> 30) << " GB)"
                            << std::endl;
@@ -125,7 +217,7 @@ public:
             }
 #endif
             // Free device memory
-            CHECK_HIP_ERROR((hipFree)(d));
+            CHECK_HIP_ERROR(d_vector_pool::deallocate(d));
         }
     }
 };
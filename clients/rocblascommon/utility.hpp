@@ -74,19 +74,39 @@ static constexpr char LIMITED_MEMORY_STRING_GTEST[]
 
 /* ============================================================================================
  */
-/*! \brief  local handle which is automatically created and destroyed  */
+/*! \brief  local handle which is automatically created and destroyed. If a shared handle
+ * has been set, it is used instead (and not destroyed) */
 class rocblas_local_handle
 {
     rocblas_handle m_handle;
+    bool m_owner;
+
+    static rocblas_handle& shared()
+    {
+        static rocblas_handle handle = nullptr;
+        return handle;
+    }
 
 public:
     rocblas_local_handle()
+        : m_owner(shared() == nullptr)
     {
-        rocblas_create_handle(&m_handle);
+        if(m_owner)
+            rocblas_create_handle(&m_handle);
+        else
+            m_handle = shared();
     }
     ~rocblas_local_handle()
     {
-        rocblas_destroy_handle(m_handle);
+        if(m_owner)
+            rocblas_destroy_handle(m_handle);
+    }
+
+    // set (or unset, with nullptr) the handle used by all the subsequent local handles;
+    // the caller keeps its ownership
+    static void set_shared(rocblas_handle handle)
+    {
+        shared() = handle;
     }
 
     rocblas_local_handle(const rocblas_local_handle&) = delete;
@@ -26,6 +26,7 @@
 #include <thread>
 #include <unistd.h>
 #include <utility>
+#include <vector>
 
 /*****************************************************************************
  * rocBLAS output streams                                                    *
@@ -43,83 +44,68 @@ class rocsolver_ostream
     /**************************************************************************
    * The worker class sets up a worker thread for writing to log files. Two *
    * files are considered the same if they have the same device ID / inode. *
+   * Data is copied into a preallocated ring buffer, and the worker thread  *
+   * writes everything accumulated in it with a single system call. When    *
+   * the buffer is full, asynchronous sends are either dropped (and        *
+   * counted) or wait for space, depending on the ROCSOLVER_LOG_DROP        *
+   * environment variable; the size of the buffer is given by              *
+   * ROCSOLVER_LOG_BUFFER_SIZE.                                             *
    **************************************************************************/
     class worker
     {
-        // task_t represents a payload of data and a promise to finish
-        class task_t
-        {
-            std::string str;
-            std::promise<void> promise;
-
-        public:
-            // The task takes ownership of the string payload and promise
-            task_t(std::string&& str, std::promise<void>&& promise)
-                : str(std::move(str))
-                , promise(std::move(promise))
-            {
-            }
-
-            // Notify the future when the worker thread exits
-            void set_value_at_thread_exit()
-            {
-                promise.set_value_at_thread_exit();
-            }
-
-            // Notify the future immediately
-            void set_value()
-            {
-                promise.set_value();
-            }
-
-            // Size of the string payload
-            size_t size() const
-            {
-                return str.size();
-            }
-
-            // Data of the string payload
-            const char* data() const
-            {
-                return str.data();
-            }
-        };
-
-        // FILE is used for safety in the presence of signals
-        FILE* file = nullptr;
-
-        // This worker's thread
-        std::thread thread;
-
-        // Condition variable for worker notification
-        std::condition_variable cond;
-
-        // Mutex for this thread's queue
+        // The file descriptor, owned by the worker
+        int fd = -1;
+
+        // Whether asynchronous sends are dropped when the buffer is full
+        bool drop_when_full = false;
+
+        // Ring buffer, and the total number of bytes that have been sent to it and written from
+        // it (positions in the buffer are taken modulo its size)
+        std::vector<char> buffer;
+        uint64_t head = 0;
+        uint64_t tail = 0;
+
+        // Number of messages and bytes dropped since they were last taken
+        uint64_t dropped_messages = 0;
+        uint64_t dropped_bytes = 0;
+
+        // Flags for the worker thread to exit, and for a write error
+        bool closing = false;
+        bool failed = false;
+
+        // Future which is ready when the worker thread exits
+        std::future<void> exited;
+
+        // Condition variables for data to be written, and for space or written data
+        std::condition_variable data_cond;
+        std::condition_variable space_cond;
+
+        // Mutex for the ring buffer, and mutex that keeps each message contiguous when it has
+        // to wait for space
         std::mutex mutex;
+        std::mutex send_mutex;
 
-        // Queue of tasks
-        std::queue<task_t> queue;
+        // Worker thread which waits for and writes data
+        void thread_function(std::promise<void> promise);
 
-        // Worker thread which waits for and handles tasks sequentially
-        void thread_function();
+        // Copy the bytes from position start up to end in the buffer to the file
+        bool write_buffer(uint64_t start, uint64_t end);
 
     public:
         // Worker constructor creates a worker thread for a raw filehandle
         explicit worker(int fd);
 
-        // Send a string to be written
-        void send(std::string);
+        // Send a string to be written; if wait is true, wait until it has been written
+        void send(const std::string& str, bool wait);
 
-        // Destroy a worker when all std::shared_ptr references to it are gone
-        ~worker()
-        {
-            // Tell worker thread to exit, by sending it an empty string
-            send({});
+        // Wait until all the data sent so far has been written
+        void sync();
 
-            // Close the FILE
-            if(file)
-                fclose(file);
-        }
+        // Return and reset the number of dropped messages and bytes
+        std::pair<uint64_t, uint64_t> take_dropped();
+
+        // Destroy a worker when all std::shared_ptr references to it are gone
+        ~worker();
     };
 
     // Two filehandles point to the same file if they share the same (std_dev,
@@ -166,6 +152,9 @@ class rocsolver_ostream
     // Flag indicating whether YAML mode is turned on
     bool yaml = false;
 
+    // Flag indicating whether flushes return before the output is written
+    bool async = false;
+
     // Get worker for file descriptor
     static std::shared_ptr<worker> get_worker(int fd);
 
@@ -173,6 +162,7 @@ class rocsolver_ostream
     // buffer
     explicit rocsolver_ostream(const rocsolver_ostream& other)
         : worker_ptr(other.worker_ptr)
+        , async(other.async)
     {
     }
 
@@ -226,6 +216,33 @@ public:
     // Flush the output
     void flush();
 
+    // Make flushes return as soon as the output is in the worker's buffer, instead of waiting
+    // for it to be written. Asynchronous output may be dropped if the buffer is full.
+    void set_async(bool value)
+    {
+        async = value;
+    }
+
+    // Flush the output, and wait until all the data sent to the file has been written
+    void sync()
+    {
+        flush();
+        if(worker_ptr)
+            worker_ptr->sync();
+    }
+
+    // Return and reset the number of messages and bytes dropped from the file of this stream
+    std::pair<uint64_t, uint64_t> take_dropped()
+    {
+        return worker_ptr ? worker_ptr->take_dropped() : std::pair<uint64_t, uint64_t>(0, 0);
+    }
+
+    // Whether this stream writes to the same file as another stream
+    bool same_file(const rocsolver_ostream& other) const
+    {
+        return worker_ptr && worker_ptr == other.worker_ptr;
+    }
+
     // Destroy the rocsolver_ostream
     virtual ~rocsolver_ostream()
     {
@@ -394,6 +411,18 @@ public:
         return os << rocblas2char_eform(value);
     }
 
+    // rocsolver_erange output
+    friend rocsolver_ostream& operator<<(rocsolver_ostream& os, rocblas_erange value)
+    {
+        return os << rocblas2char_erange(value);
+    }
+
+    // rocsolver_eorder output
+    friend rocsolver_ostream& operator<<(rocsolver_ostream& os, rocblas_eorder value)
+    {
+        return os << rocblas2char_eorder(value);
+    }
+
     // rocsolver_status output
     friend rocsolver_ostream& operator<<(rocsolver_ostream& os, rocblas_status status)
     {
@@ -7,8 +7,12 @@
 static void rocsolver_abort_once [[noreturn]] ();
 
 #include "rocsolver_ostream.hpp"
+#include <algorithm>
+#include <cerrno>
 #include <csignal>
+#include <cstring>
 #include <fcntl.h>
+#include <sys/uio.h>
 #include <type_traits>
 
 /***********************************************************************
@@ -130,9 +134,8 @@ void rocsolver_ostream::flush()
         // The contents of the string buffer
         auto str = os.str();
 
-        // Empty string buffers kill the worker thread, so they are not flushed here
         if(str.size())
-            worker_ptr->send(std::move(str));
+            worker_ptr->send(str, !async);
 
         // Clear the string buffer
         clear();
@@ -258,99 +261,182 @@ rocsolver_ostream& operator<<(rocsolver_ostream& os, std::ostream& (*pf)(std::os
  ***********************************************************************/
 
 // Send a string to the worker thread for this stream's device/inode
-// Empty strings tell the worker thread to exit
-void rocsolver_ostream::worker::send(std::string str)
+void rocsolver_ostream::worker::send(const std::string& str, bool wait)
 {
-    // Create a promise to wait for the operation to complete
-    std::promise<void> promise;
+    const char* data = str.data();
+    size_t size = str.size();
+    size_t capacity = buffer.size();
+    uint64_t end;
 
-    // The future indicating when the operation has completed
-    auto future = promise.get_future();
+    {
+        // Keep the message contiguous, even if it has to wait for space
+        std::lock_guard<std::mutex> send_lock(send_mutex);
+        std::unique_lock<std::mutex> lock(mutex);
 
-    // task_t consists of string and promise
-    // std::move transfers ownership of str and promise to task
-    task_t worker_task(std::move(str), std::move(promise));
+        // Drop asynchronous messages that do not fit, if requested
+        if(failed || (!wait && drop_when_full && capacity - (head - tail) < size))
+        {
+            dropped_messages++;
+            dropped_bytes += size;
+            return;
+        }
 
-    // Submit the task to the worker assigned to this device/inode
-    // Hold mutex for as short as possible, to reduce contention
-    // TODO: Consider whether notification should be done with lock held or
-    // released
+        // Copy the message into the buffer, as space becomes available
+        while(size > 0)
+        {
+            space_cond.wait(lock, [&] { return head - tail < capacity || failed; });
+            if(failed)
+                return;
+
+            size_t pos = head % capacity;
+            size_t count = std::min({size, capacity - size_t(head - tail), capacity - pos});
+            memcpy(buffer.data() + pos, data, count);
+            head += count;
+            data += count;
+            size -= count;
+
+            data_cond.notify_one();
+        }
+        end = head;
+    }
+
+    // Wait for the message to be written, to ensure flushed IO
+    if(wait)
     {
-        std::lock_guard<std::mutex> lock(mutex);
-        queue.push(std::move(worker_task));
-        cond.notify_one();
+        std::unique_lock<std::mutex> lock(mutex);
+        space_cond.wait(lock, [&] { return tail >= end || failed; });
     }
+}
 
-    // Wait for the task to be completed, to ensure flushed IO
-    future.get();
+// Wait until all the data sent so far has been written
+void rocsolver_ostream::worker::sync()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    uint64_t end = head;
+    space_cond.wait(lock, [&] { return tail >= end || failed; });
 }
 
-// Worker thread which serializes data to be written to a device/inode
-void rocsolver_ostream::worker::thread_function()
+// Return and reset the number of dropped messages and bytes
+std::pair<uint64_t, uint64_t> rocsolver_ostream::worker::take_dropped()
 {
-    // Clear any errors in the FILE
-    clearerr(file);
+    std::lock_guard<std::mutex> lock(mutex);
+    std::pair<uint64_t, uint64_t> result(dropped_messages, dropped_bytes);
+    dropped_messages = 0;
+    dropped_bytes = 0;
+    return result;
+}
+
+// Write the data in the buffer between two positions, which may wrap around its end
+bool rocsolver_ostream::worker::write_buffer(uint64_t start, uint64_t end)
+{
+    size_t capacity = buffer.size();
+    while(start < end)
+    {
+        size_t pos = start % capacity;
+        size_t first = std::min(size_t(end - start), capacity - pos);
+
+        iovec iov[2];
+        iov[0].iov_base = buffer.data() + pos;
+        iov[0].iov_len = first;
+        iov[1].iov_base = buffer.data();
+        iov[1].iov_len = size_t(end - start) - first;
+
+        ssize_t written = writev(fd, iov, iov[1].iov_len ? 2 : 1);
+        if(written < 0)
+        {
+            if(errno == EINTR)
+                continue;
+            return false;
+        }
+        start += written;
+    }
+    return true;
+}
 
+// Worker thread which serializes data to be written to a device/inode
+void rocsolver_ostream::worker::thread_function(std::promise<void> promise)
+{
     // Lock the mutex in preparation for cond.wait
     std::unique_lock<std::mutex> lock(mutex);
 
     while(true)
     {
         // Wait for any data, ignoring spurious wakeups
-        cond.wait(lock, [&] { return !queue.empty(); });
+        data_cond.wait(lock, [&] { return head != tail || closing; });
 
-        // With the mutex locked, get and pop data from the front of queue
-        task_t task = std::move(queue.front());
-        queue.pop();
-
-        // Temporarily unlock queue mutex, unblocking other threads
-        lock.unlock();
-
-        // An empty message indicates the closing of the stream
-        if(!task.size())
-        {
-            // Tell future to wake up after thread exits
-            task.set_value_at_thread_exit();
+        // Exit when closing, once all the data has been written
+        if(head == tail)
             break;
-        }
 
-        // Write the data
-        fwrite(task.data(), 1, task.size(), file);
+        // Temporarily unlock the mutex while writing all the data in the buffer; producers only
+        // copy data to the free part of the buffer
+        uint64_t start = tail;
+        uint64_t end = head;
+        lock.unlock();
 
-        // Detect any error and flush the C FILE stream
-        if(ferror(file) || fflush(file))
-        {
+        bool ok = write_buffer(start, end);
+        if(!ok)
             perror("Error writing log file");
 
-            // Tell future to wake up after thread exits
-            task.set_value_at_thread_exit();
-            break;
-        }
-
-        // Promise that the data has been written
-        task.set_value();
-
-        // Re-lock the mutex in preparation for cond.wait
+        // Re-lock the mutex, and notify the producers waiting for space or for their data to be
+        // written
         lock.lock();
+        tail = end;
+        failed = !ok;
+        space_cond.notify_all();
+
+        if(failed)
+            break;
     }
+
+    // Tell future to wake up after thread exits
+    promise.set_value_at_thread_exit();
 }
 
 // Constructor creates a worker thread from a file descriptor
 rocsolver_ostream::worker::worker(int fd)
 {
     // The worker duplicates the file descriptor (RAII)
-    fd = fcntl(fd, F_DUPFD_CLOEXEC, 0);
+    this->fd = fcntl(fd, F_DUPFD_CLOEXEC, 0);
 
-    // If the dup fails or fdopen fails, print error and abort
-    if(fd == -1 || !(file = fdopen(fd, "a")))
+    // If the dup fails, print error and abort
+    if(this->fd == -1)
     {
-        perror("fdopen() error");
+        perror("fcntl() error");
         rocsolver_abort();
     }
 
+    // Allocate the ring buffer (1 MiB by default, at least 4 KiB)
+    size_t capacity = 1 << 20;
+    if(const char* str = getenv("ROCSOLVER_LOG_BUFFER_SIZE"))
+        capacity = std::max(strtoull(str, nullptr, 0), 4096ull);
+    buffer.resize(capacity);
+
+    // Asynchronous sends wait for space unless dropping is requested
+    if(const char* str = getenv("ROCSOLVER_LOG_DROP"))
+        drop_when_full = strtol(str, nullptr, 0) != 0;
+
     // Create a worker thread, capturing *this
-    thread = std::thread([=] { thread_function(); });
+    std::promise<void> promise;
+    exited = promise.get_future();
+    std::thread thread([this](std::promise<void> p) { thread_function(std::move(p)); },
+                       std::move(promise));
 
     // Detatch from the worker thread
     thread.detach();
 }
+
+// Destructor waits for the pending data to be written
+rocsolver_ostream::worker::~worker()
+{
+    // Tell worker thread to exit
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        closing = true;
+        data_cond.notify_one();
+    }
+    exited.wait();
+
+    // Close the file descriptor
+    close(fd);
+}
@@ -10,6 +10,15 @@
  ********************************************************************************/
 typedef uint32_t rocblas_layer_mode_flags;
 
+/*! \brief Used to specify the additional rocSOLVER logging layer modes, which can be
+ *combined with the rocblas_layer_mode values in a rocblas_layer_mode_flags.
+ ********************************************************************************/
+typedef enum rocsolver_layer_mode_ex_
+{
+    rocsolver_layer_mode_log_timeline
+    = 0x8, /**< Timeline of the nested function calls, in Chrome trace format. */
+} rocsolver_layer_mode_ex;
+
 /*! \brief Used to specify the order in which multiple elementary matrices are
  *applied together
  ********************************************************************************/
@@ -71,4 +80,80 @@ typedef enum rocblas_eform_
     rocblas_eform_bax = 223, /**< The problem is B*A*x = lambda*x. */
 } rocblas_eform;
 
+/*! \brief Used to specify the type of range in which eigenvalues will be found
+ *in partial eigenvalue decompositions
+ ********************************************************************************/
+typedef enum rocblas_erange_
+{
+    rocblas_erange_all = 241, /**< All eigenvalues will be found. */
+    rocblas_erange_value = 242, /**< All eigenvalues in the half-open interval
+                                    (vl, vu] will be found. */
+    rocblas_erange_index = 243, /**< The il-th through iu-th eigenvalues will be found.*/
+} rocblas_erange;
+
+/*! \brief Used to specify whether the eigenvalues are grouped and ordered by blocks
+ ********************************************************************************/
+typedef enum rocblas_eorder_
+{
+    rocblas_eorder_blocks = 251, /**< The computed eigenvalues will be grouped by split-off
+                                    blocks and arranged in increasing order within each block. */
+    rocblas_eorder_entire = 252, /**< All computed eigenvalues of the entire matrix will be
+                                    ordered from smallest to largest. */
+} rocblas_eorder;
+
+/*! \brief Statistics of the workspace pool attached to a handle
+ *(see rocsolver_workspace_pool_get_stats)
+ ********************************************************************************/
+typedef struct rocsolver_workspace_pool_stats_
+{
+    size_t hits; /**< Number of calls whose workspace was taken from the pool. */
+    size_t misses; /**< Number of calls that required a new device allocation. */
+    size_t peak_bytes; /**< Largest amount of pooled workspace in use at the same time. */
+    size_t reserved_bytes; /**< Device memory currently held by the pool. */
+} rocsolver_workspace_pool_stats;
+
+/*! \brief Convergence statistics of an instance of the batch solved by an iterative
+ *function (see rocsolver_convergence_stats_set)
+ ********************************************************************************/
+typedef struct rocsolver_convergence_stats_
+{
+    rocblas_int sweeps; /**< Number of implicit QL/QR sweeps applied. */
+    rocblas_int deflations; /**< Number of off-diagonal elements found negligible and set to
+                               zero, splitting the matrix into independent blocks. */
+    rocblas_int iterations; /**< Iteration count of the algorithm, in the units of its
+                               iteration limit. */
+    rocblas_int max_iterations; /**< Iteration limit of the algorithm. */
+    rocblas_int hit_limit; /**< 1 if the iteration limit was reached before the algorithm
+                              converged, 0 otherwise. */
+} rocsolver_convergence_stats;
+
+/*! \brief Used to specify the variant of a function for which a workspace plan
+ *is computed
+ ********************************************************************************/
+typedef enum rocsolver_batch_mode_
+{
+    rocsolver_batch_none = 231, /**< The normal (non-batched) function. */
+    rocsolver_batch_pointers = 232, /**< The batched function (arrays of pointers). */
+    rocsolver_batch_strided = 233, /**< The strided_batched function. */
+} rocsolver_batch_mode;
+
+/*! \brief Maximum number of workspace buffers described by a rocsolver_workspace_plan
+ ********************************************************************************/
+#define ROCSOLVER_PLAN_MAX_BUFFERS 16
+
+/*! \brief Device workspace required by a rocSOLVER function
+ *(see rocsolver_plan_getrf and related functions)
+ ********************************************************************************/
+typedef struct rocsolver_workspace_plan_
+{
+    size_t size_total; /**< Total size in bytes, as returned by a device memory size query. */
+    rocblas_int num_buffers; /**< Number of workspace buffers. */
+    size_t buffer_sizes[ROCSOLVER_PLAN_MAX_BUFFERS]; /**< Size in bytes of each buffer. */
+    const char* buffer_names[ROCSOLVER_PLAN_MAX_BUFFERS]; /**< Name of each buffer. */
+    const char* algorithm; /**< Name of the algorithm that will be executed (e.g. getf2 or
+                                getrf), or "none" when the function returns immediately. */
+    rocblas_int block_size; /**< Block size of the blocked algorithm, or 0 if the unblocked
+                                 algorithm is executed. */
+} rocsolver_workspace_plan;
+
 #endif /* ROCSOLVER_EXTRAS_H_ */
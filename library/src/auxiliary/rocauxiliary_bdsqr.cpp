@@ -56,7 +56,7 @@ rocblas_status rocsolver_bdsqr_impl(rocblas_handle handle,
 
     // memory workspace allocation
     void* work;
-    rocblas_device_malloc mem(handle, size_work);
+    rocsolver_device_malloc mem(handle, size_work);
     if(!mem)
         return rocblas_status_memory_error;
 
@@ -14,14 +14,14 @@
 #include "rocsolver.h"
 
 /****************************************************************************
-(TODO:THIS IS BASIC IMPLEMENTATION. THE ONLY PARALLELISM INTRODUCED HERE IS
-  FOR THE BATCHED VERSIONS (A DIFFERENT THREAD WORKS ON EACH INSTANCE OF THE
-  BATCH). MORE PARALLELISM CAN BE INTRODUCED IN THE FUTURE IN AT LEAST TWO
+(TODO:THIS IS BASIC IMPLEMENTATION. THE QR STEPS ARE COMPUTED BY A SINGLE
+  THREAD PER INSTANCE OF THE BATCH; ONLY THE UPDATE OF THE SINGULAR VECTORS
+  WITH THE ROTATIONS OF EACH STEP IS DISTRIBUTED AMONG THE THREADS OF THE
+  GROUP. MORE PARALLELISM CAN BE INTRODUCED IN THE FUTURE IN AT LEAST TWO
   WAYS:
   1. the split diagonal blocks can be worked in parallel as they are
   independent
   2. for each block, multiple threads can accelerate some of the reductions
-  and vector operations
 ***************************************************************************/
 
 /** ESTIMATE device function computes an estimate of the smallest
@@ -65,7 +65,8 @@ __device__ void negvect(const rocblas_int n, T* x, const rocblas_int incx)
 
 /** T2BQRSTEP device function applies implicit QR interation to
     the n-by-n bidiagonal matrix given by D and E, using shift = sh,
-    from top to bottom **/
+    from top to bottom. The rotations are saved in rots to update the
+    singular vectors (see bdsqr_update_vectors) **/
 template <typename S, typename W>
 __device__ void t2bQRstep(const rocblas_int n,
                           const rocblas_int nv,
@@ -73,12 +74,6 @@ __device__ void t2bQRstep(const rocblas_int n,
                           const rocblas_int nc,
                           S* D,
                           S* E,
-                          W* V,
-                          const rocblas_int ldv,
-                          W* U,
-                          const rocblas_int ldu,
-                          W* C,
-                          const rocblas_int ldc,
                           const S sh,
                           S* rots)
 {
@@ -127,21 +122,12 @@ __device__ void t2bQRstep(const rocblas_int n,
         }
     }
     E[n - 2] = f;
-
-    // update singular vectors
-    if(nv)
-        lasr(rocblas_side_left, rocblas_forward_direction, n, nv, rots, rots + n - 1, V, ldv);
-    if(nu)
-        lasr(rocblas_side_right, rocblas_forward_direction, nu, n, rots + nr, rots + nr + n - 1, U,
-             ldu);
-    if(nc)
-        lasr(rocblas_side_left, rocblas_forward_direction, n, nc, rots + nr, rots + nr + n - 1, C,
-             ldc);
 }
 
 /** B2TQRSTEP device function applies implicit QR interation to
     the n-by-n bidiagonal matrix given by D and E, using shift = sh,
-    from bottom to top **/
+    from bottom to top. The rotations are saved in rots to update the
+    singular vectors (see bdsqr_update_vectors) **/
 template <typename S, typename W>
 __device__ void b2tQRstep(const rocblas_int n,
                           const rocblas_int nv,
@@ -149,12 +135,6 @@ __device__ void b2tQRstep(const rocblas_int n,
                           const rocblas_int nc,
                           S* D,
                           S* E,
-                          W* V,
-                          const rocblas_int ldv,
-                          W* U,
-                          const rocblas_int ldu,
-                          W* C,
-                          const rocblas_int ldc,
                           const S sh,
                           S* rots)
 {
@@ -203,51 +183,79 @@ __device__ void b2tQRstep(const rocblas_int n,
         }
     }
     E[0] = f;
+}
+
+/** BDSQR_UPDATE_VECTORS device function applies the rotations saved in rots
+    by the last QR step (on the n-by-n diagonal block) to the singular vectors
+    V, U and C. The rows/columns of the matrices are distributed among the
+    nthreads threads of the group **/
+template <typename S, typename W>
+__device__ void bdsqr_update_vectors(const rocblas_direct direc,
+                                     const rocblas_int n,
+                                     const rocblas_int nv,
+                                     const rocblas_int nu,
+                                     const rocblas_int nc,
+                                     W* V,
+                                     const rocblas_int ldv,
+                                     W* U,
+                                     const rocblas_int ldu,
+                                     W* C,
+                                     const rocblas_int ldc,
+                                     S* rots,
+                                     const rocblas_int tid,
+                                     const rocblas_int nthreads)
+{
+    rocblas_int nr = nv ? 2 * (n - 1) : 0;
 
-    // update singular vectors
     if(nv)
-        lasr(rocblas_side_left, rocblas_backward_direction, n, nv, rots, rots + n - 1, V, ldv);
+        lasr(rocblas_side_left, direc, n, nv, rots, rots + n - 1, V, ldv, tid, nthreads);
     if(nu)
-        lasr(rocblas_side_right, rocblas_backward_direction, nu, n, rots + nr, rots + nr + n - 1, U,
-             ldu);
+        lasr(rocblas_side_right, direc, nu, n, rots + nr, rots + nr + n - 1, U, ldu, tid,
+             nthreads);
     if(nc)
-        lasr(rocblas_side_left, rocblas_backward_direction, n, nc, rots + nr, rots + nr + n - 1, C,
-             ldc);
+        lasr(rocblas_side_left, direc, n, nc, rots + nr, rots + nr + n - 1, C, ldc, tid, nthreads);
 }
 
 /** BDSQRKERNEL implements the main loop of the bdsqr algorithm
-    to compute the SVD of an upper bidiagonal matrix given by D and E **/
+    to compute the SVD of an upper bidiagonal matrix given by D and E.
+    The QR steps are computed by thread 0; the singular vectors are updated
+    by all the threads of the group. If stats is not null, the convergence
+    statistics of each instance of the batch are written to it **/
 template <typename T, typename S, typename W>
-__global__ void bdsqrKernel(const rocblas_int n,
-                            const rocblas_int nv,
-                            const rocblas_int nu,
-                            const rocblas_int nc,
-                            S* DD,
-                            const rocblas_stride strideD,
-                            S* EE,
-                            const rocblas_stride strideE,
-                            W VV,
-                            const rocblas_int shiftV,
-                            const rocblas_int ldv,
-                            const rocblas_stride strideV,
-                            W UU,
-                            const rocblas_int shiftU,
-                            const rocblas_int ldu,
-                            const rocblas_stride strideU,
-                            W CC,
-                            const rocblas_int shiftC,
-                            const rocblas_int ldc,
-                            const rocblas_stride strideC,
-                            rocblas_int* info,
-                            const rocblas_int maxiter,
-                            const S eps,
-                            const S sfm,
-                            const S tol,
-                            const S minshift,
-                            S* workA,
-                            const rocblas_stride strideW)
+__global__ void __launch_bounds__(BDSQR_BDIM) bdsqrKernel(const rocblas_int n,
+                                                          const rocblas_int nv,
+                                                          const rocblas_int nu,
+                                                          const rocblas_int nc,
+                                                          S* DD,
+                                                          const rocblas_stride strideD,
+                                                          S* EE,
+                                                          const rocblas_stride strideE,
+                                                          W VV,
+                                                          const rocblas_int shiftV,
+                                                          const rocblas_int ldv,
+                                                          const rocblas_stride strideV,
+                                                          W UU,
+                                                          const rocblas_int shiftU,
+                                                          const rocblas_int ldu,
+                                                          const rocblas_stride strideU,
+                                                          W CC,
+                                                          const rocblas_int shiftC,
+                                                          const rocblas_int ldc,
+                                                          const rocblas_stride strideC,
+                                                          rocblas_int* info,
+                                                          const rocblas_int maxiter,
+                                                          const S eps,
+                                                          const S sfm,
+                                                          const S tol,
+                                                          const S minshift,
+                                                          S* workA,
+                                                          const rocblas_stride strideW,
+                                                          rocsolver_convergence_stats* stats,
+                                                          const rocblas_int nstats)
 {
     rocblas_int bid = hipBlockIdx_x;
+    rocblas_int tid = hipThreadIdx_x;
+    rocblas_int nthreads = hipBlockDim_x;
 
     // select batch instance to work with
     // (avoiding arithmetics with possible nullptrs)
@@ -264,86 +272,127 @@ __global__ void bdsqrKernel(const rocblas_int n,
     if(workA)
         rots = workA + bid * strideW;
 
-    // calculate threshold for zeroing elements (convergence threshold)
-    int t2b = (D[0] >= D[n - 1]) ? 1 : 0; // direction
-    S smin = estimate<S>(n, D, E, t2b, tol,
-                         0); // estimate of the smallest singular value
-    S thresh = std::max(tol * smin / S(std::sqrt(n)),
-                        S(maxiter) * sfm); // threshold
+    // diagonal block updated by the last QR step (first index, size and
+    // direction), as seen by all the threads
+    __shared__ rocblas_int qri, qrn, qrt2b;
+    // state of the main loop, as seen by all the threads
+    __shared__ rocblas_int sk, sdone;
 
     rocblas_int k = n - 1; // k is the last element of last unconverged diagonal block
     rocblas_int iter = 0; // iter is the number of iterations (QR steps) applied
+    rocblas_int sweeps = 0, deflations = 0; // only tracked by thread 0
     rocblas_int i;
-    S sh, smax;
+    int t2b;
+    S sh, smax, smin, thresh;
+
+    if(tid == 0)
+    {
+        // calculate threshold for zeroing elements (convergence threshold)
+        t2b = (D[0] >= D[n - 1]) ? 1 : 0; // direction
+        smin = estimate<S>(n, D, E, t2b, tol,
+                           0); // estimate of the smallest singular value
+        thresh = std::max(tol * smin / S(std::sqrt(n)),
+                          S(maxiter) * sfm); // threshold
+    }
 
     // main loop
-    while(k > 0 && iter < maxiter)
+    while(true)
     {
-        // split the diagonal blocks
-        for(rocblas_int j = 0; j < k + 1; ++j)
+        if(tid == 0)
         {
-            i = k - j - 1;
-            if(i >= 0 && std::abs(E[i]) < thresh)
-            {
-                E[i] = 0;
-                break;
-            }
-        }
+            qrn = 0;
+            sdone = !(k > 0 && iter < maxiter);
 
-        // check if last singular value converged,
-        // if not, continue with the QR step
-        //(TODO: splitted blocks can be analyzed in parallel)
-        if(i == k - 1)
-            k--;
-        else
-        {
-            // last block goes from i+1 until k
-            // determine shift for the QR step
-            // (apply convergence test to find gaps)
-            i++;
-            if(std::abs(D[i]) >= std::abs(D[k]))
-            {
-                t2b = 1;
-                sh = std::abs(D[i]);
-            }
-            else
+            if(!sdone)
             {
-                t2b = 0;
-                sh = std::abs(D[k]);
-            }
-            smin = estimate<S>(k - i + 1, D + i, E + i, t2b, tol, 1); // shift
-            smax = find_max_tridiag(i, k, D, E); // estimate of the largest singular value in the block
-
-            // check for gaps, if none then continue
-            if(smin >= 0)
-            {
-                if(smin / smax <= minshift)
-                    smin = 0; // shift set to zero if less than accepted value
-                else if(sh > 0)
+                // split the diagonal blocks
+                for(rocblas_int j = 0; j < k + 1; ++j)
                 {
-                    if(smin * smin / sh / sh < eps)
-                        smin = 0; // shift set to zero if negligible
+                    i = k - j - 1;
+                    if(i >= 0 && std::abs(E[i]) < thresh)
+                    {
+                        deflations += (E[i] != 0);
+                        E[i] = 0;
+                        break;
+                    }
                 }
 
-                // apply QR step
-                iter += k - i;
-                if(t2b)
-                    t2bQRstep(k - i + 1, nv, nu, nc, D + i, E + i, V + i, ldv, U + i * ldu, ldu,
-                              C + i, ldc, smin, rots);
+                // check if last singular value converged,
+                // if not, continue with the QR step
+                //(TODO: splitted blocks can be analyzed in parallel)
+                if(i == k - 1)
+                    k--;
                 else
-                    b2tQRstep(k - i + 1, nv, nu, nc, D + i, E + i, V + i, ldv, U + i * ldu, ldu,
-                              C + i, ldc, smin, rots);
+                {
+                    // last block goes from i+1 until k
+                    // determine shift for the QR step
+                    // (apply convergence test to find gaps)
+                    i++;
+                    if(std::abs(D[i]) >= std::abs(D[k]))
+                    {
+                        t2b = 1;
+                        sh = std::abs(D[i]);
+                    }
+                    else
+                    {
+                        t2b = 0;
+                        sh = std::abs(D[k]);
+                    }
+                    smin = estimate<S>(k - i + 1, D + i, E + i, t2b, tol, 1); // shift
+                    // estimate of the largest singular value in the block
+                    smax = find_max_tridiag(i, k, D, E);
+
+                    // check for gaps, if none then continue
+                    if(smin >= 0)
+                    {
+                        if(smin / smax <= minshift)
+                            smin = 0; // shift set to zero if less than accepted value
+                        else if(sh > 0)
+                        {
+                            if(smin * smin / sh / sh < eps)
+                                smin = 0; // shift set to zero if negligible
+                        }
+
+                        // apply QR step
+                        iter += k - i;
+                        sweeps++;
+                        if(t2b)
+                            t2bQRstep(k - i + 1, nv, nu, nc, D + i, E + i, smin, rots);
+                        else
+                            b2tQRstep(k - i + 1, nv, nu, nc, D + i, E + i, smin, rots);
+
+                        qri = i;
+                        qrn = k - i + 1;
+                        qrt2b = t2b;
+                    }
+                }
             }
+            sk = k;
         }
+        __syncthreads();
+
+        if(sdone)
+            break;
+
+        // update singular vectors
+        if(qrn)
+            bdsqr_update_vectors(
+                qrt2b ? rocblas_forward_direction : rocblas_backward_direction, qrn, nv, nu, nc,
+                V + qri, ldv, U + qri * ldu, ldu, C + qri, ldc, rots, tid, nthreads);
+        __syncthreads();
     }
 
-    info[bid] = 0;
+    if(tid == 0)
+    {
+        info[bid] = 0;
+        convergence_record(stats, nstats, bid, sweeps, deflations, iter, maxiter, sk == 0);
+    }
 
     // re-arrange singular values/vectors if algorithm converged
-    if(k == 0)
+    if(sk == 0)
     {
         // all positive
-        for(rocblas_int ii = 0; ii < n; ++ii)
+        for(rocblas_int ii = tid; ii < n; ii += nthreads)
         {
             if(D[ii] < 0)
             {
@@ -352,39 +401,51 @@ __global__ void bdsqrKernel(const rocblas_int n,
                     negvect(nv, V + ii, ldv);
             }
         }
+        __syncthreads();
 
         // in decreasing order
         rocblas_int idx;
         for(rocblas_int ii = 0; ii < n - 1; ++ii)
         {
-            idx = ii;
-            smax = D[ii];
-            // detect maximum
-            for(rocblas_int jj = ii + 1; jj < n; ++jj)
+            if(tid == 0)
             {
-                if(D[jj] > smax)
+                idx = ii;
+                smax = D[ii];
+                // detect maximum
+                for(rocblas_int jj = ii + 1; jj < n; ++jj)
                 {
-                    idx = jj;
-                    smax = D[jj];
+                    if(D[jj] > smax)
+                    {
+                        idx = jj;
+                        smax = D[jj];
+                    }
                 }
+                if(idx != ii)
+                {
+                    D[idx] = D[ii];
+                    D[ii] = smax;
+                }
+                qri = idx;
             }
+            __syncthreads();
+
             // swap
+            idx = qri;
             if(idx != ii)
             {
-                D[idx] = D[ii];
-                D[ii] = smax;
                 if(nv)
-                    swapvect(nv, V + idx, ldv, V + ii, ldv);
+                    swapvect(nv, V + idx, ldv, V + ii, ldv, tid, nthreads);
                 if(nu)
-                    swapvect(nu, U + idx * ldu, 1, U + ii * ldu, 1);
+                    swapvect(nu, U + idx * ldu, 1, U + ii * ldu, 1, tid, nthreads);
                 if(nc)
-                    swapvect(nc, C + idx, ldc, C + ii, ldc);
+                    swapvect(nc, C + idx, ldc, C + ii, ldc, tid, nthreads);
             }
+            __syncthreads();
         }
     }
 
     // if not, set value of info
-    else
+    else if(tid == 0)
     {
         for(rocblas_int i = 0; i < n - 1; ++i)
             if(E[i] != 0)
@@ -393,27 +454,31 @@ __global__ void bdsqrKernel(const rocblas_int n,
 }
 
 /** LOWER2UPPER kernel transforms a lower bidiagonal matrix given by D and E
-    into an upper bidiagonal matrix via givens rotations **/
+    into an upper bidiagonal matrix via givens rotations. The rotations are
+    computed by thread 0 and applied to the singular vectors by all the threads
+    of the group **/
 template <typename T, typename S, typename W>
-__global__ void lower2upper(const rocblas_int n,
-                            const rocblas_int nu,
-                            const rocblas_int nc,
-                            S* DD,
-                            const rocblas_stride strideD,
-                            S* EE,
-                            const rocblas_stride strideE,
-                            W UU,
-                            const rocblas_int shiftU,
-                            const rocblas_int ldu,
-                            const rocblas_stride strideU,
-                            W CC,
-                            const rocblas_int shiftC,
-                            const rocblas_int ldc,
-                            const rocblas_stride strideC,
-                            S* workA,
-                            const rocblas_stride strideW)
+__global__ void __launch_bounds__(BDSQR_BDIM) lower2upper(const rocblas_int n,
+                                                          const rocblas_int nu,
+                                                          const rocblas_int nc,
+                                                          S* DD,
+                                                          const rocblas_stride strideD,
+                                                          S* EE,
+                                                          const rocblas_stride strideE,
+                                                          W UU,
+                                                          const rocblas_int shiftU,
+                                                          const rocblas_int ldu,
+                                                          const rocblas_stride strideU,
+                                                          W CC,
+                                                          const rocblas_int shiftC,
+                                                          const rocblas_int ldc,
+                                                          const rocblas_stride strideC,
+                                                          S* workA,
+                                                          const rocblas_stride strideW)
 {
     rocblas_int bid = hipBlockIdx_x;
+    rocblas_int tid = hipThreadIdx_x;
+    rocblas_int nthreads = hipBlockDim_x;
     S f, g, c, s, r;
 
     // select batch instance to work with
@@ -429,31 +494,37 @@ __global__ void lower2upper(const rocblas_int n,
     if(workA)
         rots = workA + bid * strideW;
 
-    f = D[0];
-    g = E[0];
-    for(rocblas_int i = 0; i < n - 1; ++i)
+    if(tid == 0)
     {
-        // apply rotations by rows
-        lartg(f, g, c, s, r);
-        D[i] = r;
-        E[i] = -s * D[i + 1];
-        f = c * D[i + 1];
-        g = E[i + 1];
-
-        // save rotation to update singular vectors
-        if(nu || nc)
+        f = D[0];
+        g = E[0];
+        for(rocblas_int i = 0; i < n - 1; ++i)
         {
-            rots[i] = c;
-            rots[i + n - 1] = -s;
+            // apply rotations by rows
+            lartg(f, g, c, s, r);
+            D[i] = r;
+            E[i] = -s * D[i + 1];
+            f = c * D[i + 1];
+            g = E[i + 1];
+
+            // save rotation to update singular vectors
+            if(nu || nc)
+            {
+                rots[i] = c;
+                rots[i + n - 1] = -s;
+            }
         }
+        D[n - 1] = f;
     }
-    D[n - 1] = f;
+    __syncthreads();
 
     // update singular vectors
     if(nu)
-        lasr(rocblas_side_right, rocblas_forward_direction, nu, n, rots, rots + n - 1, U, ldu);
+        lasr(rocblas_side_right, rocblas_forward_direction, nu, n, rots, rots + n - 1, U, ldu, tid,
+             nthreads);
     if(nc)
-        lasr(rocblas_side_left, rocblas_forward_direction, n, nc, rots, rots + n - 1, C, ldc);
+        lasr(rocblas_side_left, rocblas_forward_direction, n, nc, rots, rots + n - 1, C, ldc, tid,
+             nthreads);
 }
 
 template <typename T>
@@ -580,15 +651,24 @@ rocblas_status rocsolver_bdsqr_template(rocblas_handle handle,
     // rotate to upper bidiagonal if necessary
     if(uplo == rocblas_fill_lower)
     {
-        hipLaunchKernelGGL((lower2upper<T>), dim3(batch_count), dim3(1), 0, stream, n, nu, nc, D,
-                           strideD, E, strideE, U, shiftU, ldu, strideU, C, shiftC, ldc, strideC,
-                           work, strideW);
+        hipLaunchKernelGGL((lower2upper<T>), dim3(batch_count), dim3(BDSQR_BDIM), 0, stream, n, nu,
+                           nc, D, strideD, E, strideE, U, shiftU, ldu, strideU, C, shiftC, ldc,
+                           strideC, work, strideW);
     }
 
+    // convergence statistics, if requested
+    rocblas_int nstats;
+    rocsolver_convergence_stats* stats = rocsolver_convergence::get(handle, &nstats);
+    nstats = std::min(nstats, batch_count);
+
     // main computation of SVD
-    hipLaunchKernelGGL((bdsqrKernel<T>), dim3(batch_count), dim3(1), 0, stream, n, nv, nu, nc, D,
-                       strideD, E, strideE, V, shiftV, ldv, strideV, U, shiftU, ldu, strideU, C,
-                       shiftC, ldc, strideC, info, maxiter, eps, sfm, tol, minshift, work, strideW);
+    hipLaunchKernelGGL((bdsqrKernel<T>), dim3(batch_count), dim3(BDSQR_BDIM), 0, stream, n, nv,
+                       nu, nc, D, strideD, E, strideE, V, shiftV, ldv, strideV, U, shiftU, ldu,
+                       strideU, C, shiftC, ldc, strideC, info, maxiter, eps, sfm, tol, minshift,
+                       work, strideW, stats, nstats);
+
+    if(stats && rocsolver_logger::is_logging_enabled())
+        rocsolver_logger::instance()->log_convergence(handle, "bdsqr", stats, nstats);
 
     return rocblas_status_success;
 }
@@ -62,7 +62,7 @@ rocblas_status rocsolver_labrd_impl(rocblas_handle handle,
 
     // memory workspace allocation
     void *scalars, *work_workArr, *norms;
-    rocblas_device_malloc mem(handle, size_scalars, size_work_workArr, size_norms);
+    rocsolver_device_malloc mem(handle, size_scalars, size_work_workArr, size_norms);
 
     if(!mem)
         return rocblas_status_memory_error;
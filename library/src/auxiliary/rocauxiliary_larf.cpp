@@ -50,7 +50,7 @@ rocblas_status rocsolver_larf_impl(rocblas_handle handle,
 
     // memory workspace allocation
     void *scalars, *Abyx, *workArr;
-    rocblas_device_malloc mem(handle, size_scalars, size_Abyx, size_workArr);
+    rocsolver_device_malloc mem(handle, size_scalars, size_Abyx, size_workArr);
     if(!mem)
         return rocblas_status_memory_error;
 
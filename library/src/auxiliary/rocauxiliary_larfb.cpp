@@ -56,7 +56,7 @@ rocblas_status rocsolver_larfb_impl(rocblas_handle handle,
 
     // memory workspace allocation
     void *tmptr, *workArr;
-    rocblas_device_malloc mem(handle, size_tmptr, size_workArr);
+    rocsolver_device_malloc mem(handle, size_tmptr, size_workArr);
     if(!mem)
         return rocblas_status_memory_error;
 
@@ -44,7 +44,7 @@ rocblas_status rocsolver_larfg_impl(rocblas_handle handle,
 
     // memory workspace allocation
     void *work, *norms;
-    rocblas_device_malloc mem(handle, size_work, size_norms);
+    rocsolver_device_malloc mem(handle, size_work, size_norms);
     if(!mem)
         return rocblas_status_memory_error;
 
@@ -51,7 +51,7 @@ rocblas_status rocsolver_larft_impl(rocblas_handle handle,
 
     // memory workspace allocation
     void *scalars, *work, *workArr;
-    rocblas_device_malloc mem(handle, size_scalars, size_work, size_workArr);
+    rocsolver_device_malloc mem(handle, size_scalars, size_work, size_workArr);
     if(!mem)
         return rocblas_status_memory_error;
 
@@ -53,7 +53,7 @@ rocblas_status rocsolver_latrd_impl(rocblas_handle handle,
 
     // memory workspace allocation
     void *scalars, *work, *norms, *workArr;
-    rocblas_device_malloc mem(handle, size_scalars, size_work, size_norms, size_workArr);
+    rocsolver_device_malloc mem(handle, size_scalars, size_work, size_norms, size_workArr);
 
     if(!mem)
         return rocblas_status_memory_error;
@@ -52,8 +52,8 @@ rocblas_status rocsolver_orgqr_ungqr_impl(rocblas_handle handle,
 
     // memory workspace allocation
     void *scalars, *work, *Abyx_tmptr, *trfact, *workArr;
-    rocblas_device_malloc mem(handle, size_scalars, size_work, size_Abyx_tmptr, size_trfact,
-                              size_workArr);
+    rocsolver_device_malloc mem(handle, size_scalars, size_work, size_Abyx_tmptr, size_trfact,
+                                size_workArr);
     if(!mem)
         return rocblas_status_memory_error;
 
@@ -41,7 +41,10 @@ void rocsolver_orgqr_ungqr_getMemorySize(const rocblas_int m,
     rocsolver_org2r_ung2r_getMemorySize<T, BATCHED>(m, n, batch_count, size_scalars,
                                                     size_Abyx_tmptr, size_workArr);
 
-    if(k <= ORGxx_UNGxx_SWITCHSIZE)
+    const rocblas_int nx = rocsolver_tuning::get()->orgxx_ungxx_switchsize;
+    const rocblas_int nb = rocsolver_tuning::get()->orgxx_ungxx_blocksize;
+
+    if(k <= nx)
     {
         *size_work = 0;
         *size_trfact = 0;
@@ -49,8 +52,8 @@ void rocsolver_orgqr_ungqr_getMemorySize(const rocblas_int m,
 
     else
     {
-        rocblas_int jb = ORGxx_UNGxx_BLOCKSIZE;
-        rocblas_int j = ((k - ORGxx_UNGxx_SWITCHSIZE - 1) / jb) * jb;
+        rocblas_int jb = nb;
+        rocblas_int j = ((k - nx - 1) / jb) * jb;
         rocblas_int kk = min(k, j + jb);
 
         // size of workspace is maximum of what is needed by larft and larfb.
@@ -94,17 +97,20 @@ rocblas_status rocsolver_orgqr_ungqr_template(rocblas_handle handle,
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
+    const rocblas_int nx = rocsolver_tuning::get()->orgxx_ungxx_switchsize;
+    const rocblas_int nb = rocsolver_tuning::get()->orgxx_ungxx_blocksize;
+
     // if the matrix is small, use the unblocked variant of the algorithm
-    if(k <= ORGxx_UNGxx_SWITCHSIZE)
+    if(k <= nx)
         return rocsolver_org2r_ung2r_template<T>(handle, m, n, k, A, shiftA, lda, strideA, ipiv,
                                                  strideP, batch_count, scalars, Abyx_tmptr, workArr);
 
-    rocblas_int ldw = ORGxx_UNGxx_BLOCKSIZE;
+    rocblas_int ldw = nb;
     rocblas_stride strideW = rocblas_stride(ldw) * ldw;
 
     // start of first blocked block
-    rocblas_int jb = ORGxx_UNGxx_BLOCKSIZE;
-    rocblas_int j = ((k - ORGxx_UNGxx_SWITCHSIZE - 1) / jb) * jb;
+    rocblas_int jb = nb;
+    rocblas_int j = ((k - nx - 1) / jb) * jb;
 
     // start of the unblocked block
     rocblas_int kk = min(k, j + jb);
@@ -58,7 +58,7 @@ rocblas_status rocsolver_orm2l_unm2l_impl(rocblas_handle handle,
 
     // memory workspace allocation
     void *scalars, *Abyx, *diag, *workArr;
-    rocblas_device_malloc mem(handle, size_scalars, size_Abyx, size_diag, size_workArr);
+    rocsolver_device_malloc mem(handle, size_scalars, size_Abyx, size_diag, size_workArr);
     if(!mem)
         return rocblas_status_memory_error;
 
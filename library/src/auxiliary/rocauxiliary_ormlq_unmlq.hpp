@@ -42,9 +42,11 @@ void rocsolver_ormlq_unmlq_getMemorySize(const rocblas_side side,
     rocsolver_orml2_unml2_getMemorySize<T, BATCHED>(side, m, n, k, batch_count, size_scalars,
                                                     size_AbyxORwork, size_diagORtmptr, size_workArr);
 
-    if(k > ORMxx_ORMxx_BLOCKSIZE)
+    const rocblas_int nb = rocsolver_tuning::get()->ormxx_unmxx_blocksize;
+
+    if(k > nb)
     {
-        rocblas_int jb = ORMxx_ORMxx_BLOCKSIZE;
+        rocblas_int jb = nb;
 
         // requirements for calling larft
         rocsolver_larft_getMemorySize<T, BATCHED>(max(m, n), min(jb, k), batch_count, &unused,
@@ -96,13 +98,15 @@ rocblas_status rocsolver_ormlq_unmlq_template(rocblas_handle handle,
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
+    const rocblas_int nb = rocsolver_tuning::get()->ormxx_unmxx_blocksize;
+
     // if the matrix is small, use the unblocked variant of the algorithm
-    if(k <= ORMxx_ORMxx_BLOCKSIZE)
+    if(k <= nb)
         return rocsolver_orml2_unml2_template<T>(
             handle, side, trans, m, n, k, A, shiftA, lda, strideA, ipiv, strideP, C, shiftC, ldc,
             strideC, batch_count, scalars, AbyxORwork, diagORtmptr, workArr);
 
-    rocblas_int ldw = ORMxx_ORMxx_BLOCKSIZE;
+    rocblas_int ldw = nb;
     rocblas_stride strideW = rocblas_stride(ldw) * ldw;
 
     // determine limits and indices
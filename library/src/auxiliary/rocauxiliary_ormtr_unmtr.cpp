@@ -56,8 +56,8 @@ rocblas_status rocsolver_ormtr_unmtr_impl(rocblas_handle handle,
 
     // memory workspace allocation
     void *scalars, *AbyxORwork, *diagORtmptr, *trfact, *workArr;
-    rocblas_device_malloc mem(handle, size_scalars, size_AbyxORwork, size_diagORtmptr, size_trfact,
-                              size_workArr);
+    rocsolver_device_malloc mem(handle, size_scalars, size_AbyxORwork, size_diagORtmptr,
+                                size_trfact, size_workArr);
     if(!mem)
         return rocblas_status_memory_error;
 
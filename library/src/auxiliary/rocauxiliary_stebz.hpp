@@ -0,0 +1,537 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "lapack_device_functions.hpp"
+#include "rocblas.hpp"
+#include "rocsolver.h"
+
+/****************************************************************************
+ STEBZ computes selected eigenvalues of a symmetric tridiagonal matrix by
+ bisection. A serial prologue (one thread per instance of the batch) splits
+ the matrix into unreduced blocks, determines the interval (wl, wu] that
+ contains the requested eigenvalues, and counts how many of them lie in
+ each block. Every eigenvalue is then refined on its own thread with Sturm
+ counts, and the results are finally ranked to produce the requested order.
+
+ The workspace is organized as follows (for each instance of the batch):
+   work:  E2 (squared off-diagonal, zero at the splits), Wtmp (eigenvalues
+          as computed by the bisection), bl and bu (search interval of each
+          block), and the scalars atoli, rtoli and pivmin.
+   iwork: offs (first eigenvalue of each block), nlow (number of
+          eigenvalues of each block below wl), btmp (block of each computed
+          eigenvalue), rank (position of each computed eigenvalue in
+          ascending order), and the scalars m, idiscl, idiscu and itmax.
+***************************************************************************/
+
+/** STEBZ_STURM returns the number of eigenvalues of the unreduced block
+    [start, end] that are less than or equal to x **/
+template <typename S>
+__device__ rocblas_int stebz_sturm(const rocblas_int start,
+                                   const rocblas_int end,
+                                   S* D,
+                                   S* E2,
+                                   const S x,
+                                   const S pivmin)
+{
+    rocblas_int count = 0;
+    S q = D[start] - x;
+    if(abs(q) <= pivmin)
+        q = -pivmin;
+    if(q < 0)
+        count++;
+
+    for(rocblas_int i = start + 1; i <= end; ++i)
+    {
+        q = D[i] - x - E2[i - 1] / q;
+        if(abs(q) <= pivmin)
+            q = -pivmin;
+        if(q < 0)
+            count++;
+    }
+
+    return count;
+}
+
+/** STEBZ_BOUND narrows, by bisection on the whole matrix, the interval
+    (lo, hi] that contains the (target+1)-th eigenvalue **/
+template <typename S>
+__device__ void stebz_bound(const rocblas_int n,
+                            S* D,
+                            S* E2,
+                            const rocblas_int target,
+                            const rocblas_int itmax,
+                            const S rtoli,
+                            const S pivmin,
+                            S& lo,
+                            S& hi)
+{
+    for(rocblas_int it = 0; it < itmax; ++it)
+    {
+        S tol = max(rtoli * max(abs(lo), abs(hi)), 2 * pivmin);
+        if(hi - lo <= tol)
+            break;
+
+        S mid = (lo + hi) / 2;
+        rocblas_int c = stebz_sturm(0, n - 1, D, E2, mid, pivmin);
+        if(c <= target)
+            lo = mid;
+        else
+            hi = mid;
+    }
+}
+
+/** STEBZ_SPLITTING_KERNEL splits the matrix into unreduced blocks and
+    computes the search interval and number of eigenvalues of each block **/
+template <typename S>
+__global__ void stebz_splitting_kernel(const rocblas_erange erange,
+                                       const rocblas_int n,
+                                       const S vl,
+                                       const S vu,
+                                       const rocblas_int il,
+                                       const rocblas_int iu,
+                                       const S abstol,
+                                       S* DD,
+                                       const rocblas_stride strideD,
+                                       S* EE,
+                                       const rocblas_stride strideE,
+                                       rocblas_int* nevA,
+                                       rocblas_int* nsplitA,
+                                       rocblas_int* isplitA,
+                                       const rocblas_stride strideIsplit,
+                                       S* workA,
+                                       rocblas_int* iworkA,
+                                       const S eps,
+                                       const S sfmin)
+{
+    rocblas_int bid = hipBlockIdx_x;
+
+    S* D = DD + (bid * strideD);
+    S* E = EE + (bid * strideE);
+    rocblas_int* isplit = isplitA + (bid * strideIsplit);
+
+    S* E2 = workA + bid * (4 * n + 3);
+    S* bl = E2 + 2 * n;
+    S* bu = bl + n;
+    S* scal = bu + n;
+    rocblas_int* offs = iworkA + bid * (4 * n + 5);
+    rocblas_int* nlow = offs + n + 1;
+    rocblas_int* iscal = nlow + 3 * n;
+
+    // find the splitting points and the pivot threshold
+    rocblas_int nsplit = 0;
+    S emax = 0;
+    for(rocblas_int i = 0; i < n - 1; ++i)
+    {
+        S tmp = E[i] * E[i];
+        if(abs(D[i] * D[i + 1]) * eps * eps + sfmin > tmp)
+        {
+            isplit[nsplit] = i + 1;
+            nsplit++;
+            E2[i] = 0;
+        }
+        else
+        {
+            E2[i] = tmp;
+            emax = max(emax, tmp);
+        }
+    }
+    isplit[nsplit] = n;
+    nsplit++;
+    S pivmin = sfmin * max(S(1), emax);
+
+    // Gershgorin bounds of the whole matrix
+    S gl = D[0];
+    S gu = D[0];
+    for(rocblas_int j = 0; j < n; ++j)
+    {
+        S r = (j > 0 ? abs(E[j - 1]) : 0) + (j < n - 1 ? abs(E[j]) : 0);
+        gl = min(gl, D[j] - r);
+        gu = max(gu, D[j] + r);
+    }
+    S tnorm = max(abs(gl), abs(gu));
+    gl = gl - 2 * tnorm * eps * n - 4 * pivmin;
+    gu = gu + 2 * tnorm * eps * n + 4 * pivmin;
+
+    S rtoli = 2 * eps;
+    S atoli = (abstol <= 0 ? eps * tnorm : abstol);
+    rocblas_int itmax = rocblas_int((log(tnorm + pivmin) - log(pivmin)) / log(S(2))) + 2;
+
+    // determine the interval (wl, wu] that contains the requested eigenvalues
+    S wl = gl;
+    S wu = gu;
+    if(erange == rocblas_erange_index)
+    {
+        S hi = gu;
+        stebz_bound(n, D, E2, il - 1, itmax, rtoli, pivmin, wl, hi);
+        S lo = gl;
+        stebz_bound(n, D, E2, iu, itmax, rtoli, pivmin, lo, wu);
+    }
+    else if(erange == rocblas_erange_value)
+    {
+        wl = vl;
+        wu = vu;
+    }
+
+    // count the eigenvalues of each block in the interval
+    rocblas_int m = 0;
+    rocblas_int nwl = 0;
+    rocblas_int nwu = 0;
+    for(rocblas_int b = 0; b < nsplit; ++b)
+    {
+        rocblas_int start = (b == 0 ? 0 : isplit[b - 1]);
+        rocblas_int end = isplit[b] - 1;
+        rocblas_int bsize = end - start + 1;
+
+        S bgl = D[start];
+        S bgu = D[start];
+        for(rocblas_int j = start; j <= end; ++j)
+        {
+            S r = (j > start ? abs(E[j - 1]) : 0) + (j < end ? abs(E[j]) : 0);
+            bgl = min(bgl, D[j] - r);
+            bgu = max(bgu, D[j] + r);
+        }
+        S bnorm = max(abs(bgl), abs(bgu));
+        bgl = bgl - 2 * bnorm * eps * bsize - 4 * pivmin;
+        bgu = bgu + 2 * bnorm * eps * bsize + 4 * pivmin;
+
+        rocblas_int nl = 0;
+        rocblas_int nu = bsize;
+        if(erange != rocblas_erange_all)
+        {
+            if(wl >= bgu)
+                nl = bsize;
+            else if(wl > bgl)
+                nl = stebz_sturm(start, end, D, E2, wl, pivmin);
+            bgl = max(bgl, wl);
+
+            if(wu <= bgl)
+                nu = nl;
+            else if(wu < bgu)
+                nu = stebz_sturm(start, end, D, E2, wu, pivmin);
+            bgu = min(bgu, wu);
+        }
+
+        offs[b] = m;
+        nlow[b] = nl;
+        bl[b] = bgl;
+        bu[b] = bgu;
+        m += nu - nl;
+        nwl += nl;
+        nwu += nu;
+    }
+    offs[nsplit] = m;
+
+    // with a range by index, the ties at the ends of the interval are discarded
+    rocblas_int idiscl = 0;
+    rocblas_int idiscu = 0;
+    if(erange == rocblas_erange_index)
+    {
+        idiscl = max(il - 1 - nwl, 0);
+        idiscu = max(nwu - iu, 0);
+    }
+
+    nevA[bid] = m - idiscl - idiscu;
+    nsplitA[bid] = nsplit;
+    scal[0] = atoli;
+    scal[1] = rtoli;
+    scal[2] = pivmin;
+    iscal[0] = m;
+    iscal[1] = idiscl;
+    iscal[2] = idiscu;
+    iscal[3] = itmax;
+}
+
+/** STEBZ_BISECTION_KERNEL refines each eigenvalue in the interval of its
+    block by bisection (one thread per eigenvalue) **/
+template <typename S>
+__global__ void __launch_bounds__(STEBZ_BDIM)
+    stebz_bisection_kernel(const rocblas_int n,
+                           S* DD,
+                           const rocblas_stride strideD,
+                           rocblas_int* nsplitA,
+                           rocblas_int* isplitA,
+                           const rocblas_stride strideIsplit,
+                           rocblas_int* infoA,
+                           S* workA,
+                           rocblas_int* iworkA)
+{
+    rocblas_int bid = hipBlockIdx_y;
+    rocblas_int t = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    S* E2 = workA + bid * (4 * n + 3);
+    S* Wtmp = E2 + n;
+    S* bl = Wtmp + n;
+    S* bu = bl + n;
+    S* scal = bu + n;
+    rocblas_int* offs = iworkA + bid * (4 * n + 5);
+    rocblas_int* nlow = offs + n + 1;
+    rocblas_int* btmp = nlow + n;
+    rocblas_int* iscal = btmp + 2 * n;
+
+    if(t < iscal[0])
+    {
+        S* D = DD + (bid * strideD);
+        rocblas_int* isplit = isplitA + (bid * strideIsplit);
+        S atoli = scal[0];
+        S rtoli = scal[1];
+        S pivmin = scal[2];
+        rocblas_int itmax = iscal[3];
+
+        // find the block of this eigenvalue
+        rocblas_int b = 0;
+        rocblas_int hi = nsplitA[bid];
+        while(hi - b > 1)
+        {
+            rocblas_int mid = (b + hi) / 2;
+            if(offs[mid] <= t)
+                b = mid;
+            else
+                hi = mid;
+        }
+        rocblas_int start = (b == 0 ? 0 : isplit[b - 1]);
+        rocblas_int end = isplit[b] - 1;
+        rocblas_int target = nlow[b] + t - offs[b];
+
+        // bisection
+        S left = bl[b];
+        S right = bu[b];
+        rocblas_int it;
+        for(it = 0; it < itmax; ++it)
+        {
+            S tol = max(atoli, max(rtoli * max(abs(left), abs(right)), pivmin));
+            if(right - left <= tol)
+                break;
+
+            S mid = (left + right) / 2;
+            if(stebz_sturm(start, end, D, E2, mid, pivmin) > target)
+                right = mid;
+            else
+                left = mid;
+        }
+        if(it == itmax)
+            infoA[bid] = 1;
+
+        Wtmp[t] = (left + right) / 2;
+        btmp[t] = b + 1;
+    }
+}
+
+/** STEBZ_RANK_KERNEL computes the position of each eigenvalue in ascending
+    order **/
+template <typename S>
+__global__ void __launch_bounds__(STEBZ_BDIM)
+    stebz_rank_kernel(const rocblas_int n, S* workA, rocblas_int* iworkA)
+{
+    rocblas_int bid = hipBlockIdx_y;
+    rocblas_int t = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    S* Wtmp = workA + bid * (4 * n + 3) + n;
+    rocblas_int* rank = iworkA + bid * (4 * n + 5) + 3 * n + 1;
+    rocblas_int m = rank[n];
+
+    if(t < m)
+    {
+        S w = Wtmp[t];
+        rocblas_int r = 0;
+        for(rocblas_int j = 0; j < m; ++j)
+        {
+            if(Wtmp[j] < w || (Wtmp[j] == w && j < t))
+                r++;
+        }
+        rank[t] = r;
+    }
+}
+
+/** STEBZ_ORDER_KERNEL discards the unwanted eigenvalues and copies the
+    others to W in the requested order **/
+template <typename S>
+__global__ void __launch_bounds__(STEBZ_BDIM)
+    stebz_order_kernel(const rocblas_eorder eorder,
+                       const rocblas_int n,
+                       S* WW,
+                       const rocblas_stride strideW,
+                       rocblas_int* iblockA,
+                       const rocblas_stride strideIblock,
+                       S* workA,
+                       rocblas_int* iworkA)
+{
+    rocblas_int bid = hipBlockIdx_y;
+    rocblas_int t = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    S* Wtmp = workA + bid * (4 * n + 3) + n;
+    rocblas_int* btmp = iworkA + bid * (4 * n + 5) + 2 * n + 1;
+    rocblas_int* rank = btmp + n;
+    rocblas_int m = rank[n];
+    rocblas_int idiscl = rank[n + 1];
+    rocblas_int idiscu = rank[n + 2];
+
+    if(t < m && rank[t] >= idiscl && rank[t] < m - idiscu)
+    {
+        S* W = WW + (bid * strideW);
+        rocblas_int* iblock = iblockA + (bid * strideIblock);
+
+        rocblas_int pos = rank[t] - idiscl;
+        if(eorder == rocblas_eorder_blocks)
+        {
+            pos = t;
+            for(rocblas_int j = 0; j < t; ++j)
+            {
+                if(rank[j] < idiscl || rank[j] >= m - idiscu)
+                    pos--;
+            }
+        }
+
+        W[pos] = Wtmp[t];
+        iblock[pos] = btmp[t];
+    }
+}
+
+template <typename S>
+void rocsolver_stebz_getMemorySize(const rocblas_int n,
+                                   const rocblas_int batch_count,
+                                   size_t* size_work,
+                                   size_t* size_iwork)
+{
+    // if quick return no workspace needed
+    if(n == 0 || !batch_count)
+    {
+        *size_work = 0;
+        *size_iwork = 0;
+        return;
+    }
+
+    // size of the real and integer arrays used by the bisection
+    *size_work = sizeof(S) * (4 * n + 3) * batch_count;
+    *size_iwork = sizeof(rocblas_int) * (4 * n + 5) * batch_count;
+}
+
+template <typename T>
+rocblas_status rocsolver_stebz_argCheck(rocblas_handle handle,
+                                        const rocblas_erange erange,
+                                        const rocblas_eorder eorder,
+                                        const rocblas_int n,
+                                        const T vl,
+                                        const T vu,
+                                        const rocblas_int il,
+                                        const rocblas_int iu,
+                                        T* D,
+                                        T* E,
+                                        rocblas_int* nev,
+                                        rocblas_int* nsplit,
+                                        T* W,
+                                        rocblas_int* iblock,
+                                        rocblas_int* isplit,
+                                        rocblas_int* info)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(erange != rocblas_erange_all && erange != rocblas_erange_value
+       && erange != rocblas_erange_index)
+        return rocblas_status_invalid_value;
+    if(eorder != rocblas_eorder_blocks && eorder != rocblas_eorder_entire)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0)
+        return rocblas_status_invalid_size;
+    if(erange == rocblas_erange_value && vl >= vu)
+        return rocblas_status_invalid_size;
+    if(erange == rocblas_erange_index && (il < 1 || iu < 0))
+        return rocblas_status_invalid_size;
+    if(erange == rocblas_erange_index && (iu > n || (n > 0 && il > iu)))
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !D) || (n && !E) || !nev || !nsplit || (n && !W) || (n && !iblock)
+       || (n && !isplit) || !info)
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename S>
+rocblas_status rocsolver_stebz_template(rocblas_handle handle,
+                                        const rocblas_erange erange,
+                                        const rocblas_eorder eorder,
+                                        const rocblas_int n,
+                                        const S vl,
+                                        const S vu,
+                                        const rocblas_int il,
+                                        const rocblas_int iu,
+                                        const S abstol,
+                                        S* D,
+                                        const rocblas_int shiftD,
+                                        const rocblas_stride strideD,
+                                        S* E,
+                                        const rocblas_int shiftE,
+                                        const rocblas_stride strideE,
+                                        rocblas_int* nev,
+                                        rocblas_int* nsplit,
+                                        S* W,
+                                        const rocblas_stride strideW,
+                                        rocblas_int* iblock,
+                                        const rocblas_stride strideIblock,
+                                        rocblas_int* isplit,
+                                        const rocblas_stride strideIsplit,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count,
+                                        S* work,
+                                        rocblas_int* iwork)
+{
+    ROCSOLVER_ENTER("stebz", "erange:", erange, "eorder:", eorder, "n:", n, "vl:", vl, "vu:", vu,
+                    "il:", il, "iu:", iu, "abstol:", abstol, "shiftD:", shiftD,
+                    "shiftE:", shiftE, "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocksReset = (batch_count - 1) / BLOCKSIZE + 1;
+    dim3 gridReset(blocksReset, 1, 1);
+    dim3 threads(BLOCKSIZE, 1, 1);
+
+    // info = nev = nsplit = 0
+    hipLaunchKernelGGL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
+    hipLaunchKernelGGL(reset_info, gridReset, threads, 0, stream, nev, batch_count, 0);
+    hipLaunchKernelGGL(reset_info, gridReset, threads, 0, stream, nsplit, batch_count, 0);
+
+    // quick return
+    if(n == 0)
+        return rocblas_status_success;
+
+    S eps = get_epsilon<S>();
+    S sfmin = get_safemin<S>();
+
+    // split the matrix and prepare the search intervals
+    hipLaunchKernelGGL(stebz_splitting_kernel<S>, dim3(batch_count), dim3(1), 0, stream, erange, n,
+                       vl, vu, il, iu, abstol, D + shiftD, strideD, E + shiftE, strideE, nev,
+                       nsplit, isplit, strideIsplit, work, iwork, eps, sfmin);
+
+    // compute the eigenvalues and sort them in the requested order
+    rocblas_int blocks = (n - 1) / STEBZ_BDIM + 1;
+    dim3 grid(blocks, batch_count);
+    dim3 threadsB(STEBZ_BDIM);
+    hipLaunchKernelGGL(stebz_bisection_kernel<S>, grid, threadsB, 0, stream, n, D + shiftD,
+                       strideD, nsplit, isplit, strideIsplit, info, work, iwork);
+    hipLaunchKernelGGL(stebz_rank_kernel<S>, grid, threadsB, 0, stream, n, work, iwork);
+    hipLaunchKernelGGL(stebz_order_kernel<S>, grid, threadsB, 0, stream, eorder, n, W, strideW,
+                       iblock, strideIblock, work, iwork);
+
+    return rocblas_status_success;
+}
@@ -0,0 +1,833 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "lapack_device_functions.hpp"
+#include "rocauxiliary_steqr.hpp"
+#include "rocblas.hpp"
+#include "rocsolver.h"
+
+/****************************************************************************
+ STEDC splits the tridiagonal matrix recursively in two halves (Cuppen's
+ divide-and-conquer method) until the sub-blocks have at most
+ STEDC_MIN_DC_SIZE rows. The sub-blocks are solved with the implicit QL/QR
+ algorithm (one thread per sub-block), and are then merged back level by
+ level. Each merge deflates the rank-one modification, solves the secular
+ equation (one thread per eigenvalue) and updates the eigenvectors with a
+ GEMM. All the merges of a level are processed by the same kernel launches.
+
+ The workspace of the merges is organized as follows (for each instance of
+ the batch, and at the first row of the merged sub-block):
+   tmpz:   dd (sorted eigenvalues of the sub-blocks), zz (sorted components
+           of the updating vector), ev (new eigenvalues), tau (distance of
+           the new eigenvalues to their closest pole), and zu (unsorted
+           updating vector). tmpz also holds the scale factor of the matrix.
+   splits: perm (permutation of the columns of the eigenvectors), org (pole
+           of each new eigenvalue), src (origin of each output column) and
+           iwork (sorted order of the eigenvalues).
+ During the deflation, ev/tau and org/src store the Givens rotations.
+***************************************************************************/
+
+/** STEDC_SEGMENT computes the first row and the size of the sub-block idx
+    at the given level of the recursive splitting of a matrix of size n **/
+__host__ __device__ inline void stedc_segment(const rocblas_int n,
+                                              const rocblas_int level,
+                                              const rocblas_int idx,
+                                              rocblas_int& start,
+                                              rocblas_int& size)
+{
+    start = 0;
+    size = n;
+    for(rocblas_int l = level - 1; l >= 0; --l)
+    {
+        rocblas_int half = size / 2;
+        if((idx >> l) & 1)
+        {
+            start += half;
+            size -= half;
+        }
+        else
+            size = half;
+    }
+}
+
+/** STEDC_SPLIT_KERNEL scales the tridiagonal matrix and splits it into
+    independent sub-blocks by removing the rank-one modifications **/
+template <typename S>
+__global__ void stedc_split_kernel(const rocblas_int n,
+                                   const rocblas_int levels,
+                                   S* DD,
+                                   const rocblas_stride strideD,
+                                   S* EE,
+                                   const rocblas_stride strideE,
+                                   S* tmpzA)
+{
+    rocblas_int bid = hipBlockIdx_x;
+
+    S* D = DD + (bid * strideD);
+    S* E = EE + (bid * strideE);
+    S* scale = tmpzA + bid * (5 * n + 1) + 5 * n;
+
+    // scale the matrix
+    S anorm = find_max_tridiag(0, n - 1, D, E);
+    if(anorm == 0)
+        anorm = 1;
+    scale_tridiag(0, n - 1, D, E, S(1) / anorm);
+    *scale = anorm;
+
+    // subtract the rank-one modifications
+    rocblas_int p, k, j;
+    for(rocblas_int l = 0; l < levels; ++l)
+    {
+        for(rocblas_int idx = 0; idx < (1 << l); ++idx)
+        {
+            stedc_segment(n, l, idx, p, k);
+            j = p + k / 2;
+            D[j - 1] -= abs(E[j - 1]);
+            D[j] -= abs(E[j - 1]);
+        }
+    }
+}
+
+/** STEDC_LEAF_KERNEL solves the sub-blocks at the bottom level with the
+    QL/QR algorithm (one wavefront per sub-block) **/
+template <typename S>
+__global__ void stedc_leaf_kernel(const rocblas_int n,
+                                  const rocblas_int levels,
+                                  S* DD,
+                                  const rocblas_stride strideD,
+                                  S* EE,
+                                  const rocblas_stride strideE,
+                                  S* QQ,
+                                  rocblas_int* info,
+                                  S* WW,
+                                  const S eps,
+                                  const S ssfmin,
+                                  const S ssfmax)
+{
+    rocblas_int idx = hipBlockIdx_x;
+    rocblas_int bid = hipBlockIdx_y;
+    rocblas_int tid = hipThreadIdx_x;
+
+    rocblas_int p, k;
+    stedc_segment(n, levels, idx, p, k);
+
+    S* D = DD + (bid * strideD) + p;
+    S* E = EE + (bid * strideE) + p;
+    S* Q = QQ + (bid * rocblas_stride(n) * n) + p + p * n;
+    S* work = WW + (bid * 2 * n) + 2 * p;
+
+    rocblas_int nconv
+        = run_steqr(tid, hipBlockDim_x, k, D, E, Q, n, work, 30 * k, eps, ssfmin, ssfmax);
+    if(tid == 0 && nconv)
+        atomicAdd(info + bid, nconv);
+}
+
+/** STEDC_MERGEPREP_KERNEL prepares the merge of the two halves of each
+    sub-block at the given level: it forms the updating vector, sorts the
+    eigenvalues and deflates the rank-one modification **/
+template <typename S>
+__global__ void __launch_bounds__(STEDC_BDIM) stedc_mergePrep_kernel(const rocblas_int n,
+                                                                     const rocblas_int level,
+                                                                     S* DD,
+                                                                     const rocblas_stride strideD,
+                                                                     S* EE,
+                                                                     const rocblas_stride strideE,
+                                                                     S* QQ,
+                                                                     S* tmpzA,
+                                                                     rocblas_int* splitsA,
+                                                                     const S eps)
+{
+    rocblas_int idx = hipBlockIdx_x;
+    rocblas_int bid = hipBlockIdx_y;
+    rocblas_int tid = hipThreadIdx_x;
+
+    rocblas_int p, k;
+    stedc_segment(n, level, idx, p, k);
+    rocblas_int n1 = k / 2;
+
+    S* D = DD + (bid * strideD) + p;
+    S rho = EE[(bid * strideE) + p + n1 - 1];
+    S* Q = QQ + (bid * rocblas_stride(n) * n) + p + p * n;
+
+    S* dd = tmpzA + bid * (5 * n + 1) + p;
+    S* zz = dd + n;
+    S* ev = dd + 2 * n;
+    S* tau = dd + 3 * n;
+    S* zu = dd + 4 * n;
+    rocblas_int* perm = splitsA + bid * (4 * n) + p;
+    rocblas_int* org = perm + n;
+    rocblas_int* src = perm + 2 * n;
+    rocblas_int* iwork = perm + 3 * n;
+
+    __shared__ rocblas_int nrot;
+
+    // the updating vector is formed by the last row of the eigenvectors of
+    // the first half and the first row of the eigenvectors of the second half
+    // (normalized, and with the sign of rho)
+    S sq2 = sqrt(S(2));
+    for(rocblas_int i = tid; i < k; i += hipBlockDim_x)
+    {
+        if(i < n1)
+            zu[i] = Q[(n1 - 1) + i * n] / sq2;
+        else
+            zu[i] = (rho < 0 ? -Q[n1 + i * n] : Q[n1 + i * n]) / sq2;
+    }
+    __syncthreads();
+
+    if(tid == 0)
+    {
+        rho = 2 * abs(rho);
+
+        // merge the eigenvalues of the two halves in increasing order
+        rocblas_int i1 = 0, i2 = n1;
+        for(rocblas_int j = 0; j < k; ++j)
+        {
+            if(i2 == k || (i1 < n1 && D[i1] <= D[i2]))
+                iwork[j] = i1++;
+            else
+                iwork[j] = i2++;
+        }
+
+        // deflation tolerance
+        S zmax = 0;
+        for(rocblas_int j = 0; j < k; ++j)
+            zmax = max(zmax, abs(zu[j]));
+        S dmax = max(abs(D[iwork[0]]), abs(D[iwork[k - 1]]));
+        S tol = 8 * eps * max(dmax, zmax);
+
+        // deflate; the deflated eigenvalues are stored backwards at the end
+        rocblas_int K = 0, nd = 0, nr = 0;
+        rocblas_int pj = -1;
+        for(rocblas_int j = 0; j < k; ++j)
+        {
+            rocblas_int c = iwork[j];
+            if(rho * abs(zu[c]) <= tol)
+            {
+                // small component of the updating vector
+                nd++;
+                perm[k - nd] = c;
+                dd[k - nd] = D[c];
+            }
+            else if(pj < 0)
+                pj = c;
+            else
+            {
+                // check if the eigenvalues of pj and c are close enough
+                S s = zu[pj];
+                S cs = zu[c];
+                S t = sqrt(cs * cs + s * s);
+                cs = cs / t;
+                s = -s / t;
+                if(abs((D[c] - D[pj]) * cs * s) <= tol)
+                {
+                    // rotate to zero the component of pj
+                    zu[c] = t;
+                    zu[pj] = 0;
+                    org[nr] = pj;
+                    src[nr] = c;
+                    ev[nr] = cs;
+                    tau[nr] = s;
+                    nr++;
+
+                    t = D[pj] * cs * cs + D[c] * s * s;
+                    D[c] = D[pj] * s * s + D[c] * cs * cs;
+                    D[pj] = t;
+
+                    nd++;
+                    perm[k - nd] = pj;
+                    dd[k - nd] = D[pj];
+                }
+                else
+                {
+                    perm[K] = pj;
+                    dd[K] = D[pj];
+                    zz[K] = zu[pj];
+                    K++;
+                }
+                pj = c;
+            }
+        }
+        if(pj >= 0)
+        {
+            perm[K] = pj;
+            dd[K] = D[pj];
+            zz[K] = zu[pj];
+            K++;
+        }
+
+        // sort the deflated eigenvalues in increasing order
+        for(rocblas_int i = K, j = k - 1; i < j; ++i, --j)
+        {
+            rocblas_int c = perm[i];
+            perm[i] = perm[j];
+            perm[j] = c;
+            S v = dd[i];
+            dd[i] = dd[j];
+            dd[j] = v;
+        }
+        for(rocblas_int i = K + 1; i < k; ++i)
+        {
+            S v = dd[i];
+            rocblas_int c = perm[i];
+            rocblas_int j = i - 1;
+            while(j >= K && dd[j] > v)
+            {
+                dd[j + 1] = dd[j];
+                perm[j + 1] = perm[j];
+                j--;
+            }
+            dd[j + 1] = v;
+            perm[j + 1] = c;
+        }
+
+        iwork[0] = K;
+        zu[0] = rho;
+        nrot = nr;
+    }
+    __syncthreads();
+
+    // apply the rotations to the eigenvectors (each thread updates its rows)
+    for(rocblas_int i = tid; i < k; i += hipBlockDim_x)
+    {
+        for(rocblas_int r = 0; r < nrot; ++r)
+        {
+            S x = Q[i + org[r] * n];
+            S y = Q[i + src[r] * n];
+            Q[i + org[r] * n] = ev[r] * x + tau[r] * y;
+            Q[i + src[r] * n] = ev[r] * y - tau[r] * x;
+        }
+    }
+}
+
+/** STEDC_SECULAR_EVAL evaluates the secular function
+    f(t) = 1/rho + sum_j z_j^2 / (d_j - d_o - t) and its derivative **/
+template <typename S>
+__device__ void stedc_secular_eval(const rocblas_int K,
+                                   const S* d,
+                                   const S* z,
+                                   const S rho,
+                                   const rocblas_int o,
+                                   const S t,
+                                   S& f,
+                                   S& df,
+                                   S& fsum)
+{
+    f = S(1) / rho;
+    df = 0;
+    fsum = f;
+    for(rocblas_int j = 0; j < K; ++j)
+    {
+        S r = z[j] / ((d[j] - d[o]) - t);
+        f += z[j] * r;
+        df += r * r;
+        fsum += abs(z[j] * r);
+    }
+}
+
+/** STEDC_SECULAR_KERNEL computes the new eigenvalues of each merge (one
+    thread per eigenvalue) with a safeguarded Newton iteration. Each
+    eigenvalue is represented by its closest pole d_o and the distance tau
+    to it, so that the differences d_j - lambda can be computed accurately **/
+template <typename S>
+__global__ void stedc_secular_kernel(const rocblas_int n,
+                                     const rocblas_int level,
+                                     S* tmpzA,
+                                     rocblas_int* splitsA,
+                                     rocblas_int* info,
+                                     const S eps)
+{
+    rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int idx = hipBlockIdx_y;
+    rocblas_int bid = hipBlockIdx_z;
+
+    rocblas_int p, k;
+    stedc_segment(n, level, idx, p, k);
+
+    S* dd = tmpzA + bid * (5 * n + 1) + p;
+    S* zz = dd + n;
+    S* ev = dd + 2 * n;
+    S* tau = dd + 3 * n;
+    S* zu = dd + 4 * n;
+    rocblas_int* org = splitsA + bid * (4 * n) + p + n;
+    rocblas_int* iwork = org + 2 * n;
+
+    rocblas_int K = iwork[0];
+    if(i >= K)
+        return;
+
+    S rho = zu[0];
+    S f, df, fsum, lo, hi, t;
+    rocblas_int o;
+
+    // bracket the eigenvalue and choose the closest pole
+    if(i < K - 1)
+    {
+        S mid = (dd[i + 1] - dd[i]) / 2;
+        stedc_secular_eval(K, dd, zz, rho, i, mid, f, df, fsum);
+        if(f >= 0)
+        {
+            o = i;
+            lo = 0;
+            hi = mid;
+        }
+        else
+        {
+            o = i + 1;
+            lo = -mid;
+            hi = 0;
+        }
+    }
+    else
+    {
+        S nrm = 0;
+        for(rocblas_int j = 0; j < K; ++j)
+            nrm += zz[j] * zz[j];
+        o = K - 1;
+        lo = 0;
+        hi = rho * nrm;
+    }
+
+    bool converged = (K == 1);
+    t = converged ? hi : (lo + hi) / 2;
+    for(rocblas_int iter = 0; iter < STEDC_MAX_ITERS && !converged; ++iter)
+    {
+        stedc_secular_eval(K, dd, zz, rho, o, t, f, df, fsum);
+        if(abs(f) <= K * eps * fsum)
+            converged = true;
+        else
+        {
+            if(f < 0)
+                lo = t;
+            else
+                hi = t;
+
+            if(hi - lo <= 2 * eps * max(abs(lo), abs(hi)))
+                converged = true;
+            else
+            {
+                // Newton step, or bisection if the step leaves the bracket
+                S tn = t - f / df;
+                t = (tn > lo && tn < hi) ? tn : (lo + hi) / 2;
+            }
+        }
+    }
+
+    ev[i] = dd[o] + t;
+    tau[i] = t;
+    org[i] = o;
+    if(!converged)
+        atomicAdd(info + bid, 1);
+}
+
+/** STEDC_ZHAT_KERNEL recomputes the updating vector from the new
+    eigenvalues (Gu-Eisenstat), so that the eigenvectors are numerically
+    orthogonal **/
+template <typename S>
+__global__ void stedc_zhat_kernel(const rocblas_int n,
+                                  const rocblas_int level,
+                                  S* tmpzA,
+                                  rocblas_int* splitsA)
+{
+    rocblas_int j = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int idx = hipBlockIdx_y;
+    rocblas_int bid = hipBlockIdx_z;
+
+    rocblas_int p, k;
+    stedc_segment(n, level, idx, p, k);
+
+    S* dd = tmpzA + bid * (5 * n + 1) + p;
+    S* zz = dd + n;
+    S* tau = dd + 3 * n;
+    S* zu = dd + 4 * n;
+    rocblas_int* org = splitsA + bid * (4 * n) + p + n;
+    rocblas_int* iwork = org + 2 * n;
+
+    rocblas_int K = iwork[0];
+    if(j >= K)
+        return;
+
+    // zhat_j^2 = prod_i (lambda_i - d_j) / (rho * prod_{i != j} (d_i - d_j))
+    S rho = zu[0];
+    S w = (tau[j] - (dd[j] - dd[org[j]])) / rho;
+    for(rocblas_int i = 0; i < K; ++i)
+    {
+        if(i != j)
+            w *= (tau[i] - (dd[j] - dd[org[i]])) / (dd[i] - dd[j]);
+    }
+
+    w = sqrt(abs(w));
+    zz[j] = (zz[j] < 0 ? -w : w);
+}
+
+/** STEDC_ORDER_KERNEL merges the new and the deflated eigenvalues of each
+    sub-block in increasing order **/
+template <typename S>
+__global__ void stedc_order_kernel(const rocblas_int n,
+                                   const rocblas_int level,
+                                   S* DD,
+                                   const rocblas_stride strideD,
+                                   S* tmpzA,
+                                   rocblas_int* splitsA)
+{
+    rocblas_int idx = hipBlockIdx_x;
+    rocblas_int bid = hipBlockIdx_y;
+
+    rocblas_int p, k;
+    stedc_segment(n, level, idx, p, k);
+
+    S* D = DD + (bid * strideD) + p;
+    S* dd = tmpzA + bid * (5 * n + 1) + p;
+    S* ev = dd + 2 * n;
+    rocblas_int* src = splitsA + bid * (4 * n) + p + 2 * n;
+    rocblas_int* iwork = src + n;
+
+    rocblas_int K = iwork[0];
+    rocblas_int i1 = 0, i2 = K;
+    for(rocblas_int o = 0; o < k; ++o)
+    {
+        if(i2 == k || (i1 < K && ev[i1] <= dd[i2]))
+        {
+            D[o] = ev[i1];
+            src[o] = i1++;
+        }
+        else
+        {
+            D[o] = dd[i2];
+            src[o] = i2++;
+        }
+    }
+}
+
+/** STEDC_VECTORS_KERNEL computes the eigenvectors of the rank-one
+    modification of each sub-block (one thread-block per column) **/
+template <typename S>
+__global__ void __launch_bounds__(STEDC_BDIM) stedc_vectors_kernel(const rocblas_int n,
+                                                                   const rocblas_int level,
+                                                                   S* UU,
+                                                                   S* tmpzA,
+                                                                   rocblas_int* splitsA)
+{
+    rocblas_int o = hipBlockIdx_x;
+    rocblas_int idx = hipBlockIdx_y;
+    rocblas_int bid = hipBlockIdx_z;
+    rocblas_int tid = hipThreadIdx_x;
+
+    rocblas_int p, k;
+    stedc_segment(n, level, idx, p, k);
+    if(o >= k)
+        return;
+
+    S* U = UU + (bid * rocblas_stride(n) * n) + p + (p + o) * n;
+    S* dd = tmpzA + bid * (5 * n + 1) + p;
+    S* zz = dd + n;
+    S* tau = dd + 3 * n;
+    rocblas_int* perm = splitsA + bid * (4 * n) + p;
+    rocblas_int* org = perm + n;
+    rocblas_int* src = perm + 2 * n;
+    rocblas_int* iwork = perm + 3 * n;
+
+    __shared__ S sval[STEDC_BDIM];
+
+    rocblas_int K = iwork[0];
+    rocblas_int s = src[o];
+
+    for(rocblas_int i = tid; i < k; i += hipBlockDim_x)
+        U[i] = 0;
+    __syncthreads();
+
+    if(s >= K)
+    {
+        // deflated eigenvalue; the eigenvector is a column of the identity
+        if(tid == 0)
+            U[perm[s]] = 1;
+    }
+    else
+    {
+        // u_j = zhat_j / (d_j - lambda_s), normalized
+        S ds = dd[org[s]];
+        S ts = tau[s];
+        S nrm = 0;
+        for(rocblas_int j = tid; j < K; j += hipBlockDim_x)
+        {
+            S u = zz[j] / ((dd[j] - ds) - ts);
+            nrm += u * u;
+        }
+        sval[tid] = nrm;
+        __syncthreads();
+
+        for(rocblas_int r = STEDC_BDIM / 2; r > 0; r /= 2)
+        {
+            if(tid < r)
+                sval[tid] += sval[tid + r];
+            __syncthreads();
+        }
+        nrm = sqrt(sval[0]);
+
+        for(rocblas_int j = tid; j < K; j += hipBlockDim_x)
+            U[perm[j]] = zz[j] / ((dd[j] - ds) - ts) / nrm;
+    }
+}
+
+/** STEDC_UNSCALE_KERNEL restores the scale of the eigenvalues **/
+template <typename S>
+__global__ void stedc_unscale_kernel(const rocblas_int n,
+                                     S* DD,
+                                     const rocblas_stride strideD,
+                                     S* tmpzA)
+{
+    rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int bid = hipBlockIdx_y;
+
+    if(i < n)
+        DD[(bid * strideD) + i] *= tmpzA[bid * (5 * n + 1) + 5 * n];
+}
+
+/** STEDC_COPYVECT copies the real eigenvectors Q into C **/
+template <typename T, typename S, typename U>
+__global__ void stedc_copyvect(const rocblas_int n,
+                               S* QQ,
+                               const rocblas_stride strideQ,
+                               U CC,
+                               const rocblas_int shiftC,
+                               const rocblas_int ldc,
+                               const rocblas_stride strideC)
+{
+    rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+    rocblas_int bid = hipBlockIdx_z;
+
+    if(i < n && j < n)
+    {
+        S* Q = QQ + (bid * strideQ);
+        T* C = load_ptr_batch<T>(CC, bid, shiftC, strideC);
+        C[i + j * ldc] = T(Q[i + j * n]);
+    }
+}
+
+template <typename S, typename T>
+void rocsolver_stedc_getMemorySize(const rocblas_evect evect,
+                                   const rocblas_int n,
+                                   const rocblas_int batch_count,
+                                   size_t* size_work_stack,
+                                   size_t* size_tempvect,
+                                   size_t* size_tempgemm,
+                                   size_t* size_tmpz,
+                                   size_t* size_splits)
+{
+    *size_tempvect = 0;
+    *size_tempgemm = 0;
+    *size_tmpz = 0;
+    *size_splits = 0;
+
+    // if quick return no workspace needed
+    if(n == 0 || !batch_count)
+    {
+        *size_work_stack = 0;
+        return;
+    }
+
+    // requirements for sterf/steqr (used when no eigenvectors are required
+    // or the matrix is small)
+    rocsolver_steqr_getMemorySize<S, T>(evect, n, batch_count, size_work_stack);
+    if(evect == rocblas_evect_none || n <= rocsolver_tuning::get()->stedc_min_dc_size)
+        return;
+
+    // size of workspace for the QL/QR iterations on the sub-blocks
+    *size_work_stack = std::max(*size_work_stack, sizeof(S) * 2 * n * batch_count);
+
+    // size of the two matrices of eigenvectors that are updated in turns by
+    // the merges (tempvect), and of the eigenvectors of the rank-one
+    // modifications (tempgemm). When evect is original, they also hold C as
+    // a real matrix to compute the final product.
+    size_t s = (evect == rocblas_evect_original ? sizeof(T) : sizeof(S)) * n * n * batch_count;
+    *size_tempvect = 2 * s;
+    *size_tempgemm = s;
+
+    // size of the vectors used by the merges
+    *size_tmpz = sizeof(S) * (5 * n + 1) * batch_count;
+    *size_splits = sizeof(rocblas_int) * 4 * n * batch_count;
+}
+
+template <typename S, typename T>
+rocblas_status rocsolver_stedc_argCheck(rocblas_handle handle,
+                                        const rocblas_evect evect,
+                                        const rocblas_int n,
+                                        S D,
+                                        S E,
+                                        T C,
+                                        const rocblas_int ldc,
+                                        rocblas_int* info)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(evect != rocblas_evect_none && evect != rocblas_evect_tridiagonal
+       && evect != rocblas_evect_original)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0)
+        return rocblas_status_invalid_size;
+    if(evect != rocblas_evect_none && ldc < n)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !D) || (n && !E) || (evect != rocblas_evect_none && n && !C) || !info)
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename S, typename T, typename U>
+rocblas_status rocsolver_stedc_template(rocblas_handle handle,
+                                        const rocblas_evect evect,
+                                        const rocblas_int n,
+                                        S* D,
+                                        const rocblas_int shiftD,
+                                        const rocblas_stride strideD,
+                                        S* E,
+                                        const rocblas_int shiftE,
+                                        const rocblas_stride strideE,
+                                        U C,
+                                        const rocblas_int shiftC,
+                                        const rocblas_int ldc,
+                                        const rocblas_stride strideC,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count,
+                                        void* work_stack,
+                                        S* tempvect,
+                                        S* tempgemm,
+                                        S* tmpz,
+                                        rocblas_int* splits)
+{
+    ROCSOLVER_ENTER("stedc", "evect:", evect, "n:", n, "shiftD:", shiftD, "shiftE:", shiftE,
+                    "shiftC:", shiftC, "ldc:", ldc, "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    // if no eigenvectors are required, or the matrix is small, use sterf/steqr
+    rocblas_int minsize = rocsolver_tuning::get()->stedc_min_dc_size;
+    if(evect == rocblas_evect_none || n <= minsize)
+        return rocsolver_steqr_template<S, T>(handle, evect, n, D, shiftD, strideD, E, shiftE,
+                                              strideE, C, shiftC, ldc, strideC, info, batch_count,
+                                              work_stack);
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocksReset = (batch_count - 1) / BLOCKSIZE + 1;
+    dim3 gridReset(blocksReset, 1, 1);
+    dim3 threads(BLOCKSIZE, 1, 1);
+
+    // info = 0
+    hipLaunchKernelGGL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+    S one = 1;
+    S zero = 0;
+
+    S eps = get_epsilon<S>();
+    S ssfmin = get_safemin<S>();
+    S ssfmax = S(1.0) / ssfmin;
+    ssfmin = sqrt(ssfmin) / (eps * eps);
+    ssfmax = sqrt(ssfmax) / S(3.0);
+
+    // number of levels of the recursive splitting
+    rocblas_int levels = 0;
+    while(((n - 1) >> levels) + 1 > minsize)
+        levels++;
+
+    // the eigenvectors are accumulated in Q, with W as the output of the GEMMs
+    rocblas_int cf = (evect == rocblas_evect_original ? sizeof(T) / sizeof(S) : 1);
+    rocblas_stride strideQ = rocblas_stride(n) * n;
+    S* Q = tempvect;
+    S* W = tempvect + cf * strideQ * batch_count;
+
+    rocblas_int blocks = (n - 1) / BS + 1;
+    dim3 gridQ(blocks, blocks, batch_count);
+    dim3 threadsQ(BS, BS, 1);
+
+    // scale the matrix and split it into independent sub-blocks
+    hipLaunchKernelGGL(stedc_split_kernel<S>, dim3(batch_count), dim3(1), 0, stream, n, levels,
+                       D + shiftD, strideD, E + shiftE, strideE, tmpz);
+
+    // solve the sub-blocks
+    hipLaunchKernelGGL(init_ident<S>, gridQ, threadsQ, 0, stream, n, n, Q, 0, n, strideQ);
+    hipLaunchKernelGGL(set_zero<S>, gridQ, threadsQ, 0, stream, n, n, W, 0, n, strideQ);
+    hipLaunchKernelGGL(stedc_leaf_kernel<S>, dim3(1 << levels, batch_count), dim3(WAVESIZE), 0,
+                       stream, n, levels, D + shiftD, strideD, E + shiftE, strideE, Q, info,
+                       (S*)work_stack, eps, ssfmin, ssfmax);
+
+    // merge the sub-blocks level by level
+    rocblas_int p, k;
+    for(rocblas_int l = levels - 1; l >= 0; --l)
+    {
+        rocblas_int nseg = 1 << l;
+        rocblas_int maxk = ((n - 1) >> l) + 1;
+        dim3 gridK((maxk - 1) / BLOCKSIZE + 1, nseg, batch_count);
+
+        hipLaunchKernelGGL(stedc_mergePrep_kernel<S>, dim3(nseg, batch_count), dim3(STEDC_BDIM),
+                           0, stream, n, l, D + shiftD, strideD, E + shiftE, strideE, Q, tmpz,
+                           splits, eps);
+        hipLaunchKernelGGL(stedc_secular_kernel<S>, gridK, threads, 0, stream, n, l, tmpz, splits,
+                           info, eps);
+        hipLaunchKernelGGL(stedc_zhat_kernel<S>, gridK, threads, 0, stream, n, l, tmpz, splits);
+        hipLaunchKernelGGL(stedc_order_kernel<S>, dim3(nseg, batch_count), dim3(1), 0, stream, n,
+                           l, D + shiftD, strideD, tmpz, splits);
+        hipLaunchKernelGGL(stedc_vectors_kernel<S>, dim3(maxk, nseg, batch_count),
+                           dim3(STEDC_BDIM), 0, stream, n, l, tempgemm, tmpz, splits);
+
+        // update the eigenvectors of each sub-block
+        for(rocblas_int idx = 0; idx < nseg; ++idx)
+        {
+            stedc_segment(n, l, idx, p, k);
+            rocblasCall_gemm<false, true, S>(
+                handle, rocblas_operation_none, rocblas_operation_none, k, k, k, &one, Q,
+                idx2D(p, p, n), n, strideQ, tempgemm, idx2D(p, p, n), n, strideQ, &zero, W,
+                idx2D(p, p, n), n, strideQ, batch_count, nullptr);
+        }
+        std::swap(Q, W);
+    }
+
+    // restore the scale of the eigenvalues
+    hipLaunchKernelGGL(stedc_unscale_kernel<S>, dim3((n - 1) / BLOCKSIZE + 1, batch_count),
+                       threads, 0, stream, n, D + shiftD, strideD, tmpz);
+
+    if(evect == rocblas_evect_tridiagonal)
+        hipLaunchKernelGGL(stedc_copyvect<T>, gridQ, threadsQ, 0, stream, n, Q, strideQ, C,
+                           shiftC, ldc, strideC);
+    else
+    {
+        // C = C * Q, computed as a real product (the real and imaginary parts of
+        // the entries of C are the rows of a real matrix with cf*n rows)
+        T* Ct = (T*)tempgemm;
+        hipLaunchKernelGGL(copy_mat<T>, gridQ, threadsQ, 0, stream, n, n, C, shiftC, ldc, strideC,
+                           Ct, 0, n, strideQ);
+        rocblasCall_gemm<false, true, S>(handle, rocblas_operation_none, rocblas_operation_none,
+                                         cf * n, n, n, &one, (S*)Ct, 0, cf * n, cf * strideQ, Q, 0,
+                                         n, strideQ, &zero, W, 0, cf * n, cf * strideQ,
+                                         batch_count, nullptr);
+        hipLaunchKernelGGL(copy_mat<T>, gridQ, threadsQ, 0, stream, n, n, (T*)W, 0, n, strideQ, C,
+                           shiftC, ldc, strideC);
+    }
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
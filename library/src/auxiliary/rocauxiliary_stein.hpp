@@ -0,0 +1,500 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "lapack_device_functions.hpp"
+#include "rocblas.hpp"
+#include "rocsolver.h"
+
+/****************************************************************************
+ STEIN computes the eigenvectors of a symmetric tridiagonal matrix associated
+ with the given eigenvalues by inverse iteration. Eigenvalues of the same
+ block that are closer than 1e-3 times the norm of the block form a cluster,
+ and the eigenvectors of a cluster are reorthogonalized against each other.
+ The clusters are independent and are distributed among the STEIN_BDIM
+ threads of the block assigned to each instance of the batch.
+
+ The workspace of each thread holds the LU factorization of the shifted
+ block (a, b, c, d and the pivots in iwork) and the current iterate x.
+***************************************************************************/
+
+/** STEIN_LAGTF computes the LU factorization with partial pivoting of the
+    shifted tridiagonal matrix T - lambda*I (equivalent to LAPACK's LAGTF) **/
+template <typename S>
+__device__ void stein_lagtf(const rocblas_int n,
+                            S* a,
+                            const S lambda,
+                            S* b,
+                            S* c,
+                            S* d,
+                            rocblas_int* in)
+{
+    a[0] -= lambda;
+    in[n - 1] = 0;
+    if(n == 1)
+        return;
+
+    S scale1 = abs(a[0]) + abs(b[0]);
+    for(rocblas_int k = 0; k < n - 1; ++k)
+    {
+        a[k + 1] -= lambda;
+        S scale2 = abs(c[k]) + abs(a[k + 1]);
+        if(k < n - 2)
+            scale2 += abs(b[k + 1]);
+        S piv1 = (a[k] == 0 ? 0 : abs(a[k]) / scale1);
+
+        if(c[k] == 0)
+        {
+            in[k] = 0;
+            scale1 = scale2;
+            if(k < n - 2)
+                d[k] = 0;
+        }
+        else
+        {
+            S piv2 = abs(c[k]) / scale2;
+            if(piv2 <= piv1)
+            {
+                in[k] = 0;
+                scale1 = scale2;
+                c[k] = c[k] / a[k];
+                a[k + 1] -= c[k] * b[k];
+                if(k < n - 2)
+                    d[k] = 0;
+            }
+            else
+            {
+                in[k] = 1;
+                S mult = a[k] / c[k];
+                a[k] = c[k];
+                S temp = a[k + 1];
+                a[k + 1] = b[k] - mult * temp;
+                if(k < n - 2)
+                {
+                    d[k] = b[k + 1];
+                    b[k + 1] = -mult * d[k];
+                }
+                b[k] = temp;
+                c[k] = mult;
+            }
+        }
+    }
+}
+
+/** STEIN_LAGTS solves the system (T - lambda*I)x = y with the factorization
+    computed by STEIN_LAGTF, perturbing the small pivots to avoid overflow
+    (equivalent to LAPACK's LAGTS with job = -1) **/
+template <typename S>
+__device__ void stein_lagts(const rocblas_int n,
+                            S* a,
+                            S* b,
+                            S* c,
+                            S* d,
+                            rocblas_int* in,
+                            S* y,
+                            S& tol,
+                            const S eps,
+                            const S sfmin)
+{
+    S bignum = S(1) / sfmin;
+
+    if(tol <= 0)
+    {
+        tol = abs(a[0]);
+        if(n > 1)
+            tol = max(tol, max(abs(a[1]), abs(b[0])));
+        for(rocblas_int k = 2; k < n; ++k)
+            tol = max(max(tol, abs(a[k])), max(abs(b[k - 1]), abs(d[k - 2])));
+        tol *= eps;
+        if(tol == 0)
+            tol = eps;
+    }
+
+    // forward substitution
+    for(rocblas_int k = 1; k < n; ++k)
+    {
+        if(in[k - 1] == 0)
+            y[k] -= c[k - 1] * y[k - 1];
+        else
+        {
+            S temp = y[k - 1];
+            y[k - 1] = y[k];
+            y[k] = temp - c[k - 1] * y[k];
+        }
+    }
+
+    // backward substitution
+    for(rocblas_int k = n - 1; k >= 0; --k)
+    {
+        S temp = y[k];
+        if(k < n - 2)
+            temp -= b[k] * y[k + 1] + d[k] * y[k + 2];
+        else if(k == n - 2)
+            temp -= b[k] * y[k + 1];
+
+        S ak = a[k];
+        S pert = (ak >= 0 ? abs(tol) : -abs(tol));
+        while(true)
+        {
+            S absak = abs(ak);
+            if(absak < 1)
+            {
+                if(absak < sfmin)
+                {
+                    if(absak == 0 || abs(temp) * sfmin > absak)
+                    {
+                        ak += pert;
+                        pert *= 2;
+                        continue;
+                    }
+                    temp *= bignum;
+                    ak *= bignum;
+                }
+                else if(abs(temp) > absak * bignum)
+                {
+                    ak += pert;
+                    pert *= 2;
+                    continue;
+                }
+            }
+            break;
+        }
+        y[k] = temp / ak;
+    }
+}
+
+/** STEIN_IAMAX returns the index of the entry of x with largest absolute
+    value **/
+template <typename S>
+__device__ rocblas_int stein_iamax(const rocblas_int n, S* x)
+{
+    rocblas_int jmax = 0;
+    for(rocblas_int i = 1; i < n; ++i)
+    {
+        if(abs(x[i]) > abs(x[jmax]))
+            jmax = i;
+    }
+    return jmax;
+}
+
+/** STEIN_SORT_IFAIL sorts the first nfail entries of ifail in ascending
+    order **/
+__device__ inline void stein_sort_ifail(const rocblas_int nfail, rocblas_int* ifail)
+{
+    for(rocblas_int i = 1; i < nfail; ++i)
+    {
+        rocblas_int f = ifail[i];
+        rocblas_int k = i;
+        while(k > 0 && ifail[k - 1] > f)
+        {
+            ifail[k] = ifail[k - 1];
+            k--;
+        }
+        ifail[k] = f;
+    }
+}
+
+/** STEIN_KERNEL computes the eigenvectors by inverse iteration (one thread
+    per cluster of eigenvalues) **/
+template <typename S, typename T, typename U>
+__global__ void __launch_bounds__(STEIN_BDIM) stein_kernel(const rocblas_int n,
+                                                           S* DD,
+                                                           const rocblas_stride strideD,
+                                                           S* EE,
+                                                           const rocblas_stride strideE,
+                                                           rocblas_int* nevA,
+                                                           S* WW,
+                                                           const rocblas_stride strideW,
+                                                           rocblas_int* iblockA,
+                                                           const rocblas_stride strideIblock,
+                                                           rocblas_int* isplitA,
+                                                           const rocblas_stride strideIsplit,
+                                                           U ZZ,
+                                                           const rocblas_int shiftZ,
+                                                           const rocblas_int ldz,
+                                                           const rocblas_stride strideZ,
+                                                           rocblas_int* ifailA,
+                                                           const rocblas_stride strideF,
+                                                           rocblas_int* infoA,
+                                                           S* workA,
+                                                           rocblas_int* iworkA,
+                                                           const S eps,
+                                                           const S sfmin)
+{
+    rocblas_int bid = hipBlockIdx_y;
+    rocblas_int tid = hipThreadIdx_x;
+
+    S* D = DD + (bid * strideD);
+    S* E = EE + (bid * strideE);
+    S* W = WW + (bid * strideW);
+    rocblas_int* iblock = iblockA + (bid * strideIblock);
+    rocblas_int* isplit = isplitA + (bid * strideIsplit);
+    rocblas_int* ifail = ifailA + (bid * strideF);
+    T* Z = load_ptr_batch<T>(ZZ, bid, shiftZ, strideZ);
+    rocblas_int nev = nevA[bid];
+
+    // workspace of this thread
+    S* a = workA + (bid * STEIN_BDIM + tid) * 5 * n;
+    S* b = a + n;
+    S* c = b + n;
+    S* d = c + n;
+    S* x = d + n;
+    rocblas_int* in = iworkA + (bid * STEIN_BDIM + tid) * n;
+
+    for(rocblas_int i = tid; i < nev; i += STEIN_BDIM)
+        ifail[i] = 0;
+    __syncthreads();
+
+    // traverse the eigenvalues to identify the clusters; each thread works on
+    // the clusters congruent to tid modulo STEIN_BDIM
+    rocblas_int nblk = 0, jblk = 0, b1 = 0, blksiz = 0;
+    rocblas_int cluster = -1, gpind = 0;
+    S onenrm = 0, ortol = 0, dtpcrt = 0, xjm = 0;
+    for(rocblas_int j = 0; j < nev; ++j)
+    {
+        // new block
+        if(iblock[j] != nblk)
+        {
+            nblk = iblock[j];
+            b1 = (nblk == 1 ? 0 : isplit[nblk - 2]);
+            rocblas_int bn = isplit[nblk - 1] - 1;
+            blksiz = bn - b1 + 1;
+            jblk = 0;
+
+            // reorthogonalization and stopping criteria
+            if(blksiz > 1)
+            {
+                onenrm = max(abs(D[b1]) + abs(E[b1]), abs(D[bn]) + abs(E[bn - 1]));
+                for(rocblas_int i = b1 + 1; i < bn; ++i)
+                    onenrm = max(onenrm, abs(D[i]) + abs(E[i - 1]) + abs(E[i]));
+                ortol = S(1e-3) * onenrm;
+                dtpcrt = sqrt(S(0.1) / blksiz);
+            }
+        }
+        jblk++;
+
+        // perturb the eigenvalue if it is too close to the previous one
+        S xj = W[j];
+        if(blksiz > 1 && jblk > 1)
+        {
+            S pertol = 10 * abs(eps * xj);
+            if(xj - xjm < pertol)
+                xj = xjm + pertol;
+        }
+        if(jblk == 1 || abs(xj - xjm) > ortol)
+        {
+            cluster++;
+            gpind = j;
+        }
+        xjm = xj;
+
+        if(cluster % STEIN_BDIM != tid)
+            continue;
+
+        if(blksiz == 1)
+            x[0] = 1;
+        else
+        {
+            // pseudo-random starting vector
+            uint32_t seed = 2654435761u * uint32_t(j + 1);
+            for(rocblas_int i = 0; i < blksiz; ++i)
+            {
+                seed = seed * 1664525u + 1013904223u;
+                x[i] = S(seed) / S(4294967295u) * 2 - 1;
+            }
+
+            // factorize the shifted block
+            for(rocblas_int i = 0; i < blksiz; ++i)
+                a[i] = D[b1 + i];
+            for(rocblas_int i = 0; i < blksiz - 1; ++i)
+            {
+                b[i] = E[b1 + i];
+                c[i] = E[b1 + i];
+            }
+            stein_lagtf(blksiz, a, xj, b, c, d, in);
+
+            // inverse iteration
+            S tol = 0, nrm;
+            rocblas_int its = 0, nrmchk = 0;
+            bool converged = false;
+            while(its < STEIN_MAX_ITERS)
+            {
+                its++;
+
+                // scale the right-hand side and solve
+                rocblas_int jmax = stein_iamax(blksiz, x);
+                S scl = blksiz * onenrm * max(eps, abs(a[blksiz - 1])) / abs(x[jmax]);
+                for(rocblas_int i = 0; i < blksiz; ++i)
+                    x[i] *= scl;
+                stein_lagts(blksiz, a, b, c, d, in, x, tol, eps, sfmin);
+
+                // reorthogonalize against the previous vectors of the cluster
+                for(rocblas_int k = gpind; k < j; ++k)
+                {
+                    S ztr = 0;
+                    for(rocblas_int i = 0; i < blksiz; ++i)
+                        ztr += x[i] * rreal<S>(Z[b1 + i + k * ldz]);
+                    for(rocblas_int i = 0; i < blksiz; ++i)
+                        x[i] -= ztr * rreal<S>(Z[b1 + i + k * ldz]);
+                }
+
+                // check the infinity norm of the iterate, continuing for two
+                // additional iterations after the stopping criterion is met
+                nrm = abs(x[stein_iamax(blksiz, x)]);
+                if(nrm >= dtpcrt)
+                {
+                    nrmchk++;
+                    if(nrmchk >= 3)
+                    {
+                        converged = true;
+                        break;
+                    }
+                }
+            }
+
+            if(!converged)
+                ifail[atomicAdd(infoA + bid, 1)] = j + 1;
+
+            // normalize with the largest component positive
+            nrm = 0;
+            for(rocblas_int i = 0; i < blksiz; ++i)
+                nrm += x[i] * x[i];
+            S scl = 1 / sqrt(nrm);
+            if(x[stein_iamax(blksiz, x)] < 0)
+                scl = -scl;
+            for(rocblas_int i = 0; i < blksiz; ++i)
+                x[i] *= scl;
+        }
+
+        // accept the iterate as the j-th eigenvector
+        for(rocblas_int i = 0; i < n; ++i)
+            Z[i + j * ldz] = 0;
+        for(rocblas_int i = 0; i < blksiz; ++i)
+            Z[b1 + i + j * ldz] = T(x[i]);
+    }
+    __syncthreads();
+
+    // sort the indices of the eigenvectors that failed to converge
+    if(tid == 0)
+        stein_sort_ifail(infoA[bid], ifail);
+}
+
+template <typename S>
+void rocsolver_stein_getMemorySize(const rocblas_int n,
+                                   const rocblas_int batch_count,
+                                   size_t* size_work,
+                                   size_t* size_iwork)
+{
+    // if quick return no workspace needed
+    if(n == 0 || !batch_count)
+    {
+        *size_work = 0;
+        *size_iwork = 0;
+        return;
+    }
+
+    // size of the workspace of every thread
+    *size_work = sizeof(S) * 5 * n * STEIN_BDIM * batch_count;
+    *size_iwork = sizeof(rocblas_int) * n * STEIN_BDIM * batch_count;
+}
+
+template <typename S, typename T>
+rocblas_status rocsolver_stein_argCheck(rocblas_handle handle,
+                                        const rocblas_int n,
+                                        S* D,
+                                        S* E,
+                                        rocblas_int* nev,
+                                        S* W,
+                                        rocblas_int* iblock,
+                                        rocblas_int* isplit,
+                                        T Z,
+                                        const rocblas_int ldz,
+                                        rocblas_int* ifail,
+                                        rocblas_int* info)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(n < 0 || ldz < n)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !D) || (n && !E) || !nev || (n && !W) || (n && !iblock) || (n && !isplit)
+       || (n && !Z) || (n && !ifail) || !info)
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename S, typename T, typename U>
+rocblas_status rocsolver_stein_template(rocblas_handle handle,
+                                        const rocblas_int n,
+                                        S* D,
+                                        const rocblas_int shiftD,
+                                        const rocblas_stride strideD,
+                                        S* E,
+                                        const rocblas_int shiftE,
+                                        const rocblas_stride strideE,
+                                        rocblas_int* nev,
+                                        S* W,
+                                        const rocblas_stride strideW,
+                                        rocblas_int* iblock,
+                                        const rocblas_stride strideIblock,
+                                        rocblas_int* isplit,
+                                        const rocblas_stride strideIsplit,
+                                        U Z,
+                                        const rocblas_int shiftZ,
+                                        const rocblas_int ldz,
+                                        const rocblas_stride strideZ,
+                                        rocblas_int* ifail,
+                                        const rocblas_stride strideF,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count,
+                                        S* work,
+                                        rocblas_int* iwork)
+{
+    ROCSOLVER_ENTER("stein", "n:", n, "shiftD:", shiftD, "shiftE:", shiftE, "shiftZ:", shiftZ,
+                    "ldz:", ldz, "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocksReset = (batch_count - 1) / BLOCKSIZE + 1;
+    dim3 gridReset(blocksReset, 1, 1);
+    dim3 threads(BLOCKSIZE, 1, 1);
+
+    // info = 0
+    hipLaunchKernelGGL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
+
+    // quick return
+    if(n == 0)
+        return rocblas_status_success;
+
+    S eps = get_epsilon<S>();
+    S sfmin = get_safemin<S>();
+
+    hipLaunchKernelGGL((stein_kernel<S, T>), dim3(1, batch_count), dim3(STEIN_BDIM), 0, stream, n,
+                       D + shiftD, strideD, E + shiftE, strideE, nev, W, strideW, iblock,
+                       strideIblock, isplit, strideIsplit, Z, shiftZ, ldz, strideZ, ifail, strideF,
+                       info, work, iwork, eps, sfmin);
+
+    return rocblas_status_success;
+}
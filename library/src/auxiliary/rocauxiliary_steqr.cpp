@@ -45,7 +45,7 @@ rocblas_status rocsolver_steqr_impl(rocblas_handle handle,
 
     // memory workspace allocation
     void* work_stack;
-    rocblas_device_malloc mem(handle, size_work_stack);
+    rocsolver_device_malloc mem(handle, size_work_stack);
     if(!mem)
         return rocblas_status_memory_error;
 
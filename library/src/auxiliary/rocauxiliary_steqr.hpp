@@ -15,279 +15,360 @@
 #include "rocsolver.h"
 
 /****************************************************************************
-(TODO:THIS IS BASIC IMPLEMENTATION. THE ONLY PARALLELISM INTRODUCED HERE IS
-  FOR THE BATCHED VERSIONS (A DIFFERENT THREAD WORKS ON EACH INSTANCE OF THE
-  BATCH).)
+(TODO:THIS IS BASIC IMPLEMENTATION. THE CONVERGENCE LOGIC IS SERIAL (ONE
+  THREAD PER INSTANCE OF THE BATCH); ONLY THE UPDATE OF THE EIGENVECTORS WITH
+  THE ROTATIONS OF EACH SWEEP IS DISTRIBUTED AMONG THE THREADS OF THE GROUP.)
 ***************************************************************************/
 
-/** STEQR_KERNEL implements the main loop of the sterf algorithm
-    to compute the eigenvalues of a symmetric tridiagonal matrix given by D
-    and E **/
-template <typename S, typename T, typename U>
-__global__ void steqr_kernel(const rocblas_int n,
-                             S* DD,
-                             const rocblas_stride strideD,
-                             S* EE,
-                             const rocblas_stride strideE,
-                             U CC,
-                             const rocblas_int shiftC,
-                             const rocblas_int ldc,
-                             const rocblas_stride strideC,
-                             rocblas_int* info,
-                             S* WW,
-                             const rocblas_int max_iters,
-                             const S eps,
-                             const S ssfmin,
-                             const S ssfmax)
-{
-    rocblas_int bid = hipBlockIdx_x;
-    rocblas_stride strideW = 2 * n - 2;
+/** RUN_STEQR implements the main loop of the steqr algorithm to compute the
+    eigenvalues and eigenvectors of the symmetric tridiagonal matrix given by D
+    and E. It returns the number of off-diagonal elements that did not converge
+    to zero.
 
-    S* D = DD + (bid * strideD);
-    S* E = EE + (bid * strideE);
-    T* C = load_ptr_batch<T>(CC, bid, shiftC, strideC);
-    S* work = WW + (bid * strideW);
+    The QL/QR iterations are executed by thread 0 of the group; the rotations of
+    each sweep are saved in work and then applied to C by all the nthreads
+    threads of the group (every thread of the group must call this function). **/
+template <typename S, typename T>
+__device__ rocblas_int run_steqr(const rocblas_int tid,
+                                 const rocblas_int nthreads,
+                                 const rocblas_int n,
+                                 S* D,
+                                 S* E,
+                                 T* C,
+                                 const rocblas_int ldc,
+                                 S* work,
+                                 const rocblas_int max_iters,
+                                 const S eps,
+                                 const S ssfmin,
+                                 const S ssfmax,
+                                 rocsolver_convergence_stats* stats = nullptr)
+{
+    // sequence of rotations to apply to the eigenvectors
+    // (first column, number of columns and direction)
+    __shared__ rocblas_int rcol, rcount, rdir;
 
     rocblas_int m, l, lsv, lend, lendsv;
     rocblas_int l1 = 0;
     rocblas_int iters = 0;
+    rocblas_int deflations = 0;
+    bool active = false, ql = true;
     S anorm, p;
 
-    while(l1 < n && iters < max_iters)
+    while(true)
     {
-        // Determine submatrix indices
-        if(l1 > 0)
-            E[l1 - 1] = 0;
-        for(m = l1; m < n - 1; m++)
-        {
-            if(abs(E[m]) <= sqrt(abs(D[m])) * sqrt(abs(D[m + 1])) * eps)
-            {
-                E[m] = 0;
-                break;
-            }
-        }
-
-        lsv = l = l1;
-        lendsv = lend = m;
-        l1 = m + 1;
-        if(lend == l)
-            continue;
-
-        // Scale submatrix
-        anorm = find_max_tridiag(l, lend, D, E);
-        if(anorm == 0)
-            continue;
-        else if(anorm > ssfmax)
-            scale_tridiag(l, lend, D, E, anorm / ssfmax);
-        else if(anorm < ssfmin)
-            scale_tridiag(l, lend, D, E, anorm / ssfmin);
-
-        // Choose iteration type (QL or QR)
-        if(abs(D[lend]) < abs(D[l]))
+        if(tid == 0)
         {
-            lend = lsv;
-            l = lendsv;
-        }
-
-        if(lend >= l)
-        {
-            // QL iteration
-            while(l <= lend && iters < max_iters)
+            // run the iterations until the next sequence of rotations is
+            // ready or the algorithm ends
+            rcount = 0;
+            while(rcount == 0)
             {
-                // Find small subdiagonal element
-                for(m = l; m <= lend - 1; m++)
-                    if(abs(E[m] * E[m]) <= eps * eps * abs(D[m] * D[m + 1]))
-                        break;
-
-                if(m < lend)
-                    E[m] = 0;
-                p = D[l];
-                if(m == l)
-                {
-                    D[l] = p;
-                    l++;
-                }
-                else if(m == l + 1)
+                if(!active)
                 {
-                    // Use laev2 to compute 2x2 eigenvalues and eigenvectors
-                    S rt1, rt2, c, s;
-                    laev2(D[l], E[l], D[l + 1], rt1, rt2, c, s);
-                    work[l] = c;
-                    work[n - 1 + l] = s;
-                    lasr(rocblas_side_right, rocblas_backward_direction, n, 2, work + l,
-                         work + n - 1 + l, C + 0 + l * ldc, ldc);
-
-                    D[l] = rt1;
-                    D[l + 1] = rt2;
-                    E[l] = 0;
-                    l = l + 2;
-                }
-                else
-                {
-                    if(iters == max_iters)
+                    if(l1 >= n || iters >= max_iters)
                         break;
-                    iters++;
-
-                    S f, g, c, s, b, r;
-
-                    // Form shift
-                    g = (D[l + 1] - p) / (2 * E[l]);
-                    if(g >= 0)
-                        r = abs(sqrt(1 + g * g));
-                    else
-                        r = -abs(sqrt(1 + g * g));
-                    g = D[m] - p + (E[l] / (g + r));
 
-                    c = 1;
-                    s = 1;
-                    p = 0;
-
-                    for(int i = m - 1; i >= l; i--)
+                    // Determine submatrix indices
+                    if(l1 > 0)
+                        E[l1 - 1] = 0;
+                    for(m = l1; m < n - 1; m++)
                     {
-                        f = s * E[i];
-                        b = c * E[i];
-                        lartg(g, f, c, s, r);
-                        s = -s; //get the transpose of the rotation
-                        if(i != m - 1)
-                            E[i + 1] = r;
-
-                        g = D[i + 1] - p;
-                        r = (D[i] - g) * s + 2 * c * b;
-                        p = s * r;
-                        D[i + 1] = g + p;
-                        g = c * r - b;
-
-                        // Save rotations
-                        work[i] = c;
-                        work[n - 1 + i] = -s;
+                        if(abs(E[m]) <= sqrt(abs(D[m])) * sqrt(abs(D[m + 1])) * eps)
+                        {
+                            deflations += (E[m] != 0);
+                            E[m] = 0;
+                            break;
+                        }
                     }
 
-                    // Apply saved rotations
-                    lasr(rocblas_side_right, rocblas_backward_direction, n, m - l + 1, work + l,
-                         work + n - 1 + l, C + 0 + l * ldc, ldc);
-
-                    D[l] -= p;
-                    E[l] = g;
+                    lsv = l = l1;
+                    lendsv = lend = m;
+                    l1 = m + 1;
+                    if(lend == l)
+                        continue;
+
+                    // Scale submatrix
+                    anorm = find_max_tridiag(l, lend, D, E);
+                    if(anorm == 0)
+                        continue;
+                    else if(anorm > ssfmax)
+                        scale_tridiag(l, lend, D, E, anorm / ssfmax);
+                    else if(anorm < ssfmin)
+                        scale_tridiag(l, lend, D, E, anorm / ssfmin);
+
+                    // Choose iteration type (QL or QR)
+                    if(abs(D[lend]) < abs(D[l]))
+                    {
+                        lend = lsv;
+                        l = lendsv;
+                    }
+                    ql = (lend >= l);
+                    active = true;
                 }
-            }
-        }
-
-        else
-        {
-            // QR iteration
-            while(l >= lend && iters < max_iters)
-            {
-                // Find small subdiagonal element
-                for(m = l; m >= lend + 1; m--)
-                    if(abs(E[m - 1] * E[m - 1]) <= eps * eps * abs(D[m] * D[m - 1]))
-                        break;
 
-                if(m > lend)
-                    E[m - 1] = 0;
-                p = D[l];
-                if(m == l)
+                if((ql && l > lend) || (!ql && l < lend) || iters >= max_iters)
                 {
-                    D[l] = p;
-                    l--;
+                    // Undo scaling
+                    if(anorm > ssfmax)
+                        scale_tridiag(lsv, lendsv, D, E, ssfmax / anorm);
+                    if(anorm < ssfmin)
+                        scale_tridiag(lsv, lendsv, D, E, ssfmin / anorm);
+
+                    active = false;
+                    continue;
                 }
-                else if(m == l - 1)
+
+                if(ql)
                 {
-                    // Use laev2 to compute 2x2 eigenvalues and eigenvectors
-                    S rt1, rt2, c, s;
-                    laev2(D[l - 1], E[l - 1], D[l], rt1, rt2, c, s);
-                    work[m] = c;
-                    work[n - 1 + m] = s;
-                    lasr(rocblas_side_right, rocblas_forward_direction, n, 2, work + m,
-                         work + n - 1 + m, C + 0 + (l - 1) * ldc, ldc);
-
-                    D[l - 1] = rt1;
-                    D[l] = rt2;
-                    E[l - 1] = 0;
-                    l = l - 2;
+                    // QL iteration
+                    // Find small subdiagonal element
+                    for(m = l; m <= lend - 1; m++)
+                        if(abs(E[m] * E[m]) <= eps * eps * abs(D[m] * D[m + 1]))
+                            break;
+
+                    if(m < lend)
+                    {
+                        deflations += (E[m] != 0);
+                        E[m] = 0;
+                    }
+                    p = D[l];
+                    if(m == l)
+                    {
+                        D[l] = p;
+                        l++;
+                    }
+                    else if(m == l + 1)
+                    {
+                        // Use laev2 to compute 2x2 eigenvalues and eigenvectors
+                        S rt1, rt2, c, s;
+                        laev2(D[l], E[l], D[l + 1], rt1, rt2, c, s);
+                        work[l] = c;
+                        work[n - 1 + l] = s;
+                        rcol = l;
+                        rcount = 2;
+                        rdir = rocblas_backward_direction;
+
+                        D[l] = rt1;
+                        D[l + 1] = rt2;
+                        E[l] = 0;
+                        l = l + 2;
+                    }
+                    else
+                    {
+                        iters++;
+
+                        S f, g, c, s, b, r;
+
+                        // Form shift
+                        g = (D[l + 1] - p) / (2 * E[l]);
+                        if(g >= 0)
+                            r = abs(sqrt(1 + g * g));
+                        else
+                            r = -abs(sqrt(1 + g * g));
+                        g = D[m] - p + (E[l] / (g + r));
+
+                        c = 1;
+                        s = 1;
+                        p = 0;
+
+                        for(int i = m - 1; i >= l; i--)
+                        {
+                            f = s * E[i];
+                            b = c * E[i];
+                            lartg(g, f, c, s, r);
+                            s = -s; //get the transpose of the rotation
+                            if(i != m - 1)
+                                E[i + 1] = r;
+
+                            g = D[i + 1] - p;
+                            r = (D[i] - g) * s + 2 * c * b;
+                            p = s * r;
+                            D[i + 1] = g + p;
+                            g = c * r - b;
+
+                            // Save rotations
+                            work[i] = c;
+                            work[n - 1 + i] = -s;
+                        }
+                        rcol = l;
+                        rcount = m - l + 1;
+                        rdir = rocblas_backward_direction;
+
+                        D[l] -= p;
+                        E[l] = g;
+                    }
                 }
+
                 else
                 {
-                    if(iters == max_iters)
-                        break;
-                    iters++;
-
-                    S f, g, c, s, b, r;
+                    // QR iteration
+                    // Find small subdiagonal element
+                    for(m = l; m >= lend + 1; m--)
+                        if(abs(E[m - 1] * E[m - 1]) <= eps * eps * abs(D[m] * D[m - 1]))
+                            break;
 
-                    // Form shift
-                    g = (D[l - 1] - p) / (2 * E[l - 1]);
-                    if(g >= 0)
-                        r = abs(sqrt(1 + g * g));
+                    if(m > lend)
+                    {
+                        deflations += (E[m - 1] != 0);
+                        E[m - 1] = 0;
+                    }
+                    p = D[l];
+                    if(m == l)
+                    {
+                        D[l] = p;
+                        l--;
+                    }
+                    else if(m == l - 1)
+                    {
+                        // Use laev2 to compute 2x2 eigenvalues and eigenvectors
+                        S rt1, rt2, c, s;
+                        laev2(D[l - 1], E[l - 1], D[l], rt1, rt2, c, s);
+                        work[m] = c;
+                        work[n - 1 + m] = s;
+                        rcol = m;
+                        rcount = 2;
+                        rdir = rocblas_forward_direction;
+
+                        D[l - 1] = rt1;
+                        D[l] = rt2;
+                        E[l - 1] = 0;
+                        l = l - 2;
+                    }
                     else
-                        r = -abs(sqrt(1 + g * g));
-                    g = D[m] - p + (E[l - 1] / (g + r));
-
-                    c = 1;
-                    s = 1;
-                    p = 0;
-
-                    for(int i = m; i <= l - 1; i++)
                     {
-                        f = s * E[i];
-                        b = c * E[i];
-                        lartg(g, f, c, s, r);
-                        s = -s; //get the transpose of the rotation
-                        if(i != m)
-                            E[i - 1] = r;
-
-                        g = D[i] - p;
-                        r = (D[i + 1] - g) * s + 2 * c * b;
-                        p = s * r;
-                        D[i] = g + p;
-                        g = c * r - b;
-
-                        // Save rotations
-                        work[i] = c;
-                        work[n - 1 + i] = s;
+                        iters++;
+
+                        S f, g, c, s, b, r;
+
+                        // Form shift
+                        g = (D[l - 1] - p) / (2 * E[l - 1]);
+                        if(g >= 0)
+                            r = abs(sqrt(1 + g * g));
+                        else
+                            r = -abs(sqrt(1 + g * g));
+                        g = D[m] - p + (E[l - 1] / (g + r));
+
+                        c = 1;
+                        s = 1;
+                        p = 0;
+
+                        for(int i = m; i <= l - 1; i++)
+                        {
+                            f = s * E[i];
+                            b = c * E[i];
+                            lartg(g, f, c, s, r);
+                            s = -s; //get the transpose of the rotation
+                            if(i != m)
+                                E[i - 1] = r;
+
+                            g = D[i] - p;
+                            r = (D[i + 1] - g) * s + 2 * c * b;
+                            p = s * r;
+                            D[i] = g + p;
+                            g = c * r - b;
+
+                            // Save rotations
+                            work[i] = c;
+                            work[n - 1 + i] = s;
+                        }
+                        rcol = m;
+                        rcount = l - m + 1;
+                        rdir = rocblas_forward_direction;
+
+                        D[l] -= p;
+                        E[l - 1] = g;
                     }
-
-                    // Apply saved rotations
-                    lasr(rocblas_side_right, rocblas_forward_direction, n, l - m + 1, work + m,
-                         work + n - 1 + m, C + 0 + m * ldc, ldc);
-
-                    D[l] -= p;
-                    E[l - 1] = g;
                 }
             }
         }
+        __syncthreads();
+
+        if(rcount == 0)
+            break;
 
-        // Undo scaling
-        if(anorm > ssfmax)
-            scale_tridiag(lsv, lendsv, D, E, ssfmax / anorm);
-        if(anorm < ssfmin)
-            scale_tridiag(lsv, lendsv, D, E, ssfmin / anorm);
+        // Apply saved rotations
+        lasr(rocblas_side_right, rocblas_direct(rdir), n, rcount, work + rcol,
+             work + n - 1 + rcol, C + 0 + rcol * ldc, ldc, tid, nthreads);
+        __syncthreads();
     }
 
     // Check for convergence
+    rocblas_int nconv = 0;
     for(int i = 0; i < n - 1; i++)
         if(E[i] != 0)
-            info[bid]++;
+            nconv++;
+
+    if(tid == 0)
+        convergence_record(stats, 1, 0, iters, deflations, iters, max_iters, nconv == 0);
 
     // Sort eigenvalues and eigenvectors by selection sort
     for(int ii = 1; ii < n; ii++)
     {
-        l = ii - 1;
-        m = l;
-        p = D[l];
-        for(int j = ii; j < n; j++)
+        if(tid == 0)
         {
-            if(D[j] < p)
+            l = ii - 1;
+            m = l;
+            p = D[l];
+            for(int j = ii; j < n; j++)
             {
-                m = j;
-                p = D[j];
+                if(D[j] < p)
+                {
+                    m = j;
+                    p = D[j];
+                }
             }
+            if(m != l)
+            {
+                D[m] = D[l];
+                D[l] = p;
+            }
+            rcol = l;
+            rcount = m;
         }
-        if(m != l)
-        {
-            D[m] = D[l];
-            D[l] = p;
-            swapvect(n, C + 0 + l * ldc, 1, C + 0 + m * ldc, 1);
-        }
+        __syncthreads();
+
+        if(rcount != rcol)
+            swapvect(n, C + 0 + rcol * ldc, 1, C + 0 + rcount * ldc, 1, tid, nthreads);
+        __syncthreads();
     }
+
+    return nconv;
+}
+
+/** STEQR_KERNEL computes the eigenvalues and eigenvectors of a symmetric
+    tridiagonal matrix given by D and E (one group of threads per matrix) **/
+template <typename S, typename T, typename U>
+__global__ void __launch_bounds__(STEQR_BDIM) steqr_kernel(const rocblas_int n,
+                                                           S* DD,
+                                                           const rocblas_stride strideD,
+                                                           S* EE,
+                                                           const rocblas_stride strideE,
+                                                           U CC,
+                                                           const rocblas_int shiftC,
+                                                           const rocblas_int ldc,
+                                                           const rocblas_stride strideC,
+                                                           rocblas_int* info,
+                                                           S* WW,
+                                                           const rocblas_int max_iters,
+                                                           const S eps,
+                                                           const S ssfmin,
+                                                           const S ssfmax,
+                                                           rocsolver_convergence_stats* stats,
+                                                           const rocblas_int nstats)
+{
+    rocblas_int bid = hipBlockIdx_x;
+    rocblas_int tid = hipThreadIdx_x;
+    rocblas_stride strideW = 2 * n - 2;
+
+    S* D = DD + (bid * strideD);
+    S* E = EE + (bid * strideE);
+    T* C = load_ptr_batch<T>(CC, bid, shiftC, strideC);
+    S* work = WW + (bid * strideW);
+
+    rocblas_int nconv = run_steqr(tid, hipBlockDim_x, n, D, E, C, ldc, work, max_iters, eps, ssfmin,
+                                  ssfmax, (stats && bid < nstats) ? stats + bid : nullptr);
+    if(tid == 0)
+        info[bid] = nconv;
 }
 
 template <typename S, typename T>
@@ -400,14 +481,22 @@ rocblas_status rocsolver_steqr_template(rocblas_handle handle,
     ssfmin = sqrt(ssfmin) / (eps * eps);
     ssfmax = sqrt(ssfmax) / S(3.0);
 
+    // convergence statistics, if requested
+    rocblas_int nstats;
+    rocsolver_convergence_stats* stats = rocsolver_convergence::get(handle, &nstats);
+    nstats = std::min(nstats, batch_count);
+
     if(evect == rocblas_evect_none)
         hipLaunchKernelGGL(sterf_kernel<S>, dim3(batch_count), dim3(1), 0, stream, n, D + shiftD,
                            strideD, E + shiftE, strideE, info, (rocblas_int*)work_stack, 30 * n,
-                           eps, ssfmin, ssfmax);
+                           eps, ssfmin, ssfmax, stats, nstats);
     else
-        hipLaunchKernelGGL((steqr_kernel<S, T>), dim3(batch_count), dim3(1), 0, stream, n,
-                           D + shiftD, strideD, E + shiftE, strideE, C, shiftC, ldc, strideC, info,
-                           (S*)work_stack, 30 * n, eps, ssfmin, ssfmax);
+        hipLaunchKernelGGL((steqr_kernel<S, T>), dim3(batch_count), dim3(STEQR_BDIM), 0, stream,
+                           n, D + shiftD, strideD, E + shiftE, strideE, C, shiftC, ldc, strideC,
+                           info, (S*)work_stack, 30 * n, eps, ssfmin, ssfmax, stats, nstats);
+
+    if(stats && rocsolver_logger::is_logging_enabled())
+        rocsolver_logger::instance()->log_convergence(handle, "steqr", stats, nstats);
 
     return rocblas_status_success;
 }
@@ -37,7 +37,7 @@ rocblas_status
 
     // memory workspace allocation
     void* stack;
-    rocblas_device_malloc mem(handle, size_stack);
+    rocsolver_device_malloc mem(handle, size_stack);
     if(!mem)
         return rocblas_status_memory_error;
 
@@ -29,7 +29,8 @@ __device__ void sterf_sq_e(const rocblas_int start, const rocblas_int end, T* E)
 
 /** STERF_KERNEL implements the main loop of the sterf algorithm
     to compute the eigenvalues of a symmetric tridiagonal matrix given by D
-    and E **/
+    and E. If stats is not null, the convergence statistics of each instance
+    of the batch are written to it **/
 template <typename T>
 __global__ void sterf_kernel(const rocblas_int n,
                              T* DD,
@@ -41,7 +42,9 @@ __global__ void sterf_kernel(const rocblas_int n,
                              const rocblas_int max_iters,
                              const T eps,
                              const T ssfmin,
-                             const T ssfmax)
+                             const T ssfmax,
+                             rocsolver_convergence_stats* stats,
+                             const rocblas_int nstats)
 {
     rocblas_int bid = hipBlockIdx_x;
 
@@ -51,6 +54,7 @@ __global__ void sterf_kernel(const rocblas_int n,
     rocblas_int m, l, lsv, lend, lendsv;
     rocblas_int l1 = 0;
     rocblas_int iters = 0;
+    rocblas_int deflations = 0;
     T anorm, p;
 
     while(l1 < n && iters < max_iters)
@@ -62,6 +66,7 @@ __global__ void sterf_kernel(const rocblas_int n,
         {
             if(abs(E[m]) <= sqrt(abs(D[m])) * sqrt(abs(D[m + 1])) * eps)
             {
+                deflations += (E[m] != 0);
                 E[m] = 0;
                 break;
             }
@@ -101,7 +106,10 @@ __global__ void sterf_kernel(const rocblas_int n,
                         break;
 
                 if(m < lend)
+                {
+                    deflations += (E[m] != 0);
                     E[m] = 0;
+                }
                 p = D[l];
                 if(m == l)
                 {
@@ -177,7 +185,10 @@ __global__ void sterf_kernel(const rocblas_int n,
                         break;
 
                 if(m > lend)
+                {
+                    deflations += (E[m - 1] != 0);
                     E[m - 1] = 0;
+                }
                 p = D[l];
                 if(m == l)
                 {
@@ -254,6 +265,8 @@ __global__ void sterf_kernel(const rocblas_int n,
         if(E[i] != 0)
             info[bid]++;
 
+    convergence_record(stats, nstats, bid, iters, deflations, iters, max_iters, info[bid] == 0);
+
     // Sort eigenvalues
     /** (TODO: the quick-sort method implemented in lasrt_increasing fails for some cases.
         Substituting it here with a simple sorting algorithm. If more performance is required in
@@ -360,8 +373,17 @@ rocblas_status rocsolver_sterf_template(rocblas_handle handle,
     ssfmin = sqrt(ssfmin) / (eps * eps);
     ssfmax = sqrt(ssfmax) / T(3.0);
 
+    // convergence statistics, if requested
+    rocblas_int nstats;
+    rocsolver_convergence_stats* stats = rocsolver_convergence::get(handle, &nstats);
+    nstats = std::min(nstats, batch_count);
+
     hipLaunchKernelGGL(sterf_kernel<T>, dim3(batch_count), dim3(1), 0, stream, n, D + shiftD,
-                       strideD, E + shiftE, strideE, info, stack, 30 * n, eps, ssfmin, ssfmax);
+                       strideD, E + shiftE, strideE, info, stack, 30 * n, eps, ssfmin, ssfmax,
+                       stats, nstats);
+
+    if(stats && rocsolver_logger::is_logging_enabled())
+        rocsolver_logger::instance()->log_convergence(handle, "sterf", stats, nstats);
 
     return rocblas_status_success;
 }
@@ -0,0 +1,90 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "rocsolver_convergence.hpp"
+#include "rocblascommon/utility.hpp"
+
+// initialize the static variables
+std::mutex rocsolver_convergence::_mutex;
+std::unordered_map<rocblas_handle, rocsolver_convergence::buffer> rocsolver_convergence::_buffers;
+std::atomic<size_t> rocsolver_convergence::_active{0};
+
+/***************************************************************************
+ * Buffer lookup
+ ***************************************************************************/
+
+rocsolver_convergence_stats* rocsolver_convergence::get(rocblas_handle handle, rocblas_int* size)
+{
+    *size = 0;
+
+    // quick return if no handle has a buffer
+    if(_active == 0)
+        return nullptr;
+
+    int device;
+    if(hipGetDevice(&device) != hipSuccess)
+        return nullptr;
+
+    const std::lock_guard<std::mutex> lock(_mutex);
+
+    auto it = _buffers.find(handle);
+    if(it == _buffers.end())
+        return nullptr;
+
+    // a buffer of another device was left by a destroyed handle with the same address
+    if(device != it->second.device)
+    {
+        _buffers.erase(it);
+        _active--;
+        return nullptr;
+    }
+
+    *size = it->second.size;
+    return it->second.stats;
+}
+
+/***************************************************************************
+ * Convergence statistics functions
+ ***************************************************************************/
+
+extern "C" {
+
+rocblas_status rocsolver_convergence_stats_set(rocblas_handle handle,
+                                               rocsolver_convergence_stats* stats,
+                                               const rocblas_int size)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(size < 0)
+        return rocblas_status_invalid_size;
+    if(size && !stats)
+        return rocblas_status_invalid_pointer;
+
+    int device;
+    if(hipGetDevice(&device) != hipSuccess)
+        return rocblas_status_internal_error;
+
+    const std::lock_guard<std::mutex> lock(rocsolver_convergence::_mutex);
+
+    auto it = rocsolver_convergence::_buffers.find(handle);
+    if(stats && size)
+    {
+        if(it == rocsolver_convergence::_buffers.end())
+            rocsolver_convergence::_active++;
+        rocsolver_convergence::_buffers[handle] = {stats, size, device};
+    }
+    else if(it != rocsolver_convergence::_buffers.end())
+    {
+        rocsolver_convergence::_buffers.erase(it);
+        rocsolver_convergence::_active--;
+    }
+
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+}
@@ -4,10 +4,12 @@
 
 #include "rocsolver_logger.hpp"
 #include "rocblascommon/utility.hpp"
+#include <algorithm>
 #include <cerrno>
 #include <climits>
 #include <cstdlib>
 #include <sys/time.h>
+#include <unistd.h>
 
 #define STRINGIFY(s) STRINGIFY_HELPER(s)
 #define STRINGIFY_HELPER(s) #s
@@ -15,13 +17,14 @@
 // initialize the static variable
 rocsolver_logger* rocsolver_logger::_instance = nullptr;
 std::mutex rocsolver_logger::_mutex;
+uint64_t rocsolver_logger::_sessions = 0;
 
 /***************************************************************************
  * Open logging streams
  ***************************************************************************/
 
 std::unique_ptr<rocsolver_ostream>
-    rocsolver_logger::open_log_stream(const char* environment_variable_name)
+    rocsolver_logger::open_log_stream(const char* environment_variable_name, bool async)
 {
     const char* logfile;
     if((logfile = std::getenv(environment_variable_name)) != nullptr
@@ -42,55 +45,459 @@ std::unique_ptr<rocsolver_ostream>
             *os << std::endl;
         }
 
+        os->set_async(async);
         return os;
     }
     else
-        return std::make_unique<rocsolver_ostream>(STDERR_FILENO);
+    {
+        auto os = std::make_unique<rocsolver_ostream>(STDERR_FILENO);
+        os->set_async(async);
+        return os;
+    }
+}
+
+void rocsolver_logger::close_log_streams()
+{
+    // the streams that share a file share its counters, so they are reported once
+    rocsolver_ostream* streams[] = {trace_os.get(), bench_os.get(), profile_os.get()};
+    for(int i = 0; i < 3; i++)
+    {
+        bool reported = false;
+        for(int j = 0; j < i; j++)
+            reported = reported || streams[i]->same_file(*streams[j]);
+        if(reported)
+            continue;
+
+        std::pair<uint64_t, uint64_t> dropped = streams[i]->take_dropped();
+        if(dropped.first > 0)
+        {
+            *streams[i] << "------- " << dropped.first << " log messages (" << dropped.second
+                        << " bytes) were dropped because the log buffer was full -------"
+                        << std::endl;
+        }
+        streams[i]->sync();
+    }
 }
 
 /***************************************************************************
- * Call stack manipulation
+ * Thread data and call stack manipulation
  ***************************************************************************/
 
-rocsolver_log_entry& rocsolver_logger::push_log_entry(rocblas_handle handle, std::string&& name)
+rocsolver_log_thread& rocsolver_logger::thread_data()
 {
-    std::vector<rocsolver_log_entry>& stack = call_stack[handle];
-    stack.push_back(rocsolver_log_entry());
+    // the data of a thread is shared with the logger, so that it outlives the thread
+    thread_local std::shared_ptr<rocsolver_log_thread> data;
+    if(!data || data->session != session)
+    {
+        data = std::make_shared<rocsolver_log_thread>(session);
 
-    rocsolver_log_entry& result = stack.back();
-    result.name = std::move(name);
-    result.level = stack.size() - 1;
-    result.start_time = get_time_us_no_sync();
+        const std::lock_guard<std::mutex> lock(rocsolver_logger::_mutex);
+        data->trace_os = std::make_unique<rocsolver_ostream>(trace_os->dup());
+        data->bench_os = std::make_unique<rocsolver_ostream>(bench_os->dup());
+        threads.push_back(data);
+    }
 
-    for(int i = 1; i < stack.size() - 1; i++)
-        result.callers.push_back(stack[i].name);
+    return *data;
+}
 
+const std::string* rocsolver_logger::intern_name(rocsolver_log_thread& data,
+                                                 const char* func_prefix,
+                                                 const char* func_name,
+                                                 char precision)
+{
+    rocsolver_log_name_key key{func_prefix, func_name, precision};
+    auto it = data.names.find(key);
+    if(it != data.names.end())
+        return it->second;
+
+    std::string name = precision ? get_func_name(func_prefix, precision, func_name)
+                                 : get_template_name(func_prefix, func_name);
+
+    const std::lock_guard<std::mutex> lock(rocsolver_logger::_mutex);
+    const std::string* result = &*names.insert(std::move(name)).first;
+    data.names.emplace(key, result);
     return result;
 }
 
-rocsolver_log_entry& rocsolver_logger::peek_log_entry(rocblas_handle handle)
+rocsolver_log_entry& rocsolver_logger::push_log_entry(rocsolver_log_thread& data,
+                                                      rocblas_handle handle,
+                                                      const std::string* name)
 {
-    std::vector<rocsolver_log_entry>& stack = call_stack[handle];
+    data.depth++;
+    std::vector<rocsolver_log_entry>& stack = data.call_stack[handle];
+    stack.emplace_back();
+
     rocsolver_log_entry& result = stack.back();
+    result.name = name;
+    result.level = stack.size() - 1;
+    result.start_event = nullptr;
+
     return result;
 }
 
-rocsolver_log_entry rocsolver_logger::pop_log_entry(rocblas_handle handle)
+rocsolver_log_entry rocsolver_logger::pop_log_entry(rocsolver_log_thread& data,
+                                                    rocblas_handle handle)
 {
-    std::vector<rocsolver_log_entry>& stack = call_stack[handle];
+    // the empty stacks are kept, so that later calls do not allocate them again
+    std::vector<rocsolver_log_entry>& stack = data.call_stack[handle];
     rocsolver_log_entry result = stack.back();
     stack.pop_back();
 
-    if(stack.empty())
-        call_stack.erase(handle);
-
     return result;
 }
 
 /***************************************************************************
- * Profile log printing
+ * Convergence statistics logging
+ ***************************************************************************/
+
+void rocsolver_logger::log_convergence(rocblas_handle handle,
+                                       const char* func_name,
+                                       const rocsolver_convergence_stats* stats,
+                                       rocblas_int count)
+{
+    rocsolver_log_thread& data = thread_data();
+    std::vector<rocsolver_log_entry>& stack = data.call_stack[handle];
+    int level = stack.empty() ? 0 : stack.back().level;
+    if(!(layer_mode & rocblas_layer_mode_log_trace) || level > max_levels || count <= 0)
+        return;
+
+    // the statistics are written by the kernels, so the stream is synchronized
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+    std::vector<rocsolver_convergence_stats> hstats(count);
+    if(hipMemcpyAsync(hstats.data(), stats, sizeof(rocsolver_convergence_stats) * count,
+                      hipMemcpyDeviceToHost, stream)
+           != hipSuccess
+       || hipStreamSynchronize(stream) != hipSuccess)
+        return;
+
+    double sweeps = 0, deflations = 0;
+    rocblas_int max_sweeps = 0, max_deflations = 0, hit_limit = 0;
+    std::string limited;
+    for(rocblas_int b = 0; b < count; b++)
+    {
+        sweeps += hstats[b].sweeps;
+        deflations += hstats[b].deflations;
+        max_sweeps = std::max(max_sweeps, hstats[b].sweeps);
+        max_deflations = std::max(max_deflations, hstats[b].deflations);
+        if(hstats[b].hit_limit)
+        {
+            // list the first instances that did not converge
+            if(hit_limit < 8)
+                limited += (hit_limit ? ", " : "") + std::to_string(b);
+            else if(hit_limit == 8)
+                limited += ", ...";
+            hit_limit++;
+        }
+    }
+
+    rocsolver_ostream& os = *data.trace_os;
+    for(int i = 0; i < level; i++)
+        os << "    ";
+    os << "convergence of " << func_name << ": instances " << count
+       << ", sweeps mean " << (sweeps / count) << " max " << max_sweeps << ", deflations mean "
+       << (deflations / count) << " max " << max_deflations << ", iteration limit reached "
+       << hit_limit;
+    if(hit_limit)
+        os << " (instances " << limited << ')';
+    os << '\n';
+}
+
+/***************************************************************************
+ * Timeline log writing
+ ***************************************************************************/
+
+bool rocsolver_logger::init_timeline_origin(int device)
+{
+    const std::lock_guard<std::mutex> lock(timeline_mutex);
+    if(timeline_origins.count(device))
+        return true;
+
+    // the origin is recorded on the null stream and waited for once per device, so that its
+    // host time is known
+    hipEvent_t origin;
+    if(hipEventCreate(&origin) != hipSuccess)
+        return false;
+    if(hipEventRecord(origin, 0) != hipSuccess || hipEventSynchronize(origin) != hipSuccess)
+    {
+        (void)hipEventDestroy(origin);
+        return false;
+    }
+
+    timeline_origins[device] = std::make_pair(origin, get_time_us_no_sync());
+    return true;
+}
+
+void rocsolver_logger::add_timeline_event(rocsolver_log_thread& data,
+                                          rocblas_handle handle,
+                                          std::string head,
+                                          std::string tail)
+{
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocsolver_timeline_pending pending{nullptr, 0, get_time_us_no_sync(), handle, std::move(head),
+                                       std::move(tail)};
+    bool has_origin = hipGetDevice(&pending.device) == hipSuccess
+        && init_timeline_origin(pending.device);
+
+    const std::lock_guard<std::mutex> lock(data.profile_mutex);
+    if(has_origin)
+        pending.event = record_profile_event(data, stream);
+    data.timeline_pending.push_back(std::move(pending));
+}
+
+void rocsolver_logger::resolve_timeline_events(
+    rocsolver_log_thread& data,
+    bool wait,
+    std::vector<std::pair<rocblas_handle, std::string>>& done)
+{
+    while(!data.timeline_pending.empty())
+    {
+        rocsolver_timeline_pending& pending = data.timeline_pending.front();
+        double time = pending.host_time;
+        if(pending.event)
+        {
+            if(wait)
+                (void)hipEventSynchronize(pending.event);
+            else if(hipEventQuery(pending.event) == hipErrorNotReady)
+                break;
+
+            float ms;
+            const std::lock_guard<std::mutex> lock(timeline_mutex);
+            auto origin = timeline_origins.find(pending.device);
+            if(origin != timeline_origins.end()
+               && hipEventElapsedTime(&ms, origin->second.first, pending.event) == hipSuccess)
+                time = origin->second.second + ms * 1000.0;
+
+            data.events[pending.device].push_back(pending.event);
+        }
+
+        std::ostringstream event;
+        event << std::fixed << std::setprecision(3);
+        event << pending.head << (time - timeline_origin) << pending.tail;
+        done.emplace_back(pending.handle, event.str());
+        data.timeline_pending.pop_front();
+    }
+}
+
+void rocsolver_logger::write_timeline_events(rocsolver_log_thread& data)
+{
+    std::vector<std::pair<rocblas_handle, std::string>> done;
+    {
+        const std::lock_guard<std::mutex> lock(data.profile_mutex);
+        resolve_timeline_events(data, data.timeline_pending.size() > max_pending_events, done);
+    }
+
+    if(done.empty())
+        return;
+
+    const std::lock_guard<std::mutex> lock(rocsolver_logger::_mutex);
+    for(const auto& event : done)
+        write_timeline_event(event.first, event.second);
+    timeline_os->flush();
+}
+
+void rocsolver_logger::write_timeline_event(rocblas_handle handle, const std::string& event)
+{
+    // the timeline is a JSON array of events in Chrome trace format
+    if(!timeline_os)
+    {
+        const char* logfile = std::getenv("ROCSOLVER_LOG_TIMELINE_PATH");
+        timeline_os = std::make_unique<rocsolver_ostream>(logfile ? logfile
+                                                                  : "rocsolver_timeline.json");
+        *timeline_os << "[\n{\"name\": \"process_name\", \"ph\": \"M\", \"pid\": " << getpid()
+                     << ", \"args\": {\"name\": \"rocSOLVER " << STRINGIFY(ROCSOLVER_VERSION_MAJOR)
+                     << '.' << STRINGIFY(ROCSOLVER_VERSION_MINOR) << '.'
+                     << STRINGIFY(ROCSOLVER_VERSION_PATCH) << "\"}}";
+    }
+
+    // every handle is shown as a separate thread
+    auto it = timeline_tids.find(handle);
+    if(it == timeline_tids.end())
+    {
+        it = timeline_tids.emplace(handle, int(timeline_tids.size())).first;
+        *timeline_os << ",\n{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": " << getpid()
+                     << ", \"tid\": " << it->second << ", \"args\": {\"name\": \"handle "
+                     << (void*)handle << "\"}}";
+    }
+
+    *timeline_os << ",\n" << event << ", \"pid\": " << getpid() << ", \"tid\": " << it->second
+                 << '}';
+}
+
+void rocsolver_logger::close_timeline()
+{
+    for(auto& data : threads)
+    {
+        std::vector<std::pair<rocblas_handle, std::string>> done;
+        {
+            const std::lock_guard<std::mutex> lock(data->profile_mutex);
+            resolve_timeline_events(*data, true, done);
+        }
+        for(const auto& event : done)
+            write_timeline_event(event.first, event.second);
+    }
+
+    {
+        const std::lock_guard<std::mutex> lock(timeline_mutex);
+        for(auto& origin : timeline_origins)
+            (void)hipEventDestroy(origin.second.first);
+        timeline_origins.clear();
+    }
+
+    if(timeline_os)
+    {
+        *timeline_os << "\n]" << std::endl;
+        timeline_os.reset();
+    }
+    timeline_tids.clear();
+}
+
+/***************************************************************************
+ * Profile statistics
+ ***************************************************************************/
+
+void rocsolver_profile_stats::merge(const rocsolver_profile_stats& other)
+{
+    if(other.calls == 0)
+        return;
+
+    min_time = (calls == 0 || other.min_time < min_time) ? other.min_time : min_time;
+    max_time = (calls == 0 || other.max_time > max_time) ? other.max_time : max_time;
+    calls += other.calls;
+    time += other.time;
+
+    for(int i = 0; i < num_bins; i++)
+        histogram[i] += other.histogram[i];
+}
+
+double rocsolver_profile_stats::percentile(double p) const
+{
+    // find the bin that holds the requested rank, and return its geometric midpoint
+    // (which is within 5% of any time in the bin) clamped to the observed range
+    double rank = p * 0.01 * calls;
+    int count = 0;
+    int bin = 0;
+    while(bin < num_bins - 1 && count + histogram[bin] < rank)
+        count += histogram[bin++];
+
+    double result = std::exp2((bin + 0.5) / bins_per_octave);
+    return std::min(std::max(result, min_time), max_time);
+}
+
+/***************************************************************************
+ * Profile event recording and resolution
+ ***************************************************************************/
+
+rocsolver_log_thread::~rocsolver_log_thread()
+{
+    for(auto& it : pending)
+    {
+        (void)hipEventDestroy(it.start_event);
+        (void)hipEventDestroy(it.end_event);
+    }
+    for(auto& it : timeline_pending)
+        if(it.event)
+            (void)hipEventDestroy(it.event);
+    for(auto& it : events)
+        for(hipEvent_t event : it.second)
+            (void)hipEventDestroy(event);
+}
+
+hipEvent_t rocsolver_logger::record_profile_event(rocsolver_log_thread& data, hipStream_t stream)
+{
+    int device;
+    if(hipGetDevice(&device) != hipSuccess)
+        return nullptr;
+
+    hipEvent_t event;
+    std::vector<hipEvent_t>& pool = data.events[device];
+    if(!pool.empty())
+    {
+        event = pool.back();
+        pool.pop_back();
+    }
+    else if(hipEventCreate(&event) != hipSuccess)
+        return nullptr;
+
+    if(hipEventRecord(event, stream) != hipSuccess)
+    {
+        pool.push_back(event);
+        return nullptr;
+    }
+
+    return event;
+}
+
+void rocsolver_logger::resolve_profile_events(rocsolver_log_thread& data, bool wait)
+{
+    while(!data.pending.empty())
+    {
+        rocsolver_profile_pending& call = data.pending.front();
+        if(wait)
+            (void)hipEventSynchronize(call.end_event);
+        else if(hipEventQuery(call.end_event) == hipErrorNotReady)
+            break;
+
+        float ms;
+        if(hipEventElapsedTime(&ms, call.start_event, call.end_event) == hipSuccess)
+        {
+            call.stats->add(ms * 1000.0);
+            call.shape_stats->add(ms * 1000.0);
+        }
+
+        std::vector<hipEvent_t>& pool = data.events[call.device];
+        pool.push_back(call.start_event);
+        pool.push_back(call.end_event);
+        data.pending.pop_front();
+    }
+}
+
+/***************************************************************************
+ * Profile log merging and printing
  ***************************************************************************/
 
+static void merge_profile_map(rocsolver_profile_map& into, rocsolver_profile_map& from)
+{
+    for(auto& it : from)
+    {
+        rocsolver_profile_entry& entry = into[it.first];
+        entry.level = it.second.level;
+        entry.stats.merge(it.second.stats);
+        for(const auto& shape : it.second.shapes)
+            entry.shapes[shape.first].merge(shape.second);
+
+        if(it.second.internal_calls)
+        {
+            if(!entry.internal_calls)
+                entry.internal_calls = std::make_unique<rocsolver_profile_map>();
+            merge_profile_map(*entry.internal_calls, *it.second.internal_calls);
+        }
+    }
+}
+
+void rocsolver_logger::merge_profiles()
+{
+    for(auto& data : threads)
+    {
+        const std::lock_guard<std::mutex> lock(data->profile_mutex);
+        resolve_profile_events(*data, true);
+        merge_profile_map(profile, data->profile);
+        data->profile.clear();
+    }
+}
+
+void rocsolver_logger::write_profile_stats(const rocsolver_profile_stats& stats)
+{
+    *profile_os << "Calls: " << stats.calls << ", Total Time: " << (stats.time * 0.001)
+                << " ms, Min: " << (stats.min_time * 0.001)
+                << " ms, Max: " << (stats.max_time * 0.001)
+                << " ms, P50: " << (stats.percentile(50) * 0.001)
+                << " ms, P90: " << (stats.percentile(90) * 0.001)
+                << " ms, P99: " << (stats.percentile(99) * 0.001) << " ms";
+}
+
 void rocsolver_logger::write_profile(rocsolver_profile_map::iterator start,
                                      rocsolver_profile_map::iterator end)
 {
@@ -100,22 +507,46 @@ void rocsolver_logger::write_profile(rocsolver_profile_map::iterator start,
         for(int i = 0; i < entry.level - 1; i++)
             *profile_os << "    ";
 
-        *profile_os << it->first << ": Calls: " << entry.calls
-                    << ", Total Time: " << (entry.time * 0.001) << " ms";
+        *profile_os << *it->first << ": ";
+        write_profile_stats(entry.stats);
 
         if(entry.internal_calls)
         {
             double internal_time = 0;
             for(const auto& nested : *entry.internal_calls)
-                internal_time += nested.second.time;
+                internal_time += nested.second.stats.time;
 
-            *profile_os << " (in nested functions: " << (internal_time * 0.001) << " ms)" << '\n';
-
-            if(entry.level < max_levels)
-                write_profile(entry.internal_calls->begin(), entry.internal_calls->end());
+            *profile_os << " (in nested functions: " << (internal_time * 0.001) << " ms)";
         }
-        else
+        *profile_os << '\n';
+
+        // breakdown by argument signature
+        for(const auto& shape : entry.shapes)
+        {
+            if(shape.first.empty())
+                continue;
+
+            for(int i = 0; i < entry.level; i++)
+                *profile_os << "    ";
+
+            const rocsolver_profile_shape& sig = shape.first;
+            const char* sep = "";
+            *profile_os << '[';
+            if(sig.m >= 0)
+                *profile_os << sep << "m: " << sig.m, sep = ", ";
+            if(sig.n >= 0)
+                *profile_os << sep << "n: " << sig.n, sep = ", ";
+            if(sig.batch_count >= 0)
+                *profile_os << sep << "batch_count: " << sig.batch_count, sep = ", ";
+            if(sig.precision)
+                *profile_os << sep << "precision: " << sig.precision;
+            *profile_os << "] ";
+            write_profile_stats(shape.second);
             *profile_os << '\n';
+        }
+
+        if(entry.internal_calls && entry.level < max_levels)
+            write_profile(entry.internal_calls->begin(), entry.internal_calls->end());
     }
 }
 
@@ -130,6 +561,7 @@ rocblas_status rocsolver_log_write_profile(void)
     auto logger = rocsolver_logger::_instance;
 
     // print profile logging results
+    logger->merge_profiles();
     if(logger->layer_mode & rocblas_layer_mode_log_profile && !logger->profile.empty())
     {
         *logger->profile_os << "------- PROFILE -------" << '\n';
@@ -151,6 +583,7 @@ rocblas_status rocsolver_log_flush_profile(void)
     auto logger = rocsolver_logger::_instance;
 
     // print and clear profile logging results
+    logger->merge_profiles();
     if(logger->layer_mode & rocblas_layer_mode_log_profile && !logger->profile.empty())
     {
         *logger->profile_os << "------- PROFILE -------" << '\n';
@@ -179,6 +612,7 @@ try
         return rocblas_status_internal_error;
 
     auto logger = rocsolver_logger::_instance = new rocsolver_logger();
+    logger->session = ++rocsolver_logger::_sessions;
 
     // set layer_mode from environment variable ROCSOLVER_LAYER or to default
     if(const char* str_layer_mode = std::getenv("ROCSOLVER_LAYER"))
@@ -207,9 +641,12 @@ try
         logger->max_levels = 1;
 
     // create output streams (specified by env variables or default to stderr)
-    logger->trace_os = logger->open_log_stream("ROCSOLVER_LOG_TRACE_PATH");
-    logger->bench_os = logger->open_log_stream("ROCSOLVER_LOG_BENCH_PATH");
-    logger->profile_os = logger->open_log_stream("ROCSOLVER_LOG_PROFILE_PATH");
+    logger->trace_os = logger->open_log_stream("ROCSOLVER_LOG_TRACE_PATH", true);
+    logger->bench_os = logger->open_log_stream("ROCSOLVER_LOG_BENCH_PATH", true);
+    logger->profile_os = logger->open_log_stream("ROCSOLVER_LOG_PROFILE_PATH", false);
+
+    // the timeline log is only created if there are events to write
+    logger->timeline_origin = get_time_us_no_sync();
 
     return rocblas_status_success;
 }
@@ -229,11 +666,14 @@ try
 
     auto logger = rocsolver_logger::_instance;
 
-    // if there are pending log_exit calls:
-    if(!rocsolver_logger::_instance->call_stack.empty())
-        return rocblas_status_internal_error;
+    // if there are pending log_exit calls (the call stacks belong to their threads, so only
+    // their depths are read):
+    for(auto& data : logger->threads)
+        if(data->depth != 0)
+            return rocblas_status_internal_error;
 
     // print profile logging results
+    logger->merge_profiles();
     if(logger->layer_mode & rocblas_layer_mode_log_profile && !logger->profile.empty())
     {
         *logger->profile_os << "------- PROFILE -------" << '\n';
@@ -241,6 +681,12 @@ try
         *logger->profile_os << std::endl;
     }
 
+    // complete the timeline logging results
+    logger->close_timeline();
+
+    // report the log messages that were dropped, and complete the writing of the logs
+    logger->close_log_streams();
+
     // delete the logger
     delete rocsolver_logger::_instance;
     rocsolver_logger::_instance = nullptr;
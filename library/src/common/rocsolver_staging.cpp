@@ -0,0 +1,419 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "rocsolver_staging.hpp"
+#include "rocblascommon/definitions.hpp"
+#include "rocblascommon/utility.hpp"
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+// initialize the static variables
+std::mutex rocsolver_staging_pool::_mutex;
+std::unordered_map<rocblas_handle, rocsolver_staging_pool::pool> rocsolver_staging_pool::_pools;
+std::atomic<size_t> rocsolver_staging_pool::_active{0};
+
+/***************************************************************************
+ * Helpers
+ ***************************************************************************/
+
+static size_t staging_align(size_t bytes)
+{
+    return (bytes + rocsolver_staging_pool::alignment - 1) / rocsolver_staging_pool::alignment
+        * rocsolver_staging_pool::alignment;
+}
+
+// bytes spanned by count instances of array a in the staging buffers
+static size_t staged_bytes(const rocsolver_staged_array& a, rocblas_int count)
+{
+    return ((count - 1) * a.stage_stride + a.count) * a.elem_size;
+}
+
+// copies count instances of elems elements between host arrays with different strides
+static void copy_instances(char* dst,
+                           size_t dst_stride,
+                           const char* src,
+                           size_t src_stride,
+                           size_t elems,
+                           size_t elem_size,
+                           rocblas_int count)
+{
+    if(dst_stride == src_stride)
+        memcpy(dst, src, ((count - 1) * src_stride + elems) * elem_size);
+    else
+    {
+        for(rocblas_int b = 0; b < count; ++b)
+            memcpy(dst + b * dst_stride * elem_size, src + b * src_stride * elem_size,
+                   elems * elem_size);
+    }
+}
+
+/***************************************************************************
+ * Pool management
+ ***************************************************************************/
+
+rocsolver_staging_pool::pool* rocsolver_staging_pool::find(rocblas_handle handle)
+{
+    auto it = _pools.find(handle);
+    if(it == _pools.end())
+        return nullptr;
+
+    int device;
+    if(hipGetDevice(&device) != hipSuccess)
+        return nullptr;
+
+    // a pool of another device was left by a destroyed handle with the same address
+    if(device != it->second.device)
+    {
+        if(!it->second.in_use)
+        {
+            release(it->second);
+            _pools.erase(it);
+            _active--;
+        }
+        return nullptr;
+    }
+
+    return &it->second;
+}
+
+rocblas_status rocsolver_staging_pool::init(pool& p)
+{
+    hipError_t err = hipStreamCreateWithFlags(&p.h2d_stream, hipStreamNonBlocking);
+    if(err == hipSuccess)
+        err = hipStreamCreateWithFlags(&p.d2h_stream, hipStreamNonBlocking);
+    for(slot& s : p.slots)
+    {
+        if(err == hipSuccess)
+            err = hipEventCreateWithFlags(&s.h2d, hipEventDisableTiming);
+        if(err == hipSuccess)
+            err = hipEventCreateWithFlags(&s.done, hipEventDisableTiming);
+        if(err == hipSuccess)
+            err = hipEventCreateWithFlags(&s.d2h, hipEventDisableTiming);
+    }
+
+    if(err != hipSuccess)
+        release(p);
+    return get_rocblas_status_for_hip_status(err);
+}
+
+void rocsolver_staging_pool::release(pool& p)
+{
+    for(slot& s : p.slots)
+    {
+        if(s.host)
+            hipHostFree(s.host);
+        if(s.device)
+            hipFree(s.device);
+        if(s.h2d)
+            hipEventDestroy(s.h2d);
+        if(s.done)
+            hipEventDestroy(s.done);
+        if(s.d2h)
+            hipEventDestroy(s.d2h);
+        s = slot();
+    }
+    if(p.h2d_stream)
+        hipStreamDestroy(p.h2d_stream);
+    if(p.d2h_stream)
+        hipStreamDestroy(p.d2h_stream);
+    p.h2d_stream = p.d2h_stream = nullptr;
+}
+
+rocblas_status rocsolver_staging_pool::reserve(pool& p, size_t bytes)
+{
+    // grow in steps of 1 MiB, so that similar calls do not reallocate the buffers
+    constexpr size_t step = size_t(1) << 20;
+    bytes = (bytes + step - 1) / step * step;
+
+    for(slot& s : p.slots)
+    {
+        if(s.size >= bytes)
+            continue;
+
+        if(s.host)
+            hipHostFree(s.host);
+        if(s.device)
+            hipFree(s.device);
+        s.host = s.device = nullptr;
+        s.size = 0;
+
+        RETURN_IF_HIP_ERROR(hipHostMalloc(&s.host, bytes));
+        if(hipMalloc(&s.device, bytes) != hipSuccess)
+        {
+            hipHostFree(s.host);
+            s.host = s.device = nullptr;
+            return rocblas_status_memory_error;
+        }
+        s.size = bytes;
+    }
+
+    return rocblas_status_success;
+}
+
+/***************************************************************************
+ * Staged execution
+ ***************************************************************************/
+
+rocblas_int rocsolver_staging_pool::chunk_size(rocblas_handle handle,
+                                               const rocsolver_staged_array* arrays,
+                                               const int narrays,
+                                               const rocblas_int batch_count)
+{
+    size_t buffer_size = default_buffer_size;
+    if(_active > 0)
+    {
+        const std::lock_guard<std::mutex> lock(_mutex);
+        pool* p = find(handle);
+        if(p)
+            buffer_size = p->buffer_size;
+    }
+
+    size_t instance_bytes = 0;
+    for(int k = 0; k < narrays; ++k)
+        instance_bytes += arrays[k].stage_stride * arrays[k].elem_size;
+
+    size_t chunk = instance_bytes > 0 ? buffer_size / instance_bytes : batch_count;
+    return rocblas_int(std::max(size_t(1), std::min(chunk, size_t(batch_count))));
+}
+
+rocblas_status rocsolver_staging_pool::pipeline(pool& p,
+                                                hipStream_t stream,
+                                                const rocblas_int batch_count,
+                                                const rocblas_int chunk,
+                                                const rocsolver_staged_array* arrays,
+                                                const int narrays,
+                                                const launcher& launch)
+{
+    // place the arrays of a sub-batch in the staging buffers
+    std::vector<size_t> offset(narrays);
+    std::vector<void*> ptrs(narrays);
+    size_t total = 0;
+    for(int k = 0; k < narrays; ++k)
+    {
+        offset[k] = total;
+        total += staging_align(arrays[k].stage_stride * arrays[k].elem_size * chunk);
+    }
+    RETURN_IF_ROCBLAS_ERROR(reserve(p, total));
+
+    // copies the results of the sub-batch in s back to the user's arrays
+    auto unstage = [&](slot& s) {
+        for(int k = 0; k < narrays; ++k)
+        {
+            const rocsolver_staged_array& a = arrays[k];
+            if(a.out)
+                copy_instances((char*)a.host + s.first * a.host_stride * a.elem_size,
+                               a.host_stride, (char*)s.host + offset[k], a.stage_stride,
+                               a.count, a.elem_size, s.count);
+        }
+    };
+
+    hipError_t err = hipSuccess;
+    rocblas_status status = rocblas_status_success;
+    rocblas_int first = 0;
+    for(int c = 0; first < batch_count; ++c)
+    {
+        slot& s = p.slots[c % num_slots];
+
+        // wait for the sub-batch that last used this buffer
+        if(s.count)
+        {
+            err = hipEventSynchronize(s.d2h);
+            if(err != hipSuccess)
+                break;
+            unstage(s);
+            s.count = 0;
+        }
+
+        s.first = first;
+        s.count = std::min(chunk, batch_count - first);
+        first += s.count;
+
+        // stage the input and copy it to the device
+        for(int k = 0; k < narrays && err == hipSuccess; ++k)
+        {
+            const rocsolver_staged_array& a = arrays[k];
+            ptrs[k] = (char*)s.device + offset[k];
+            if(a.in)
+            {
+                copy_instances((char*)s.host + offset[k], a.stage_stride,
+                               (char*)a.host + s.first * a.host_stride * a.elem_size,
+                               a.host_stride, a.count, a.elem_size, s.count);
+                err = hipMemcpyAsync(ptrs[k], (char*)s.host + offset[k], staged_bytes(a, s.count),
+                                     hipMemcpyHostToDevice, p.h2d_stream);
+            }
+        }
+        if(err == hipSuccess)
+            err = hipEventRecord(s.h2d, p.h2d_stream);
+
+        // compute on the handle's stream once the input is on the device
+        if(err == hipSuccess)
+            err = hipStreamWaitEvent(stream, s.h2d, 0);
+        if(err == hipSuccess)
+            status = launch(ptrs.data(), s.count);
+        if(err == hipSuccess)
+            err = hipEventRecord(s.done, stream);
+
+        // copy the results back once computed
+        if(err == hipSuccess)
+            err = hipStreamWaitEvent(p.d2h_stream, s.done, 0);
+        for(int k = 0; k < narrays && err == hipSuccess; ++k)
+        {
+            const rocsolver_staged_array& a = arrays[k];
+            if(a.out)
+                err = hipMemcpyAsync((char*)s.host + offset[k], ptrs[k], staged_bytes(a, s.count),
+                                     hipMemcpyDeviceToHost, p.d2h_stream);
+        }
+        if(err == hipSuccess)
+            err = hipEventRecord(s.d2h, p.d2h_stream);
+
+        if(err != hipSuccess || status != rocblas_status_success)
+            break;
+    }
+
+    // wait for the sub-batches still in flight; the buffers cannot be reused before
+    hipError_t sync_err = hipStreamSynchronize(p.d2h_stream);
+    if(sync_err == hipSuccess)
+        sync_err = hipStreamSynchronize(p.h2d_stream);
+    for(slot& s : p.slots)
+    {
+        if(s.count && err == hipSuccess && sync_err == hipSuccess
+           && status == rocblas_status_success)
+            unstage(s);
+        s.count = 0;
+    }
+
+    if(err == hipSuccess)
+        err = sync_err;
+    if(err != hipSuccess)
+        return get_rocblas_status_for_hip_status(err);
+    return status;
+}
+
+rocblas_status rocsolver_staging_pool::run(rocblas_handle handle,
+                                           const rocblas_int batch_count,
+                                           const rocsolver_staged_array* arrays,
+                                           const int narrays,
+                                           const launcher& launch)
+{
+    hipStream_t stream;
+    RETURN_IF_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+    const rocblas_int chunk = chunk_size(handle, arrays, narrays, batch_count);
+
+    // use the pool of the handle, unless another call is using it
+    pool* p = nullptr;
+    if(_active > 0)
+    {
+        const std::lock_guard<std::mutex> lock(_mutex);
+        p = find(handle);
+        if(p && p->in_use)
+            p = nullptr;
+        if(p)
+            p->in_use = true;
+    }
+
+    rocblas_status status;
+    if(p)
+    {
+        try
+        {
+            status = pipeline(*p, stream, batch_count, chunk, arrays, narrays, launch);
+        }
+        catch(...)
+        {
+            const std::lock_guard<std::mutex> lock(_mutex);
+            p->in_use = false;
+            throw;
+        }
+        const std::lock_guard<std::mutex> lock(_mutex);
+        p->in_use = false;
+    }
+    else
+    {
+        // no pool available; use a temporary one
+        pool tmp;
+        status = init(tmp);
+        if(status == rocblas_status_success)
+        {
+            try
+            {
+                status = pipeline(tmp, stream, batch_count, chunk, arrays, narrays, launch);
+            }
+            catch(...)
+            {
+                release(tmp);
+                throw;
+            }
+        }
+        release(tmp);
+    }
+
+    return status;
+}
+
+/***************************************************************************
+ * Staging pool functions
+ ***************************************************************************/
+
+extern "C" {
+
+rocblas_status rocsolver_staging_pool_create(rocblas_handle handle, const size_t buffer_size)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    int device;
+    if(hipGetDevice(&device) != hipSuccess)
+        return rocblas_status_internal_error;
+
+    const std::lock_guard<std::mutex> lock(rocsolver_staging_pool::_mutex);
+
+    // if the handle already has a pool (a stale pool of another device is released first):
+    if(rocsolver_staging_pool::find(handle) || rocsolver_staging_pool::_pools.count(handle))
+        return rocblas_status_invalid_value;
+
+    rocsolver_staging_pool::pool p;
+    if(buffer_size > 0)
+        p.buffer_size = buffer_size;
+    p.device = device;
+    rocblas_status status = rocsolver_staging_pool::init(p);
+    if(status != rocblas_status_success)
+        return status;
+
+    rocsolver_staging_pool::_pools[handle] = p;
+    rocsolver_staging_pool::_active++;
+
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocsolver_staging_pool_destroy(rocblas_handle handle)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    const std::lock_guard<std::mutex> lock(rocsolver_staging_pool::_mutex);
+
+    // if the handle has no pool, or it is being used:
+    auto it = rocsolver_staging_pool::_pools.find(handle);
+    if(it == rocsolver_staging_pool::_pools.end() || it->second.in_use)
+        return rocblas_status_invalid_value;
+
+    rocsolver_staging_pool::release(it->second);
+    rocsolver_staging_pool::_pools.erase(it);
+    rocsolver_staging_pool::_active--;
+
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+}
@@ -0,0 +1,448 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "rocsolver_tuning.hpp"
+#include "rocblascommon/utility.hpp"
+#include "rocsolver_ostream.hpp"
+#include <cerrno>
+#include <climits>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+// initialize the static variables
+std::mutex rocsolver_tuning::_mutex;
+std::shared_ptr<const rocsolver_tuning_table> rocsolver_tuning::_table;
+std::atomic<bool> rocsolver_tuning::_initialized(false);
+thread_local std::shared_ptr<const rocsolver_tuning_table> rocsolver_tuning::_pinned;
+
+/***************************************************************************
+ * Description of the tunable parameters
+ ***************************************************************************/
+
+namespace
+{
+using int_list = std::vector<rocblas_int>;
+
+// an interval table: blksizes[i] is used for sizes in [intervals[i-1], intervals[i])
+struct table_param
+{
+    const char* intervals_name;
+    const char* blksizes_name;
+    int_list rocsolver_tuning_table::*intervals;
+    int_list rocsolver_tuning_table::*blksizes;
+    rocblas_int min_blksize;
+};
+
+// a single integer value in [min_value, max_value]
+struct int_param
+{
+    const char* name;
+    rocblas_int rocsolver_tuning_table::*value;
+    rocblas_int min_value;
+    rocblas_int max_value;
+};
+
+// a switch size that must not be smaller than its associated block size
+struct switch_pair
+{
+    rocblas_int rocsolver_tuning_table::*switchsize;
+    rocblas_int rocsolver_tuning_table::*blocksize;
+    const char* name;
+};
+
+using tt = rocsolver_tuning_table;
+
+// clang-format off
+const table_param table_params[] = {
+    {"GETRF_INTERVALS", "GETRF_BLKSIZES", &tt::getrf_intervals, &tt::getrf_blksizes, 1},
+    {"GETRF_BATCH_INTERVALS", "GETRF_BATCH_BLKSIZES", &tt::getrf_batch_intervals, &tt::getrf_batch_blksizes, 1},
+    {"GETRF_NPVT_INTERVALS", "GETRF_NPVT_BLKSIZES", &tt::getrf_npvt_intervals, &tt::getrf_npvt_blksizes, 1},
+    {"GETRF_NPVT_BATCH_INTERVALS", "GETRF_NPVT_BATCH_BLKSIZES", &tt::getrf_npvt_batch_intervals, &tt::getrf_npvt_batch_blksizes, 1},
+    {"GETRI_INTERVALS", "GETRI_BLKSIZES", &tt::getri_intervals, &tt::getri_blksizes, 0},
+    {"GETRI_BATCH_INTERVALS", "GETRI_BATCH_BLKSIZES", &tt::getri_batch_intervals, &tt::getri_batch_blksizes, 0},
+    {"TRTRI_INTERVALS", "TRTRI_BLKSIZES", &tt::trtri_intervals, &tt::trtri_blksizes, 0},
+    {"TRTRI_BATCH_INTERVALS", "TRTRI_BATCH_BLKSIZES", &tt::trtri_batch_intervals, &tt::trtri_batch_blksizes, 0},
+};
+
+const int_param int_params[] = {
+    {"GETRF_RECURSIVE_MIN_SIZE", &tt::getrf_recursive_min_size, 0, INT_MAX},
+    {"GETRF_RECURSIVE_MAX_SIZE", &tt::getrf_recursive_max_size, 0, INT_MAX},
+    {"GETRF_LEFT_LOOKING_RATIO", &tt::getrf_left_looking_ratio, 0, INT_MAX},
+    {"GETRF_TOURNAMENT_SWITCHSIZE", &tt::getrf_tournament_switchsize, 0, INT_MAX},
+    {"GETRF_TOURNAMENT_TILE_ROWS", &tt::getrf_tournament_tile_rows, 1, INT_MAX},
+    {"GETRI_TINY_SIZE", &tt::getri_tiny_size, 0, WAVESIZE},
+    {"GETRI_BATCH_TINY_SIZE", &tt::getri_batch_tiny_size, 0, WAVESIZE},
+    {"POTRF_POTF2_SWITCHSIZE", &tt::potrf_potf2_switchsize, 1, INT_MAX},
+    {"GEQxF_GEQx2_SWITCHSIZE", &tt::geqxf_geqx2_switchsize, 1, INT_MAX},
+    {"GEQxF_GEQx2_BLOCKSIZE", &tt::geqxf_geqx2_blocksize, 1, INT_MAX},
+    {"GEQRF_TSQR_SWITCHSIZE", &tt::geqrf_tsqr_switchsize, 1, INT_MAX},
+    {"GEQP3_BLOCKSIZE", &tt::geqp3_blocksize, 1, INT_MAX},
+    {"GExQF_GExQ2_SWITCHSIZE", &tt::gexqf_gexq2_switchsize, 1, INT_MAX},
+    {"GExQF_GExQ2_BLOCKSIZE", &tt::gexqf_gexq2_blocksize, 1, INT_MAX},
+    {"GEBRD_GEBD2_SWITCHSIZE", &tt::gebrd_gebd2_switchsize, 1, INT_MAX},
+    {"xxTRD_xxTD2_BLOCKSIZE", &tt::xxtrd_xxtd2_blocksize, 1, INT_MAX},
+    {"xxTRD_xxTD2_SWITCHSIZE", &tt::xxtrd_xxtd2_switchsize, 1, INT_MAX},
+    {"xxGST_xxGS2_BLOCKSIZE", &tt::xxgst_xxgs2_blocksize, 1, INT_MAX},
+    {"ORGxx_UNGxx_SWITCHSIZE", &tt::orgxx_ungxx_switchsize, 1, INT_MAX},
+    {"ORGxx_UNGxx_BLOCKSIZE", &tt::orgxx_ungxx_blocksize, 1, INT_MAX},
+    {"ORMxx_ORMxx_BLOCKSIZE", &tt::ormxx_unmxx_blocksize, 1, INT_MAX},
+    {"STEDC_MIN_DC_SIZE", &tt::stedc_min_dc_size, 4, INT_MAX},
+};
+
+const switch_pair switch_pairs[] = {
+    {&tt::geqxf_geqx2_switchsize, &tt::geqxf_geqx2_blocksize, "GEQxF_GEQx2"},
+    {&tt::gexqf_gexq2_switchsize, &tt::gexqf_gexq2_blocksize, "GExQF_GExQ2"},
+    {&tt::xxtrd_xxtd2_switchsize, &tt::xxtrd_xxtd2_blocksize, "xxTRD_xxTD2"},
+    {&tt::orgxx_ungxx_switchsize, &tt::orgxx_ungxx_blocksize, "ORGxx_UNGxx"},
+};
+// clang-format on
+
+const char* const thin_svd_switch_name = "THIN_SVD_SWITCH";
+const char* const header_name = "rocsolver_tuning";
+
+// parses a base-10 integer; returns false if str is not a valid rocblas_int
+bool parse_int(const std::string& str, rocblas_int& value)
+{
+    char* end;
+    errno = 0;
+    long v = strtol(str.c_str(), &end, 10);
+    if(errno || *end != '\0' || end == str.c_str() || v < INT_MIN || v > INT_MAX)
+        return false;
+    value = static_cast<rocblas_int>(v);
+    return true;
+}
+
+// parses a floating-point number; returns false if str is not a valid double
+bool parse_double(const std::string& str, double& value)
+{
+    char* end;
+    errno = 0;
+    double v = strtod(str.c_str(), &end);
+    if(errno || *end != '\0' || end == str.c_str())
+        return false;
+    value = v;
+    return true;
+}
+} // namespace
+
+/***************************************************************************
+ * Parsing, validation and output of tuning tables
+ ***************************************************************************/
+
+bool rocsolver_tuning::parse(const char* path, rocsolver_tuning_table& table, std::string& msg)
+{
+    std::ifstream file(path);
+    if(!file)
+    {
+        msg = "cannot open file";
+        return false;
+    }
+
+    rocsolver_tuning_table result;
+    bool has_header = false;
+    std::string line;
+    for(int line_no = 1; std::getline(file, line); line_no++)
+    {
+        // discard comments
+        size_t pos = line.find('#');
+        if(pos != std::string::npos)
+            line.erase(pos);
+
+        std::istringstream iss(line);
+        std::string key, token;
+        if(!(iss >> key))
+            continue;
+
+        std::vector<std::string> values;
+        while(iss >> token)
+            values.push_back(token);
+
+        std::string where = "line " + std::to_string(line_no) + ": ";
+
+        // the first entry must identify the format version
+        if(!has_header)
+        {
+            rocblas_int version;
+            if(key != header_name || values.size() != 1 || !parse_int(values[0], version))
+            {
+                msg = where + "expected '" + header_name + " <version>'";
+                return false;
+            }
+            if(version != file_version)
+            {
+                msg = where + "unsupported version " + values[0];
+                return false;
+            }
+            has_header = true;
+            continue;
+        }
+
+        bool found = false;
+
+        for(const auto& p : table_params)
+        {
+            int_list* target = nullptr;
+            if(key == p.intervals_name)
+                target = &(result.*p.intervals);
+            else if(key == p.blksizes_name)
+                target = &(result.*p.blksizes);
+            else
+                continue;
+
+            target->clear();
+            for(const auto& v : values)
+            {
+                rocblas_int x;
+                if(!parse_int(v, x))
+                {
+                    msg = where + "invalid integer '" + v + "' for " + key;
+                    return false;
+                }
+                target->push_back(x);
+            }
+            found = true;
+            break;
+        }
+
+        for(const auto& p : int_params)
+        {
+            if(found || key != p.name)
+                continue;
+
+            if(values.size() != 1 || !parse_int(values[0], result.*p.value))
+            {
+                msg = where + key + " expects a single integer";
+                return false;
+            }
+            found = true;
+        }
+
+        if(!found && key == thin_svd_switch_name)
+        {
+            if(values.size() != 1 || !parse_double(values[0], result.thin_svd_switch))
+            {
+                msg = where + key + " expects a single number";
+                return false;
+            }
+            found = true;
+        }
+
+        if(!found)
+        {
+            msg = where + "unknown parameter " + key;
+            return false;
+        }
+    }
+
+    if(!has_header)
+    {
+        msg = "missing '" + std::string(header_name) + " <version>' header";
+        return false;
+    }
+
+    if(!validate(result, msg))
+        return false;
+
+    table = std::move(result);
+    return true;
+}
+
+bool rocsolver_tuning::validate(const rocsolver_tuning_table& table, std::string& msg)
+{
+    for(const auto& p : table_params)
+    {
+        const int_list& intervals = table.*p.intervals;
+        const int_list& blksizes = table.*p.blksizes;
+
+        if(blksizes.size() != intervals.size() + 1)
+        {
+            msg = std::string(p.blksizes_name) + " must have one more entry than "
+                + p.intervals_name;
+            return false;
+        }
+        for(size_t i = 0; i < intervals.size(); i++)
+        {
+            if(intervals[i] < 0 || (i > 0 && intervals[i] <= intervals[i - 1]))
+            {
+                msg = std::string(p.intervals_name) + " must be non-negative and increasing";
+                return false;
+            }
+        }
+        for(rocblas_int blk : blksizes)
+        {
+            if(blk < p.min_blksize)
+            {
+                msg = std::string(p.blksizes_name) + " entries must be at least "
+                    + std::to_string(p.min_blksize);
+                return false;
+            }
+        }
+    }
+
+    for(const auto& p : int_params)
+    {
+        rocblas_int value = table.*p.value;
+        if(value < p.min_value || value > p.max_value)
+        {
+            msg = std::string(p.name) + " is out of range";
+            return false;
+        }
+    }
+
+    for(const auto& p : switch_pairs)
+    {
+        if(table.*p.switchsize < table.*p.blocksize)
+        {
+            msg = std::string(p.name) + "_SWITCHSIZE must not be smaller than " + p.name
+                + "_BLOCKSIZE";
+            return false;
+        }
+    }
+
+    if(table.getrf_recursive_min_size > table.getrf_recursive_max_size)
+    {
+        msg = "GETRF_RECURSIVE_MIN_SIZE must not be larger than GETRF_RECURSIVE_MAX_SIZE";
+        return false;
+    }
+
+    if(!(table.thin_svd_switch >= 1))
+    {
+        msg = std::string(thin_svd_switch_name) + " must be at least 1";
+        return false;
+    }
+
+    return true;
+}
+
+bool rocsolver_tuning::write(const char* path, const rocsolver_tuning_table& table)
+{
+    std::ofstream file(path, std::ios::trunc);
+    if(!file)
+        return false;
+
+    file << "# rocSOLVER tuning table\n";
+    file << header_name << ' ' << file_version << '\n';
+
+    for(const auto& p : table_params)
+    {
+        file << p.intervals_name;
+        for(rocblas_int x : table.*p.intervals)
+            file << ' ' << x;
+        file << '\n' << p.blksizes_name;
+        for(rocblas_int x : table.*p.blksizes)
+            file << ' ' << x;
+        file << '\n';
+    }
+
+    for(const auto& p : int_params)
+        file << p.name << ' ' << table.*p.value << '\n';
+
+    file << thin_svd_switch_name << ' ' << table.thin_svd_switch << '\n';
+
+    file.close();
+    return !file.fail();
+}
+
+/***************************************************************************
+ * Access to the active tuning table
+ ***************************************************************************/
+
+void rocsolver_tuning::initialize()
+{
+    auto table = std::make_shared<rocsolver_tuning_table>();
+
+    // load the tuning file specified by ROCSOLVER_TUNING_PATH, if any
+    if(const char* path = std::getenv("ROCSOLVER_TUNING_PATH"))
+    {
+        std::string msg;
+        if(!parse(path, *table, msg))
+        {
+            rocsolver_cerr << "rocSOLVER: ignoring tuning file " << path << " (" << msg
+                           << "); using default sizes" << std::endl;
+            table = std::make_shared<rocsolver_tuning_table>();
+        }
+    }
+
+    std::atomic_store(&_table, std::shared_ptr<const rocsolver_tuning_table>(std::move(table)));
+    _initialized.store(true, std::memory_order_release);
+}
+
+std::shared_ptr<const rocsolver_tuning_table> rocsolver_tuning::active()
+{
+    // the mutex is only taken until the table is initialized
+    if(!_initialized.load(std::memory_order_acquire))
+    {
+        const std::lock_guard<std::mutex> lock(_mutex);
+        if(!_initialized.load(std::memory_order_relaxed))
+            initialize();
+    }
+
+    return std::atomic_load(&_table);
+}
+
+void rocsolver_tuning::replace(std::shared_ptr<const rocsolver_tuning_table> table)
+{
+    const std::lock_guard<std::mutex> lock(_mutex);
+    std::atomic_store(&_table, std::move(table));
+    _initialized.store(true, std::memory_order_release);
+}
+
+/***************************************************************************
+ * Tuning API
+ ***************************************************************************/
+
+extern "C" {
+
+rocblas_status rocsolver_tuning_load(const char* path)
+try
+{
+    if(!path)
+        return rocblas_status_invalid_pointer;
+
+    auto table = std::make_shared<rocsolver_tuning_table>();
+    std::string msg;
+    if(!rocsolver_tuning::parse(path, *table, msg))
+        return rocblas_status_invalid_value;
+
+    rocsolver_tuning::replace(std::move(table));
+
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocsolver_tuning_write(const char* path)
+try
+{
+    if(!path)
+        return rocblas_status_invalid_pointer;
+
+    auto table = rocsolver_tuning::active();
+    if(!rocsolver_tuning::write(path, *table))
+        return rocblas_status_internal_error;
+
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocsolver_tuning_restore_defaults(void)
+try
+{
+    auto table = std::make_shared<rocsolver_tuning_table>();
+
+    rocsolver_tuning::replace(std::move(table));
+
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+}
@@ -0,0 +1,233 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "rocsolver_workspace.hpp"
+#include "rocblascommon/utility.hpp"
+#include <algorithm>
+
+// initialize the static variables
+std::mutex rocsolver_workspace_pool::_mutex;
+std::unordered_map<rocblas_handle, rocsolver_workspace_pool::pool> rocsolver_workspace_pool::_pools;
+std::atomic<size_t> rocsolver_workspace_pool::_active{0};
+
+/***************************************************************************
+ * Pool management
+ ***************************************************************************/
+
+size_t rocsolver_workspace_pool::size_class(size_t bytes)
+{
+    // blocks smaller than min_class are not worth distinguishing
+    constexpr size_t min_class = 4096;
+    if(bytes <= min_class)
+        return min_class;
+
+    // otherwise, each power of two is split in four classes, so that less than 25% of a
+    // block of the requested class (and less than 40% of a block of the next class, which
+    // acquire can also reuse) is wasted
+    size_t p = min_class;
+    while(p <= bytes / 2)
+        p *= 2;
+    const size_t step = p / 4;
+    return (bytes + step - 1) / step * step;
+}
+
+void rocsolver_workspace_pool::free_block(const block& blk)
+{
+    hipEventDestroy(blk.event);
+    hipFree(blk.ptr);
+}
+
+void rocsolver_workspace_pool::trim(pool& p)
+{
+    for(auto& fb : p.free_blocks)
+    {
+        free_block(fb.second);
+        p.stats.reserved_bytes -= fb.first;
+    }
+    p.free_blocks.clear();
+}
+
+bool rocsolver_workspace_pool::acquire(rocblas_handle handle, size_t bytes, block& blk)
+{
+    // quick return if no handle uses a pool
+    if(_active == 0)
+        return false;
+
+    hipStream_t stream;
+    int device;
+    if(rocblas_get_stream(handle, &stream) != rocblas_status_success
+       || hipGetDevice(&device) != hipSuccess)
+        return false;
+
+    const std::lock_guard<std::mutex> lock(_mutex);
+
+    auto it = _pools.find(handle);
+    if(it == _pools.end())
+        return false;
+    pool& p = it->second;
+
+    // a pool of another device was left by a destroyed handle with the same address
+    if(device != p.device)
+    {
+        trim(p);
+        _pools.erase(it);
+        _active--;
+        return false;
+    }
+
+    // reuse the smallest cached block of the same or the next size class
+    const size_t cls = size_class(bytes);
+    auto fb = p.free_blocks.lower_bound(cls);
+    if(fb != p.free_blocks.end() && fb->first <= size_class(cls + 1))
+    {
+        blk = fb->second;
+        p.free_blocks.erase(fb);
+        p.stats.hits++;
+
+        // the block could still be used by the work queued by its previous call
+        // (the stream of that call may no longer exist, but its event does)
+        hipStreamWaitEvent(stream, blk.event, 0);
+    }
+    else
+    {
+        // allocate a new block; if there is not enough memory, release the cached blocks
+        // and try again
+        p.stats.misses++;
+        blk.size = cls;
+        if(hipMalloc(&blk.ptr, cls) != hipSuccess)
+        {
+            trim(p);
+            if(hipMalloc(&blk.ptr, cls) != hipSuccess)
+            {
+                blk.ptr = nullptr;
+                return true;
+            }
+        }
+        if(hipEventCreateWithFlags(&blk.event, hipEventDisableTiming) != hipSuccess)
+        {
+            hipFree(blk.ptr);
+            blk.ptr = nullptr;
+            return true;
+        }
+        p.stats.reserved_bytes += cls;
+    }
+
+    blk.stream = stream;
+
+    p.in_use += blk.size;
+    p.stats.peak_bytes = std::max(p.stats.peak_bytes, p.in_use);
+    return true;
+}
+
+void rocsolver_workspace_pool::release(rocblas_handle handle, const block& blk)
+{
+    // the block can be reused once the work queued by the call is done
+    hipEventRecord(blk.event, blk.stream);
+
+    const std::lock_guard<std::mutex> lock(_mutex);
+
+    auto it = _pools.find(handle);
+    if(it == _pools.end())
+    {
+        // the pool was destroyed while the block was in use
+        free_block(blk);
+        return;
+    }
+
+    pool& p = it->second;
+    p.free_blocks.emplace(blk.size, blk);
+    p.in_use -= blk.size;
+}
+
+/***************************************************************************
+ * Workspace pool functions
+ ***************************************************************************/
+
+extern "C" {
+
+rocblas_status rocsolver_workspace_pool_create(rocblas_handle handle)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    int device;
+    if(hipGetDevice(&device) != hipSuccess)
+        return rocblas_status_internal_error;
+
+    const std::lock_guard<std::mutex> lock(rocsolver_workspace_pool::_mutex);
+
+    // if the handle already has a pool:
+    auto it = rocsolver_workspace_pool::_pools.find(handle);
+    if(it != rocsolver_workspace_pool::_pools.end())
+    {
+        if(it->second.device == device)
+            return rocblas_status_invalid_value;
+
+        // a pool of another device was left by a destroyed handle with the same address
+        rocsolver_workspace_pool::trim(it->second);
+        rocsolver_workspace_pool::_pools.erase(it);
+        rocsolver_workspace_pool::_active--;
+    }
+
+    rocsolver_workspace_pool::_pools[handle].device = device;
+    rocsolver_workspace_pool::_active++;
+
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocsolver_workspace_pool_destroy(rocblas_handle handle)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    const std::lock_guard<std::mutex> lock(rocsolver_workspace_pool::_mutex);
+
+    // if the handle has no pool:
+    auto it = rocsolver_workspace_pool::_pools.find(handle);
+    if(it == rocsolver_workspace_pool::_pools.end())
+        return rocblas_status_invalid_value;
+
+    // free the cached blocks; blocks still in use are freed when released
+    rocsolver_workspace_pool::trim(it->second);
+    rocsolver_workspace_pool::_pools.erase(it);
+    rocsolver_workspace_pool::_active--;
+
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocsolver_workspace_pool_get_stats(rocblas_handle handle,
+                                                  rocsolver_workspace_pool_stats* stats)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!stats)
+        return rocblas_status_invalid_pointer;
+
+    const std::lock_guard<std::mutex> lock(rocsolver_workspace_pool::_mutex);
+
+    // if the handle has no pool:
+    auto it = rocsolver_workspace_pool::_pools.find(handle);
+    if(it == rocsolver_workspace_pool::_pools.end())
+        return rocblas_status_invalid_value;
+
+    *stats = it->second.stats;
+
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+}
@@ -4,6 +4,14 @@
 
 #pragma once
 
+/*
+ * The interval tables, block sizes and switch sizes of the blocked algorithms
+ * defined here (getrf, getri, trtri, potrf, geqxf, tsqr, geqp3, gexqf, gebrd, xxtrd,
+ * xxgst, orgxx, ormxx, gesvd and stedc) are only the built-in defaults of the runtime
+ * tuning table; library code must read them through rocsolver_tuning::get().
+ * (See rocsolver_tuning.hpp)
+ */
+
 // general
 #define WAVESIZE 64 // size of wavefront
 
@@ -40,6 +48,12 @@
 #define GETRF_NPVT_BATCH_NUM_INTERVALS 3
 #define GETRF_NPVT_BATCH_INTERVALS 45, 181, 2049
 #define GETRF_NPVT_BATCH_BLKSIZES 1, 16, 32, 64
+// the recursive and left-looking variants are disabled unless enabled by the tuning table
+#define GETRF_RECURSIVE_MIN_SIZE 0
+#define GETRF_RECURSIVE_MAX_SIZE 0
+#define GETRF_LEFT_LOOKING_RATIO 0
+#define GETRF_TOURNAMENT_SWITCHSIZE 0
+#define GETRF_TOURNAMENT_TILE_ROWS 256
 
 // getri
 #define GETRI_TINY_SIZE 43
@@ -61,10 +75,27 @@
 
 // potf2/potrf
 #define POTRF_POTF2_SWITCHSIZE 64
+#define POTF2_MAX_SMALL_SIZE 64
+#define POTF2_OPTIM_NGRP \
+    16, 15, 8, 8, 8, 8, 8, 8, 6, 6, 4, 4, 4, 4, 4, 4, 3, 3, 3, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2
+
+// gesv/posv
+#define GESV_POSV_MAX_SMALL_SIZE 64
+#define GESV_POSV_MAX_SMALL_LDS 49152
 
 // geqx2/geqxf
 #define GEQxF_GEQx2_SWITCHSIZE 128
 #define GEQxF_GEQx2_BLOCKSIZE 64
+#define GEQR2_MAX_SMALL_ROWS 256
+#define GEQR2_MAX_SMALL_COLS 32
+#define GEQR2_SMALL_REDCOLS 8
+
+// tsqr (tall-skinny geqrf)
+#define GEQRF_TSQR_SWITCHSIZE 16384
+#define GEQRF_TSQR_TILE_ROWS GEQR2_MAX_SMALL_ROWS
+
+// geqp3
+#define GEQP3_BLOCKSIZE 32
 
 // gexq2/gexqf
 #define GExQF_GExQ2_SWITCHSIZE 128
@@ -83,6 +114,26 @@
 // gesvd
 #define THIN_SVD_SWITCH 1.6
 
+// bdsqr
+#define BDSQR_BDIM 256
+
+// steqr
+#define STEQR_BDIM 256
+
+// stedc
+#define STEDC_MIN_DC_SIZE 32
+#define STEDC_BDIM 512
+#define STEDC_MAX_ITERS 400
+
+// stebz/stein
+#define STEBZ_BDIM 256
+#define STEIN_BDIM 64
+#define STEIN_MAX_ITERS 5
+
+// syevj/heevj and gesvdj
+#define JACOBI_BDIM 256
+#define JACOBI_MAX_LDS 49152
+
 // THESE FOLLOWING VALUES ARE TO MATCH ROCBLAS C++ INTERFACE
 // THEY ARE DEFINED/TUNNED IN ROCBLAS
 #define ROCBLAS_AXPY_NB 256
@@ -395,6 +395,86 @@ __device__ void lasr(const rocblas_side side,
     }
 }
 
+/** LASR device function (multi-threaded version) applies the same sequence of
+    rotations as LASR, but the columns of A (side left) or the rows of A (side
+    right), which are updated independently, are distributed among the nthreads
+    threads of the group. Each thread applies the whole sequence to its own
+    rows/columns. **/
+template <typename T, typename W>
+__device__ void lasr(const rocblas_side side,
+                     const rocblas_direct direc,
+                     const rocblas_int m,
+                     const rocblas_int n,
+                     W* c,
+                     W* s,
+                     T* A,
+                     const rocblas_int lda,
+                     const rocblas_int tid,
+                     const rocblas_int nthreads)
+{
+    T temp;
+    W cs, sn;
+
+    if(side == rocblas_side_left)
+    {
+        for(rocblas_int j = tid; j < n; j += nthreads)
+        {
+            T* a = A + j * lda;
+            if(direc == rocblas_forward_direction)
+            {
+                for(rocblas_int i = 0; i < m - 1; ++i)
+                {
+                    temp = a[i];
+                    cs = c[i];
+                    sn = s[i];
+                    a[i] = cs * temp + sn * a[i + 1];
+                    a[i + 1] = cs * a[i + 1] - sn * temp;
+                }
+            }
+            else
+            {
+                for(rocblas_int i = m - 1; i > 0; --i)
+                {
+                    temp = a[i];
+                    cs = c[i - 1];
+                    sn = s[i - 1];
+                    a[i] = cs * temp - sn * a[i - 1];
+                    a[i - 1] = cs * a[i - 1] + sn * temp;
+                }
+            }
+        }
+    }
+
+    else
+    {
+        for(rocblas_int i = tid; i < m; i += nthreads)
+        {
+            if(direc == rocblas_forward_direction)
+            {
+                for(rocblas_int j = 0; j < n - 1; ++j)
+                {
+                    temp = A[i + j * lda];
+                    cs = c[j];
+                    sn = s[j];
+                    A[i + j * lda] = cs * temp + sn * A[i + (j + 1) * lda];
+                    A[i + (j + 1) * lda] = cs * A[i + (j + 1) * lda] - sn * temp;
+                }
+            }
+            else
+            {
+                for(rocblas_int j = n - 1; j > 0; --j)
+                {
+                    temp = A[i + j * lda];
+                    cs = c[j - 1];
+                    sn = s[j - 1];
+                    A[i + j * lda] = cs * temp - sn * A[i + (j - 1) * lda];
+                    A[i + (j - 1) * lda] = cs * A[i + (j - 1) * lda] + sn * temp;
+                }
+            }
+        }
+    }
+}
+
 /** LAE2 computes the eigenvalues of a 2x2 symmetric matrix
     [ a b ]
     [ b c ] **/
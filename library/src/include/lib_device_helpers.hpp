@@ -32,6 +32,19 @@ __device__ S aabs(T val)
     return asum(val);
 }
 
+/** RREAL returns the real part of val (val itself in the real case) **/
+template <typename S, typename T, std::enable_if_t<!is_complex<T>, int> = 0>
+__device__ S rreal(const T val)
+{
+    return val;
+}
+
+template <typename S, typename T, std::enable_if_t<is_complex<T>, int> = 0>
+__device__ S rreal(const T val)
+{
+    return val.real();
+}
+
 template <typename T>
 __device__ void swap(const rocblas_int n, T* a, const rocblas_int inca, T* b, const rocblas_int incb)
 {
@@ -58,6 +71,27 @@ __device__ void
     }
 }
 
+/** SWAPVECT device function (multi-threaded version) swap vectors a and b of
+    dimension n; the elements are distributed among the nthreads threads of the
+    group **/
+template <typename T>
+__device__ void swapvect(const rocblas_int n,
+                         T* a,
+                         const rocblas_int inca,
+                         T* b,
+                         const rocblas_int incb,
+                         const rocblas_int tid,
+                         const rocblas_int nthreads)
+{
+    T orig;
+    for(rocblas_int i = tid; i < n; i += nthreads)
+    {
+        orig = a[inca * i];
+        a[inca * i] = b[incb * i];
+        b[incb * i] = orig;
+    }
+}
+
 /** FIND_MAX_TRIDIAG finds the element with the largest magnitude in the
     tridiagonal matrix **/
 template <typename T>
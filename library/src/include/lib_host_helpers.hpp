@@ -81,7 +81,7 @@ T* const* cast2constPointer(T** array)
 }
 
 
-inline rocblas_int get_index(rocblas_int* intervals, rocblas_int max, rocblas_int dim)
+inline rocblas_int get_index(const rocblas_int* intervals, rocblas_int max, rocblas_int dim)
 {
     rocblas_int i;
 
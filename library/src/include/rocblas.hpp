@@ -13,7 +13,10 @@ struct rocblas_index_value_t;
 #include "internal/rocblas_device_malloc.hpp"
 #include "lib_device_helpers.hpp"
 #include "lib_host_helpers.hpp"
+#include "rocsolver_convergence.hpp"
 #include "rocsolver_logger.hpp"
+#include "rocsolver_tuning.hpp"
+#include "rocsolver_workspace.hpp"
 #include <rocblas.h>
 
 // axpy
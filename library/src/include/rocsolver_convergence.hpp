@@ -0,0 +1,73 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocsolver.h"
+#include <atomic>
+#include <hip/hip_runtime.h>
+#include <mutex>
+#include <unordered_map>
+
+/***************************************************************************
+ * The rocsolver_convergence class keeps the convergence statistics buffers
+ * attached to rocBLAS handles (see rocsolver_convergence_stats_set). The
+ * iterative solvers write the statistics of each instance of the batch to
+ * the buffer of the handle, if there is one.
+ *
+ * As with the workspace pools, buffers are identified by the address of
+ * their handle, so a buffer must be detached before its handle is destroyed.
+ * If a new handle is created at the same address on another device, the
+ * stale buffer is detected and detached by get.
+ ***************************************************************************/
+class rocsolver_convergence
+{
+public:
+    // returns the statistics buffer of handle and sets size to its number of elements, or
+    // returns nullptr (and sets size to 0) if the handle has no buffer (or if it was left by a
+    // destroyed handle)
+    static rocsolver_convergence_stats* get(rocblas_handle handle, rocblas_int* size);
+
+private:
+    // an attached buffer
+    struct buffer
+    {
+        rocsolver_convergence_stats* stats;
+        rocblas_int size;
+        // the device of the handle
+        int device;
+    };
+
+    // static mutex for multithreading
+    static std::mutex _mutex;
+    // the buffers, by handle
+    static std::unordered_map<rocblas_handle, buffer> _buffers;
+    // number of attached buffers; allows skipping the lookup when statistics are not used
+    static std::atomic<size_t> _active;
+
+    friend rocblas_status rocsolver_convergence_stats_set(rocblas_handle handle,
+                                                          rocsolver_convergence_stats* stats,
+                                                          const rocblas_int size);
+};
+
+/** CONVERGENCE_RECORD writes the statistics of instance bid of the batch, if there is a
+    buffer for them **/
+__device__ inline void convergence_record(rocsolver_convergence_stats* stats,
+                                          const rocblas_int nstats,
+                                          const rocblas_int bid,
+                                          const rocblas_int sweeps,
+                                          const rocblas_int deflations,
+                                          const rocblas_int iterations,
+                                          const rocblas_int max_iterations,
+                                          const bool converged)
+{
+    if(stats && bid < nstats)
+    {
+        stats[bid].sweeps = sweeps;
+        stats[bid].deflations = deflations;
+        stats[bid].iterations = iterations;
+        stats[bid].max_iterations = max_iterations;
+        stats[bid].hit_limit = converged ? 0 : 1;
+    }
+}
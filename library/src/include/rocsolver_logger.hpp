@@ -7,15 +7,27 @@
 #include "common_host_helpers.hpp"
 #include "lib_host_helpers.hpp"
 #include "rocsolver.h"
+#include "rocsolver_tuning.hpp"
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <deque>
+#include <iomanip>
+#include <map>
 #include <memory>
 #include <mutex>
+#include <sstream>
 #include <unordered_map>
+#include <unordered_set>
 
 /***************************************************************************
  * rocSOLVER logging macros
  ***************************************************************************/
 
+// ROCSOLVER_ENTER_TOP also pins the tuning table for the whole call (see rocsolver_tuning_scope)
 #define ROCSOLVER_ENTER_TOP(name, ...)                                                      \
+    const rocsolver_tuning_scope _tuning_scope;                                             \
     std::unique_ptr<rocsolver_logger::scope_guard<T>> _log_token;                           \
     do                                                                                      \
     {                                                                                       \
@@ -47,20 +59,113 @@
         }                                                                                     \
     } while(0)
 
+/***************************************************************************
+ * The rocsolver_profile_shape struct records the argument signature of a
+ * function call, so that profile logging can tell apart calls on different
+ * problem sizes. Arguments that the function does not have are set to -1.
+ ***************************************************************************/
+struct rocsolver_profile_shape
+{
+    rocblas_int m;
+    rocblas_int n;
+    rocblas_int batch_count;
+    char precision;
+
+    rocsolver_profile_shape()
+        : m(-1)
+        , n(-1)
+        , batch_count(-1)
+        , precision(0)
+    {
+    }
+
+    bool empty() const
+    {
+        return m < 0 && n < 0 && batch_count < 0;
+    }
+
+    bool operator<(const rocsolver_profile_shape& other) const
+    {
+        if(precision != other.precision)
+            return precision < other.precision;
+        if(m != other.m)
+            return m < other.m;
+        if(n != other.n)
+            return n < other.n;
+        return batch_count < other.batch_count;
+    }
+};
+
+/***************************************************************************
+ * The rocsolver_profile_stats struct accumulates the execution times of
+ * the calls to a function. Percentiles are estimated from a histogram with
+ * logarithmically spaced bins, so that the memory used does not depend on
+ * the number of calls.
+ ***************************************************************************/
+struct rocsolver_profile_stats
+{
+    // bins per power of two, and number of bins (covering times up to 2^25 us)
+    static constexpr int bins_per_octave = 8;
+    static constexpr int num_bins = 25 * bins_per_octave;
+
+    int calls;
+    double time;
+    double min_time;
+    double max_time;
+    std::array<int, num_bins> histogram;
+
+    rocsolver_profile_stats()
+        : calls(0)
+        , time(0)
+        , min_time(0)
+        , max_time(0)
+    {
+        histogram.fill(0);
+    }
+
+    // adds a call that took the given time (in microseconds)
+    void add(double t)
+    {
+        min_time = (calls == 0 || t < min_time) ? t : min_time;
+        max_time = (calls == 0 || t > max_time) ? t : max_time;
+        calls++;
+        time += t;
+
+        int bin = t > 1 ? int(std::log2(t) * bins_per_octave) : 0;
+        histogram[std::min(bin, num_bins - 1)]++;
+    }
+
+    // adds the calls accumulated in other
+    void merge(const rocsolver_profile_stats& other);
+
+    // returns an estimate of the given percentile (between 0 and 100) of the execution times
+    double percentile(double p) const;
+};
+
 /***************************************************************************
  * The rocsolver_log_entry struct records function data for trace and
  * profile logging purposes.
  ***************************************************************************/
 struct rocsolver_log_entry
 {
-    std::vector<std::string> callers;
-    std::string name;
+    // interned function name
+    const std::string* name;
     int level;
-    double start_time;
+    // event recorded on the stream upon entering the function, and argument signature; set
+    // only if profile logging is enabled
+    hipEvent_t start_event;
+    rocsolver_profile_shape shape;
+    // whether trace and timeline logging were enabled upon entering the function, so that the
+    // output upon exiting it matches, even if the layer mode was changed meanwhile
+    bool trace;
+    bool timeline;
 
     rocsolver_log_entry()
-        : level(0)
-        , start_time(0)
+        : name(nullptr)
+        , level(0)
+        , start_event(nullptr)
+        , trace(false)
+        , timeline(false)
     {
     }
 
@@ -76,20 +181,18 @@ struct rocsolver_log_entry
  * logging purposes.
  ***************************************************************************/
 struct rocsolver_profile_entry;
-using rocsolver_profile_map = std::unordered_map<std::string, rocsolver_profile_entry>;
+using rocsolver_profile_map = std::unordered_map<const std::string*, rocsolver_profile_entry>;
 
 struct rocsolver_profile_entry
 {
-    std::string name;
     int level;
-    int calls;
-    double time;
+    // statistics of all the calls, and of the calls with each argument signature
+    rocsolver_profile_stats stats;
+    std::map<rocsolver_profile_shape, rocsolver_profile_stats> shapes;
     std::unique_ptr<rocsolver_profile_map> internal_calls;
 
     rocsolver_profile_entry()
         : level(0)
-        , calls(0)
-        , time(0)
     {
     }
 
@@ -100,6 +203,109 @@ struct rocsolver_profile_entry
     rocsolver_profile_entry(const rocsolver_profile_entry&) = delete;
 };
 
+/***************************************************************************
+ * The rocsolver_profile_pending struct records a call whose execution time
+ * is yet to be added to the profile logging data. The time is measured
+ * between two events recorded on the stream, so that it is the time spent
+ * by the device on the work enqueued by the function.
+ ***************************************************************************/
+struct rocsolver_profile_pending
+{
+    hipEvent_t start_event;
+    hipEvent_t end_event;
+    int device;
+    // statistics to be updated (the addresses of map elements are stable)
+    rocsolver_profile_stats* stats;
+    rocsolver_profile_stats* shape_stats;
+};
+
+/***************************************************************************
+ * The rocsolver_timeline_pending struct records a timeline event whose
+ * timestamp is yet to be resolved. The timestamp is taken from an event
+ * recorded on the stream, so that it marks the time at which the device
+ * reaches the work enqueued by the function, without synchronizing.
+ ***************************************************************************/
+struct rocsolver_timeline_pending
+{
+    // recorded event (or nullptr, if it could not be recorded), and its device
+    hipEvent_t event;
+    int device;
+    // host time of the call, used if the event could not be recorded
+    double host_time;
+    rocblas_handle handle;
+    // the JSON object of the event is head, followed by the timestamp and tail
+    std::string head;
+    std::string tail;
+};
+
+/***************************************************************************
+ * The rocsolver_log_thread struct holds the logging data of a host thread,
+ * so that entering and exiting functions requires no synchronization
+ * between threads.
+ ***************************************************************************/
+struct rocsolver_log_name_key
+{
+    // addresses of the string literals passed to the logging macros
+    const char* func_prefix;
+    const char* func_name;
+    // precision of a top-level function, or 0 for a template
+    char precision;
+
+    bool operator==(const rocsolver_log_name_key& other) const
+    {
+        return func_prefix == other.func_prefix && func_name == other.func_name
+            && precision == other.precision;
+    }
+};
+
+struct rocsolver_log_name_key_hash
+{
+    size_t operator()(const rocsolver_log_name_key& key) const
+    {
+        std::hash<const void*> hash;
+        return hash(key.func_prefix) ^ (hash(key.func_name) << 1) ^ size_t(key.precision);
+    }
+};
+
+struct rocsolver_log_thread
+{
+    // logging session to which the data belongs
+    uint64_t session;
+    // function call stack keyed by handle (only accessed by the thread)
+    std::unordered_map<rocblas_handle, std::vector<rocsolver_log_entry>> call_stack;
+    // number of calls that the thread has entered and not yet exited, over all the handles;
+    // read by rocsolver_log_end, which fails if another thread is within a logged call
+    std::atomic<int> depth;
+    // interned function names seen by the thread
+    std::unordered_map<rocsolver_log_name_key, const std::string*, rocsolver_log_name_key_hash>
+        names;
+    // profile logging data of the thread, merged into the logger's profile when it is written;
+    // the mutex (which also guards the timeline events) is only contended while merging
+    std::mutex profile_mutex;
+    rocsolver_profile_map profile;
+    // calls whose events have not been resolved yet, in order, and unused events by device
+    std::deque<rocsolver_profile_pending> pending;
+    std::unordered_map<int, std::vector<hipEvent_t>> events;
+    // timeline events whose timestamps have not been resolved yet, in order
+    std::deque<rocsolver_timeline_pending> timeline_pending;
+    // streams for trace and bench logging, which share the files of the logger's streams; a
+    // message is sent to the file when a line or a trace tree is complete
+    std::unique_ptr<rocsolver_ostream> trace_os;
+    std::unique_ptr<rocsolver_ostream> bench_os;
+
+    explicit rocsolver_log_thread(uint64_t session)
+        : session(session)
+        , depth(0)
+    {
+    }
+
+    // Copy constructor is deleted
+    rocsolver_log_thread(const rocsolver_log_thread&) = delete;
+
+    // Destructor
+    ~rocsolver_log_thread();
+};
+
 /***************************************************************************
  * The rocsolver_logger class provides functions to be called upon entering
  * or exiting a function that will output multi-level logging information.
@@ -109,39 +315,110 @@ class rocsolver_logger
 private:
     // static singleton instance
     static rocsolver_logger* _instance;
-    // static mutex for multithreading
+    // static mutex for the logging session and the data shared by all threads
     static std::mutex _mutex;
-    // profile logging data keyed by function name
+    // number of logging sessions begun so far
+    static uint64_t _sessions;
+    // identifier of this logging session
+    uint64_t session;
+    // interned function names (the addresses of the elements of a node-based set are stable)
+    std::unordered_set<std::string> names;
+    // logging data of every thread that has logged in this session
+    std::vector<std::shared_ptr<rocsolver_log_thread>> threads;
+    // profile logging data keyed by function name, merged from the threads
     rocsolver_profile_map profile;
-    // function call stack keyed by handle
-    std::unordered_map<rocblas_handle, std::vector<rocsolver_log_entry>> call_stack;
     // the maximum depth at which nested function calls will appear in the log
-    int max_levels;
+    std::atomic<int> max_levels;
     // layer mode enum describing which logging facilities are enabled
-    rocblas_layer_mode_flags layer_mode;
-    // streams for different logging types
+    std::atomic<rocblas_layer_mode_flags> layer_mode;
+    // streams for different logging types (the threads write trace and bench logging to
+    // duplicates of trace_os and bench_os)
     std::unique_ptr<rocsolver_ostream> trace_os;
     std::unique_ptr<rocsolver_ostream> bench_os;
     std::unique_ptr<rocsolver_ostream> profile_os;
-
-    // returns a unique_ptr to a file stream or a given default stream
-    std::unique_ptr<rocsolver_ostream> open_log_stream(const char* environment_variable_name);
+    std::unique_ptr<rocsolver_ostream> timeline_os;
+    // time origin of the timeline events, and thread id of the timeline of each handle
+    double timeline_origin;
+    std::unordered_map<rocblas_handle, int> timeline_tids;
+    // an event of each device and the host time at which it completed, which relate the
+    // events of the timeline to the host clock (guarded by timeline_mutex)
+    std::mutex timeline_mutex;
+    std::unordered_map<int, std::pair<hipEvent_t, double>> timeline_origins;
+
+    // returns a unique_ptr to a file stream or a given default stream; the output of an
+    // asynchronous stream is written in the background, and may be dropped if it cannot keep up
+    std::unique_ptr<rocsolver_ostream> open_log_stream(const char* environment_variable_name,
+                                                       bool async);
+    // writes the number of messages dropped from the log files since they were last reported,
+    // and waits for all the data sent to the files to be written
+    void close_log_streams();
+
+    // returns the logging data of the calling thread, which is created upon its first use in
+    // a logging session
+    rocsolver_log_thread& thread_data();
+
+    // returns the interned name of a function
+    const std::string* intern_name(rocsolver_log_thread& data,
+                                   const char* func_prefix,
+                                   const char* func_name,
+                                   char precision);
 
     // returns a log entry on the call stack
-    rocsolver_log_entry& push_log_entry(rocblas_handle handle, std::string&& name);
-    rocsolver_log_entry& peek_log_entry(rocblas_handle handle);
-    rocsolver_log_entry pop_log_entry(rocblas_handle handle);
-
+    rocsolver_log_entry& push_log_entry(rocsolver_log_thread& data,
+                                        rocblas_handle handle,
+                                        const std::string* name);
+    rocsolver_log_entry pop_log_entry(rocsolver_log_thread& data, rocblas_handle handle);
+
+    // maximum number of pending calls of a thread before their events are waited for
+    static constexpr size_t max_pending_events = 4096;
+
+    // records an event on the given stream, taking it from the pool of unused events of the
+    // thread (requires data.profile_mutex); returns nullptr if the event cannot be recorded
+    static hipEvent_t record_profile_event(rocsolver_log_thread& data, hipStream_t stream);
+    // adds the times of the pending calls of a thread to its profile logging data, and returns
+    // their events to the pool (requires data.profile_mutex); if wait is false, it stops at the
+    // first call whose events have not completed yet
+    static void resolve_profile_events(rocsolver_log_thread& data, bool wait);
+
+    // moves the profile logging data of all the threads into profile
+    void merge_profiles();
+
+    // records the origin of the timeline of a device, if it has not been recorded yet;
+    // returns false if it cannot be recorded
+    bool init_timeline_origin(int device);
+    // adds an event to the timeline of the calling thread, with a timestamp recorded on the
+    // stream of handle
+    void add_timeline_event(rocsolver_log_thread& data,
+                            rocblas_handle handle,
+                            std::string head,
+                            std::string tail);
+    // resolves the timestamps of the pending timeline events of a thread, appends the completed
+    // events to done, and returns their events to the pool (requires data.profile_mutex); if
+    // wait is false, it stops at the first event that has not completed yet
+    void resolve_timeline_events(rocsolver_log_thread& data,
+                                 bool wait,
+                                 std::vector<std::pair<rocblas_handle, std::string>>& done);
+    // writes the completed timeline events of the calling thread, without waiting for the others
+    void write_timeline_events(rocsolver_log_thread& data);
+    // writes an event to the timeline log, which is opened upon the first event (requires
+    // _mutex); the given event has all the members of the JSON object except for the process
+    // and thread ids (which identify the handle), and the closing brace
+    void write_timeline_event(rocblas_handle handle, const std::string& event);
+    // waits for the pending timeline events of all the threads, writes them, and closes the
+    // timeline log, if it was opened (requires _mutex)
+    void close_timeline();
+
+    // prints the statistics of profile logging
+    void write_profile_stats(const rocsolver_profile_stats& stats);
     // prints the results of profile logging
     void write_profile(rocsolver_profile_map::iterator start, rocsolver_profile_map::iterator end);
 
     // combines a function prefix and name into an std::string
-    template <typename T>
-    std::string get_func_name(const char* func_prefix, const char* func_name)
+    std::string get_func_name(const char* func_prefix, char precision, const char* func_name)
     {
         std::string result(func_prefix);
         result += '_';
-        result += rocblas2char_precision<T>;
+        result += precision;
         result += func_name;
         return result;
     }
@@ -156,55 +433,157 @@ private:
 
     // outputs bench logging
     template <typename T, typename... Ts>
-    void log_bench(int level, const char* func_prefix, const char* func_name, Ts... args)
+    void log_bench(rocsolver_ostream& os,
+                   const char* func_prefix,
+                   const char* func_name,
+                   Ts... args)
     {
-        *bench_os << "./rocsolver-bench -f " << func_name << " -r "
-                  << rocblas2char_precision<T> << ' ';
-        print_pairs(*bench_os, " ", args...);
-        *bench_os << std::endl;
+        os << "./rocsolver-bench -f " << func_name << " -r " << rocblas2char_precision<T> << ' ';
+        print_pairs(os, " ", args...);
+        os << std::endl;
     }
 
     // outputs trace logging
     template <typename T, typename... Ts>
-    void log_trace(int level, const char* func_prefix, const char* func_name, Ts... args)
+    void log_trace(rocsolver_ostream& os,
+                   int level,
+                   const char* func_prefix,
+                   const char* func_name,
+                   Ts... args)
     {
         for(int i = 0; i < level - 1; i++)
-            *trace_os << "    ";
+            os << "    ";
 
-        *trace_os << get_template_name(func_prefix, func_name) << " (";
-        print_pairs(*trace_os, ", ", args...);
-        *trace_os << ')' << '\n';
+        os << get_template_name(func_prefix, func_name) << " (";
+        print_pairs(os, ", ", args...);
+        os << ')' << '\n';
     }
 
-    // populates profile logging data with information from call_stack
+    // extracts the argument signature of a function from its arguments (as passed to the logging
+    // macros, the names of the arguments may be decorated with leading dashes or a trailing colon)
+    static void get_profile_shape(rocsolver_profile_shape& shape) {}
+    template <typename T1, typename T2, typename... Ts>
+    static void
+        get_profile_shape(rocsolver_profile_shape& shape, T1 arg_name, T2 arg_value, Ts... args)
+    {
+        set_profile_shape(shape, arg_name, arg_value);
+        get_profile_shape(shape, args...);
+    }
+    template <typename T, std::enable_if_t<!std::is_integral<T>{}, int> = 0>
+    static void set_profile_shape(rocsolver_profile_shape& shape, const char* arg_name, T arg_value)
+    {
+    }
+    template <typename T, std::enable_if_t<std::is_integral<T>{}, int> = 0>
+    static void set_profile_shape(rocsolver_profile_shape& shape, const char* arg_name, T arg_value)
+    {
+        while(*arg_name == '-')
+            arg_name++;
+        size_t len = std::strcspn(arg_name, ":");
+
+        if(len == 1 && arg_name[0] == 'm')
+            shape.m = arg_value;
+        else if(len == 1 && arg_name[0] == 'n')
+            shape.n = arg_value;
+        else if((len == 2 && !std::strncmp(arg_name, "bc", 2))
+                || (len == 11 && !std::strncmp(arg_name, "batch_count", 11)))
+            shape.batch_count = arg_value;
+    }
+
+    // outputs the arguments of a function as the members of a JSON object
+    static void print_json_args(std::ostream& os, bool first) {}
+    template <typename T1, typename T2, typename... Ts>
+    static void print_json_args(std::ostream& os, bool first, T1 arg_name, T2 arg_value, Ts... args)
+    {
+        std::string key(arg_name);
+        key.erase(0, key.find_first_not_of('-'));
+        rocsolver_ostream value;
+        value << arg_value;
+
+        os << (first ? "" : ", ") << '"' << key << "\": \"" << value.str() << '"';
+        print_json_args(os, false, args...);
+    }
+
+    // outputs timeline logging: a duration event in Chrome trace format begins when the device
+    // reaches the work enqueued by a function, and ends when it completes it (the timestamps are
+    // recorded as events on the stream, and written once they have completed)
+    template <typename... Ts>
+    void log_timeline_begin(rocsolver_log_thread& data,
+                            rocblas_handle handle,
+                            const std::string& name,
+                            const char* func_prefix,
+                            int level,
+                            Ts... args)
+    {
+        hipStream_t stream;
+        rocblas_get_stream(handle, &stream);
+
+        std::ostringstream head, tail;
+        head << "{\"name\": \"" << name << "\", \"cat\": \"" << func_prefix
+             << "\", \"ph\": \"B\", \"ts\": ";
+        tail << ", \"args\": {\"level\": " << level << ", \"stream\": \"" << stream << '"';
+        print_json_args(tail, false, args...);
+        tail << "}";
+        add_timeline_event(data, handle, head.str(), tail.str());
+    }
+    void log_timeline_end(rocsolver_log_thread& data, rocblas_handle handle)
+    {
+        add_timeline_event(data, handle, "{\"ph\": \"E\", \"ts\": ", "");
+        write_timeline_events(data);
+    }
+
+    // records the start event of profile logging for an entry pushed onto the call stack
+    void log_profile_begin(rocsolver_log_thread& data,
+                           rocblas_handle handle,
+                           rocsolver_log_entry& from_stack)
+    {
+        hipStream_t stream;
+        rocblas_get_stream(handle, &stream);
+
+        const std::lock_guard<std::mutex> lock(data.profile_mutex);
+        from_stack.start_event = record_profile_event(data, stream);
+    }
+
+    // populates profile logging data with the information of an entry popped from the call
+    // stack (the remaining entries, but the top-level one, are its callers); the execution
+    // time of the call is added once its end event has completed, so that the stream is not
+    // synchronized
     template <typename T>
-    void log_profile(rocblas_handle handle, rocsolver_log_entry& from_stack)
+    void log_profile(rocsolver_log_thread& data,
+                     rocblas_handle handle,
+                     const rocsolver_log_entry& from_stack)
     {
         hipStream_t stream;
         rocblas_get_stream(handle, &stream);
-        double time = get_time_us_sync(stream) - from_stack.start_time;
 
-        const std::lock_guard<std::mutex> lock(rocsolver_logger::_mutex);
+        const std::vector<rocsolver_log_entry>& stack = data.call_stack[handle];
+        const std::lock_guard<std::mutex> lock(data.profile_mutex);
 
-        rocsolver_profile_map* map = &profile;
-        for(const std::string& caller_name : from_stack.callers)
+        int device;
+        hipEvent_t end_event = record_profile_event(data, stream);
+        if(!end_event || hipGetDevice(&device) != hipSuccess)
         {
-            rocsolver_profile_entry& entry = (*map)[caller_name];
+            (void)hipEventDestroy(from_stack.start_event);
+            if(end_event)
+                (void)hipEventDestroy(end_event);
+            return;
+        }
+
+        rocsolver_profile_map* map = &data.profile;
+        for(size_t i = 1; i < stack.size(); i++)
+        {
+            rocsolver_profile_entry& entry = (*map)[stack[i].name];
             if(!entry.internal_calls)
                 entry.internal_calls = std::make_unique<rocsolver_profile_map>();
             map = entry.internal_calls.get();
         }
 
         rocsolver_profile_entry& from_profile = (*map)[from_stack.name];
-        from_profile.name = from_stack.name;
         from_profile.level = from_stack.level;
-        from_profile.calls++;
-        from_profile.time += time;
-    }
+        data.pending.push_back({from_stack.start_event, end_event, device, &from_profile.stats,
+                                &from_profile.shapes[from_stack.shape]});
 
-    static std::unique_lock<std::mutex> acquire_lock()
-    {
-        return std::unique_lock<std::mutex>(rocsolver_logger::_mutex);
+        // the events of earlier calls have usually completed by now
+        resolve_profile_events(data, data.pending.size() > max_pending_events);
     }
 
 public:
@@ -220,7 +599,7 @@ public:
         return (rocsolver_logger::_instance != nullptr)
             && (rocsolver_logger::_instance->layer_mode
                 & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
-                   | rocblas_layer_mode_log_profile));
+                   | rocblas_layer_mode_log_profile | rocsolver_layer_mode_log_timeline));
     }
 
     // logging function to be called upon entering a top-level (i.e. impl) function
@@ -230,63 +609,110 @@ public:
                              const char* func_name,
                              Ts... args)
     {
-        auto lock = acquire_lock();
-        auto entry = push_log_entry(handle, get_func_name<T>(func_prefix, func_name));
-        bool bench_enabled = layer_mode & rocblas_layer_mode_log_bench;
-        bool trace_enabled = layer_mode & rocblas_layer_mode_log_trace;
-        lock.unlock();
+        rocsolver_log_thread& data = thread_data();
+        rocsolver_log_entry& entry = push_log_entry(
+            data, handle, intern_name(data, func_prefix, func_name, rocblas2char_precision<T>));
+        rocblas_layer_mode_flags mode = layer_mode;
+        bool bench_enabled = mode & rocblas_layer_mode_log_bench;
+        bool trace_enabled = mode & rocblas_layer_mode_log_trace;
+        bool profile_enabled = mode & rocblas_layer_mode_log_profile;
+        bool timeline_enabled = mode & rocsolver_layer_mode_log_timeline;
         ROCSOLVER_ASSUME(entry.level == 0);
+        entry.trace = trace_enabled;
+        entry.timeline = timeline_enabled;
+
+        if(profile_enabled)
+        {
+            entry.shape.precision = rocblas2char_precision<T>;
+            get_profile_shape(entry.shape, args...);
+        }
 
         if(bench_enabled)
-            log_bench<T>(entry.level, func_prefix, func_name, args...);
+            log_bench<T>(*data.bench_os, func_prefix, func_name, args...);
 
         if(trace_enabled)
-            *trace_os << "------- ENTER " << entry.name << " trace tree"
-                      << " -------\n";
+            *data.trace_os << "------- ENTER " << *entry.name << " trace tree"
+                           << " -------\n";
+
+        if(timeline_enabled)
+            log_timeline_begin(data, handle, *entry.name, func_prefix, entry.level, args...);
     }
 
     // logging function to be called before exiting a top-level (i.e. impl) function
     template <typename T>
     void log_exit_top_level(rocblas_handle handle)
     {
-        auto lock = acquire_lock();
-        auto entry = pop_log_entry(handle);
-        bool trace_enabled = layer_mode & rocblas_layer_mode_log_trace;
-        lock.unlock();
+        rocsolver_log_thread& data = thread_data();
+        rocsolver_log_entry entry = pop_log_entry(data, handle);
         ROCSOLVER_ASSUME(entry.level == 0);
 
-        if(trace_enabled)
-            *trace_os << "------- EXIT " << entry.name << " trace tree"
-                      << " -------\n"
-                      << std::endl;
+        if(entry.timeline)
+            log_timeline_end(data, handle);
+
+        if(entry.trace)
+            *data.trace_os << "------- EXIT " << *entry.name << " trace tree"
+                           << " -------\n"
+                           << std::endl;
+
+        // the call is completed once the logger is no longer used
+        data.depth--;
     }
 
     // logging function to be called upon entering a sub-level (i.e. template) function
     template <typename T, typename... Ts>
     void log_enter(rocblas_handle handle, const char* func_prefix, const char* func_name, Ts... args)
     {
-        auto lock = acquire_lock();
-        auto entry = push_log_entry(handle, get_template_name(func_prefix, func_name));
-        bool trace_enabled = layer_mode & rocblas_layer_mode_log_trace && entry.level <= max_levels;
-        lock.unlock();
+        rocsolver_log_thread& data = thread_data();
+        rocsolver_log_entry& entry
+            = push_log_entry(data, handle, intern_name(data, func_prefix, func_name, 0));
+        rocblas_layer_mode_flags mode = layer_mode;
+        bool trace_enabled = mode & rocblas_layer_mode_log_trace && entry.level <= max_levels;
+        bool profile_enabled = mode & rocblas_layer_mode_log_profile;
+        bool timeline_enabled
+            = mode & rocsolver_layer_mode_log_timeline && entry.level <= max_levels;
+        entry.trace = trace_enabled;
+        entry.timeline = timeline_enabled;
+
+        if(profile_enabled)
+        {
+            entry.shape.precision = rocblas2char_precision<T>;
+            get_profile_shape(entry.shape, args...);
+            log_profile_begin(data, handle, entry);
+        }
 
         if(trace_enabled)
-            log_trace<T>(entry.level, func_prefix, func_name, args...);
+            log_trace<T>(*data.trace_os, entry.level, func_prefix, func_name, args...);
+
+        if(timeline_enabled)
+            log_timeline_begin(data, handle, *entry.name, func_prefix, entry.level, args...);
     }
 
     // logging function to be called before exiting a sub-level (i.e. template) function
     template <typename T>
     void log_exit(rocblas_handle handle)
     {
-        auto lock = acquire_lock();
-        auto entry = pop_log_entry(handle);
-        bool profile_enabled = layer_mode & rocblas_layer_mode_log_profile;
-        lock.unlock();
+        rocsolver_log_thread& data = thread_data();
+        rocsolver_log_entry entry = pop_log_entry(data, handle);
 
-        if(profile_enabled)
-            log_profile<T>(handle, entry);
+        // the profile and timeline logging of a call are completed even if they were disabled
+        // in the meantime
+        if(entry.start_event)
+            log_profile<T>(data, handle, entry);
+
+        if(entry.timeline)
+            log_timeline_end(data, handle);
+
+        // the call is completed once the logger is no longer used
+        data.depth--;
     }
 
+    // logging function to be called after launching an iterative solver that wrote convergence
+    // statistics for count instances of the batch; it summarizes them in the trace log
+    void log_convergence(rocblas_handle handle,
+                         const char* func_name,
+                         const rocsolver_convergence_stats* stats,
+                         rocblas_int count);
+
     /***************************************************************************
      * The scope_guard struct will call an appropriate logging exit function
      * upon the function losing scope.
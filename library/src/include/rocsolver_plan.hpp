@@ -0,0 +1,103 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocsolver.h"
+#include "rocsolver_tuning.hpp"
+
+/***************************************************************************
+ * Helpers for the workspace planner functions (rocsolver_plan_<function>).
+ * The planners evaluate the getMemorySize templates of a function on the
+ * host, without a handle or a device.
+ ***************************************************************************/
+
+// rocBLAS rounds each workspace buffer up to a multiple of this size
+constexpr size_t rocsolver_plan_chunk_size = 64;
+
+// checks the arguments common to all the planner functions
+inline rocblas_status rocsolver_plan_argCheck(const rocblas_datatype type,
+                                              const rocsolver_batch_mode mode,
+                                              const rocblas_int m,
+                                              const rocblas_int n,
+                                              const rocblas_int batch_count,
+                                              rocsolver_workspace_plan* plan)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(type != rocblas_datatype_f32_r && type != rocblas_datatype_f64_r
+       && type != rocblas_datatype_f32_c && type != rocblas_datatype_f64_c)
+        return rocblas_status_invalid_value;
+    if(mode != rocsolver_batch_none && mode != rocsolver_batch_pointers
+       && mode != rocsolver_batch_strided)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(m < 0 || n < 0 || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // 3. invalid pointers
+    if(!plan)
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+// returns true if the function would return immediately
+inline bool rocsolver_plan_quick_return(const rocsolver_batch_mode mode,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        const rocblas_int batch_count)
+{
+    return m == 0 || n == 0 || (mode != rocsolver_batch_none && batch_count == 0);
+}
+
+// initializes an empty plan
+inline void rocsolver_plan_init(rocsolver_workspace_plan* plan)
+{
+    *plan = rocsolver_workspace_plan{};
+    plan->algorithm = "none";
+}
+
+// checks the arguments, initializes the plan, and calls f with a value of the precision
+// given by type (with the tuning table pinned for the whole plan)
+template <typename F>
+rocblas_status rocsolver_plan_template(const rocblas_datatype type,
+                                       const rocsolver_batch_mode mode,
+                                       const rocblas_int m,
+                                       const rocblas_int n,
+                                       const rocblas_int batch_count,
+                                       rocsolver_workspace_plan* plan,
+                                       F f)
+{
+    rocblas_status st = rocsolver_plan_argCheck(type, mode, m, n, batch_count, plan);
+    if(st != rocblas_status_continue)
+        return st;
+
+    rocsolver_plan_init(plan);
+
+    const rocsolver_tuning_scope tuning_scope;
+    switch(type)
+    {
+    case rocblas_datatype_f32_r: f(float{}); break;
+    case rocblas_datatype_f64_r: f(double{}); break;
+    case rocblas_datatype_f32_c: f(rocblas_float_complex{}); break;
+    case rocblas_datatype_f64_c: f(rocblas_double_complex{}); break;
+    default: break;
+    }
+
+    return rocblas_status_success;
+}
+
+// adds a workspace buffer to the plan
+inline void rocsolver_plan_add(rocsolver_workspace_plan* plan, const char* name, const size_t size)
+{
+    plan->buffer_names[plan->num_buffers] = name;
+    plan->buffer_sizes[plan->num_buffers] = size;
+    plan->num_buffers++;
+
+    const size_t chunk = rocsolver_plan_chunk_size;
+    plan->size_total += (size + chunk - 1) / chunk * chunk;
+}
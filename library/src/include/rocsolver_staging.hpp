@@ -0,0 +1,123 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocsolver.h"
+#include <atomic>
+#include <functional>
+#include <hip/hip_runtime.h>
+#include <mutex>
+#include <unordered_map>
+
+/***************************************************************************
+ * A batch of arrays in host memory that is staged to the device by the
+ * rocsolver_staging_pool. Sizes and strides are in elements.
+ ***************************************************************************/
+struct rocsolver_staged_array
+{
+    void* host; // first instance of the batch, in host memory
+    size_t elem_size; // size of an element in bytes
+    size_t count; // elements of an instance that are transferred
+    size_t host_stride; // from one instance to the next in host memory
+    size_t stage_stride; // from one instance to the next in the staging buffers
+    bool in; // copied to the device before the computation
+    bool out; // copied back to host memory after the computation
+};
+
+/***************************************************************************
+ * The rocsolver_staging_pool class runs the functions that take batches in
+ * host memory (e.g. rocsolver_dgetrf_strided_batched_host). The batch is
+ * split in consecutive sub-batches that are pipelined through a few pinned
+ * host buffers and their device counterparts: while a sub-batch is computed
+ * on the handle's stream, the next one is copied to the device, and the
+ * previous one is copied back, on two separate copy streams. The buffers
+ * and streams are kept by the staging pool attached to the handle (see
+ * rocsolver_staging_pool_create) or, if there is none, created for the call.
+ *
+ * As with the workspace pools, staging pools are identified by the address
+ * of their handle. A handle destroyed without destroying its pool leaks the
+ * buffers; if a new handle is created at the same address on another device,
+ * the stale pool is detected and released by find.
+ ***************************************************************************/
+class rocsolver_staging_pool
+{
+public:
+    // computes a sub-batch of count instances, given the device addresses of the staged
+    // arrays (in the order they were passed to run)
+    using launcher = std::function<rocblas_status(void* const* arrays, rocblas_int count)>;
+
+    // number of staging buffers, i.e. sub-batches in flight
+    static constexpr int num_slots = 3;
+    // default size of each staging buffer
+    static constexpr size_t default_buffer_size = size_t(32) << 20;
+    // alignment of the arrays in the staging buffers
+    static constexpr size_t alignment = 256;
+
+    // the number of instances of the sub-batches used by run for the given arrays
+    static rocblas_int chunk_size(rocblas_handle handle,
+                                  const rocsolver_staged_array* arrays,
+                                  const int narrays,
+                                  const rocblas_int batch_count);
+
+    // copies the batch_count instances of arrays from host memory, calls launch for each
+    // sub-batch and copies the results back; returns when the results are in host memory
+    static rocblas_status run(rocblas_handle handle,
+                              const rocblas_int batch_count,
+                              const rocsolver_staged_array* arrays,
+                              const int narrays,
+                              const launcher& launch);
+
+private:
+    // a staging buffer and the events that order its uses
+    struct slot
+    {
+        void* host = nullptr;
+        void* device = nullptr;
+        size_t size = 0;
+        hipEvent_t h2d = nullptr, done = nullptr, d2h = nullptr;
+        rocblas_int first = 0, count = 0; // the sub-batch in the buffer
+    };
+
+    // the state of the staging pool attached to a handle
+    struct pool
+    {
+        size_t buffer_size = default_buffer_size;
+        // the device of the handle
+        int device = 0;
+        hipStream_t h2d_stream = nullptr, d2h_stream = nullptr;
+        slot slots[num_slots];
+        bool in_use = false;
+    };
+
+    // returns the pool attached to handle, or nullptr if there is none; a pool of another
+    // device, left by a destroyed handle with the same address, is released (requires _mutex)
+    static pool* find(rocblas_handle handle);
+
+    // creates the streams and events of p
+    static rocblas_status init(pool& p);
+    // frees the buffers, events and streams of p
+    static void release(pool& p);
+    // makes all the buffers of p at least bytes long
+    static rocblas_status reserve(pool& p, size_t bytes);
+    // the pipeline of run, using p
+    static rocblas_status pipeline(pool& p,
+                                   hipStream_t stream,
+                                   const rocblas_int batch_count,
+                                   const rocblas_int chunk,
+                                   const rocsolver_staged_array* arrays,
+                                   const int narrays,
+                                   const launcher& launch);
+
+    // static mutex for multithreading
+    static std::mutex _mutex;
+    // the pools, by handle
+    static std::unordered_map<rocblas_handle, pool> _pools;
+    // number of attached pools; allows skipping the lookup when pools are not used
+    static std::atomic<size_t> _active;
+
+    friend rocblas_status rocsolver_staging_pool_create(rocblas_handle handle,
+                                                        const size_t buffer_size);
+    friend rocblas_status rocsolver_staging_pool_destroy(rocblas_handle handle);
+};
@@ -0,0 +1,190 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "ideal_sizes.hpp"
+#include "lib_host_helpers.hpp"
+#include "rocsolver.h"
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/***************************************************************************
+ * The rocsolver_tuning_table struct holds the block sizes and switch sizes
+ * that drive the blocking decisions of the library. It is initialized with
+ * the built-in defaults from ideal_sizes.hpp and can be overridden at runtime
+ * by a tuning file (see rocsolver_tuning_load).
+ ***************************************************************************/
+struct rocsolver_tuning_table
+{
+    // getrf
+    std::vector<rocblas_int> getrf_intervals{GETRF_INTERVALS};
+    std::vector<rocblas_int> getrf_blksizes{GETRF_BLKSIZES};
+    std::vector<rocblas_int> getrf_batch_intervals{GETRF_BATCH_INTERVALS};
+    std::vector<rocblas_int> getrf_batch_blksizes{GETRF_BATCH_BLKSIZES};
+    std::vector<rocblas_int> getrf_npvt_intervals{GETRF_NPVT_INTERVALS};
+    std::vector<rocblas_int> getrf_npvt_blksizes{GETRF_NPVT_BLKSIZES};
+    std::vector<rocblas_int> getrf_npvt_batch_intervals{GETRF_NPVT_BATCH_INTERVALS};
+    std::vector<rocblas_int> getrf_npvt_batch_blksizes{GETRF_NPVT_BATCH_BLKSIZES};
+    rocblas_int getrf_recursive_min_size = GETRF_RECURSIVE_MIN_SIZE;
+    rocblas_int getrf_recursive_max_size = GETRF_RECURSIVE_MAX_SIZE;
+    rocblas_int getrf_left_looking_ratio = GETRF_LEFT_LOOKING_RATIO;
+    rocblas_int getrf_tournament_switchsize = GETRF_TOURNAMENT_SWITCHSIZE;
+    rocblas_int getrf_tournament_tile_rows = GETRF_TOURNAMENT_TILE_ROWS;
+
+    // getri
+    rocblas_int getri_tiny_size = GETRI_TINY_SIZE;
+    std::vector<rocblas_int> getri_intervals{GETRI_INTERVALS};
+    std::vector<rocblas_int> getri_blksizes{GETRI_BLKSIZES};
+    rocblas_int getri_batch_tiny_size = GETRI_BATCH_TINY_SIZE;
+    std::vector<rocblas_int> getri_batch_intervals{GETRI_BATCH_INTERVALS};
+    std::vector<rocblas_int> getri_batch_blksizes{GETRI_BATCH_BLKSIZES};
+
+    // trtri
+    std::vector<rocblas_int> trtri_intervals{TRTRI_INTERVALS};
+    std::vector<rocblas_int> trtri_blksizes{TRTRI_BLKSIZES};
+    std::vector<rocblas_int> trtri_batch_intervals{TRTRI_BATCH_INTERVALS};
+    std::vector<rocblas_int> trtri_batch_blksizes{TRTRI_BATCH_BLKSIZES};
+
+    // potf2/potrf
+    rocblas_int potrf_potf2_switchsize = POTRF_POTF2_SWITCHSIZE;
+
+    // geqx2/geqxf
+    rocblas_int geqxf_geqx2_switchsize = GEQxF_GEQx2_SWITCHSIZE;
+    rocblas_int geqxf_geqx2_blocksize = GEQxF_GEQx2_BLOCKSIZE;
+
+    // tsqr
+    rocblas_int geqrf_tsqr_switchsize = GEQRF_TSQR_SWITCHSIZE;
+
+    // geqp3
+    rocblas_int geqp3_blocksize = GEQP3_BLOCKSIZE;
+
+    // gexq2/gexqf
+    rocblas_int gexqf_gexq2_switchsize = GExQF_GExQ2_SWITCHSIZE;
+    rocblas_int gexqf_gexq2_blocksize = GExQF_GExQ2_BLOCKSIZE;
+
+    // gebd2/gebrd
+    rocblas_int gebrd_gebd2_switchsize = GEBRD_GEBD2_SWITCHSIZE;
+
+    // xxtd2/xxtrd
+    rocblas_int xxtrd_xxtd2_blocksize = xxTRD_xxTD2_BLOCKSIZE;
+    rocblas_int xxtrd_xxtd2_switchsize = xxTRD_xxTD2_SWITCHSIZE;
+
+    // xxgs2/xxgst
+    rocblas_int xxgst_xxgs2_blocksize = xxGST_xxGS2_BLOCKSIZE;
+
+    // orgxx/ungxx
+    rocblas_int orgxx_ungxx_switchsize = ORGxx_UNGxx_SWITCHSIZE;
+    rocblas_int orgxx_ungxx_blocksize = ORGxx_UNGxx_BLOCKSIZE;
+
+    // ormxx/unmxx
+    rocblas_int ormxx_unmxx_blocksize = ORMxx_ORMxx_BLOCKSIZE;
+
+    // gesvd
+    double thin_svd_switch = THIN_SVD_SWITCH;
+
+    // stedc
+    rocblas_int stedc_min_dc_size = STEDC_MIN_DC_SIZE;
+
+    // returns the block size in blksizes corresponding to the interval that contains dim
+    static rocblas_int get_blksize(const std::vector<rocblas_int>& intervals,
+                                   const std::vector<rocblas_int>& blksizes,
+                                   const rocblas_int dim)
+    {
+        return blksizes[get_index(intervals.data(), rocblas_int(intervals.size()), dim)];
+    }
+};
+
+/***************************************************************************
+ * The rocsolver_tuning class manages the process-wide tuning table. On first
+ * use, the table is loaded from the file given by the environment variable
+ * ROCSOLVER_TUNING_PATH (if set); otherwise the built-in defaults are used.
+ *
+ * Loading a new table never modifies the previous one: a call to a rocSOLVER
+ * function keeps using the table that was active when it started (see
+ * rocsolver_tuning_scope).
+ ***************************************************************************/
+class rocsolver_tuning
+{
+private:
+    // static mutex for the initialization and the replacement of the table
+    static std::mutex _mutex;
+    // the active table (never null once initialized; accessed atomically)
+    static std::shared_ptr<const rocsolver_tuning_table> _table;
+    // true once the environment has been consulted
+    static std::atomic<bool> _initialized;
+    // the table pinned to the calling thread by a rocsolver_tuning_scope, if any
+    static thread_local std::shared_ptr<const rocsolver_tuning_table> _pinned;
+
+    // loads the table given by ROCSOLVER_TUNING_PATH, if any (requires _mutex)
+    static void initialize();
+
+    // returns the active tuning table, ignoring any pinned table
+    static std::shared_ptr<const rocsolver_tuning_table> active();
+
+    // replaces the active tuning table
+    static void replace(std::shared_ptr<const rocsolver_tuning_table> table);
+
+public:
+    // the version of the tuning file format understood by this library
+    static constexpr int file_version = 1;
+
+    // returns the tuning table pinned to the calling thread or, if there is none,
+    // the active tuning table
+    static std::shared_ptr<const rocsolver_tuning_table> get()
+    {
+        if(_pinned)
+            return _pinned;
+        return active();
+    }
+
+    // parses and validates a tuning file; on failure, returns false and sets msg
+    static bool parse(const char* path, rocsolver_tuning_table& table, std::string& msg);
+
+    // checks the consistency of a tuning table; on failure, returns false and sets msg
+    static bool validate(const rocsolver_tuning_table& table, std::string& msg);
+
+    // writes a tuning table in the format accepted by parse
+    static bool write(const char* path, const rocsolver_tuning_table& table);
+
+    friend class rocsolver_tuning_scope;
+    friend rocblas_status rocsolver_tuning_load(const char* path);
+    friend rocblas_status rocsolver_tuning_write(const char* path);
+    friend rocblas_status rocsolver_tuning_restore_defaults(void);
+};
+
+/***************************************************************************
+ * A rocsolver_tuning_scope pins the active tuning table to the calling thread
+ * for its lifetime, so that all the reads of the table made by a rocSOLVER
+ * function (in particular, by its getMemorySize function and by its template)
+ * see the same sizes, even if another thread loads a different table in the
+ * meantime. It is opened at the top-level entry of every API function (see
+ * ROCSOLVER_ENTER_TOP) and of every workspace planner. Nested scopes keep the
+ * outermost table.
+ ***************************************************************************/
+class rocsolver_tuning_scope
+{
+private:
+    bool _owner;
+
+public:
+    rocsolver_tuning_scope()
+        : _owner(!rocsolver_tuning::_pinned)
+    {
+        if(_owner)
+            rocsolver_tuning::_pinned = rocsolver_tuning::active();
+    }
+
+    ~rocsolver_tuning_scope()
+    {
+        if(_owner)
+            rocsolver_tuning::_pinned.reset();
+    }
+
+    rocsolver_tuning_scope(const rocsolver_tuning_scope&) = delete;
+    rocsolver_tuning_scope& operator=(const rocsolver_tuning_scope&) = delete;
+};
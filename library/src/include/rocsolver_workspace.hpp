@@ -0,0 +1,184 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "internal/rocblas_device_malloc.hpp"
+#include "rocsolver.h"
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <unordered_map>
+
+/***************************************************************************
+ * The rocsolver_workspace_pool class manages the optional workspace pools
+ * attached to rocBLAS handles (see rocsolver_workspace_pool_create). Each
+ * pool keeps the device blocks used by previous rocSOLVER calls, grouped by
+ * size class, so that calls with repeated problem sizes do not allocate
+ * device memory. A reused block is ordered after the work of its previous
+ * call through an event recorded when that call released it, so that blocks
+ * can be reused safely after the stream of the handle changes (even if the
+ * previous stream was destroyed).
+ *
+ * Pools are identified by the address of their handle. A handle destroyed
+ * without destroying its pool leaks the cached blocks; if a new handle is
+ * created at the same address on another device, the stale pool is detected
+ * and discarded by acquire or rocsolver_workspace_pool_create.
+ ***************************************************************************/
+class rocsolver_workspace_pool
+{
+public:
+    // a device block of the pool
+    struct block
+    {
+        void* ptr;
+        size_t size;
+        // recorded when the block is released, once the work that uses it is queued
+        hipEvent_t event;
+        // the stream of the call that uses the block
+        hipStream_t stream;
+    };
+
+    // alignment of the buffers carved from a block
+    static constexpr size_t alignment = 256;
+
+    // the size class of a block that can hold bytes
+    static size_t size_class(size_t bytes);
+
+    // takes a block of at least bytes from the pool of handle; returns false if there is
+    // no pool attached to handle (or if it was left by a destroyed handle), and sets blk.ptr
+    // to nullptr if the allocation failed
+    static bool acquire(rocblas_handle handle, size_t bytes, block& blk);
+
+    // returns a block to the pool of handle (or frees it if the pool no longer exists)
+    static void release(rocblas_handle handle, const block& blk);
+
+private:
+    // the state of the pool attached to a handle
+    struct pool
+    {
+        // cached blocks, by size
+        std::multimap<size_t, block> free_blocks;
+        // the device of the handle
+        int device = 0;
+        // statistics
+        rocsolver_workspace_pool_stats stats{};
+        // bytes currently lent to rocSOLVER calls
+        size_t in_use = 0;
+    };
+
+    // frees all the cached blocks of p (requires _mutex)
+    static void trim(pool& p);
+
+    // frees a block and its event
+    static void free_block(const block& blk);
+
+    // static mutex for multithreading
+    static std::mutex _mutex;
+    // the pools, by handle
+    static std::unordered_map<rocblas_handle, pool> _pools;
+    // number of attached pools; allows skipping the lookup when pooling is not used
+    static std::atomic<size_t> _active;
+
+    friend rocblas_status rocsolver_workspace_pool_create(rocblas_handle handle);
+    friend rocblas_status rocsolver_workspace_pool_destroy(rocblas_handle handle);
+    friend rocblas_status
+        rocsolver_workspace_pool_get_stats(rocblas_handle handle,
+                                           rocsolver_workspace_pool_stats* stats);
+};
+
+/***************************************************************************
+ * The rocsolver_device_malloc class allocates the device workspace of a
+ * rocSOLVER call. It has the same interface as rocblas_device_malloc, which
+ * is used unless a workspace pool is attached to the handle, in which case
+ * all the requested buffers are carved from a single block of the pool.
+ ***************************************************************************/
+class rocsolver_device_malloc
+{
+private:
+    static constexpr int max_buffers = 16;
+
+    rocblas_handle handle;
+    bool pooled = false;
+    bool success = false;
+    rocsolver_workspace_pool::block blk{nullptr, 0, nullptr, 0};
+    void* buffers[max_buffers];
+
+    // storage for the rocBLAS allocation, used when the handle has no pool
+    typename std::aligned_storage<sizeof(rocblas_device_malloc),
+                                  alignof(rocblas_device_malloc)>::type rb_storage;
+
+    rocblas_device_malloc& rb_mem()
+    {
+        return *reinterpret_cast<rocblas_device_malloc*>(&rb_storage);
+    }
+    const rocblas_device_malloc& rb_mem() const
+    {
+        return *reinterpret_cast<const rocblas_device_malloc*>(&rb_storage);
+    }
+
+    static size_t align(size_t bytes)
+    {
+        return (bytes + rocsolver_workspace_pool::alignment - 1)
+            / rocsolver_workspace_pool::alignment * rocsolver_workspace_pool::alignment;
+    }
+
+public:
+    template <typename... Ss>
+    explicit rocsolver_device_malloc(rocblas_handle handle, Ss... sizes)
+        : handle(handle)
+    {
+        static_assert(sizeof...(Ss) <= max_buffers, "too many workspace buffers");
+        const size_t sz[] = {size_t(sizes)...};
+
+        size_t total = 0;
+        for(size_t s : sz)
+            total += align(s);
+
+        if(total > 0 && rocsolver_workspace_pool::acquire(handle, total, blk))
+        {
+            pooled = true;
+            success = (blk.ptr != nullptr);
+            size_t offset = 0;
+            for(size_t i = 0; i < sizeof...(Ss); ++i)
+            {
+                buffers[i] = success ? static_cast<char*>(blk.ptr) + offset : nullptr;
+                offset += align(sz[i]);
+            }
+        }
+        else
+        {
+            new(&rb_storage) rocblas_device_malloc(handle, sizes...);
+            success = bool(rb_mem());
+        }
+    }
+
+    ~rocsolver_device_malloc()
+    {
+        if(!pooled)
+            rb_mem().~rocblas_device_malloc();
+        else if(blk.ptr)
+            rocsolver_workspace_pool::release(handle, blk);
+    }
+
+    rocsolver_device_malloc(const rocsolver_device_malloc&) = delete;
+    rocsolver_device_malloc& operator=(const rocsolver_device_malloc&) = delete;
+
+    explicit operator bool() const
+    {
+        return success;
+    }
+
+    bool operator!() const
+    {
+        return !success;
+    }
+
+    void* operator[](size_t i) const
+    {
+        return pooled ? buffers[i] : rb_mem()[i];
+    }
+};
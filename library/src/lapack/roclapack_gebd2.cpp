@@ -52,7 +52,7 @@ rocblas_status rocsolver_gebd2_impl(rocblas_handle handle,
 
     // memory workspace allocation
     void *scalars, *work_workArr, *Abyx_norms;
-    rocblas_device_malloc mem(handle, size_scalars, size_work_workArr, size_Abyx_norms);
+    rocsolver_device_malloc mem(handle, size_scalars, size_work_workArr, size_Abyx_norms);
 
     if(!mem)
         return rocblas_status_memory_error;
@@ -59,8 +59,8 @@ rocblas_status rocsolver_gebrd_impl(rocblas_handle handle,
 
     // memory workspace allocation
     void *scalars, *work_workArr, *Abyx_norms, *X, *Y;
-    rocblas_device_malloc mem(handle, size_scalars, size_work_workArr, size_Abyx_norms, size_X,
-                              size_Y);
+    rocsolver_device_malloc mem(handle, size_scalars, size_work_workArr, size_Abyx_norms, size_X,
+                                size_Y);
 
     if(!mem)
         return rocblas_status_memory_error;
@@ -35,7 +35,9 @@ void rocsolver_gebrd_getMemorySize(const rocblas_int m,
         return;
     }
 
-    if(m <= GEBRD_GEBD2_SWITCHSIZE || n <= GEBRD_GEBD2_SWITCHSIZE)
+    const rocblas_int nb = rocsolver_tuning::get()->gebrd_gebd2_switchsize;
+
+    if(m <= nb || n <= nb)
     {
         // requirements for calling a single GEBD2
         rocsolver_gebd2_getMemorySize<T, BATCHED>(m, n, batch_count, size_scalars,
@@ -47,7 +49,7 @@ void rocsolver_gebrd_getMemorySize(const rocblas_int m,
     else
     {
         size_t s1, s2, w1, w2, unused;
-        rocblas_int k = GEBRD_GEBD2_SWITCHSIZE;
+        rocblas_int k = nb;
         rocblas_int d = min(m / k, n / k);
 
         // sizes are maximum of what is required by GEBD2 and LABRD
@@ -107,7 +109,7 @@ rocblas_status rocsolver_gebrd_template(rocblas_handle handle,
 
     T minone = -1;
     T one = 1;
-    rocblas_int k = GEBRD_GEBD2_SWITCHSIZE;
+    rocblas_int k = rocsolver_tuning::get()->gebrd_gebd2_switchsize;
     rocblas_int dim = min(m, n); // total number of pivots
     rocblas_int jb, j = 0;
     rocblas_int blocks;
@@ -163,7 +165,7 @@ rocblas_status rocsolver_gebrd_template(rocblas_handle handle,
                                strideA, jb);
         }
 
-        j += GEBRD_GEBD2_SWITCHSIZE;
+        j += k;
     }
 
     // factor last block
@@ -39,9 +39,11 @@ rocblas_status rocsolver_gebrd_strided_batched_impl(rocblas_handle handle,
     rocblas_int shiftX = 0;
     rocblas_int shiftY = 0;
 
+    const rocblas_int nb = rocsolver_tuning::get()->gebrd_gebd2_switchsize;
+
     // strided_batched execution
-    rocblas_stride strideX = m * GEBRD_GEBD2_SWITCHSIZE;
-    rocblas_stride strideY = n * GEBRD_GEBD2_SWITCHSIZE;
+    rocblas_stride strideX = m * nb;
+    rocblas_stride strideY = n * nb;
 
     // memory workspace sizes:
     // size for constants in rocblas calls
@@ -62,8 +64,8 @@ rocblas_status rocsolver_gebrd_strided_batched_impl(rocblas_handle handle,
 
     // memory workspace allocation
     void *scalars, *work_workArr, *Abyx_norms, *X, *Y;
-    rocblas_device_malloc mem(handle, size_scalars, size_work_workArr, size_Abyx_norms, size_X,
-                              size_Y);
+    rocsolver_device_malloc mem(handle, size_scalars, size_work_workArr, size_Abyx_norms, size_X,
+                                size_Y);
 
     if(!mem)
         return rocblas_status_memory_error;
@@ -3,6 +3,7 @@
  * ************************************************************************ */
 
 #include "roclapack_gelqf.hpp"
+#include "rocsolver_plan.hpp"
 
 template <typename T, typename U>
 rocblas_status rocsolver_gelqf_impl(rocblas_handle handle,
@@ -49,8 +50,8 @@ rocblas_status rocsolver_gelqf_impl(rocblas_handle handle,
 
     // memory workspace allocation
     void *scalars, *work_workArr, *Abyx_norms_trfact, *diag_tmptr, *workArr;
-    rocblas_device_malloc mem(handle, size_scalars, size_work_workArr, size_Abyx_norms_trfact,
-                              size_diag_tmptr, size_workArr);
+    rocsolver_device_malloc mem(handle, size_scalars, size_work_workArr, size_Abyx_norms_trfact,
+                                size_diag_tmptr, size_workArr);
 
     if(!mem)
         return rocblas_status_memory_error;
@@ -69,6 +70,48 @@ rocblas_status rocsolver_gelqf_impl(rocblas_handle handle,
         work_workArr, (T*)Abyx_norms_trfact, (T*)diag_tmptr, (T**)workArr);
 }
 
+template <typename T>
+void rocsolver_gelqf_plan(const rocsolver_batch_mode mode,
+                          const rocblas_int m,
+                          const rocblas_int n,
+                          const rocblas_int batch_count,
+                          rocsolver_workspace_plan* plan)
+{
+    // normal execution works with a single matrix
+    const rocblas_int bc = (mode == rocsolver_batch_none ? 1 : batch_count);
+
+    // memory workspace sizes
+    size_t size_scalars, size_work_workArr, size_Abyx_norms_trfact, size_diag_tmptr, size_workArr;
+    if(mode == rocsolver_batch_pointers)
+        rocsolver_gelqf_getMemorySize<T, true>(m, n, bc, &size_scalars, &size_work_workArr,
+                                               &size_Abyx_norms_trfact, &size_diag_tmptr,
+                                               &size_workArr);
+    else
+        rocsolver_gelqf_getMemorySize<T, false>(m, n, bc, &size_scalars, &size_work_workArr,
+                                                &size_Abyx_norms_trfact, &size_diag_tmptr,
+                                                &size_workArr);
+
+    rocsolver_plan_add(plan, "scalars", size_scalars);
+    rocsolver_plan_add(plan, "work_workArr", size_work_workArr);
+    rocsolver_plan_add(plan, "Abyx_norms_trfact", size_Abyx_norms_trfact);
+    rocsolver_plan_add(plan, "diag_tmptr", size_diag_tmptr);
+    rocsolver_plan_add(plan, "workArr", size_workArr);
+
+    if(rocsolver_plan_quick_return(mode, m, n, batch_count))
+        return;
+
+    // small matrices are factorized with a single GELQ2
+    const rocblas_int nx = rocsolver_tuning::get()->gexqf_gexq2_switchsize;
+    const rocblas_int nb = rocsolver_tuning::get()->gexqf_gexq2_blocksize;
+    if(m <= nx || n <= nx)
+        plan->algorithm = "gelq2";
+    else
+    {
+        plan->algorithm = "gelqf";
+        plan->block_size = nb;
+    }
+}
+
 /*
  * ===========================================================================
  *    C wrapper
@@ -117,4 +160,16 @@ rocblas_status rocsolver_zgelqf(rocblas_handle handle,
     return rocsolver_gelqf_impl<rocblas_double_complex>(handle, m, n, A, lda, ipiv);
 }
 
+rocblas_status rocsolver_plan_gelqf(const rocblas_datatype type,
+                                    const rocsolver_batch_mode mode,
+                                    const rocblas_int m,
+                                    const rocblas_int n,
+                                    const rocblas_int batch_count,
+                                    rocsolver_workspace_plan* plan)
+{
+    return rocsolver_plan_template(type, mode, m, n, batch_count, plan, [&](auto t) {
+        rocsolver_gelqf_plan<decltype(t)>(mode, m, n, batch_count, plan);
+    });
+}
+
 } // extern C
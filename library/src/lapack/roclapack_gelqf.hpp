@@ -36,7 +36,10 @@ void rocsolver_gelqf_getMemorySize(const rocblas_int m,
         return;
     }
 
-    if(m <= GExQF_GExQ2_SWITCHSIZE || n <= GExQF_GExQ2_SWITCHSIZE)
+    const rocblas_int nx = rocsolver_tuning::get()->gexqf_gexq2_switchsize;
+    const rocblas_int nb = rocsolver_tuning::get()->gexqf_gexq2_blocksize;
+
+    if(m <= nx || n <= nx)
     {
         // requirements for a single GELQ2 call
         rocsolver_gelq2_getMemorySize<T, BATCHED>(m, n, batch_count, size_scalars, size_work_workArr,
@@ -46,7 +49,7 @@ void rocsolver_gelqf_getMemorySize(const rocblas_int m,
     else
     {
         size_t w1, w2, unused, s1, s2;
-        rocblas_int jb = GExQF_GExQ2_BLOCKSIZE;
+        rocblas_int jb = nb;
 
         // size to store the temporary triangular factor
         *size_Abyx_norms_trfact = sizeof(T) * jb * jb * batch_count;
@@ -98,9 +101,12 @@ rocblas_status rocsolver_gelqf_template(rocblas_handle handle,
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
+    const rocblas_int nx = rocsolver_tuning::get()->gexqf_gexq2_switchsize;
+    const rocblas_int nb = rocsolver_tuning::get()->gexqf_gexq2_blocksize;
+
     // if the matrix is small, use the unblocked (BLAS-levelII) variant of the
     // algorithm
-    if(m <= GExQF_GExQ2_SWITCHSIZE || n <= GExQF_GExQ2_SWITCHSIZE)
+    if(m <= nx || n <= nx)
         return rocsolver_gelq2_template<T>(handle, m, n, A, shiftA, lda, strideA, ipiv, strideP,
                                            batch_count, scalars, work_workArr, Abyx_norms_trfact,
                                            diag_tmptr);
@@ -108,13 +114,13 @@ rocblas_status rocsolver_gelqf_template(rocblas_handle handle,
     rocblas_int dim = min(m, n); // total number of pivots
     rocblas_int jb, j = 0;
 
-    rocblas_int ldw = GExQF_GExQ2_BLOCKSIZE;
+    rocblas_int ldw = nb;
     rocblas_stride strideW = rocblas_stride(ldw) * ldw;
 
-    while(j < dim - GExQF_GExQ2_SWITCHSIZE)
+    while(j < dim - nx)
     {
         // Factor diagonal and subdiagonal blocks
-        jb = min(dim - j, GExQF_GExQ2_BLOCKSIZE); // number of rows in the block
+        jb = min(dim - j, nb); // number of rows in the block
         rocsolver_gelq2_template<T>(handle, jb, n - j, A, shiftA + idx2D(j, j, lda), lda, strideA,
                                     (ipiv + j), strideP, batch_count, scalars, work_workArr,
                                     Abyx_norms_trfact, diag_tmptr);
@@ -135,7 +141,7 @@ rocblas_status rocsolver_gelqf_template(rocblas_handle handle,
                 Abyx_norms_trfact, 0, ldw, strideW, A, shiftA + idx2D(j + jb, j, lda), lda, strideA,
                 batch_count, diag_tmptr, workArr);
         }
-        j += GExQF_GExQ2_BLOCKSIZE;
+        j += nb;
     }
 
     // factor last block
@@ -48,8 +48,8 @@ rocblas_status rocsolver_gelqf_strided_batched_impl(rocblas_handle handle,
 
     // memory workspace allocation
     void *scalars, *work_workArr, *Abyx_norms_trfact, *diag_tmptr, *workArr;
-    rocblas_device_malloc mem(handle, size_scalars, size_work_workArr, size_Abyx_norms_trfact,
-                              size_diag_tmptr, size_workArr);
+    rocsolver_device_malloc mem(handle, size_scalars, size_work_workArr, size_Abyx_norms_trfact,
+                                size_diag_tmptr, size_workArr);
 
     if(!mem)
         return rocblas_status_memory_error;
@@ -53,8 +53,8 @@ rocblas_status rocsolver_gels_batched_impl(rocblas_handle handle,
 
     // memory workspace allocation
     void *scalars, *work, *workArr, *diag_trfac_invA, *trfact_workTrmm_invA, *ipiv;
-    rocblas_device_malloc mem(handle, size_scalars, size_work_x_temp, size_workArr_temp_arr,
-                              size_diag_trfac_invA, size_trfact_workTrmm_invA_arr, size_ipiv);
+    rocsolver_device_malloc mem(handle, size_scalars, size_work_x_temp, size_workArr_temp_arr,
+                                size_diag_trfac_invA, size_trfact_workTrmm_invA_arr, size_ipiv);
     if(!mem)
         return rocblas_status_memory_error;
 
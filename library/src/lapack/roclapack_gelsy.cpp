@@ -0,0 +1,154 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_gelsy.hpp"
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_gelsy_impl(rocblas_handle handle,
+                                    const rocblas_int m,
+                                    const rocblas_int n,
+                                    const rocblas_int nrhs,
+                                    U A,
+                                    const rocblas_int lda,
+                                    U B,
+                                    const rocblas_int ldb,
+                                    rocblas_int* jpvt,
+                                    const S rcond,
+                                    rocblas_int* rank)
+{
+    ROCSOLVER_ENTER_TOP("gelsy", "-m", m, "-n", n, "--nrhs", nrhs, "--lda", lda, "--ldb",
+                        ldb, "--rcond", rcond);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_gelsy_argCheck(handle, m, n, nrhs, A, lda, B, ldb, jpvt, rcond,
+                                                 rank);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    const rocblas_int shiftA = 0;
+    const rocblas_int shiftB = 0;
+
+    // normal (non-batched non-strided) execution
+    const rocblas_stride strideA = 0;
+    const rocblas_stride strideB = 0;
+    const rocblas_stride strideJ = 0;
+    const rocblas_int batch_count = 1;
+
+    size_t size_scalars, size_work_x_temp, size_workArr_temp_arr, size_diag_trfac_invA,
+        size_trfact_workTrmm_invA_arr, size_ipiv, size_F_savedB, size_norms;
+    rocsolver_gelsy_getMemorySize<false, false, T>(
+        m, n, nrhs, batch_count, &size_scalars, &size_work_x_temp, &size_workArr_temp_arr,
+        &size_diag_trfac_invA, &size_trfact_workTrmm_invA_arr, &size_ipiv, &size_F_savedB,
+        &size_norms);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(
+            handle, size_scalars, size_work_x_temp, size_workArr_temp_arr, size_diag_trfac_invA,
+            size_trfact_workTrmm_invA_arr, size_ipiv, size_F_savedB, size_norms);
+
+    // always allocate all required memory for TRSM optimal performance
+    bool optim_mem = true;
+
+    // memory workspace allocation
+    void *scalars, *work, *workArr, *diag_trfac_invA, *trfact_workTrmm_invA, *ipiv, *F_savedB,
+        *norms;
+    rocsolver_device_malloc mem(handle, size_scalars, size_work_x_temp, size_workArr_temp_arr,
+                                size_diag_trfac_invA, size_trfact_workTrmm_invA_arr, size_ipiv,
+                                size_F_savedB, size_norms);
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    scalars = mem[0];
+    work = mem[1];
+    workArr = mem[2];
+    diag_trfac_invA = mem[3];
+    trfact_workTrmm_invA = mem[4];
+    ipiv = mem[5];
+    F_savedB = mem[6];
+    norms = mem[7];
+    if(size_scalars > 0)
+        init_scalars(handle, (T*)scalars);
+
+    // execution
+    return rocsolver_gelsy_template<false, false, T>(
+        handle, m, n, nrhs, A, shiftA, lda, strideA, B, shiftB, ldb, strideB, jpvt, strideJ, rcond,
+        rank, batch_count, (T*)scalars, (T*)work, (T*)workArr, (T*)diag_trfac_invA,
+        (T**)trfact_workTrmm_invA, (T*)ipiv, (T*)F_savedB, (S*)norms, optim_mem);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sgelsy(rocblas_handle handle,
+                                const rocblas_int m,
+                                const rocblas_int n,
+                                const rocblas_int nrhs,
+                                float* A,
+                                const rocblas_int lda,
+                                float* B,
+                                const rocblas_int ldb,
+                                rocblas_int* jpvt,
+                                const float rcond,
+                                rocblas_int* rank)
+{
+    return rocsolver_gelsy_impl<float>(handle, m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank);
+}
+
+rocblas_status rocsolver_dgelsy(rocblas_handle handle,
+                                const rocblas_int m,
+                                const rocblas_int n,
+                                const rocblas_int nrhs,
+                                double* A,
+                                const rocblas_int lda,
+                                double* B,
+                                const rocblas_int ldb,
+                                rocblas_int* jpvt,
+                                const double rcond,
+                                rocblas_int* rank)
+{
+    return rocsolver_gelsy_impl<double>(handle, m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank);
+}
+
+rocblas_status rocsolver_cgelsy(rocblas_handle handle,
+                                const rocblas_int m,
+                                const rocblas_int n,
+                                const rocblas_int nrhs,
+                                rocblas_float_complex* A,
+                                const rocblas_int lda,
+                                rocblas_float_complex* B,
+                                const rocblas_int ldb,
+                                rocblas_int* jpvt,
+                                const float rcond,
+                                rocblas_int* rank)
+{
+    return rocsolver_gelsy_impl<rocblas_float_complex>(handle, m, n, nrhs, A, lda, B, ldb, jpvt,
+                                                       rcond, rank);
+}
+
+rocblas_status rocsolver_zgelsy(rocblas_handle handle,
+                                const rocblas_int m,
+                                const rocblas_int n,
+                                const rocblas_int nrhs,
+                                rocblas_double_complex* A,
+                                const rocblas_int lda,
+                                rocblas_double_complex* B,
+                                const rocblas_int ldb,
+                                rocblas_int* jpvt,
+                                const double rcond,
+                                rocblas_int* rank)
+{
+    return rocsolver_gelsy_impl<rocblas_double_complex>(handle, m, n, nrhs, A, lda, B, ldb, jpvt,
+                                                        rcond, rank);
+}
+
+} // extern C
@@ -0,0 +1,353 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.9.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     November 2019
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "auxiliary/rocauxiliary_ormlq_unmlq.hpp"
+#include "auxiliary/rocauxiliary_ormqr_unmqr.hpp"
+#include "rocblas.hpp"
+#include "roclapack_gelqf.hpp"
+#include "roclapack_geqp3.hpp"
+#include "rocsolver.h"
+
+/** GELSY_RANK determines the effective rank of A from the diagonal of the triangular
+    factor R of its pivoted QR factorization, as the number of leading diagonal
+    elements with |R(i,i)| > rcond * |R(0,0)|. **/
+template <typename T, typename S, typename U>
+__global__ void __launch_bounds__(BLOCKSIZE) gelsy_rank(const rocblas_int dim,
+                                                        U AA,
+                                                        const rocblas_int shiftA,
+                                                        const rocblas_int lda,
+                                                        const rocblas_stride strideA,
+                                                        const S rcond,
+                                                        rocblas_int* rank)
+{
+    const rocblas_int b = hipBlockIdx_x;
+    const rocblas_int tid = hipThreadIdx_x;
+
+    T* A = load_ptr_batch<T>(AA, b, shiftA, strideA);
+
+    __shared__ rocblas_int srank;
+    if(tid == 0)
+        srank = dim;
+    __syncthreads();
+
+    const S tol = rcond * sqrt(std::real(A[0] * conj(A[0])));
+    for(rocblas_int i = tid; i < dim; i += BLOCKSIZE)
+    {
+        const T d = A[i + i * lda];
+        if(!(sqrt(std::real(d * conj(d))) > tol))
+            atomicMin(&srank, i);
+    }
+    __syncthreads();
+
+    if(tid == 0)
+        rank[b] = srank;
+}
+
+/** GELSY_TRUNCATE sets to zero the rows rank..k-1 of the m-by-n array A. If diag_one is true,
+    A(i,i) is set to one instead for i = rank..k-1. **/
+template <typename T, typename U>
+__global__ void gelsy_truncate(const rocblas_int k,
+                               const rocblas_int n,
+                               U AA,
+                               const rocblas_int shiftA,
+                               const rocblas_int lda,
+                               const rocblas_stride strideA,
+                               const rocblas_int* rank,
+                               const bool diag_one)
+{
+    const auto b = hipBlockIdx_z;
+    const auto i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const auto j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+
+    if(i < k && j < n && i >= rank[b])
+    {
+        T* A = load_ptr_batch<T>(AA, b, shiftA, strideA);
+
+        if(!diag_one)
+            A[i + j * lda] = 0;
+        else if(i == j)
+            A[i + j * lda] = 1;
+    }
+}
+
+/** GELSY_PERMUTE copies row i of the n-by-nrhs array W into row jpvt[i]-1 of B **/
+template <typename T, typename U>
+__global__ void gelsy_permute(const rocblas_int n,
+                              const rocblas_int nrhs,
+                              U BB,
+                              const rocblas_int shiftB,
+                              const rocblas_int ldb,
+                              const rocblas_stride strideB,
+                              T* WW,
+                              const rocblas_int* jpvtA,
+                              const rocblas_stride strideJ)
+{
+    const auto b = hipBlockIdx_z;
+    const auto i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const auto j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+
+    if(i < n && j < nrhs)
+    {
+        T* B = load_ptr_batch<T>(BB, b, shiftB, strideB);
+        T* W = WW + b * n * nrhs;
+        const rocblas_int* jpvt = jpvtA + b * strideJ;
+
+        B[(jpvt[i] - 1) + j * ldb] = W[i + j * n];
+    }
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void rocsolver_gelsy_getMemorySize(const rocblas_int m,
+                                   const rocblas_int n,
+                                   const rocblas_int nrhs,
+                                   const rocblas_int batch_count,
+                                   size_t* size_scalars,
+                                   size_t* size_work_x_temp,
+                                   size_t* size_workArr_temp_arr,
+                                   size_t* size_diag_trfac_invA,
+                                   size_t* size_trfact_workTrmm_invA_arr,
+                                   size_t* size_ipiv,
+                                   size_t* size_F_savedB,
+                                   size_t* size_norms)
+{
+    // if quick return no workspace needed
+    if(m == 0 || n == 0 || batch_count == 0)
+    {
+        *size_scalars = 0;
+        *size_work_x_temp = 0;
+        *size_workArr_temp_arr = 0;
+        *size_diag_trfac_invA = 0;
+        *size_trfact_workTrmm_invA_arr = 0;
+        *size_ipiv = 0;
+        *size_F_savedB = 0;
+        *size_norms = 0;
+        return;
+    }
+
+    const rocblas_int k = std::min(m, n);
+    size_t geqp3_scalars, geqp3_work, geqp3_Abyx, geqp3_diag, geqp3_F;
+    size_t gelqf_scalars, gelqf_work, gelqf_workArr, gelqf_diag, gelqf_trfact;
+    size_t ormqr_scalars, ormqr_work, ormqr_workArr, ormqr_trfact, ormqr_workTrmm;
+    size_t ormlq_scalars, ormlq_work, ormlq_workArr, ormlq_trfact, ormlq_workTrmm;
+    size_t trsm_x_temp, trsm_x_temp_arr, trsm_invA, trsm_invA_arr;
+
+    rocsolver_geqp3_getMemorySize<BATCHED, T>(m, n, batch_count, &geqp3_scalars, &geqp3_work,
+                                              &geqp3_Abyx, &geqp3_diag, &geqp3_F, size_norms);
+
+    rocsolver_gelqf_getMemorySize<T, BATCHED>(k, n, batch_count, &gelqf_scalars, &gelqf_work,
+                                              &gelqf_workArr, &gelqf_diag, &gelqf_trfact);
+
+    rocsolver_ormqr_unmqr_getMemorySize<T, BATCHED>(rocblas_side_left, m, nrhs, k, batch_count,
+                                                    &ormqr_scalars, &ormqr_work, &ormqr_workArr,
+                                                    &ormqr_trfact, &ormqr_workTrmm);
+
+    rocsolver_ormlq_unmlq_getMemorySize<T, BATCHED>(rocblas_side_left, n, nrhs, k, batch_count,
+                                                    &ormlq_scalars, &ormlq_work, &ormlq_workArr,
+                                                    &ormlq_trfact, &ormlq_workTrmm);
+
+    rocblasCall_trsm_mem<BATCHED, T>(rocblas_side_left, k, nrhs, batch_count, &trsm_x_temp,
+                                     &trsm_x_temp_arr, &trsm_invA, &trsm_invA_arr);
+
+    *size_scalars = geqp3_scalars;
+    *size_work_x_temp = std::max({geqp3_work, gelqf_work, ormqr_work, ormlq_work, trsm_x_temp});
+    *size_workArr_temp_arr
+        = std::max({geqp3_Abyx, gelqf_workArr, ormqr_workArr, ormlq_workArr, trsm_x_temp_arr});
+    *size_diag_trfac_invA
+        = std::max({geqp3_diag, gelqf_diag, ormqr_trfact, ormlq_trfact, trsm_invA});
+    *size_trfact_workTrmm_invA_arr
+        = std::max({gelqf_trfact, ormqr_workTrmm, ormlq_workTrmm, trsm_invA_arr});
+
+    // size of the Householder scalars of GEQP3 and GELQF
+    *size_ipiv = sizeof(T) * k * batch_count;
+
+    // size of the block update matrix of GEQP3, and of the copy of the solution to permute
+    *size_F_savedB = std::max(geqp3_F, sizeof(T) * n * nrhs * batch_count);
+}
+
+template <typename T, typename S>
+rocblas_status rocsolver_gelsy_argCheck(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        const rocblas_int nrhs,
+                                        T A,
+                                        const rocblas_int lda,
+                                        T B,
+                                        const rocblas_int ldb,
+                                        rocblas_int* jpvt,
+                                        const S rcond,
+                                        rocblas_int* rank,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(m < 0 || n < 0 || nrhs < 0 || lda < m || ldb < m || ldb < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((m * n && !A) || ((m * nrhs || n * nrhs) && !B) || (n && !jpvt) || (batch_count && !rank))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename S, typename U>
+rocblas_status rocsolver_gelsy_template(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        const rocblas_int nrhs,
+                                        U A,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        U B,
+                                        const rocblas_int shiftB,
+                                        const rocblas_int ldb,
+                                        const rocblas_stride strideB,
+                                        rocblas_int* jpvt,
+                                        const rocblas_stride strideJ,
+                                        const S rcond,
+                                        rocblas_int* rank,
+                                        const rocblas_int batch_count,
+                                        T* scalars,
+                                        T* work_x_temp,
+                                        T* workArr_temp_arr,
+                                        T* diag_trfac_invA,
+                                        T** trfact_workTrmm_invA_arr,
+                                        T* ipiv,
+                                        T* F_savedB,
+                                        S* norms,
+                                        bool optim_mem)
+{
+    ROCSOLVER_ENTER("gelsy", "m:", m, "n:", n, "nrhs:", nrhs, "shiftA:", shiftA, "lda:", lda,
+                    "shiftB:", shiftB, "ldb:", ldb, "rcond:", rcond, "bc:", batch_count);
+
+    // quick return if zero instances in batch
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // quick return if A is empty
+    if(m == 0 || n == 0)
+    {
+        rocblas_int blocksReset = (batch_count - 1) / BLOCKSIZE + 1;
+        hipLaunchKernelGGL(reset_info, dim3(blocksReset, 1, 1), dim3(BLOCKSIZE, 1, 1), 0, stream,
+                           rank, batch_count, 0);
+
+        if(nrhs > 0)
+        {
+            rocblas_int rowsB = std::max(m, n);
+            rocblas_int blocksx = (rowsB - 1) / 32 + 1;
+            rocblas_int blocksy = (nrhs - 1) / 32 + 1;
+            hipLaunchKernelGGL(set_zero<T>, dim3(blocksx, blocksy, batch_count), dim3(32, 32), 0,
+                               stream, rowsB, nrhs, B, shiftB, ldb, strideB);
+        }
+
+        return rocblas_status_success;
+    }
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+
+    // constants in host memory
+    const rocblas_int k = std::min(m, n);
+    const rocblas_stride strideP = k;
+    const rocblas_int blocksk = (k - 1) / 32 + 1;
+    const rocblas_int blocksn = (n - 1) / 32 + 1;
+    const rocblas_int blocksr = (nrhs - 1) / 32 + 1;
+    const T one = 1;
+
+    // TODO: apply scaling to improve accuracy over a larger range of values
+
+    // compute the pivoted QR factorization A * P = Q * R
+    rocsolver_geqp3_template<BATCHED, STRIDED>(handle, m, n, A, shiftA, lda, strideA, jpvt,
+                                               strideJ, ipiv, strideP, batch_count, scalars,
+                                               work_x_temp, workArr_temp_arr, diag_trfac_invA,
+                                               F_savedB, norms);
+
+    // determine the effective rank
+    hipLaunchKernelGGL((gelsy_rank<T>), dim3(batch_count), dim3(BLOCKSIZE), 0, stream, k, A,
+                       shiftA, lda, strideA, rcond, rank);
+
+    // B <- Q' * B
+    if(nrhs > 0)
+        rocsolver_ormqr_unmqr_template<BATCHED, STRIDED>(
+            handle, rocblas_side_left, rocblas_operation_conjugate_transpose, m, nrhs, k, A, shiftA,
+            lda, strideA, ipiv, strideP, B, shiftB, ldb, strideB, batch_count, scalars,
+            (T*)work_x_temp, (T*)workArr_temp_arr, (T*)diag_trfac_invA,
+            (T**)trfact_workTrmm_invA_arr);
+
+    // keep the leading rank rows of R, and compute the LQ factorization of
+    // the resulting (upper trapezoidal) rank-deficient matrix, R = [L 0] * Z.
+    // (The rows of L past the rank are zero, and their diagonal is set to one so that
+    // the triangular solve leaves the corresponding elements of the solution as zero.
+    // This yields the minimum norm solution, as the complete orthogonal factorization
+    // of LAPACK does)
+    hipLaunchKernelGGL(set_zero<T>, dim3(blocksk, blocksn, batch_count), dim3(32, 32), 0, stream,
+                       k, n, A, shiftA, lda, strideA, rocblas_fill_upper);
+    hipLaunchKernelGGL((gelsy_truncate<T>), dim3(blocksk, blocksn, batch_count), dim3(32, 32), 0,
+                       stream, k, n, A, shiftA, lda, strideA, rank, false);
+
+    rocsolver_gelqf_template<BATCHED, STRIDED>(handle, k, n, A, shiftA, lda, strideA, ipiv, strideP,
+                                               batch_count, scalars, work_x_temp, workArr_temp_arr,
+                                               diag_trfac_invA, trfact_workTrmm_invA_arr);
+
+    hipLaunchKernelGGL((gelsy_truncate<T>), dim3(blocksk, blocksk, batch_count), dim3(32, 32), 0,
+                       stream, k, k, A, shiftA, lda, strideA, rank, true);
+
+    if(nrhs > 0)
+    {
+        // solve L * Y = (Q' * B)(0:k-1,:), with the rows past the rank set to zero
+        hipLaunchKernelGGL((gelsy_truncate<T>), dim3(blocksk, blocksr, batch_count), dim3(32, 32),
+                           0, stream, k, nrhs, B, shiftB, ldb, strideB, rank, false);
+
+        rocblasCall_trsm<BATCHED, T>(handle, rocblas_side_left, rocblas_fill_lower,
+                                     rocblas_operation_none, rocblas_diagonal_non_unit, k, nrhs,
+                                     &one, A, shiftA, lda, strideA, B, shiftB, ldb, strideB,
+                                     batch_count, optim_mem, work_x_temp, workArr_temp_arr,
+                                     diag_trfac_invA, trfact_workTrmm_invA_arr);
+
+        // zero rows k to n-1 of B
+        if(n > k)
+        {
+            const rocblas_int zeroblocksx = (n - k - 1) / 32 + 1;
+            hipLaunchKernelGGL(set_zero<T>, dim3(zeroblocksx, blocksr, batch_count), dim3(32, 32),
+                               0, stream, n - k, nrhs, B, shiftB + k, ldb, strideB);
+        }
+
+        // X = P * Z' * Y
+        rocsolver_ormlq_unmlq_template<BATCHED, STRIDED>(
+            handle, rocblas_side_left, rocblas_operation_conjugate_transpose, n, nrhs, k, A, shiftA,
+            lda, strideA, ipiv, strideP, B, shiftB, ldb, strideB, batch_count, scalars,
+            (T*)work_x_temp, (T*)workArr_temp_arr, (T*)diag_trfac_invA,
+            (T**)trfact_workTrmm_invA_arr);
+
+        hipLaunchKernelGGL(copy_mat<T>, dim3(blocksn, blocksr, batch_count), dim3(32, 32), 0,
+                           stream, n, nrhs, B, shiftB, ldb, strideB, F_savedB, 0, n,
+                           rocblas_stride(n) * nrhs);
+        hipLaunchKernelGGL(gelsy_permute<T>, dim3(blocksn, blocksr, batch_count), dim3(32, 32), 0,
+                           stream, n, nrhs, B, shiftB, ldb, strideB, F_savedB, jpvt, strideJ);
+    }
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
@@ -49,7 +49,8 @@ rocblas_status rocsolver_geql2_batched_impl(rocblas_handle handle,
 
     // memory workspace allocation
     void *scalars, *work_workArr, *Abyx_norms, *diag;
-    rocblas_device_malloc mem(handle, size_scalars, size_work_workArr, size_Abyx_norms, size_diag);
+    rocsolver_device_malloc mem(handle, size_scalars, size_work_workArr, size_Abyx_norms,
+                                size_diag);
 
     if(!mem)
         return rocblas_status_memory_error;
@@ -36,7 +36,10 @@ void rocsolver_geqlf_getMemorySize(const rocblas_int m,
         return;
     }
 
-    if(m <= GEQxF_GEQx2_SWITCHSIZE || n <= GEQxF_GEQx2_SWITCHSIZE)
+    const rocblas_int nx = rocsolver_tuning::get()->geqxf_geqx2_switchsize;
+    const rocblas_int nb = rocsolver_tuning::get()->geqxf_geqx2_blocksize;
+
+    if(m <= nx || n <= nx)
     {
         // requirements for a single GEQL2 call
         rocsolver_geql2_getMemorySize<T, BATCHED>(m, n, batch_count, size_scalars, size_work_workArr,
@@ -46,7 +49,7 @@ void rocsolver_geqlf_getMemorySize(const rocblas_int m,
     else
     {
         size_t w1, w2, unused, s1, s2;
-        rocblas_int jb = GEQxF_GEQx2_BLOCKSIZE;
+        rocblas_int jb = nb;
 
         // size to store the temporary triangular factor
         *size_Abyx_norms_trfact = sizeof(T) * jb * jb * batch_count;
@@ -98,21 +101,23 @@ rocblas_status rocsolver_geqlf_template(rocblas_handle handle,
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
+    const rocblas_int nx = rocsolver_tuning::get()->geqxf_geqx2_switchsize;
+
     // if the matrix is small, use the unblocked (BLAS-levelII) variant of the
     // algorithm
-    if(m <= GEQxF_GEQx2_SWITCHSIZE || n <= GEQxF_GEQx2_SWITCHSIZE)
+    if(m <= nx || n <= nx)
         return rocsolver_geql2_template<T>(handle, m, n, A, shiftA, lda, strideA, ipiv, strideP,
                                            batch_count, scalars, work_workArr, Abyx_norms_trfact,
                                            diag_tmptr);
 
     rocblas_int k = min(m, n); // total number of pivots
-    rocblas_int nb = GEQxF_GEQx2_BLOCKSIZE;
-    rocblas_int ki = ((k - GEQxF_GEQx2_SWITCHSIZE - 1) / nb) * nb;
+    rocblas_int nb = rocsolver_tuning::get()->geqxf_geqx2_blocksize;
+    rocblas_int ki = ((k - nx - 1) / nb) * nb;
     rocblas_int kk = min(k, ki + nb);
     rocblas_int jb, j = k - kk + ki;
     rocblas_int mu = m, nu = n;
 
-    rocblas_int ldw = GEQxF_GEQx2_BLOCKSIZE;
+    rocblas_int ldw = nb;
     rocblas_stride strideW = rocblas_stride(ldw) * ldw;
 
     while(j >= k - kk)
@@ -0,0 +1,475 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.9.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     November 2019
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "auxiliary/rocauxiliary_lacgv.hpp"
+#include "auxiliary/rocauxiliary_larfg.hpp"
+#include "rocblas.hpp"
+#include "rocsolver.h"
+
+/** GEQP3_INIT_NORMS computes the norms of the columns of A, and initializes
+    the permutation. Each block takes care of one column. **/
+template <typename T, typename S, typename U>
+__global__ void __launch_bounds__(BLOCKSIZE) geqp3_init_norms(const rocblas_int m,
+                                                              const rocblas_int n,
+                                                              U AA,
+                                                              const rocblas_int shiftA,
+                                                              const rocblas_int lda,
+                                                              const rocblas_stride strideA,
+                                                              rocblas_int* jpvtA,
+                                                              const rocblas_stride strideJ,
+                                                              S* normsA,
+                                                              const rocblas_stride strideN)
+{
+    const rocblas_int c = hipBlockIdx_x;
+    const rocblas_int b = hipBlockIdx_y;
+    const rocblas_int tid = hipThreadIdx_x;
+
+    T* A = load_ptr_batch<T>(AA, b, shiftA, strideA);
+    rocblas_int* jpvt = jpvtA + b * strideJ;
+    S* vn1 = normsA + b * strideN;
+    S* vn2 = vn1 + n;
+
+    __shared__ S sval[BLOCKSIZE];
+
+    S sum = 0;
+    for(rocblas_int i = tid; i < m; i += BLOCKSIZE)
+        sum += std::real(A[i + c * lda] * conj(A[i + c * lda]));
+    sval[tid] = sum;
+    __syncthreads();
+
+    for(int s = BLOCKSIZE / 2; s > 0; s /= 2)
+    {
+        if(tid < s)
+            sval[tid] += sval[tid + s];
+        __syncthreads();
+    }
+
+    if(tid == 0)
+    {
+        vn1[c] = sqrt(sval[0]);
+        vn2[c] = vn1[c];
+        jpvt[c] = c + 1;
+    }
+}
+
+/** GEQP3_PIVOT finds the column j+k..n-1 with the largest partial norm and, if needed,
+    interchanges it with column j+k (together with the corresponding rows of the
+    block update matrix F, the permutation and the partial norms).
+    Each block takes care of one matrix of the batch. **/
+template <typename T, typename S, typename U>
+__global__ void __launch_bounds__(BLOCKSIZE) geqp3_pivot(const rocblas_int m,
+                                                         const rocblas_int n,
+                                                         const rocblas_int j,
+                                                         const rocblas_int k,
+                                                         U AA,
+                                                         const rocblas_int shiftA,
+                                                         const rocblas_int lda,
+                                                         const rocblas_stride strideA,
+                                                         T* FA,
+                                                         const rocblas_int ldf,
+                                                         const rocblas_stride strideF,
+                                                         rocblas_int* jpvtA,
+                                                         const rocblas_stride strideJ,
+                                                         S* normsA,
+                                                         const rocblas_stride strideN)
+{
+    const rocblas_int b = hipBlockIdx_x;
+    const rocblas_int tid = hipThreadIdx_x;
+    const rocblas_int c = j + k;
+
+    T* A = load_ptr_batch<T>(AA, b, shiftA, strideA);
+    T* F = FA + b * strideF;
+    rocblas_int* jpvt = jpvtA + b * strideJ;
+    S* vn1 = normsA + b * strideN;
+    S* vn2 = vn1 + n;
+
+    __shared__ S sval[BLOCKSIZE];
+    __shared__ rocblas_int sidx[BLOCKSIZE];
+
+    // search for the pivot column (the first one with the largest norm, as iamax)
+    S best = -1;
+    rocblas_int bidx = n;
+    for(rocblas_int i = c + tid; i < n; i += BLOCKSIZE)
+    {
+        if(vn1[i] > best)
+        {
+            best = vn1[i];
+            bidx = i;
+        }
+    }
+    sval[tid] = best;
+    sidx[tid] = bidx;
+    __syncthreads();
+
+    for(int s = BLOCKSIZE / 2; s > 0; s /= 2)
+    {
+        if(tid < s
+           && (sval[tid + s] > sval[tid]
+               || (sval[tid + s] == sval[tid] && sidx[tid + s] < sidx[tid])))
+        {
+            sval[tid] = sval[tid + s];
+            sidx[tid] = sidx[tid + s];
+        }
+        __syncthreads();
+    }
+
+    const rocblas_int p = sidx[0];
+    if(p == c || p >= n)
+        return;
+
+    // interchange the columns, and the rows of F
+    T temp;
+    for(rocblas_int i = tid; i < m; i += BLOCKSIZE)
+    {
+        temp = A[i + c * lda];
+        A[i + c * lda] = A[i + p * lda];
+        A[i + p * lda] = temp;
+    }
+    for(rocblas_int i = tid; i < k; i += BLOCKSIZE)
+    {
+        temp = F[k + i * ldf];
+        F[k + i * ldf] = F[(p - j) + i * ldf];
+        F[(p - j) + i * ldf] = temp;
+    }
+
+    if(tid == 0)
+    {
+        rocblas_int t = jpvt[c];
+        jpvt[c] = jpvt[p];
+        jpvt[p] = t;
+        vn1[p] = vn1[c];
+        vn2[p] = vn2[c];
+    }
+}
+
+/** GEQP3_UPDATE_NORMS downdates the partial norms of columns j+k+1..n-1 after
+    the elimination of row rk. When cancellation makes the downdate unreliable, the
+    norm is recomputed from the implicitly updated column
+    A(rk+1:m-1,c) - A(rk+1:m-1,j:j+k) * F(c-j,0:k)'
+    (LAPACK stops the block at that point instead, and recomputes the norm after the
+    trailing update; doing it here keeps the same block size for all the batch instances).
+    Each block takes care of one column. **/
+template <typename T, typename S, typename U>
+__global__ void __launch_bounds__(BLOCKSIZE) geqp3_update_norms(const rocblas_int m,
+                                                                const rocblas_int n,
+                                                                const rocblas_int j,
+                                                                const rocblas_int k,
+                                                                const rocblas_int rk,
+                                                                U AA,
+                                                                const rocblas_int shiftA,
+                                                                const rocblas_int lda,
+                                                                const rocblas_stride strideA,
+                                                                T* FA,
+                                                                const rocblas_int ldf,
+                                                                const rocblas_stride strideF,
+                                                                S* normsA,
+                                                                const rocblas_stride strideN,
+                                                                const S tol3z)
+{
+    const rocblas_int c = j + k + 1 + hipBlockIdx_x;
+    const rocblas_int b = hipBlockIdx_y;
+    const rocblas_int tid = hipThreadIdx_x;
+
+    T* A = load_ptr_batch<T>(AA, b, shiftA, strideA);
+    T* F = FA + b * strideF;
+    S* vn1 = normsA + b * strideN;
+    S* vn2 = vn1 + n;
+
+    __shared__ S sval[BLOCKSIZE];
+    __shared__ bool recompute;
+
+    if(tid == 0)
+    {
+        recompute = false;
+        if(vn1[c] != 0)
+        {
+            T a = A[rk + c * lda];
+            S temp = sqrt(std::real(a * conj(a))) / vn1[c];
+            temp = (1 + temp) * (1 - temp);
+            temp = temp > 0 ? temp : 0;
+            S temp2 = temp * (vn1[c] / vn2[c]) * (vn1[c] / vn2[c]);
+            if(temp2 <= tol3z)
+                recompute = true;
+            else
+                vn1[c] *= sqrt(temp);
+        }
+    }
+    __syncthreads();
+
+    if(!recompute)
+        return;
+
+    S sum = 0;
+    for(rocblas_int i = rk + 1 + tid; i < m; i += BLOCKSIZE)
+    {
+        T v = A[i + c * lda];
+        for(rocblas_int l = 0; l <= k; ++l)
+            v -= A[i + (j + l) * lda] * conj(F[(c - j) + l * ldf]);
+        sum += std::real(v * conj(v));
+    }
+    sval[tid] = sum;
+    __syncthreads();
+
+    for(int s = BLOCKSIZE / 2; s > 0; s /= 2)
+    {
+        if(tid < s)
+            sval[tid] += sval[tid + s];
+        __syncthreads();
+    }
+
+    if(tid == 0)
+    {
+        vn1[c] = sqrt(sval[0]);
+        vn2[c] = vn1[c];
+    }
+}
+
+template <bool BATCHED, typename T>
+void rocsolver_geqp3_getMemorySize(const rocblas_int m,
+                                   const rocblas_int n,
+                                   const rocblas_int batch_count,
+                                   size_t* size_scalars,
+                                   size_t* size_work_workArr,
+                                   size_t* size_Abyx_norms,
+                                   size_t* size_diag,
+                                   size_t* size_F,
+                                   size_t* size_norms)
+{
+    using S = decltype(std::real(T{}));
+
+    // if quick return no workspace needed
+    if(m == 0 || n == 0 || batch_count == 0)
+    {
+        *size_scalars = 0;
+        *size_work_workArr = 0;
+        *size_Abyx_norms = 0;
+        *size_diag = 0;
+        *size_F = 0;
+        *size_norms = 0;
+        return;
+    }
+
+    const rocblas_int nb = rocsolver_tuning::get()->geqp3_blocksize;
+
+    // size of scalars (constants) for rocblas calls
+    *size_scalars = sizeof(T) * 3;
+
+    // requirements for calling LARFG
+    rocsolver_larfg_getMemorySize<T>(m, batch_count, size_work_workArr, size_Abyx_norms);
+
+    // size of arrays of pointers (batched cases)
+    if(BATCHED)
+        *size_work_workArr = max(*size_work_workArr, sizeof(T*) * 2 * batch_count);
+
+    // size to store the diagonal element of the current column
+    *size_diag = sizeof(T) * batch_count;
+
+    // size of the block update matrix F (n-by-nb) and the auxiliary vector
+    *size_F = sizeof(T) * (size_t(n) * nb + nb) * batch_count;
+
+    // size of the partial and reference column norms
+    *size_norms = sizeof(S) * 2 * n * batch_count;
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_geqp3_argCheck(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        const rocblas_int lda,
+                                        T A,
+                                        rocblas_int* jpvt,
+                                        U ipiv,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(m < 0 || n < 0 || lda < m || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((m * n && !A) || (n && !jpvt) || (m * n && !ipiv))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED,
+          bool STRIDED,
+          typename T,
+          typename S,
+          typename U,
+          bool COMPLEX = is_complex<T>>
+rocblas_status rocsolver_geqp3_template(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        U A,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        rocblas_int* jpvt,
+                                        const rocblas_stride strideJ,
+                                        T* ipiv,
+                                        const rocblas_stride strideP,
+                                        const rocblas_int batch_count,
+                                        T* scalars,
+                                        void* work_workArr,
+                                        T* Abyx_norms,
+                                        T* diag,
+                                        T* F,
+                                        S* norms)
+{
+    ROCSOLVER_ENTER("geqp3", "m:", m, "n:", n, "shiftA:", shiftA, "lda:", lda, "bc:", batch_count);
+
+    // quick return
+    if(m == 0 || n == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // everything must be executed with scalars on the device
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device);
+
+    const rocblas_int dim = min(m, n); // total number of pivots
+    const rocblas_int nb = rocsolver_tuning::get()->geqp3_blocksize;
+    const S tol3z = sqrt(get_epsilon<S>());
+
+    // F is n-by-nb, followed by the auxiliary vector of size nb
+    const rocblas_int ldf = n;
+    const rocblas_int shiftV = n * nb;
+    const rocblas_stride strideF = rocblas_stride(n) * nb + nb;
+    const rocblas_stride strideN = 2 * n;
+    T** workArr = (T**)work_workArr;
+
+    // initial column norms and permutation
+    hipLaunchKernelGGL((geqp3_init_norms<T>), dim3(n, batch_count), dim3(BLOCKSIZE), 0, stream, m,
+                       n, A, shiftA, lda, strideA, jpvt, strideJ, norms, strideN);
+
+    for(rocblas_int j = 0; j < dim; j += nb)
+    {
+        // factorize the block of columns j:j+jb-1, accumulating the updates of the
+        // remaining columns in F, such that A(j:m-1,j:n-1) <- A - V * F'
+        const rocblas_int jb = min(dim - j, nb);
+        const rocblas_int nn = n - j;
+
+        rocblas_int blocksx = (nn - 1) / 32 + 1;
+        rocblas_int blocksy = (jb - 1) / 32 + 1;
+        hipLaunchKernelGGL(set_zero<T>, dim3(blocksx, blocksy, batch_count), dim3(32, 32), 0,
+                           stream, nn, jb, F, 0, ldf, strideF);
+
+        for(rocblas_int k = 0; k < jb; ++k)
+        {
+            const rocblas_int rk = j + k;
+
+            // select pivot column
+            hipLaunchKernelGGL((geqp3_pivot<T>), dim3(batch_count), dim3(BLOCKSIZE), 0, stream, m,
+                               n, j, k, A, shiftA, lda, strideA, F, ldf, strideF, jpvt, strideJ,
+                               norms, strideN);
+
+            // apply the previous reflectors of the block to the pivot column:
+            // A(rk:m-1,rk) -= A(rk:m-1,j:rk-1) * F(k,0:k-1)'
+            if(k > 0)
+            {
+                if(COMPLEX)
+                    rocsolver_lacgv_template<T>(handle, k, F, k, ldf, strideF, batch_count);
+
+                rocblasCall_gemv<T>(handle, rocblas_operation_none, m - rk, k,
+                                    cast2constType<T>(scalars), 0, A, shiftA + idx2D(rk, j, lda),
+                                    lda, strideA, F, k, ldf, strideF,
+                                    cast2constType<T>(scalars + 2), 0, A,
+                                    shiftA + idx2D(rk, rk, lda), 1, strideA, batch_count, workArr);
+
+                if(COMPLEX)
+                    rocsolver_lacgv_template<T>(handle, k, F, k, ldf, strideF, batch_count);
+            }
+
+            // generate Householder reflector to work on column rk
+            rocsolver_larfg_template(handle, m - rk, A, shiftA + idx2D(rk, rk, lda), A,
+                                     shiftA + idx2D(min(rk + 1, m - 1), rk, lda), 1, strideA,
+                                     (ipiv + rk), strideP, batch_count, (T*)work_workArr,
+                                     Abyx_norms);
+
+            // insert one in A(rk,rk) to build/apply the householder matrix
+            hipLaunchKernelGGL(set_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0, stream,
+                               diag, 0, 1, A, shiftA + idx2D(rk, rk, lda), lda, strideA, 1, true);
+
+            // compute column k of F:
+            // F(k+1:nn-1,k) = tau * A(rk:m-1,rk+1:n-1)' * v
+            if(k < nn - 1)
+                rocblasCall_gemv<T>(handle, rocblas_operation_conjugate_transpose, m - rk,
+                                    nn - k - 1, cast2constType<T>(ipiv + rk), strideP, A,
+                                    shiftA + idx2D(rk, rk + 1, lda), lda, strideA, A,
+                                    shiftA + idx2D(rk, rk, lda), 1, strideA,
+                                    cast2constType<T>(scalars + 1), 0, F, idx2D(k + 1, k, ldf), 1,
+                                    strideF, batch_count, workArr);
+
+            // account for the previous reflectors of the block:
+            // F(0:nn-1,k) -= F(0:nn-1,0:k-1) * (tau * A(rk:m-1,j:rk-1)' * v)
+            if(k > 0)
+            {
+                rocblasCall_gemv<T>(handle, rocblas_operation_conjugate_transpose, m - rk, k,
+                                    cast2constType<T>(ipiv + rk), strideP, A,
+                                    shiftA + idx2D(rk, j, lda), lda, strideA, A,
+                                    shiftA + idx2D(rk, rk, lda), 1, strideA,
+                                    cast2constType<T>(scalars + 1), 0, F, shiftV, 1, strideF,
+                                    batch_count, workArr);
+
+                rocblasCall_gemv<T>(handle, rocblas_operation_none, nn, k,
+                                    cast2constType<T>(scalars), 0, F, 0, ldf, strideF, F, shiftV, 1,
+                                    strideF, cast2constType<T>(scalars + 2), 0, F, idx2D(0, k, ldf),
+                                    1, strideF, batch_count, workArr);
+            }
+
+            if(k < nn - 1)
+            {
+                // update row rk of the remaining columns:
+                // A(rk,rk+1:n-1) -= A(rk,j:rk) * F(k+1:nn-1,0:k)'
+                rocblasCall_gemm<BATCHED, STRIDED, T>(
+                    handle, rocblas_operation_none, rocblas_operation_conjugate_transpose, 1,
+                    nn - k - 1, k + 1, cast2constType<T>(scalars), A, shiftA + idx2D(rk, j, lda),
+                    lda, strideA, F, idx2D(k + 1, 0, ldf), ldf, strideF,
+                    cast2constType<T>(scalars + 2), A, shiftA + idx2D(rk, rk + 1, lda), lda,
+                    strideA, batch_count, workArr);
+
+                // update partial column norms
+                hipLaunchKernelGGL((geqp3_update_norms<T>), dim3(nn - k - 1, batch_count),
+                                   dim3(BLOCKSIZE), 0, stream, m, n, j, k, rk, A, shiftA, lda,
+                                   strideA, F, ldf, strideF, norms, strideN, tol3z);
+            }
+
+            // restore original value of A(rk,rk)
+            hipLaunchKernelGGL(restore_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0, stream,
+                               diag, 0, 1, A, shiftA + idx2D(rk, rk, lda), lda, strideA, 1);
+        }
+
+        // apply the block of reflectors to the trailing matrix:
+        // A(j+jb:m-1,j+jb:n-1) -= A(j+jb:m-1,j:j+jb-1) * F(jb:nn-1,0:jb-1)'
+        if(j + jb < m && jb < nn)
+            rocblasCall_gemm<BATCHED, STRIDED, T>(
+                handle, rocblas_operation_none, rocblas_operation_conjugate_transpose, m - j - jb,
+                nn - jb, jb, cast2constType<T>(scalars), A, shiftA + idx2D(j + jb, j, lda), lda,
+                strideA, F, idx2D(jb, 0, ldf), ldf, strideF, cast2constType<T>(scalars + 2), A,
+                shiftA + idx2D(j + jb, j + jb, lda), lda, strideA, batch_count, workArr);
+    }
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
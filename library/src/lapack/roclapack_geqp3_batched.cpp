@@ -0,0 +1,149 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_geqp3.hpp"
+
+template <typename T, typename U>
+rocblas_status rocsolver_geqp3_batched_impl(rocblas_handle handle,
+                                            const rocblas_int m,
+                                            const rocblas_int n,
+                                            U A,
+                                            const rocblas_int lda,
+                                            rocblas_int* jpvt,
+                                            const rocblas_stride strideJ,
+                                            T* ipiv,
+                                            const rocblas_stride strideP,
+                                            const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("geqp3_batched", "-m", m, "-n", n, "--lda", lda, "--strideJ", strideJ,
+                        "--strideP", strideP, "--batch_count", batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_geqp3_argCheck(handle, m, n, lda, A, jpvt, ipiv, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+
+    // batched execution
+    rocblas_stride strideA = 0;
+
+    // memory workspace sizes:
+    // size for constants in rocblas calls
+    size_t size_scalars;
+    // size of arrays of pointers (for batched cases) and re-usable workspace
+    size_t size_work_workArr;
+    // extra requirements for calling LARFG
+    size_t size_Abyx_norms;
+    // size to store the diagonal element of the current column
+    size_t size_diag;
+    // size of the block update matrix
+    size_t size_F;
+    // size of the column norms
+    size_t size_norms;
+    rocsolver_geqp3_getMemorySize<true, T>(m, n, batch_count, &size_scalars, &size_work_workArr,
+                                           &size_Abyx_norms, &size_diag, &size_F, &size_norms);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work_workArr,
+                                                      size_Abyx_norms, size_diag, size_F,
+                                                      size_norms);
+
+    // memory workspace allocation
+    void *scalars, *work_workArr, *Abyx_norms, *diag, *F, *norms;
+    rocsolver_device_malloc mem(handle, size_scalars, size_work_workArr, size_Abyx_norms,
+                                size_diag, size_F, size_norms);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    scalars = mem[0];
+    work_workArr = mem[1];
+    Abyx_norms = mem[2];
+    diag = mem[3];
+    F = mem[4];
+    norms = mem[5];
+    if(size_scalars > 0)
+        init_scalars(handle, (T*)scalars);
+
+    // execution
+    using S = decltype(std::real(T{}));
+    return rocsolver_geqp3_template<true, false, T>(
+        handle, m, n, A, shiftA, lda, strideA, jpvt, strideJ, ipiv, strideP, batch_count,
+        (T*)scalars, work_workArr, (T*)Abyx_norms, (T*)diag, (T*)F, (S*)norms);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sgeqp3_batched(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        float* const A[],
+                                        const rocblas_int lda,
+                                        rocblas_int* jpvt,
+                                        const rocblas_stride strideJ,
+                                        float* ipiv,
+                                        const rocblas_stride strideP,
+                                        const rocblas_int batch_count)
+{
+    return rocsolver_geqp3_batched_impl<float>(handle, m, n, A, lda, jpvt, strideJ, ipiv, strideP,
+                                               batch_count);
+}
+
+rocblas_status rocsolver_dgeqp3_batched(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        double* const A[],
+                                        const rocblas_int lda,
+                                        rocblas_int* jpvt,
+                                        const rocblas_stride strideJ,
+                                        double* ipiv,
+                                        const rocblas_stride strideP,
+                                        const rocblas_int batch_count)
+{
+    return rocsolver_geqp3_batched_impl<double>(handle, m, n, A, lda, jpvt, strideJ, ipiv, strideP,
+                                                batch_count);
+}
+
+rocblas_status rocsolver_cgeqp3_batched(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        rocblas_float_complex* const A[],
+                                        const rocblas_int lda,
+                                        rocblas_int* jpvt,
+                                        const rocblas_stride strideJ,
+                                        rocblas_float_complex* ipiv,
+                                        const rocblas_stride strideP,
+                                        const rocblas_int batch_count)
+{
+    return rocsolver_geqp3_batched_impl<rocblas_float_complex>(handle, m, n, A, lda, jpvt, strideJ,
+                                                               ipiv, strideP, batch_count);
+}
+
+rocblas_status rocsolver_zgeqp3_batched(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        rocblas_double_complex* const A[],
+                                        const rocblas_int lda,
+                                        rocblas_int* jpvt,
+                                        const rocblas_stride strideJ,
+                                        rocblas_double_complex* ipiv,
+                                        const rocblas_stride strideP,
+                                        const rocblas_int batch_count)
+{
+    return rocsolver_geqp3_batched_impl<rocblas_double_complex>(handle, m, n, A, lda, jpvt, strideJ,
+                                                                ipiv, strideP, batch_count);
+}
+
+} // extern C
@@ -3,6 +3,7 @@
  * ************************************************************************ */
 
 #include "roclapack_geqr2.hpp"
+#include "rocsolver_plan.hpp"
 
 template <typename T, typename U>
 rocblas_status rocsolver_geqr2_impl(rocblas_handle handle,
@@ -48,7 +49,8 @@ rocblas_status rocsolver_geqr2_impl(rocblas_handle handle,
 
     // memory workspace allocation
     void *scalars, *work_workArr, *Abyx_norms, *diag;
-    rocblas_device_malloc mem(handle, size_scalars, size_work_workArr, size_Abyx_norms, size_diag);
+    rocsolver_device_malloc mem(handle, size_scalars, size_work_workArr, size_Abyx_norms,
+                                size_diag);
 
     if(!mem)
         return rocblas_status_memory_error;
@@ -66,6 +68,34 @@ rocblas_status rocsolver_geqr2_impl(rocblas_handle handle,
                                        (T*)diag);
 }
 
+template <typename T>
+void rocsolver_geqr2_plan(const rocsolver_batch_mode mode,
+                          const rocblas_int m,
+                          const rocblas_int n,
+                          const rocblas_int batch_count,
+                          rocsolver_workspace_plan* plan)
+{
+    // normal execution works with a single matrix
+    const rocblas_int bc = (mode == rocsolver_batch_none ? 1 : batch_count);
+
+    // memory workspace sizes
+    size_t size_scalars, size_work_workArr, size_Abyx_norms, size_diag;
+    if(mode == rocsolver_batch_pointers)
+        rocsolver_geqr2_getMemorySize<T, true>(m, n, bc, &size_scalars, &size_work_workArr,
+                                               &size_Abyx_norms, &size_diag);
+    else
+        rocsolver_geqr2_getMemorySize<T, false>(m, n, bc, &size_scalars, &size_work_workArr,
+                                                &size_Abyx_norms, &size_diag);
+
+    rocsolver_plan_add(plan, "scalars", size_scalars);
+    rocsolver_plan_add(plan, "work_workArr", size_work_workArr);
+    rocsolver_plan_add(plan, "Abyx_norms", size_Abyx_norms);
+    rocsolver_plan_add(plan, "diag", size_diag);
+
+    if(!rocsolver_plan_quick_return(mode, m, n, batch_count))
+        plan->algorithm = "geqr2";
+}
+
 /*
  * ===========================================================================
  *    C wrapper
@@ -114,4 +144,16 @@ rocblas_status rocsolver_zgeqr2(rocblas_handle handle,
     return rocsolver_geqr2_impl<rocblas_double_complex>(handle, m, n, A, lda, ipiv);
 }
 
+rocblas_status rocsolver_plan_geqr2(const rocblas_datatype type,
+                                    const rocsolver_batch_mode mode,
+                                    const rocblas_int m,
+                                    const rocblas_int n,
+                                    const rocblas_int batch_count,
+                                    rocsolver_workspace_plan* plan)
+{
+    return rocsolver_plan_template(type, mode, m, n, batch_count, plan, [&](auto t) {
+        rocsolver_geqr2_plan<decltype(t)>(mode, m, n, batch_count, plan);
+    });
+}
+
 } // extern C
@@ -15,6 +15,244 @@
 #include "rocblas.hpp"
 #include "rocsolver.h"
 
+#ifdef OPTIMAL
+////////////////////////////////////////////////////////////////////////////////////
+// OPTIMIZED KERNEL FOR QR FACTORIZATION OF SMALL AND TALL-SKINNY MATRICES        //
+////////////////////////////////////////////////////////////////////////////////////
+
+/** QRFACT_SMALL_TAUBETA computes tau, beta and the scaling factor of the Householder
+    reflector of a column with first element alpha, and whose remaining elements have
+    squared norm norm2 (as set_taubeta does in larfg) **/
+template <typename T, std::enable_if_t<!is_complex<T>, int> = 0>
+__device__ void qrfact_small_taubeta(const T alpha, const T norm2, T& tau, T& beta, T& scal)
+{
+    if(norm2 > 0)
+    {
+        T n = sqrt(norm2 + alpha * alpha);
+        n = alpha >= 0 ? -n : n;
+        scal = T(1) / (alpha - n);
+        tau = (n - alpha) / n;
+        beta = n;
+    }
+    else
+    {
+        scal = 1;
+        tau = 0;
+        beta = alpha;
+    }
+}
+
+template <typename T, std::enable_if_t<is_complex<T>, int> = 0>
+__device__ void qrfact_small_taubeta(const T alpha, const T norm2, T& tau, T& beta, T& scal)
+{
+    using S = decltype(std::real(T{}));
+    S ar = alpha.real();
+    S ai = alpha.imag();
+    S m = ai * ai;
+
+    if(norm2.real() > 0 || m > 0)
+    {
+        m += ar * ar;
+        S n = sqrt(norm2.real() + m);
+        n = ar >= 0 ? -n : n;
+        S r = (ar - n) * (ar - n) + ai * ai;
+        scal = rocblas_complex_num<S>((ar - n) / r, -ai / r);
+        tau = rocblas_complex_num<S>((n - ar) / n, -ai / n);
+        beta = n;
+    }
+    else
+    {
+        scal = 1;
+        tau = 0;
+        beta = alpha;
+    }
+}
+
+/** QRFACT_SMALL_REDUCE adds up the rows of the m-by-nb array red (with leading dimension m)
+    into its first row. All the threads in the block must call it. **/
+template <typename T>
+__device__ void qrfact_small_reduce(const int tid, const int m, const int nb, T* red)
+{
+    int s = 1;
+    while(s < m)
+        s <<= 1;
+
+    for(s >>= 1; s > 0; s >>= 1)
+    {
+        if(tid < s && tid + s < m)
+        {
+            for(int j = 0; j < nb; ++j)
+                red[tid + j * m] += red[tid + s + j * m];
+        }
+        __syncthreads();
+    }
+}
+
+/************************************************************************
+    QRfact_small_kernel takes care of matrices with
+    m <= GEQR2_MAX_SMALL_ROWS and n <= GEQR2_MAX_SMALL_COLS.
+    Each thread keeps a row of the matrix in registers; the reflectors
+    are generated and applied without leaving the kernel.
+************************************************************************/
+template <rocblas_int DIM, typename T, typename U>
+__global__ void __launch_bounds__(GEQR2_MAX_SMALL_ROWS)
+    QRfact_small_kernel(const rocblas_int m,
+                        U AA,
+                        const rocblas_int shiftA,
+                        const rocblas_int lda,
+                        const rocblas_stride strideA,
+                        T* ipivA,
+                        const rocblas_stride strideP)
+{
+    const int myrow = hipThreadIdx_x;
+    const int id = hipBlockIdx_x;
+
+    // batch instance
+    T* A = load_ptr_batch<T>(AA, id, shiftA, strideA);
+    T* ipiv = ipivA + id * strideP;
+
+    // shared memory (for the reductions and to share the diagonal element)
+    extern __shared__ double lmem[];
+    T* red = (T*)lmem;
+    T* alpha = red + m * GEQR2_SMALL_REDCOLS;
+
+    // local variables
+    T tau, beta, scal, v;
+    T rA[DIM]; // to store this-row values
+
+// read corresponding row from global memory into local array
+#pragma unroll DIM
+    for(int j = 0; j < DIM; ++j)
+        rA[j] = A[myrow + j * lda];
+
+// for each column (main loop)
+#pragma unroll DIM
+    for(int k = 0; k < DIM; ++k)
+    {
+        if(k >= m)
+            break;
+
+        // squared norm of the column below the diagonal
+        red[myrow] = (myrow > k) ? rA[k] * conj(rA[k]) : T(0);
+        if(myrow == k)
+            *alpha = rA[k];
+        __syncthreads();
+        qrfact_small_reduce(myrow, m, 1, red);
+
+        // generate Householder reflector (as larfg)
+        qrfact_small_taubeta(*alpha, red[0], tau, beta, scal);
+        __syncthreads();
+
+        if(myrow == k)
+            rA[k] = beta;
+        else if(myrow > k)
+            rA[k] *= scal;
+        if(myrow == 0)
+            ipiv[k] = tau;
+        v = (myrow == k) ? T(1) : (myrow > k ? rA[k] : T(0));
+
+        // apply H' = I - conj(tau) * v * v' to the rest of the matrix,
+        // GEQR2_SMALL_REDCOLS columns at a time
+        for(int j0 = k + 1; j0 < DIM; j0 += GEQR2_SMALL_REDCOLS)
+        {
+            const int nb = min(GEQR2_SMALL_REDCOLS, DIM - j0);
+
+            // w = v' * A(k:m-1, j0:j0+nb-1)
+            for(int jj = 0; jj < nb; ++jj)
+                red[myrow + jj * m] = conj(v) * rA[j0 + jj];
+            __syncthreads();
+            qrfact_small_reduce(myrow, m, nb, red);
+
+            // A(k:m-1, j0:j0+nb-1) -= conj(tau) * v * w
+            if(myrow >= k)
+            {
+                for(int jj = 0; jj < nb; ++jj)
+                    rA[j0 + jj] -= conj(tau) * v * red[jj * m];
+            }
+            __syncthreads();
+        }
+    }
+
+// write results to global memory
+#pragma unroll DIM
+    for(int j = 0; j < DIM; ++j)
+        A[myrow + j * lda] = rA[j];
+}
+
+/*************************************************************
+    Launcher of QRfact_small kernels
+*************************************************************/
+template <typename T, typename U>
+rocblas_status QRfact_small(rocblas_handle handle,
+                            const rocblas_int m,
+                            const rocblas_int n,
+                            U A,
+                            const rocblas_int shiftA,
+                            const rocblas_int lda,
+                            const rocblas_stride strideA,
+                            T* ipiv,
+                            const rocblas_stride strideP,
+                            const rocblas_int batch_count)
+{
+#define RUN_QRFACT_SMALL(DIM)                                                                      \
+    hipLaunchKernelGGL((QRfact_small_kernel<DIM, T>), grid, block, lmemsize, stream, m, A, shiftA, \
+                       lda, strideA, ipiv, strideP)
+
+    // prepare kernel launch
+    dim3 grid(batch_count, 1, 1);
+    dim3 block(m, 1, 1);
+    size_t lmemsize = (m * GEQR2_SMALL_REDCOLS + 1) * sizeof(T);
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // instantiate cases to make number of columns n known at compile time
+    // this should allow loop unrolling.
+    // kernel launch
+    switch(n)
+    {
+    case 1: RUN_QRFACT_SMALL(1); break;
+    case 2: RUN_QRFACT_SMALL(2); break;
+    case 3: RUN_QRFACT_SMALL(3); break;
+    case 4: RUN_QRFACT_SMALL(4); break;
+    case 5: RUN_QRFACT_SMALL(5); break;
+    case 6: RUN_QRFACT_SMALL(6); break;
+    case 7: RUN_QRFACT_SMALL(7); break;
+    case 8: RUN_QRFACT_SMALL(8); break;
+    case 9: RUN_QRFACT_SMALL(9); break;
+    case 10: RUN_QRFACT_SMALL(10); break;
+    case 11: RUN_QRFACT_SMALL(11); break;
+    case 12: RUN_QRFACT_SMALL(12); break;
+    case 13: RUN_QRFACT_SMALL(13); break;
+    case 14: RUN_QRFACT_SMALL(14); break;
+    case 15: RUN_QRFACT_SMALL(15); break;
+    case 16: RUN_QRFACT_SMALL(16); break;
+    case 17: RUN_QRFACT_SMALL(17); break;
+    case 18: RUN_QRFACT_SMALL(18); break;
+    case 19: RUN_QRFACT_SMALL(19); break;
+    case 20: RUN_QRFACT_SMALL(20); break;
+    case 21: RUN_QRFACT_SMALL(21); break;
+    case 22: RUN_QRFACT_SMALL(22); break;
+    case 23: RUN_QRFACT_SMALL(23); break;
+    case 24: RUN_QRFACT_SMALL(24); break;
+    case 25: RUN_QRFACT_SMALL(25); break;
+    case 26: RUN_QRFACT_SMALL(26); break;
+    case 27: RUN_QRFACT_SMALL(27); break;
+    case 28: RUN_QRFACT_SMALL(28); break;
+    case 29: RUN_QRFACT_SMALL(29); break;
+    case 30: RUN_QRFACT_SMALL(30); break;
+    case 31: RUN_QRFACT_SMALL(31); break;
+    case 32: RUN_QRFACT_SMALL(32); break;
+    default: ROCSOLVER_UNREACHABLE();
+    }
+
+    return rocblas_status_success;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+//                      END OF OPTIMIZED KERNEL                                         //
+//////////////////////////////////////////////////////////////////////////////////////////
+#endif // OPTIMAL
+
 template <typename T, bool BATCHED>
 void rocsolver_geqr2_getMemorySize(const rocblas_int m,
                                    const rocblas_int n,
@@ -98,6 +336,12 @@ rocblas_status rocsolver_geqr2_template(rocblas_handle handle,
     if(m == 0 || n == 0 || batch_count == 0)
         return rocblas_status_success;
 
+#ifdef OPTIMAL
+    // Use the fused kernel when the matrix fits in registers
+    if(m <= GEQR2_MAX_SMALL_ROWS && n <= GEQR2_MAX_SMALL_COLS)
+        return QRfact_small<T>(handle, m, n, A, shiftA, lda, strideA, ipiv, strideP, batch_count);
+#endif
+
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
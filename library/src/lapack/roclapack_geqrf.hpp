@@ -13,6 +13,7 @@
 #include "auxiliary/rocauxiliary_larft.hpp"
 #include "rocblas.hpp"
 #include "roclapack_geqr2.hpp"
+#include "roclapack_tsqr.hpp"
 #include "rocsolver.h"
 
 template <typename T, bool BATCHED>
@@ -36,7 +37,26 @@ void rocsolver_geqrf_getMemorySize(const rocblas_int m,
         return;
     }
 
-    if(m <= GEQxF_GEQx2_SWITCHSIZE || n <= GEQxF_GEQx2_SWITCHSIZE)
+    const rocblas_int nx = rocsolver_tuning::get()->geqxf_geqx2_switchsize;
+    const rocblas_int nb = rocsolver_tuning::get()->geqxf_geqx2_blocksize;
+
+#ifdef OPTIMAL
+    // requirements for the reduction tree of tall-skinny matrices
+    // (the scalars are still those of GEQR2, as callers such as GELS expect)
+    if(rocsolver_tsqr_usable<BATCHED>(m, n, batch_count))
+    {
+        rocsolver_geqr2_getMemorySize<T, BATCHED>(m, n, batch_count, size_scalars,
+                                                  size_work_workArr, size_Abyx_norms_trfact,
+                                                  size_diag_tmptr);
+        rocsolver_tsqr_getMemorySize<T>(m, n, size_work_workArr);
+        *size_Abyx_norms_trfact = 0;
+        *size_diag_tmptr = 0;
+        *size_workArr = 0;
+        return;
+    }
+#endif
+
+    if(m <= nx || n <= nx)
     {
         // requirements for a single GEQR2 call
         rocsolver_geqr2_getMemorySize<T, BATCHED>(m, n, batch_count, size_scalars, size_work_workArr,
@@ -46,7 +66,7 @@ void rocsolver_geqrf_getMemorySize(const rocblas_int m,
     else
     {
         size_t w1, w2, unused, s1, s2;
-        rocblas_int jb = GEQxF_GEQx2_BLOCKSIZE;
+        rocblas_int jb = nb;
 
         // size to store the temporary triangular factor
         *size_Abyx_norms_trfact = sizeof(T) * jb * jb * batch_count;
@@ -98,9 +118,19 @@ rocblas_status rocsolver_geqrf_template(rocblas_handle handle,
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
+    const rocblas_int nx = rocsolver_tuning::get()->geqxf_geqx2_switchsize;
+    const rocblas_int nb = rocsolver_tuning::get()->geqxf_geqx2_blocksize;
+
+#ifdef OPTIMAL
+    // if the matrix is tall and skinny, factorize its tiles in parallel and
+    // combine them with a reduction tree
+    if(rocsolver_tsqr_usable<BATCHED>(m, n, batch_count))
+        return rocsolver_tsqr_template<T>(handle, m, n, A, shiftA, lda, ipiv, (T*)work_workArr);
+#endif
+
     // if the matrix is small, use the unblocked (BLAS-levelII) variant of the
     // algorithm
-    if(m <= GEQxF_GEQx2_SWITCHSIZE || n <= GEQxF_GEQx2_SWITCHSIZE)
+    if(m <= nx || n <= nx)
     {
         rocsolver_geqr2_template<T>(handle, m, n, A, shiftA, lda, strideA, ipiv, strideP, batch_count,
                                     scalars, work_workArr, Abyx_norms_trfact, diag_tmptr);
@@ -110,13 +140,13 @@ rocblas_status rocsolver_geqrf_template(rocblas_handle handle,
     rocblas_int dim = min(m, n); // total number of pivots
     rocblas_int jb, j = 0;
 
-    rocblas_int ldw = GEQxF_GEQx2_BLOCKSIZE;
+    rocblas_int ldw = nb;
     rocblas_stride strideW = rocblas_stride(ldw) * ldw;
 
-    while(j < dim - GEQxF_GEQx2_SWITCHSIZE)
+    while(j < dim - nx)
     {
         // Factor diagonal and subdiagonal blocks
-        jb = min(dim - j, GEQxF_GEQx2_BLOCKSIZE); // number of columns in the block
+        jb = min(dim - j, nb); // number of columns in the block
         rocsolver_geqr2_template<T>(handle, m - j, jb, A, shiftA + idx2D(j, j, lda), lda, strideA,
                                     (ipiv + j), strideP, batch_count, scalars, work_workArr,
                                     Abyx_norms_trfact, diag_tmptr);
@@ -137,7 +167,7 @@ rocblas_status rocsolver_geqrf_template(rocblas_handle handle,
                 shiftA + idx2D(j, j, lda), lda, strideA, Abyx_norms_trfact, 0, ldw, strideW, A,
                 shiftA + idx2D(j, j + jb, lda), lda, strideA, batch_count, diag_tmptr, workArr);
         }
-        j += GEQxF_GEQx2_BLOCKSIZE;
+        j += nb;
     }
 
     // factor last block
@@ -0,0 +1,483 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "lib_device_helpers.hpp"
+#include "rocblas.hpp"
+#include "roclapack_getrf.hpp"
+#include "roclapack_getrs.hpp"
+#include "rocsolver.h"
+
+#ifdef OPTIMAL
+/** GESV_SMALL_LMEMSIZE returns the size of the shared memory needed by each
+    group of threads in gesv_small_kernel: the current column, the pivot row,
+    the pivot row of B, and the rows of B owned by the threads **/
+template <typename T>
+size_t gesv_small_lmemsize(const rocblas_int n, const rocblas_int nrhs)
+{
+    return sizeof(T) * (2 * size_t(n) + nrhs + size_t(n) * nrhs);
+}
+
+template <typename T>
+bool gesv_use_small(const rocblas_int n, const rocblas_int nrhs)
+{
+    return n <= GESV_POSV_MAX_SMALL_SIZE
+        && gesv_small_lmemsize<T>(n, nrhs) <= GESV_POSV_MAX_SMALL_LDS;
+}
+
+/*************************************************************
+    gesv_small_kernel takes care of systems with
+    n <= GESV_POSV_MAX_SMALL_SIZE. Each thread of a group holds a row
+    of A in registers and the same row of B in shared memory. The
+    LU factorization with partial pivoting is applied to B as it is
+    computed (forward substitution), followed by the backward
+    substitution with U; nothing is written back to global memory
+    until the system is solved
+*************************************************************/
+template <rocblas_int DIM, typename T, typename U>
+__global__ void __launch_bounds__(GETF2_MAX_THDS)
+    gesv_small_kernel(const rocblas_int nrhs,
+                      U AA,
+                      const rocblas_int shiftA,
+                      const rocblas_int lda,
+                      const rocblas_stride strideA,
+                      rocblas_int* ipivA,
+                      const rocblas_stride strideP,
+                      U BB,
+                      const rocblas_int shiftB,
+                      const rocblas_int ldb,
+                      const rocblas_stride strideB,
+                      rocblas_int* infoA,
+                      const rocblas_int batch_count)
+{
+    using S = decltype(std::real(T{}));
+
+    const int tid = hipThreadIdx_x;
+    const int ty = hipThreadIdx_y;
+    const int id = hipBlockIdx_x * hipBlockDim_y + ty;
+
+    if(id >= batch_count)
+        return;
+
+    // batch instance
+    T* A = load_ptr_batch<T>(AA, id, shiftA, strideA);
+    T* B = (nrhs > 0) ? load_ptr_batch<T>(BB, id, shiftB, strideB) : nullptr;
+    rocblas_int* ipiv = ipivA + id * strideP;
+    rocblas_int* info = infoA + id;
+
+    // shared memory (for communication between threads in group)
+    extern __shared__ double lmem[];
+    T* col = (T*)lmem;
+    col += ty * (2 * DIM + nrhs + DIM * nrhs);
+    T* prow = col + DIM;
+    T* xrow = prow + DIM;
+    T* rB = xrow + nrhs;
+
+    // local variables
+    T pivot_value;
+    T test_value;
+    int pivot_index;
+    int myrow = tid; // current (logical) row of the data held by this thread
+    int myinfo = 0; // to build info
+    T rA[DIM]; // to store this-row values
+
+    // read corresponding rows from global memory
+#pragma unroll DIM
+    for(int j = 0; j < DIM; ++j)
+        rA[j] = A[tid + j * lda];
+    for(int j = 0; j < nrhs; ++j)
+        rB[tid + j * DIM] = B[tid + j * ldb];
+
+// LU factorization and forward substitution (main loop)
+#pragma unroll DIM
+    for(int k = 0; k < DIM; ++k)
+    {
+        // share current column
+        col[myrow] = rA[k];
+        __syncthreads();
+
+        // search pivot index
+        pivot_index = k;
+        pivot_value = col[k];
+        for(int i = k + 1; i < DIM; ++i)
+        {
+            test_value = col[i];
+            if(aabs<S>(pivot_value) < aabs<S>(test_value))
+            {
+                pivot_value = test_value;
+                pivot_index = i;
+            }
+        }
+
+        // check singularity and scale value for current column
+        // (as in GETF2, a zero pivot leaves the column unscaled)
+        if(pivot_value != T(0))
+            pivot_value = S(1) / pivot_value;
+        else
+        {
+            pivot_value = 1;
+            if(myinfo == 0)
+                myinfo = k + 1;
+        }
+
+        // swap rows (lazy swaping)
+        if(tid == 0)
+            ipiv[k] = pivot_index + 1;
+        if(myrow == pivot_index)
+        {
+            myrow = k;
+            // share pivot rows of A and B
+            for(int j = k + 1; j < DIM; ++j)
+                prow[j] = rA[j];
+            for(int j = 0; j < nrhs; ++j)
+                xrow[j] = rB[tid + j * DIM];
+        }
+        else if(myrow == k)
+            myrow = pivot_index;
+        __syncthreads();
+
+        // scale current column and update trailing matrix and right-hand sides
+        if(myrow > k)
+        {
+            rA[k] *= pivot_value;
+            for(int j = k + 1; j < DIM; ++j)
+                rA[j] -= rA[k] * prow[j];
+            for(int j = 0; j < nrhs; ++j)
+                rB[tid + j * DIM] -= rA[k] * xrow[j];
+        }
+        __syncthreads();
+    }
+
+// backward substitution with U (skipped if A is singular)
+#pragma unroll DIM
+    for(int k = DIM - 1; k >= 0; --k)
+    {
+        if(myinfo == 0 && myrow == k)
+        {
+            pivot_value = S(1) / rA[k];
+            for(int j = 0; j < nrhs; ++j)
+            {
+                rB[tid + j * DIM] *= pivot_value;
+                xrow[j] = rB[tid + j * DIM];
+            }
+        }
+        __syncthreads();
+
+        if(myinfo == 0 && myrow < k)
+        {
+            for(int j = 0; j < nrhs; ++j)
+                rB[tid + j * DIM] -= rA[k] * xrow[j];
+        }
+        __syncthreads();
+    }
+
+    // write results to global memory
+    // (B is left unchanged if A is singular)
+    if(myrow == 0)
+        *info = myinfo;
+#pragma unroll DIM
+    for(int j = 0; j < DIM; ++j)
+        A[myrow + j * lda] = rA[j];
+    if(myinfo == 0)
+    {
+        for(int j = 0; j < nrhs; ++j)
+            B[myrow + j * ldb] = rB[tid + j * DIM];
+    }
+}
+
+/*************************************************************
+    Launcher of gesv_small kernels
+*************************************************************/
+template <typename T, typename U>
+rocblas_status gesv_small(rocblas_handle handle,
+                          const rocblas_int n,
+                          const rocblas_int nrhs,
+                          U A,
+                          const rocblas_int shiftA,
+                          const rocblas_int lda,
+                          const rocblas_stride strideA,
+                          rocblas_int* ipiv,
+                          const rocblas_stride strideP,
+                          U B,
+                          const rocblas_int shiftB,
+                          const rocblas_int ldb,
+                          const rocblas_stride strideB,
+                          rocblas_int* info,
+                          const rocblas_int batch_count)
+{
+#define RUN_GESV_SMALL(DIM)                                                                       \
+    hipLaunchKernelGGL((gesv_small_kernel<DIM, T>), grid, block, lmemsize, stream, nrhs, A,       \
+                       shiftA, lda, strideA, ipiv, strideP, B, shiftB, ldb, strideB, info,        \
+                       batch_count)
+
+    // determine sizes
+    // (the number of groups per block is limited by the available shared memory)
+    std::vector<int> opval{GETF2_OPTIM_NGRP};
+    size_t lmemgrp = gesv_small_lmemsize<T>(n, nrhs);
+    rocblas_int ngrp = (batch_count < 2 || n > 32) ? 1 : opval[n - 1];
+    ngrp = max(1, min(ngrp, rocblas_int(GESV_POSV_MAX_SMALL_LDS / lmemgrp)));
+    rocblas_int blocks = (batch_count - 1) / ngrp + 1;
+    rocblas_int nthds = n;
+
+    // prepare kernel launch
+    dim3 grid(blocks, 1, 1);
+    dim3 block(nthds, ngrp, 1);
+    size_t lmemsize = lmemgrp * ngrp;
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // instantiate cases to make the size n known at compile time
+    // this should allow loop unrolling.
+    // kernel launch
+    switch(n)
+    {
+    case 1: RUN_GESV_SMALL(1); break;
+    case 2: RUN_GESV_SMALL(2); break;
+    case 3: RUN_GESV_SMALL(3); break;
+    case 4: RUN_GESV_SMALL(4); break;
+    case 5: RUN_GESV_SMALL(5); break;
+    case 6: RUN_GESV_SMALL(6); break;
+    case 7: RUN_GESV_SMALL(7); break;
+    case 8: RUN_GESV_SMALL(8); break;
+    case 9: RUN_GESV_SMALL(9); break;
+    case 10: RUN_GESV_SMALL(10); break;
+    case 11: RUN_GESV_SMALL(11); break;
+    case 12: RUN_GESV_SMALL(12); break;
+    case 13: RUN_GESV_SMALL(13); break;
+    case 14: RUN_GESV_SMALL(14); break;
+    case 15: RUN_GESV_SMALL(15); break;
+    case 16: RUN_GESV_SMALL(16); break;
+    case 17: RUN_GESV_SMALL(17); break;
+    case 18: RUN_GESV_SMALL(18); break;
+    case 19: RUN_GESV_SMALL(19); break;
+    case 20: RUN_GESV_SMALL(20); break;
+    case 21: RUN_GESV_SMALL(21); break;
+    case 22: RUN_GESV_SMALL(22); break;
+    case 23: RUN_GESV_SMALL(23); break;
+    case 24: RUN_GESV_SMALL(24); break;
+    case 25: RUN_GESV_SMALL(25); break;
+    case 26: RUN_GESV_SMALL(26); break;
+    case 27: RUN_GESV_SMALL(27); break;
+    case 28: RUN_GESV_SMALL(28); break;
+    case 29: RUN_GESV_SMALL(29); break;
+    case 30: RUN_GESV_SMALL(30); break;
+    case 31: RUN_GESV_SMALL(31); break;
+    case 32: RUN_GESV_SMALL(32); break;
+    case 33: RUN_GESV_SMALL(33); break;
+    case 34: RUN_GESV_SMALL(34); break;
+    case 35: RUN_GESV_SMALL(35); break;
+    case 36: RUN_GESV_SMALL(36); break;
+    case 37: RUN_GESV_SMALL(37); break;
+    case 38: RUN_GESV_SMALL(38); break;
+    case 39: RUN_GESV_SMALL(39); break;
+    case 40: RUN_GESV_SMALL(40); break;
+    case 41: RUN_GESV_SMALL(41); break;
+    case 42: RUN_GESV_SMALL(42); break;
+    case 43: RUN_GESV_SMALL(43); break;
+    case 44: RUN_GESV_SMALL(44); break;
+    case 45: RUN_GESV_SMALL(45); break;
+    case 46: RUN_GESV_SMALL(46); break;
+    case 47: RUN_GESV_SMALL(47); break;
+    case 48: RUN_GESV_SMALL(48); break;
+    case 49: RUN_GESV_SMALL(49); break;
+    case 50: RUN_GESV_SMALL(50); break;
+    case 51: RUN_GESV_SMALL(51); break;
+    case 52: RUN_GESV_SMALL(52); break;
+    case 53: RUN_GESV_SMALL(53); break;
+    case 54: RUN_GESV_SMALL(54); break;
+    case 55: RUN_GESV_SMALL(55); break;
+    case 56: RUN_GESV_SMALL(56); break;
+    case 57: RUN_GESV_SMALL(57); break;
+    case 58: RUN_GESV_SMALL(58); break;
+    case 59: RUN_GESV_SMALL(59); break;
+    case 60: RUN_GESV_SMALL(60); break;
+    case 61: RUN_GESV_SMALL(61); break;
+    case 62: RUN_GESV_SMALL(62); break;
+    case 63: RUN_GESV_SMALL(63); break;
+    case 64: RUN_GESV_SMALL(64); break;
+    default: ROCSOLVER_UNREACHABLE();
+    }
+
+    return rocblas_status_success;
+}
+#endif // OPTIMAL
+
+template <bool BATCHED, bool STRIDED, typename T, typename S>
+void rocsolver_gesv_getMemorySize(const rocblas_int n,
+                                  const rocblas_int nrhs,
+                                  const rocblas_int batch_count,
+                                  size_t* size_scalars,
+                                  size_t* size_work,
+                                  size_t* size_work1,
+                                  size_t* size_work2,
+                                  size_t* size_work3,
+                                  size_t* size_work4,
+                                  size_t* size_pivotval,
+                                  size_t* size_pivotidx,
+                                  size_t* size_iinfo,
+                                  size_t* size_savedB)
+{
+    // if quick return, no workspace needed
+    bool quick = (n == 0 || batch_count == 0);
+#ifdef OPTIMAL
+    // if using the fused kernel for small sizes, no workspace needed
+    quick = quick || gesv_use_small<T>(n, nrhs);
+#endif
+    if(quick)
+    {
+        *size_scalars = 0;
+        *size_work = 0;
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *size_pivotval = 0;
+        *size_pivotidx = 0;
+        *size_iinfo = 0;
+        *size_savedB = 0;
+        return;
+    }
+
+    size_t w1, w2, w3, w4;
+
+    // requirements for calling GETRF
+    rocsolver_getrf_getMemorySize<BATCHED, STRIDED, true, T, S>(
+        n, n, batch_count, size_scalars, size_work, size_work1, size_work2, size_work3, size_work4,
+        size_pivotval, size_pivotidx, size_iinfo);
+
+    // requirements for calling GETRS
+    rocsolver_getrs_getMemorySize<BATCHED, T>(n, nrhs, batch_count, &w1, &w2, &w3, &w4);
+
+    *size_work1 = std::max(*size_work1, w1);
+    *size_work2 = std::max(*size_work2, w2);
+    *size_work3 = std::max(*size_work3, w3);
+    *size_work4 = std::max(*size_work4, w4);
+
+    // size to save B in cases where A is singular
+    *size_savedB = sizeof(T) * n * nrhs * batch_count;
+}
+
+template <typename T>
+rocblas_status rocsolver_gesv_argCheck(rocblas_handle handle,
+                                       const rocblas_int n,
+                                       const rocblas_int nrhs,
+                                       const rocblas_int lda,
+                                       const rocblas_int ldb,
+                                       T A,
+                                       T B,
+                                       const rocblas_int* ipiv,
+                                       const rocblas_int* info,
+                                       const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(n < 0 || nrhs < 0 || lda < n || ldb < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (n && !ipiv) || (nrhs * n && !B) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename S, typename U>
+rocblas_status rocsolver_gesv_template(rocblas_handle handle,
+                                       const rocblas_int n,
+                                       const rocblas_int nrhs,
+                                       U A,
+                                       const rocblas_int shiftA,
+                                       const rocblas_int lda,
+                                       const rocblas_stride strideA,
+                                       rocblas_int* ipiv,
+                                       const rocblas_stride strideP,
+                                       U B,
+                                       const rocblas_int shiftB,
+                                       const rocblas_int ldb,
+                                       const rocblas_stride strideB,
+                                       rocblas_int* info,
+                                       const rocblas_int batch_count,
+                                       T* scalars,
+                                       rocblas_index_value_t<S>* work,
+                                       void* work1,
+                                       void* work2,
+                                       void* work3,
+                                       void* work4,
+                                       T* pivotval,
+                                       rocblas_int* pivotidx,
+                                       rocblas_int* iinfo,
+                                       T* savedB,
+                                       bool optim_mem)
+{
+    ROCSOLVER_ENTER("gesv", "n:", n, "nrhs:", nrhs, "shiftA:", shiftA, "lda:", lda,
+                    "shiftB:", shiftB, "ldb:", ldb, "bc:", batch_count);
+
+    // quick return if zero instances in batch
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocksReset = (batch_count - 1) / BLOCKSIZE + 1;
+    dim3 gridReset(blocksReset, 1, 1);
+    dim3 threads(BLOCKSIZE, 1, 1);
+
+    // info=0 (starting with a nonsingular matrix)
+    hipLaunchKernelGGL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
+
+    // quick return if A is empty
+    if(n == 0)
+        return rocblas_status_success;
+
+#ifdef OPTIMAL
+    // factorize and solve with a single kernel launch for small sizes
+    if(gesv_use_small<T>(n, nrhs))
+        return gesv_small<T>(handle, n, nrhs, A, shiftA, lda, strideA, ipiv, strideP, B, shiftB,
+                             ldb, strideB, info, batch_count);
+#endif
+
+    // compute LU factorization of A
+    rocsolver_getrf_template<BATCHED, STRIDED, true, T, S>(
+        handle, n, n, A, shiftA, lda, strideA, ipiv, 0, strideP, info, batch_count, scalars, work,
+        work1, work2, work3, work4, pivotval, pivotidx, iinfo, optim_mem);
+
+    // quick return if B is empty
+    if(nrhs == 0)
+        return rocblas_status_success;
+
+    const rocblas_int copyblocksx = (nrhs - 1) / 32 + 1;
+    const rocblas_int copyblocksy = (n - 1) / 32 + 1;
+
+    // save elements of B that will be overwritten by GETRS for cases where info is nonzero
+    hipLaunchKernelGGL((masked_copymat<T, U>), dim3(copyblocksx, copyblocksy, batch_count),
+                       dim3(32, 32), 0, stream, copymat_to_buffer, n, nrhs, B, shiftB, ldb,
+                       strideB, savedB, info);
+
+    // solve AX = B, overwriting B with X
+    rocsolver_getrs_template<BATCHED, T>(handle, rocblas_operation_none, n, nrhs, A, shiftA, lda,
+                                         strideA, ipiv, strideP, B, shiftB, ldb, strideB,
+                                         batch_count, work1, work2, work3, work4, optim_mem);
+
+    // restore elements of B that were overwritten by GETRS in cases where info is nonzero
+    hipLaunchKernelGGL((masked_copymat<T, U>), dim3(copyblocksx, copyblocksy, batch_count),
+                       dim3(32, 32), 0, stream, copymat_from_buffer, n, nrhs, B, shiftB, ldb,
+                       strideB, savedB, info);
+
+    return rocblas_status_success;
+}
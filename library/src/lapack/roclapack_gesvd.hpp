@@ -402,7 +402,9 @@ void rocsolver_gesvd_getMemorySize(const rocblas_svect left_svect,
     const bool othervO = !row ? leftvO : rightvO;
     const bool othervA = !row ? leftvA : rightvA;
     const bool othervN = !row ? leftvN : rightvN;
-    const bool thinSVD = (m >= THIN_SVD_SWITCH * n || n >= THIN_SVD_SWITCH * m);
+    const double thin_switch = rocsolver_tuning::get()->thin_svd_switch;
+
+    const bool thinSVD = (m >= thin_switch * n || n >= thin_switch * m);
     const bool fast_thinSVD = (thinSVD && fast_alg == rocblas_outofplace);
 
     // auxiliary sizes and variables
@@ -590,7 +592,10 @@ rocblas_status rocsolver_gesvd_template(rocblas_handle handle,
     const bool othervO = !row ? leftvO : rightvO;
     const bool othervA = !row ? leftvA : rightvA;
     const bool othervN = !row ? leftvN : rightvN;
-    const bool thinSVD = (m >= THIN_SVD_SWITCH * n || n >= THIN_SVD_SWITCH * m);
+    const double thin_switch = rocsolver_tuning::get()->thin_svd_switch;
+    const rocblas_int nb = rocsolver_tuning::get()->gebrd_gebd2_switchsize;
+
+    const bool thinSVD = (m >= thin_switch * n || n >= thin_switch * m);
     const bool fast_thinSVD = (thinSVD && fast_alg == rocblas_outofplace);
 
     // auxiliary sizes and variables
@@ -605,8 +610,8 @@ rocblas_status rocsolver_gesvd_template(rocblas_handle handle,
     const rocblas_int shiftV = 0;
     const rocblas_int ldx = thinSVD ? k : m;
     const rocblas_int ldy = thinSVD ? k : n;
-    const rocblas_stride strideX = ldx * GEBRD_GEBD2_SWITCHSIZE;
-    const rocblas_stride strideY = ldy * GEBRD_GEBD2_SWITCHSIZE;
+    const rocblas_stride strideX = ldx * nb;
+    const rocblas_stride strideY = ldy * nb;
     T* bufferT = tempArrayT;
     rocblas_int ldt = k;
     rocblas_stride strideT = k * k;
@@ -72,9 +72,9 @@ rocblas_status rocsolver_gesvd_strided_batched_impl(rocblas_handle handle,
     // memory workspace allocation
     void *scalars, *work_workArr, *Abyx_norms_tmptr, *Abyx_norms_trfact_X, *diag_tmptr_Y, *tau;
     void *tempArrayT, *tempArrayC, *workArr;
-    rocblas_device_malloc mem(handle, size_scalars, size_work_workArr, size_Abyx_norms_tmptr,
-                              size_Abyx_norms_trfact_X, size_diag_tmptr_Y, size_tau,
-                              size_tempArrayT, size_tempArrayC, size_workArr);
+    rocsolver_device_malloc mem(handle, size_scalars, size_work_workArr, size_Abyx_norms_tmptr,
+                                size_Abyx_norms_trfact_X, size_diag_tmptr_Y, size_tau,
+                                size_tempArrayT, size_tempArrayC, size_workArr);
 
     if(!mem)
         return rocblas_status_memory_error;
@@ -0,0 +1,445 @@
+/************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "roclapack_syevj_heevj.hpp"
+#include "rocsolver.h"
+
+/****************************************************************************
+GESVDJ works with B = A if m >= n, or B = A' otherwise. The one-sided Jacobi
+method applies rotations to the columns of B until they are mutually orthogonal:
+B*Q = U*S, where the singular values S are the norms of the columns and Q is the
+product of the rotations. The left and right singular vectors of A are then
+U and Q (m >= n), or Q and U (m < n).
+***************************************************************************/
+
+/** GESVDJ_LDS_LAYOUT decides which working arrays are kept in LDS and returns
+    the size of the dynamic shared memory **/
+template <typename T, typename S>
+void gesvdj_lds_layout(const bool needQ,
+                       const rocblas_int m,
+                       const rocblas_int n,
+                       bool* lds_b,
+                       bool* lds_q,
+                       size_t* lmemsize)
+{
+    rocblas_int nn = std::min(m, n);
+    rocblas_int half = (nn + 1) / 2;
+    size_t bsize = sizeof(T) * m * n;
+    size_t qsize = sizeof(T) * nn * nn;
+    size_t rsize = (sizeof(T) + sizeof(S)) * half;
+
+    *lds_b = (bsize + rsize <= JACOBI_MAX_LDS);
+    *lds_q = (*lds_b && needQ && bsize + qsize + rsize <= JACOBI_MAX_LDS);
+    *lmemsize = (*lds_b ? bsize + (*lds_q ? qsize : 0) + rsize : 0);
+}
+
+/** GESVDJ_KERNEL computes the singular values and optionally the singular
+    vectors of a general matrix with the one-sided cyclic Jacobi method **/
+template <typename T, typename S, typename U>
+__global__ void __launch_bounds__(JACOBI_BDIM) gesvdj_kernel(const rocblas_svect left_svect,
+                                                             const rocblas_svect right_svect,
+                                                             const rocblas_int m,
+                                                             const rocblas_int n,
+                                                             U AA,
+                                                             const rocblas_int shiftA,
+                                                             const rocblas_int lda,
+                                                             const rocblas_stride strideA,
+                                                             const S tolerance,
+                                                             S* residualA,
+                                                             const rocblas_int max_sweeps,
+                                                             rocblas_int* n_sweepsA,
+                                                             S* SS,
+                                                             const rocblas_stride strideS,
+                                                             T* UU,
+                                                             const rocblas_int ldu,
+                                                             const rocblas_stride strideU,
+                                                             T* VV,
+                                                             const rocblas_int ldv,
+                                                             const rocblas_stride strideV,
+                                                             rocblas_int* infoA,
+                                                             T* work,
+                                                             const bool lds_b,
+                                                             const bool lds_q)
+{
+    rocblas_int tid = hipThreadIdx_x;
+    rocblas_int nthreads = hipBlockDim_x;
+    rocblas_int bid = hipBlockIdx_y;
+    rocblas_int bc = hipGridDim_y;
+    rocblas_int mm = max(m, n);
+    rocblas_int nn = min(m, n);
+    rocblas_int n2 = nn + (nn & 1);
+    rocblas_int half = n2 / 2;
+    bool leftv = (left_svect == rocblas_svect_singular);
+    bool rightv = (right_svect == rocblas_svect_singular);
+    bool needQ = (m >= n ? rightv : leftv);
+
+    // select batch instance
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+    S* Sv = SS + (bid * strideS);
+    T* Uv = UU + (bid * strideU);
+    T* Vv = VV + (bid * strideV);
+
+    // working matrices and rotations of the current round
+    // (in LDS when they fit; otherwise in the workspace)
+    extern __shared__ double lmem[];
+    T *B, *sines, *Q = nullptr;
+    S* cosines;
+    T* wptr = work;
+    if(lds_b)
+    {
+        B = (T*)lmem;
+        sines = B + mm * nn;
+        if(lds_q)
+        {
+            Q = sines;
+            sines += nn * nn;
+        }
+        cosines = (S*)(sines + half);
+    }
+    else
+    {
+        B = wptr + bid * mm * nn;
+        wptr += bc * mm * nn;
+    }
+    if(needQ && !lds_q)
+    {
+        Q = wptr + bid * nn * nn;
+        wptr += bc * nn * nn;
+    }
+    if(!lds_b)
+    {
+        sines = wptr + bid * half;
+        cosines = (S*)(wptr + bc * half) + bid * half;
+    }
+
+    __shared__ S sval[JACOBI_BDIM + 1];
+    __shared__ rocblas_int piv;
+
+    // copy A (or A') to the working array and initialize Q
+    S lnrm = 0;
+    for(rocblas_int k = tid; k < mm * nn; k += nthreads)
+    {
+        rocblas_int i = k % mm;
+        rocblas_int j = k / mm;
+        B[k] = (m >= n ? A[i + j * lda] : conj(A[j + i * lda]));
+        lnrm += jacobi_abs2<S>(B[k]);
+    }
+    if(needQ)
+    {
+        for(rocblas_int k = tid; k < nn * nn; k += nthreads)
+            Q[k] = (k % nn == k / nn ? T(1) : T(0));
+    }
+
+    // the tolerance is relative to the squared norm of A
+    S tol = tolerance * jacobi_reduce_sum(tid, nthreads, lnrm, sval);
+
+    // main loop (off is the same in all threads)
+    rocblas_int sweeps = 0;
+    S off = 0;
+    bool converged = false;
+    while(!converged && sweeps < max_sweeps)
+    {
+        S loff = 0;
+        for(rocblas_int r = 0; r < n2 - 1; ++r)
+        {
+            rocblas_int p, q;
+
+            // compute the rotations of this round from the 2-by-2 Gram matrices
+            // of the pairs of columns
+            for(rocblas_int k = tid; k < half; k += nthreads)
+            {
+                jacobi_pair(k, r, n2, &p, &q);
+                if(q < nn)
+                {
+                    S alpha = 0, beta = 0;
+                    T gamma = T(0);
+                    for(rocblas_int i = 0; i < mm; ++i)
+                    {
+                        T bp = B[i + p * mm];
+                        T bq = B[i + q * mm];
+                        alpha += jacobi_abs2<S>(bp);
+                        beta += jacobi_abs2<S>(bq);
+                        gamma += conj(bp) * bq;
+                    }
+                    loff += 2 * jacobi_abs2<S>(gamma);
+                    jacobi_rotation(alpha, beta, gamma, cosines + k, sines + k);
+                }
+                else
+                {
+                    cosines[k] = 1;
+                    sines[k] = T(0);
+                }
+            }
+            __syncthreads();
+
+            // update the columns of B and Q
+            for(rocblas_int kk = tid; kk < half * mm; kk += nthreads)
+            {
+                rocblas_int k = kk / mm;
+                rocblas_int i = kk % mm;
+                T s = sines[k];
+                if(s != T(0))
+                {
+                    jacobi_pair(k, r, n2, &p, &q);
+                    jacobi_rotate_cols(cosines[k], s, B + i + p * mm, B + i + q * mm);
+                    if(needQ && i < nn)
+                        jacobi_rotate_cols(cosines[k], s, Q + i + p * nn, Q + i + q * nn);
+                }
+            }
+            __syncthreads();
+        }
+        sweeps++;
+
+        off = sqrt(jacobi_reduce_sum(tid, nthreads, loff, sval));
+        converged = (off <= tol);
+    }
+
+    // the singular values are the norms of the columns of B
+    for(rocblas_int j = tid; j < nn; j += nthreads)
+    {
+        S s2 = 0;
+        for(rocblas_int i = 0; i < mm; ++i)
+            s2 += jacobi_abs2<S>(B[i + j * mm]);
+        Sv[j] = sqrt(s2);
+    }
+    __syncthreads();
+
+    // sort the singular values (and vectors) in decreasing order
+    for(rocblas_int i = 0; i < nn - 1; ++i)
+    {
+        if(tid == 0)
+        {
+            rocblas_int k = i;
+            S p = Sv[i];
+            for(rocblas_int j = i + 1; j < nn; ++j)
+            {
+                if(Sv[j] > p)
+                {
+                    k = j;
+                    p = Sv[j];
+                }
+            }
+            Sv[k] = Sv[i];
+            Sv[i] = p;
+            piv = k;
+        }
+        __syncthreads();
+
+        if(piv != i)
+        {
+            swapvect(mm, B + i * mm, 1, B + piv * mm, 1, tid, nthreads);
+            if(needQ)
+                swapvect(nn, Q + i * nn, 1, Q + piv * nn, 1, tid, nthreads);
+        }
+        __syncthreads();
+    }
+
+    // write the singular vectors; the normalized columns of B are the left
+    // (m >= n) or right (m < n) singular vectors
+    if(m >= n)
+    {
+        if(leftv)
+        {
+            for(rocblas_int k = tid; k < m * n; k += nthreads)
+            {
+                rocblas_int i = k % m;
+                rocblas_int j = k / m;
+                S sj = Sv[j];
+                Uv[i + j * ldu] = (sj > 0 ? (1 / sj) * B[k] : B[k]);
+            }
+        }
+        if(rightv)
+        {
+            for(rocblas_int k = tid; k < n * n; k += nthreads)
+            {
+                rocblas_int i = k % n;
+                rocblas_int j = k / n;
+                Vv[i + j * ldv] = conj(Q[j + i * n]);
+            }
+        }
+    }
+    else
+    {
+        if(leftv)
+        {
+            for(rocblas_int k = tid; k < m * m; k += nthreads)
+            {
+                rocblas_int i = k % m;
+                rocblas_int j = k / m;
+                Uv[i + j * ldu] = Q[k];
+            }
+        }
+        if(rightv)
+        {
+            for(rocblas_int k = tid; k < m * n; k += nthreads)
+            {
+                rocblas_int i = k % m;
+                rocblas_int j = k / m;
+                S si = Sv[i];
+                T bji = conj(B[j + i * mm]);
+                Vv[i + j * ldv] = (si > 0 ? (1 / si) * bji : bji);
+            }
+        }
+    }
+
+    if(tid == 0)
+    {
+        residualA[bid] = off;
+        n_sweepsA[bid] = sweeps;
+        infoA[bid] = (converged ? 0 : 1);
+    }
+}
+
+/** Helper to calculate workspace sizes **/
+template <typename T, typename S>
+void rocsolver_gesvdj_getMemorySize(const rocblas_svect left_svect,
+                                    const rocblas_svect right_svect,
+                                    const rocblas_int m,
+                                    const rocblas_int n,
+                                    const rocblas_int batch_count,
+                                    size_t* size_work)
+{
+    // if quick return, set workspace to zero
+    if(n == 0 || m == 0 || batch_count == 0)
+    {
+        *size_work = 0;
+        return;
+    }
+
+    // the working matrices and the rotations only need global memory when
+    // they do not fit in LDS
+    bool needQ = (m >= n ? right_svect : left_svect) == rocblas_svect_singular;
+    bool lds_b, lds_q;
+    size_t lmemsize;
+    gesvdj_lds_layout<T, S>(needQ, m, n, &lds_b, &lds_q, &lmemsize);
+
+    rocblas_int nn = std::min(m, n);
+    rocblas_int half = (nn + 1) / 2;
+    size_t w = 0;
+    if(!lds_b)
+        w += sizeof(T) * (m * n + half) + sizeof(S) * half;
+    if(needQ && !lds_q)
+        w += sizeof(T) * nn * nn;
+    *size_work = w * batch_count;
+}
+
+/** Argument checking **/
+template <typename T, typename S, typename W>
+rocblas_status rocsolver_gesvdj_argCheck(rocblas_handle handle,
+                                         const rocblas_svect left_svect,
+                                         const rocblas_svect right_svect,
+                                         const rocblas_int m,
+                                         const rocblas_int n,
+                                         W A,
+                                         const rocblas_int lda,
+                                         S* residual,
+                                         const rocblas_int max_sweeps,
+                                         rocblas_int* n_sweeps,
+                                         S* Sv,
+                                         T* U,
+                                         const rocblas_int ldu,
+                                         T* V,
+                                         const rocblas_int ldv,
+                                         rocblas_int* info,
+                                         const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if((left_svect != rocblas_svect_singular && left_svect != rocblas_svect_none)
+       || (right_svect != rocblas_svect_singular && right_svect != rocblas_svect_none))
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || m < 0 || lda < m || ldu < 1 || ldv < 1 || max_sweeps <= 0 || batch_count < 0)
+        return rocblas_status_invalid_size;
+    if(left_svect == rocblas_svect_singular && ldu < m)
+        return rocblas_status_invalid_size;
+    if(right_svect == rocblas_svect_singular && ldv < min(m, n))
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n * m && !A) || (min(m, n) && !Sv) || (batch_count && !residual)
+       || (batch_count && !n_sweeps) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+    if(left_svect == rocblas_svect_singular && min(m, n) && !U)
+        return rocblas_status_invalid_pointer;
+    if(right_svect == rocblas_svect_singular && min(m, n) && !V)
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T, typename S, typename W>
+rocblas_status rocsolver_gesvdj_template(rocblas_handle handle,
+                                         const rocblas_svect left_svect,
+                                         const rocblas_svect right_svect,
+                                         const rocblas_int m,
+                                         const rocblas_int n,
+                                         W A,
+                                         const rocblas_int shiftA,
+                                         const rocblas_int lda,
+                                         const rocblas_stride strideA,
+                                         const S abstol,
+                                         S* residual,
+                                         const rocblas_int max_sweeps,
+                                         rocblas_int* n_sweeps,
+                                         S* Sv,
+                                         const rocblas_stride strideS,
+                                         T* U,
+                                         const rocblas_int ldu,
+                                         const rocblas_stride strideU,
+                                         T* V,
+                                         const rocblas_int ldv,
+                                         const rocblas_stride strideV,
+                                         rocblas_int* info,
+                                         const rocblas_int batch_count,
+                                         T* work)
+{
+    ROCSOLVER_ENTER("gesvdj", "leftsv:", left_svect, "rightsv:", right_svect, "m:", m, "n:", n,
+                    "shiftA:", shiftA, "lda:", lda, "abstol:", abstol, "max_sweeps:", max_sweeps,
+                    "ldu:", ldu, "ldv:", ldv, "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // quick return
+    if(n == 0 || m == 0)
+    {
+        rocblas_int blocksReset = (batch_count - 1) / BLOCKSIZE + 1;
+        dim3 gridReset(blocksReset, 1, 1);
+        dim3 threads(BLOCKSIZE, 1, 1);
+        hipLaunchKernelGGL(reset_info, gridReset, threads, 0, stream, residual, batch_count, 0);
+        hipLaunchKernelGGL(reset_info, gridReset, threads, 0, stream, n_sweeps, batch_count, 0);
+        hipLaunchKernelGGL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
+        return rocblas_status_success;
+    }
+
+    bool needQ = (m >= n ? right_svect : left_svect) == rocblas_svect_singular;
+    bool lds_b, lds_q;
+    size_t lmemsize;
+    gesvdj_lds_layout<T, S>(needQ, m, n, &lds_b, &lds_q, &lmemsize);
+
+    // the tolerance is relative to the squared norm of A
+    S tolerance = (abstol <= 0 ? get_epsilon<S>() : abstol);
+
+    rocblas_int nthreads = jacobi_nthreads((std::min(m, n) + 1) / 2, std::max(m, n));
+    hipLaunchKernelGGL((gesvdj_kernel<T>), dim3(1, batch_count), dim3(nthreads), lmemsize, stream,
+                       left_svect, right_svect, m, n, A, shiftA, lda, strideA, tolerance, residual,
+                       max_sweeps, n_sweeps, Sv, strideS, U, ldu, strideU, V, ldv, strideV, info,
+                       work, lds_b, lds_q);
+
+    return rocblas_status_success;
+}
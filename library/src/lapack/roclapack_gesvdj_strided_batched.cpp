@@ -0,0 +1,195 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_gesvdj.hpp"
+
+template <typename T, typename TT, typename W>
+rocblas_status rocsolver_gesvdj_strided_batched_impl(rocblas_handle handle,
+                                                     const rocblas_svect left_svect,
+                                                     const rocblas_svect right_svect,
+                                                     const rocblas_int m,
+                                                     const rocblas_int n,
+                                                     W A,
+                                                     const rocblas_int lda,
+                                                     const rocblas_stride strideA,
+                                                     const TT abstol,
+                                                     TT* residual,
+                                                     const rocblas_int max_sweeps,
+                                                     rocblas_int* n_sweeps,
+                                                     TT* S,
+                                                     const rocblas_stride strideS,
+                                                     T* U,
+                                                     const rocblas_int ldu,
+                                                     const rocblas_stride strideU,
+                                                     T* V,
+                                                     const rocblas_int ldv,
+                                                     const rocblas_stride strideV,
+                                                     rocblas_int* info,
+                                                     const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("gesvdj_strided_batched", "--left_svect", left_svect, "--right_svect",
+                        right_svect, "-m", m, "-n", n, "--lda", lda, "--strideA", strideA,
+                        "--abstol", abstol, "--max_sweeps", max_sweeps, "--strideS", strideS,
+                        "--ldu", ldu, "--strideU", strideU, "--ldv", ldv, "--strideV", strideV,
+                        "--batch_count", batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_gesvdj_argCheck(handle, left_svect, right_svect, m, n, A, lda,
+                                                  residual, max_sweeps, n_sweeps, S, U, ldu, V, ldv,
+                                                  info, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+
+    // memory workspace sizes:
+    // size for the working matrices and the rotations (only when they do not fit in LDS)
+    size_t size_work;
+    rocsolver_gesvdj_getMemorySize<T, TT>(left_svect, right_svect, m, n, batch_count, &size_work);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_work);
+
+    // memory workspace allocation
+    void* work;
+    rocsolver_device_malloc mem(handle, size_work);
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    work = mem[0];
+
+    // execution
+    return rocsolver_gesvdj_template<T>(handle, left_svect, right_svect, m, n, A, shiftA, lda,
+                                        strideA, abstol, residual, max_sweeps, n_sweeps, S, strideS,
+                                        U, ldu, strideU, V, ldv, strideV, info, batch_count,
+                                        (T*)work);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sgesvdj_strided_batched(rocblas_handle handle,
+                                                 const rocblas_svect left_svect,
+                                                 const rocblas_svect right_svect,
+                                                 const rocblas_int m,
+                                                 const rocblas_int n,
+                                                 float* A,
+                                                 const rocblas_int lda,
+                                                 const rocblas_stride strideA,
+                                                 const float abstol,
+                                                 float* residual,
+                                                 const rocblas_int max_sweeps,
+                                                 rocblas_int* n_sweeps,
+                                                 float* S,
+                                                 const rocblas_stride strideS,
+                                                 float* U,
+                                                 const rocblas_int ldu,
+                                                 const rocblas_stride strideU,
+                                                 float* V,
+                                                 const rocblas_int ldv,
+                                                 const rocblas_stride strideV,
+                                                 rocblas_int* info,
+                                                 const rocblas_int batch_count)
+{
+    return rocsolver_gesvdj_strided_batched_impl<float>(handle, left_svect, right_svect, m, n, A,
+                                                        lda, strideA, abstol, residual, max_sweeps,
+                                                        n_sweeps, S, strideS, U, ldu, strideU, V,
+                                                        ldv, strideV, info, batch_count);
+}
+
+rocblas_status rocsolver_dgesvdj_strided_batched(rocblas_handle handle,
+                                                 const rocblas_svect left_svect,
+                                                 const rocblas_svect right_svect,
+                                                 const rocblas_int m,
+                                                 const rocblas_int n,
+                                                 double* A,
+                                                 const rocblas_int lda,
+                                                 const rocblas_stride strideA,
+                                                 const double abstol,
+                                                 double* residual,
+                                                 const rocblas_int max_sweeps,
+                                                 rocblas_int* n_sweeps,
+                                                 double* S,
+                                                 const rocblas_stride strideS,
+                                                 double* U,
+                                                 const rocblas_int ldu,
+                                                 const rocblas_stride strideU,
+                                                 double* V,
+                                                 const rocblas_int ldv,
+                                                 const rocblas_stride strideV,
+                                                 rocblas_int* info,
+                                                 const rocblas_int batch_count)
+{
+    return rocsolver_gesvdj_strided_batched_impl<double>(handle, left_svect, right_svect, m, n, A,
+                                                         lda, strideA, abstol, residual, max_sweeps,
+                                                         n_sweeps, S, strideS, U, ldu, strideU, V,
+                                                         ldv, strideV, info, batch_count);
+}
+
+rocblas_status rocsolver_cgesvdj_strided_batched(rocblas_handle handle,
+                                                 const rocblas_svect left_svect,
+                                                 const rocblas_svect right_svect,
+                                                 const rocblas_int m,
+                                                 const rocblas_int n,
+                                                 rocblas_float_complex* A,
+                                                 const rocblas_int lda,
+                                                 const rocblas_stride strideA,
+                                                 const float abstol,
+                                                 float* residual,
+                                                 const rocblas_int max_sweeps,
+                                                 rocblas_int* n_sweeps,
+                                                 float* S,
+                                                 const rocblas_stride strideS,
+                                                 rocblas_float_complex* U,
+                                                 const rocblas_int ldu,
+                                                 const rocblas_stride strideU,
+                                                 rocblas_float_complex* V,
+                                                 const rocblas_int ldv,
+                                                 const rocblas_stride strideV,
+                                                 rocblas_int* info,
+                                                 const rocblas_int batch_count)
+{
+    return rocsolver_gesvdj_strided_batched_impl<rocblas_float_complex>(
+        handle, left_svect, right_svect, m, n, A, lda, strideA, abstol, residual, max_sweeps,
+        n_sweeps, S, strideS, U, ldu, strideU, V, ldv, strideV, info, batch_count);
+}
+
+rocblas_status rocsolver_zgesvdj_strided_batched(rocblas_handle handle,
+                                                 const rocblas_svect left_svect,
+                                                 const rocblas_svect right_svect,
+                                                 const rocblas_int m,
+                                                 const rocblas_int n,
+                                                 rocblas_double_complex* A,
+                                                 const rocblas_int lda,
+                                                 const rocblas_stride strideA,
+                                                 const double abstol,
+                                                 double* residual,
+                                                 const rocblas_int max_sweeps,
+                                                 rocblas_int* n_sweeps,
+                                                 double* S,
+                                                 const rocblas_stride strideS,
+                                                 rocblas_double_complex* U,
+                                                 const rocblas_int ldu,
+                                                 const rocblas_stride strideU,
+                                                 rocblas_double_complex* V,
+                                                 const rocblas_int ldv,
+                                                 const rocblas_stride strideV,
+                                                 rocblas_int* info,
+                                                 const rocblas_int batch_count)
+{
+    return rocsolver_gesvdj_strided_batched_impl<rocblas_double_complex>(
+        handle, left_svect, right_svect, m, n, A, lda, strideA, abstol, residual, max_sweeps,
+        n_sweeps, S, strideS, U, ldu, strideU, V, ldv, strideV, info, batch_count);
+}
+
+} // extern C
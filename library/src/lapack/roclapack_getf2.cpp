@@ -3,6 +3,7 @@
  * ************************************************************************ */
 
 #include "roclapack_getf2.hpp"
+#include "rocsolver_plan.hpp"
 
 template <bool PIVOT, typename T, typename U>
 rocblas_status rocsolver_getf2_impl(rocblas_handle handle,
@@ -52,7 +53,7 @@ rocblas_status rocsolver_getf2_impl(rocblas_handle handle,
 
     // memory workspace allocation
     void *scalars, *pivotidx, *pivotval, *work;
-    rocblas_device_malloc mem(handle, size_scalars, size_work, size_pivotval, size_pivotidx);
+    rocsolver_device_malloc mem(handle, size_scalars, size_work, size_pivotval, size_pivotidx);
 
     if(!mem)
         return rocblas_status_memory_error;
@@ -70,6 +71,36 @@ rocblas_status rocsolver_getf2_impl(rocblas_handle handle,
         (T*)scalars, (rocblas_index_value_t<S>*)work, (T*)pivotval, (rocblas_int*)pivotidx);
 }
 
+template <bool PIVOT, typename T>
+void rocsolver_getf2_plan(const rocsolver_batch_mode mode,
+                          const rocblas_int m,
+                          const rocblas_int n,
+                          const rocblas_int batch_count,
+                          rocsolver_workspace_plan* plan)
+{
+    using S = decltype(std::real(T{}));
+
+    // normal execution works with a single matrix
+    const rocblas_int bc = (mode == rocsolver_batch_none ? 1 : batch_count);
+
+    // memory workspace sizes
+    size_t size_scalars, size_work, size_pivotval, size_pivotidx;
+    if(mode == rocsolver_batch_none)
+        rocsolver_getf2_getMemorySize<false, T, S>(m, n, bc, &size_scalars, &size_work,
+                                                   &size_pivotval, &size_pivotidx);
+    else
+        rocsolver_getf2_getMemorySize<true, T, S>(m, n, bc, &size_scalars, &size_work,
+                                                  &size_pivotval, &size_pivotidx);
+
+    rocsolver_plan_add(plan, "scalars", size_scalars);
+    rocsolver_plan_add(plan, "work", size_work);
+    rocsolver_plan_add(plan, "pivotval", size_pivotval);
+    rocsolver_plan_add(plan, "pivotidx", size_pivotidx);
+
+    if(!rocsolver_plan_quick_return(mode, m, n, batch_count))
+        plan->algorithm = (PIVOT ? "getf2" : "getf2_npvt");
+}
+
 /*
  * ===========================================================================
  *    C wrapper
@@ -166,4 +197,28 @@ rocblas_status rocsolver_zgetf2_npvt(rocblas_handle handle,
     return rocsolver_getf2_impl<false, rocblas_double_complex>(handle, m, n, A, lda, ipiv, info);
 }
 
+rocblas_status rocsolver_plan_getf2(const rocblas_datatype type,
+                                    const rocsolver_batch_mode mode,
+                                    const rocblas_int m,
+                                    const rocblas_int n,
+                                    const rocblas_int batch_count,
+                                    rocsolver_workspace_plan* plan)
+{
+    return rocsolver_plan_template(type, mode, m, n, batch_count, plan, [&](auto t) {
+        rocsolver_getf2_plan<true, decltype(t)>(mode, m, n, batch_count, plan);
+    });
+}
+
+rocblas_status rocsolver_plan_getf2_npvt(const rocblas_datatype type,
+                                         const rocsolver_batch_mode mode,
+                                         const rocblas_int m,
+                                         const rocblas_int n,
+                                         const rocblas_int batch_count,
+                                         rocsolver_workspace_plan* plan)
+{
+    return rocsolver_plan_template(type, mode, m, n, batch_count, plan, [&](auto t) {
+        rocsolver_getf2_plan<false, decltype(t)>(mode, m, n, batch_count, plan);
+    });
+}
+
 } // extern C
@@ -52,7 +52,7 @@ rocblas_status rocsolver_getf2_strided_batched_impl(rocblas_handle handle,
 
     // memory workspace allocation
     void *scalars, *pivotidx, *pivotval, *work;
-    rocblas_device_malloc mem(handle, size_scalars, size_work, size_pivotval, size_pivotidx);
+    rocsolver_device_malloc mem(handle, size_scalars, size_work, size_pivotval, size_pivotidx);
 
     if(!mem)
         return rocblas_status_memory_error;
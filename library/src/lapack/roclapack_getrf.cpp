@@ -3,6 +3,7 @@
  * ************************************************************************ */
 
 #include "roclapack_getrf.hpp"
+#include "rocsolver_plan.hpp"
 
 template <bool PIVOT, typename T, typename U>
 rocblas_status rocsolver_getrf_impl(rocblas_handle handle,
@@ -58,8 +59,8 @@ rocblas_status rocsolver_getrf_impl(rocblas_handle handle,
 
     // memory workspace allocation
     void *scalars, *work, *work1, *work2, *work3, *work4, *pivotval, *pivotidx, *iinfo;
-    rocblas_device_malloc mem(handle, size_scalars, size_work, size_work1, size_work2, size_work3,
-                              size_work4, size_pivotval, size_pivotidx, size_iinfo);
+    rocsolver_device_malloc mem(handle, size_scalars, size_work, size_work1, size_work2, size_work3,
+                                size_work4, size_pivotval, size_pivotidx, size_iinfo);
 
     if(!mem)
         return rocblas_status_memory_error;
@@ -83,6 +84,71 @@ rocblas_status rocsolver_getrf_impl(rocblas_handle handle,
         (rocblas_int*)pivotidx, (rocblas_int*)iinfo, optim_mem);
 }
 
+template <bool PIVOT, typename T>
+void rocsolver_getrf_plan(const rocsolver_batch_mode mode,
+                          const rocblas_int m,
+                          const rocblas_int n,
+                          const rocblas_int batch_count,
+                          rocsolver_workspace_plan* plan)
+{
+    using S = decltype(std::real(T{}));
+
+    // normal execution works with a single matrix
+    const rocblas_int bc = (mode == rocsolver_batch_none ? 1 : batch_count);
+
+    // memory workspace sizes
+    size_t size_scalars, size_work, size_work1, size_work2, size_work3, size_work4;
+    size_t size_pivotval, size_pivotidx, size_iinfo;
+    if(mode == rocsolver_batch_pointers)
+        rocsolver_getrf_getMemorySize<true, false, PIVOT, T, S>(
+            m, n, bc, &size_scalars, &size_work, &size_work1, &size_work2, &size_work3,
+            &size_work4, &size_pivotval, &size_pivotidx, &size_iinfo);
+    else if(mode == rocsolver_batch_strided)
+        rocsolver_getrf_getMemorySize<false, true, PIVOT, T, S>(
+            m, n, bc, &size_scalars, &size_work, &size_work1, &size_work2, &size_work3,
+            &size_work4, &size_pivotval, &size_pivotidx, &size_iinfo);
+    else
+        rocsolver_getrf_getMemorySize<false, false, PIVOT, T, S>(
+            m, n, bc, &size_scalars, &size_work, &size_work1, &size_work2, &size_work3,
+            &size_work4, &size_pivotval, &size_pivotidx, &size_iinfo);
+
+    rocsolver_plan_add(plan, "scalars", size_scalars);
+    rocsolver_plan_add(plan, "work", size_work);
+    rocsolver_plan_add(plan, "work1", size_work1);
+    rocsolver_plan_add(plan, "work2", size_work2);
+    rocsolver_plan_add(plan, "work3", size_work3);
+    rocsolver_plan_add(plan, "work4", size_work4);
+    rocsolver_plan_add(plan, "pivotval", size_pivotval);
+    rocsolver_plan_add(plan, "pivotidx", size_pivotidx);
+    rocsolver_plan_add(plan, "iinfo", size_iinfo);
+
+    if(rocsolver_plan_quick_return(mode, m, n, batch_count))
+        return;
+
+    // a block size of 1 means that a single GETF2 is executed
+    rocblas_int blk = (mode == rocsolver_batch_none) ? getrf_get_blksize<false, PIVOT>(min(m, n))
+                                                     : getrf_get_blksize<true, PIVOT>(min(m, n));
+
+    // tall matrices factorized with tournament pivoting are always blocked
+    if(blk == 1 && mode == rocsolver_batch_none
+       && rocsolver_getrf_tournament_usable<false, false, PIVOT>(m))
+        blk = min(min(m, n), WAVESIZE);
+
+    if(blk == 1)
+        plan->algorithm = (PIVOT ? "getf2" : "getf2_npvt");
+    else
+    {
+        getrf_variant variant = getrf_get_variant(m, n);
+        if(variant == getrf_left_looking)
+            plan->algorithm = (PIVOT ? "getrf_left_looking" : "getrf_npvt_left_looking");
+        else if(variant == getrf_recursive)
+            plan->algorithm = (PIVOT ? "getrf_recursive" : "getrf_npvt_recursive");
+        else
+            plan->algorithm = (PIVOT ? "getrf" : "getrf_npvt");
+        plan->block_size = blk;
+    }
+}
+
 /*
  * ===========================================================================
  *    C wrapper
@@ -179,4 +245,28 @@ rocblas_status rocsolver_zgetrf_npvt(rocblas_handle handle,
     return rocsolver_getrf_impl<false, rocblas_double_complex>(handle, m, n, A, lda, ipiv, info);
 }
 
+rocblas_status rocsolver_plan_getrf(const rocblas_datatype type,
+                                    const rocsolver_batch_mode mode,
+                                    const rocblas_int m,
+                                    const rocblas_int n,
+                                    const rocblas_int batch_count,
+                                    rocsolver_workspace_plan* plan)
+{
+    return rocsolver_plan_template(type, mode, m, n, batch_count, plan, [&](auto t) {
+        rocsolver_getrf_plan<true, decltype(t)>(mode, m, n, batch_count, plan);
+    });
+}
+
+rocblas_status rocsolver_plan_getrf_npvt(const rocblas_datatype type,
+                                         const rocsolver_batch_mode mode,
+                                         const rocblas_int m,
+                                         const rocblas_int n,
+                                         const rocblas_int batch_count,
+                                         rocsolver_workspace_plan* plan)
+{
+    return rocsolver_plan_template(type, mode, m, n, batch_count, plan, [&](auto t) {
+        rocsolver_getrf_plan<false, decltype(t)>(mode, m, n, batch_count, plan);
+    });
+}
+
 } // extern C
@@ -12,52 +12,133 @@
 #include "auxiliary/rocauxiliary_laswp.hpp"
 #include "rocblas.hpp"
 #include "roclapack_getf2.hpp"
+#include "roclapack_getrf_tournament.hpp"
 #include "rocsolver.h"
 
 
 template <bool ISBATCHED, bool PIVOT>
 rocblas_int getrf_get_blksize(rocblas_int dim)
 {
+    auto t = rocsolver_tuning::get();
     rocblas_int blk;
 
     if(ISBATCHED)
     {
         if(PIVOT)
         {
-            rocblas_int size[] = {GETRF_BATCH_BLKSIZES};
-            rocblas_int intervals[] = {GETRF_BATCH_INTERVALS};
-            rocblas_int max = GETRF_BATCH_NUM_INTERVALS;
-            blk = size[get_index(intervals, max, dim)];
+            blk = rocsolver_tuning_table::get_blksize(t->getrf_batch_intervals,
+                                                      t->getrf_batch_blksizes, dim);
         }
         else
         {
-            rocblas_int size[] = {GETRF_NPVT_BATCH_BLKSIZES};
-            rocblas_int intervals[] = {GETRF_NPVT_BATCH_INTERVALS};
-            rocblas_int max = GETRF_NPVT_BATCH_NUM_INTERVALS;
-            blk = size[get_index(intervals, max, dim)];
+            blk = rocsolver_tuning_table::get_blksize(t->getrf_npvt_batch_intervals,
+                                                      t->getrf_npvt_batch_blksizes, dim);
         }
     }
     else
     {
         if(PIVOT)
         {
-            rocblas_int size[] = {GETRF_BLKSIZES};
-            rocblas_int intervals[] = {GETRF_INTERVALS};
-            rocblas_int max = GETRF_NUM_INTERVALS;
-            blk = size[get_index(intervals, max, dim)];
+            blk = rocsolver_tuning_table::get_blksize(t->getrf_intervals, t->getrf_blksizes, dim);
         }
         else
         {
-            rocblas_int size[] = {GETRF_NPVT_BLKSIZES};
-            rocblas_int intervals[] = {GETRF_NPVT_INTERVALS};
-            rocblas_int max = GETRF_NPVT_NUM_INTERVALS;
-            blk = size[get_index(intervals, max, dim)];
+            blk = rocsolver_tuning_table::get_blksize(t->getrf_npvt_intervals,
+                                                      t->getrf_npvt_blksizes, dim);
         }
     }
 
     return blk;
 }
 
+/** The blocked LU factorization is computed with one of the following variants:
+    - right-looking: each panel is factorized and then used to update the whole trailing
+      matrix (one TRSM and one GEMM of rank blk per panel).
+    - left-looking (Crout): each panel is first updated with all the previous panels (one
+      TRSM and one GEMM of rank j), and then factorized. The columns to the right of the
+      panel are not touched until they are reached, so that the row interchanges are applied
+      to them only once, in bulk.
+    - recursive: the columns are split in two halves; the left half is factorized
+      recursively, the right half is updated with it (TRSM and GEMM of rank n/2) and then
+      factorized recursively. The row interchanges of each half are applied to the other
+      half once, after it is factorized.
+    The panels (the leaves of the recursion) are factorized with GETF2. **/
+enum getrf_variant
+{
+    getrf_right_looking,
+    getrf_left_looking,
+    getrf_recursive
+};
+
+/** GETRF_GET_VARIANT returns the variant used for an m-by-n matrix. Tall matrices use the
+    left-looking variant and medium-sized matrices the recursive variant, if enabled by the
+    tuning table (by default, all matrices use the right-looking variant) **/
+inline getrf_variant getrf_get_variant(const rocblas_int m, const rocblas_int n)
+{
+    auto t = rocsolver_tuning::get();
+    rocblas_int dim = min(m, n);
+
+    if(t->getrf_left_looking_ratio > 0 && int64_t(m) >= int64_t(t->getrf_left_looking_ratio) * n)
+        return getrf_left_looking;
+
+    if(dim >= t->getrf_recursive_min_size && dim < t->getrf_recursive_max_size)
+        return getrf_recursive;
+
+    return getrf_right_looking;
+}
+
+/** GETRF_RECURSIVE_SPLIT returns the number of columns of the left half when nc columns
+    are split in the recursive variant (a multiple of blk) **/
+inline rocblas_int getrf_recursive_split(const rocblas_int nc, const rocblas_int blk)
+{
+    rocblas_int nblocks = (nc - 1) / blk + 1;
+    return ((nblocks + 1) / 2) * blk;
+}
+
+/** GETRF_TRSM_MEM updates the sizes of the TRSM workspace so that they are enough for
+    a k-by-nrhs right-hand side **/
+template <bool BATCHED, typename T>
+void getrf_trsm_mem(const rocblas_int k,
+                    const rocblas_int nrhs,
+                    const rocblas_int batch_count,
+                    size_t* size_work1,
+                    size_t* size_work2,
+                    size_t* size_work3,
+                    size_t* size_work4)
+{
+    size_t w1, w2, w3, w4;
+    rocblasCall_trsm_mem<BATCHED, T>(rocblas_side_left, k, nrhs, batch_count, &w1, &w2, &w3,
+                                     &w4);
+    *size_work1 = max(*size_work1, w1);
+    *size_work2 = max(*size_work2, w2);
+    *size_work3 = max(*size_work3, w3);
+    *size_work4 = max(*size_work4, w4);
+}
+
+/** GETRF_RECURSIVE_TRSM_MEM visits the recursion tree of columns j : j+nc-1 and updates
+    the sizes of the TRSM workspace accordingly **/
+template <bool BATCHED, typename T>
+void getrf_recursive_trsm_mem(const rocblas_int nc,
+                              const rocblas_int blk,
+                              const rocblas_int batch_count,
+                              size_t* size_work1,
+                              size_t* size_work2,
+                              size_t* size_work3,
+                              size_t* size_work4)
+{
+    if(nc <= blk)
+        return;
+
+    rocblas_int n1 = getrf_recursive_split(nc, blk);
+    rocblas_int n2 = nc - n1;
+    getrf_trsm_mem<BATCHED, T>(n1, n2, batch_count, size_work1, size_work2, size_work3,
+                               size_work4);
+    getrf_recursive_trsm_mem<BATCHED, T>(n1, blk, batch_count, size_work1, size_work2,
+                                         size_work3, size_work4);
+    getrf_recursive_trsm_mem<BATCHED, T>(n2, blk, batch_count, size_work1, size_work2,
+                                         size_work3, size_work4);
+}
+
 template <typename U>
 __global__ void getrf_check_singularity(const rocblas_int n,
                                         const rocblas_int j,
@@ -116,6 +197,11 @@ void rocsolver_getrf_getMemorySize(const rocblas_int m,
 
     rocblas_int dim = min(m, n);
     rocblas_int blk = getrf_get_blksize<ISBATCHED, PIVOT>(dim);
+    bool tournament = rocsolver_getrf_tournament_usable<BATCHED, STRIDED, PIVOT>(m);
+
+    // tall matrices factorized with tournament pivoting are always blocked
+    if(blk == 1 && tournament)
+        blk = min(dim, WAVESIZE);
 
     if(blk == 1)
     {
@@ -138,8 +224,252 @@ void rocsolver_getrf_getMemorySize(const rocblas_int m,
         *size_iinfo = sizeof(rocblas_int) * batch_count;
 
         // extra workspace (for calling TRSM)
-        rocblasCall_trsm_mem<BATCHED, T>(rocblas_side_left, blk, n - blk, batch_count, size_work1,
-                                         size_work2, size_work3, size_work4);
+        switch(getrf_get_variant(m, n))
+        {
+        case getrf_right_looking:
+            rocblasCall_trsm_mem<BATCHED, T>(rocblas_side_left, blk, n - blk, batch_count,
+                                             size_work1, size_work2, size_work3, size_work4);
+            break;
+
+        case getrf_left_looking:
+            *size_work1 = 0;
+            *size_work2 = 0;
+            *size_work3 = 0;
+            *size_work4 = 0;
+            for(rocblas_int j = blk; j < dim; j += blk)
+                getrf_trsm_mem<BATCHED, T>(j, min(dim - j, blk), batch_count, size_work1,
+                                           size_work2, size_work3, size_work4);
+            break;
+
+        case getrf_recursive:
+            *size_work1 = 0;
+            *size_work2 = 0;
+            *size_work3 = 0;
+            *size_work4 = 0;
+            getrf_recursive_trsm_mem<BATCHED, T>(dim, blk, batch_count, size_work1, size_work2,
+                                                 size_work3, size_work4);
+            break;
+        }
+
+        // the columns to the right of a wide matrix are updated at the end (left-looking and
+        // recursive variants)
+        if(n > m)
+            getrf_trsm_mem<BATCHED, T>(m, n - m, batch_count, size_work1, size_work2,
+                                       size_work3, size_work4);
+
+        // the tournament pivoting of the panels (which are never factorized at the same
+        // time as a TRSM is executed) uses work1
+        if(tournament)
+        {
+            rocsolver_getrf_tournament_getMemorySize<T, S>(m, blk, size_scalars, size_work,
+                                                           size_pivotval, size_pivotidx,
+                                                           size_work1);
+            if(dim % blk != 0)
+                rocsolver_getrf_tournament_getMemorySize<T, S>(m, dim % blk, size_scalars,
+                                                               size_work, size_pivotval,
+                                                               size_pivotidx, size_work1);
+        }
+    }
+}
+
+/** GETRF_PANEL factorizes the panel of columns j : j+jb-1 (rows j : m-1) with GETF2,
+    or with tournament pivoting if the panel is tall enough, and updates ipiv and info with
+    the global pivot indices and singularity **/
+template <bool BATCHED, bool STRIDED, bool PIVOT, typename T, typename S, typename U>
+void rocsolver_getrf_panel(rocblas_handle handle,
+                           const rocblas_int m,
+                           const rocblas_int j,
+                           const rocblas_int jb,
+                           U A,
+                           const rocblas_int shiftA,
+                           const rocblas_int lda,
+                           const rocblas_stride strideA,
+                           rocblas_int* ipiv,
+                           const rocblas_int shiftP,
+                           const rocblas_stride strideP,
+                           rocblas_int* info,
+                           const rocblas_int batch_count,
+                           T* scalars,
+                           rocblas_index_value_t<S>* work,
+                           T* pivotval,
+                           rocblas_int* pivotidx,
+                           rocblas_int* iinfo,
+                           void* work1)
+{
+    static constexpr bool ISBATCHED = BATCHED || STRIDED;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocksReset = (batch_count - 1) / BLOCKSIZE + 1;
+    dim3 gridReset(blocksReset, 1, 1);
+    dim3 threads(BLOCKSIZE, 1, 1);
+
+    // Factor diagonal and subdiagonal blocks
+    // (the pivot indices given by tournament pivoting are already global)
+    bool tournament = rocsolver_getrf_tournament_usable<BATCHED, STRIDED, PIVOT>(m - j);
+    hipLaunchKernelGGL(reset_info, gridReset, threads, 0, stream, iinfo, batch_count, 0);
+    if(tournament)
+        rocsolver_getrf_tournament_template<ISBATCHED, T>(
+            handle, m, j, jb, A, shiftA, lda, strideA, ipiv, shiftP, strideP, iinfo, scalars,
+            work, pivotval, pivotidx, work1);
+    else
+        rocsolver_getf2_template<ISBATCHED, PIVOT, T>(
+            handle, m - j, jb, A, shiftA + idx2D(j, j, lda), lda, strideA, ipiv, shiftP + j,
+            strideP, iinfo, batch_count, scalars, work, pivotval, pivotidx);
+
+    // adjust pivot indices and check singularity
+    rocblas_int sizePivot = min(m - j, jb); // number of pivots in the block
+    rocblas_int blocksPivot = (sizePivot - 1) / BLOCKSIZE + 1;
+    dim3 gridPivot(blocksPivot, batch_count, 1);
+    hipLaunchKernelGGL(getrf_check_singularity<U>, gridPivot, threads, 0, stream, sizePivot, j,
+                       ipiv, shiftP + j, strideP, iinfo, info, PIVOT && !tournament);
+}
+
+/** GETRF_RECURSIVE factorizes the columns j : j+nc-1 (rows j : m-1) with the recursive
+    variant. The columns must have been updated with all the previous columns. **/
+template <bool BATCHED, bool STRIDED, bool PIVOT, typename T, typename S, typename U>
+void rocsolver_getrf_recursive(rocblas_handle handle,
+                               const rocblas_int m,
+                               const rocblas_int j,
+                               const rocblas_int nc,
+                               const rocblas_int blk,
+                               U A,
+                               const rocblas_int shiftA,
+                               const rocblas_int lda,
+                               const rocblas_stride strideA,
+                               rocblas_int* ipiv,
+                               const rocblas_int shiftP,
+                               const rocblas_stride strideP,
+                               rocblas_int* info,
+                               const rocblas_int batch_count,
+                               T* scalars,
+                               rocblas_index_value_t<S>* work,
+                               void* work1,
+                               void* work2,
+                               void* work3,
+                               void* work4,
+                               T* pivotval,
+                               rocblas_int* pivotidx,
+                               rocblas_int* iinfo,
+                               bool optim_mem)
+{
+    // constants to use when calling rocablas functions
+    T one = 1; // constant 1 in host
+    T minone = -1; // constant -1 in host
+
+    if(nc <= blk)
+    {
+        rocsolver_getrf_panel<BATCHED, STRIDED, PIVOT, T>(
+            handle, m, j, nc, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info, batch_count,
+            scalars, work, pivotval, pivotidx, iinfo, work1);
+        return;
+    }
+
+    rocblas_int n1 = getrf_recursive_split(nc, blk);
+    rocblas_int n2 = nc - n1;
+
+    // factorize left half
+    rocsolver_getrf_recursive<BATCHED, STRIDED, PIVOT, T>(
+        handle, m, j, n1, blk, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info, batch_count,
+        scalars, work, work1, work2, work3, work4, pivotval, pivotidx, iinfo, optim_mem);
+
+    // apply interchanges of the left half to the right half
+    if(PIVOT)
+        rocsolver_laswp_template<T>(handle, n2, A, shiftA + idx2D(0, j + n1, lda), lda, strideA,
+                                    j + 1, j + n1, ipiv, shiftP, strideP, 1, batch_count);
+
+    // compute block row of U
+    rocblasCall_trsm<BATCHED, T>(handle, rocblas_side_left, rocblas_fill_lower,
+                                 rocblas_operation_none, rocblas_diagonal_unit, n1, n2, &one, A,
+                                 shiftA + idx2D(j, j, lda), lda, strideA, A,
+                                 shiftA + idx2D(j, j + n1, lda), lda, strideA, batch_count,
+                                 optim_mem, work1, work2, work3, work4);
+
+    // update right half
+    rocblasCall_gemm<BATCHED, STRIDED, T>(
+        handle, rocblas_operation_none, rocblas_operation_none, m - j - n1, n2, n1, &minone, A,
+        shiftA + idx2D(j + n1, j, lda), lda, strideA, A, shiftA + idx2D(j, j + n1, lda), lda,
+        strideA, &one, A, shiftA + idx2D(j + n1, j + n1, lda), lda, strideA, batch_count, nullptr);
+
+    // factorize right half
+    rocsolver_getrf_recursive<BATCHED, STRIDED, PIVOT, T>(
+        handle, m, j + n1, n2, blk, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info,
+        batch_count, scalars, work, work1, work2, work3, work4, pivotval, pivotidx, iinfo,
+        optim_mem);
+
+    // apply interchanges of the right half to the left half
+    if(PIVOT)
+        rocsolver_laswp_template<T>(handle, n1, A, shiftA + idx2D(0, j, lda), lda, strideA,
+                                    j + n1 + 1, j + nc, ipiv, shiftP, strideP, 1, batch_count);
+}
+
+/** GETRF_LEFT_LOOKING factorizes the first dim columns with the left-looking variant **/
+template <bool BATCHED, bool STRIDED, bool PIVOT, typename T, typename S, typename U>
+void rocsolver_getrf_left_looking(rocblas_handle handle,
+                                  const rocblas_int m,
+                                  const rocblas_int dim,
+                                  const rocblas_int blk,
+                                  U A,
+                                  const rocblas_int shiftA,
+                                  const rocblas_int lda,
+                                  const rocblas_stride strideA,
+                                  rocblas_int* ipiv,
+                                  const rocblas_int shiftP,
+                                  const rocblas_stride strideP,
+                                  rocblas_int* info,
+                                  const rocblas_int batch_count,
+                                  T* scalars,
+                                  rocblas_index_value_t<S>* work,
+                                  void* work1,
+                                  void* work2,
+                                  void* work3,
+                                  void* work4,
+                                  T* pivotval,
+                                  rocblas_int* pivotidx,
+                                  rocblas_int* iinfo,
+                                  bool optim_mem)
+{
+    // constants to use when calling rocablas functions
+    T one = 1; // constant 1 in host
+    T minone = -1; // constant -1 in host
+
+    rocblas_int jb;
+
+    for(rocblas_int j = 0; j < dim; j += blk)
+    {
+        jb = min(dim - j, blk); // number of columns in the block
+
+        if(j > 0)
+        {
+            // apply all the previous interchanges to the panel at once
+            if(PIVOT)
+                rocsolver_laswp_template<T>(handle, jb, A, shiftA + idx2D(0, j, lda), lda,
+                                            strideA, 1, j, ipiv, shiftP, strideP, 1, batch_count);
+
+            // compute block column of U
+            rocblasCall_trsm<BATCHED, T>(handle, rocblas_side_left, rocblas_fill_lower,
+                                         rocblas_operation_none, rocblas_diagonal_unit, j, jb,
+                                         &one, A, shiftA, lda, strideA, A,
+                                         shiftA + idx2D(0, j, lda), lda, strideA, batch_count,
+                                         optim_mem, work1, work2, work3, work4);
+
+            // update panel with all the previous columns of L
+            rocblasCall_gemm<BATCHED, STRIDED, T>(
+                handle, rocblas_operation_none, rocblas_operation_none, m - j, jb, j, &minone, A,
+                shiftA + idx2D(j, 0, lda), lda, strideA, A, shiftA + idx2D(0, j, lda), lda,
+                strideA, &one, A, shiftA + idx2D(j, j, lda), lda, strideA, batch_count, nullptr);
+        }
+
+        // factorize panel
+        rocsolver_getrf_panel<BATCHED, STRIDED, PIVOT, T>(
+            handle, m, j, jb, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info, batch_count,
+            scalars, work, pivotval, pivotidx, iinfo, work1);
+
+        // apply interchanges to columns 1 : j-1
+        if(PIVOT && j > 0)
+            rocsolver_laswp_template<T>(handle, j, A, shiftA, lda, strideA, j + 1, j + jb, ipiv,
+                                        shiftP, strideP, 1, batch_count);
     }
 }
 
@@ -177,9 +507,7 @@ rocblas_status rocsolver_getrf_template(rocblas_handle handle,
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
-    rocblas_int blocksPivot;
     rocblas_int blocksReset = (batch_count - 1) / BLOCKSIZE + 1;
-    dim3 gridPivot;
     dim3 gridReset(blocksReset, 1, 1);
     dim3 threads(BLOCKSIZE, 1, 1);
 
@@ -202,30 +530,61 @@ rocblas_status rocsolver_getrf_template(rocblas_handle handle,
     T minone = -1; // constant -1 in host
 
     rocblas_int dim = min(m, n); // total number of pivots
-    rocblas_int jb, sizePivot;
+    rocblas_int jb;
 
     rocblas_int blk = getrf_get_blksize<ISBATCHED, PIVOT>(dim);
 
+    // tall matrices factorized with tournament pivoting are always blocked
+    if(blk == 1 && rocsolver_getrf_tournament_usable<BATCHED, STRIDED, PIVOT>(m))
+        blk = min(dim, WAVESIZE);
+
     if(blk == 1)
         return rocsolver_getf2_template<ISBATCHED, PIVOT, T>(handle, m, n, A, shiftA, lda, strideA,
                                                              ipiv, shiftP, strideP, info, batch_count,
                                                              scalars, work, pivotval, pivotidx);
 
+    getrf_variant variant = getrf_get_variant(m, n);
+
+    if(variant != getrf_right_looking)
+    {
+        if(variant == getrf_recursive)
+            rocsolver_getrf_recursive<BATCHED, STRIDED, PIVOT, T>(
+                handle, m, 0, dim, blk, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info,
+                batch_count, scalars, work, work1, work2, work3, work4, pivotval, pivotidx, iinfo,
+                optim_mem);
+        else
+            rocsolver_getrf_left_looking<BATCHED, STRIDED, PIVOT, T>(
+                handle, m, dim, blk, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info,
+                batch_count, scalars, work, work1, work2, work3, work4, pivotval, pivotidx, iinfo,
+                optim_mem);
+
+        // the columns to the right of a wide matrix have not been touched yet
+        if(n > m)
+        {
+            // apply all the interchanges at once
+            if(PIVOT)
+                rocsolver_laswp_template<T>(handle, n - m, A, shiftA + idx2D(0, m, lda), lda,
+                                            strideA, 1, m, ipiv, shiftP, strideP, 1, batch_count);
+
+            // compute block row of U
+            rocblasCall_trsm<BATCHED, T>(handle, rocblas_side_left, rocblas_fill_lower,
+                                         rocblas_operation_none, rocblas_diagonal_unit, m, n - m,
+                                         &one, A, shiftA, lda, strideA, A,
+                                         shiftA + idx2D(0, m, lda), lda, strideA, batch_count,
+                                         optim_mem, work1, work2, work3, work4);
+        }
+
+        rocblas_set_pointer_mode(handle, old_mode);
+        return rocblas_status_success;
+    }
+
     for(rocblas_int j = 0; j < dim; j += blk) //dim
     {
-        // Factor diagonal and subdiagonal blocks
+        // Factor diagonal and subdiagonal blocks, adjust pivot indices and check singularity
         jb = min(dim - j, blk); // number of columns in the block
-        hipLaunchKernelGGL(reset_info, gridReset, threads, 0, stream, iinfo, batch_count, 0);
-        rocsolver_getf2_template<ISBATCHED, PIVOT, T>(
-            handle, m - j, jb, A, shiftA + idx2D(j, j, lda), lda, strideA, ipiv, shiftP + j,
-            strideP, iinfo, batch_count, scalars, work, pivotval, pivotidx);
-
-        // adjust pivot indices and check singularity
-        sizePivot = min(m - j, jb); // number of pivots in the block
-        blocksPivot = (sizePivot - 1) / BLOCKSIZE + 1;
-        gridPivot = dim3(blocksPivot, batch_count, 1);
-        hipLaunchKernelGGL(getrf_check_singularity<U>, gridPivot, threads, 0, stream, sizePivot, j,
-                           ipiv, shiftP + j, strideP, iinfo, info, PIVOT);
+        rocsolver_getrf_panel<BATCHED, STRIDED, PIVOT, T>(
+            handle, m, j, jb, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info, batch_count,
+            scalars, work, pivotval, pivotidx, iinfo, work1);
 
         // apply interchanges to columns 1 : j-1
         if(PIVOT)
@@ -60,8 +60,8 @@ rocblas_status rocsolver_getrf_batched_impl(rocblas_handle handle,
 
     // memory workspace allocation
     void *scalars, *work, *work1, *work2, *work3, *work4, *pivotval, *pivotidx, *iinfo;
-    rocblas_device_malloc mem(handle, size_scalars, size_work, size_work1, size_work2, size_work3,
-                              size_work4, size_pivotval, size_pivotidx, size_iinfo);
+    rocsolver_device_malloc mem(handle, size_scalars, size_work, size_work1, size_work2, size_work3,
+                                size_work4, size_pivotval, size_pivotidx, size_iinfo);
 
     if(!mem)
         return rocblas_status_memory_error;
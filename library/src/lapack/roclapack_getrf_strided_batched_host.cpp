@@ -0,0 +1,181 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_getrf.hpp"
+#include "rocsolver_staging.hpp"
+
+template <typename T>
+rocblas_status rocsolver_getrf_strided_batched_host_impl(rocblas_handle handle,
+                                                         const rocblas_int m,
+                                                         const rocblas_int n,
+                                                         T* A,
+                                                         const rocblas_int lda,
+                                                         const rocblas_stride strideA,
+                                                         rocblas_int* ipiv,
+                                                         const rocblas_stride strideP,
+                                                         rocblas_int* info,
+                                                         const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("getrf_strided_batched_host", "-m", m, "-n", n, "--lda", lda, "--strideA",
+                        strideA, "--strideP", strideP, "--batch_count", batch_count);
+
+    using S = decltype(std::real(T{}));
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st
+        = rocsolver_getf2_getrf_argCheck(handle, m, n, lda, A, ipiv, info, true, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // the matrices, pivots and info are staged through pinned host buffers;
+    // in the staging buffers, consecutive matrices are lda*n elements apart
+    const bool quick = (m == 0 || n == 0 || batch_count == 0);
+    const rocblas_int mn = min(m, n);
+    const rocblas_stride stA = rocblas_stride(lda) * n;
+    rocsolver_staged_array arrays[3];
+    rocblas_int chunk = batch_count;
+    if(!quick)
+    {
+        arrays[0] = {A, sizeof(T), size_t(lda) * (n - 1) + m, size_t(strideA), size_t(stA),
+                     true, true};
+        arrays[1] = {ipiv, sizeof(rocblas_int), size_t(mn), size_t(strideP), size_t(mn),
+                     false, true};
+        arrays[2] = {info, sizeof(rocblas_int), 1, 1, 1, false, true};
+        chunk = rocsolver_staging_pool::chunk_size(handle, arrays, 3, batch_count);
+    }
+
+    // memory workspace sizes (for a sub-batch):
+    // size for constants in rocblas calls
+    size_t size_scalars;
+    // size of reusable workspace (and for calling TRSM)
+    size_t size_work, size_work1, size_work2, size_work3, size_work4;
+    // extra requirements for calling GETF2
+    size_t size_pivotval, size_pivotidx;
+    // size to store info about singularity of each subblock
+    size_t size_iinfo;
+    rocsolver_getrf_getMemorySize<false, true, true, T, S>(
+        m, n, chunk, &size_scalars, &size_work, &size_work1, &size_work2, &size_work3,
+        &size_work4, &size_pivotval, &size_pivotidx, &size_iinfo);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work, size_work1,
+                                                      size_work2, size_work3, size_work4,
+                                                      size_pivotval, size_pivotidx, size_iinfo);
+
+    // quick return (info is in host memory)
+    if(quick)
+    {
+        for(rocblas_int b = 0; b < batch_count; ++b)
+            info[b] = 0;
+        return rocblas_status_success;
+    }
+
+    // always allocate all required memory for TRSM optimal performance
+    bool optim_mem = true;
+
+    // memory workspace allocation
+    void *scalars, *work, *work1, *work2, *work3, *work4, *pivotval, *pivotidx, *iinfo;
+    rocsolver_device_malloc mem(handle, size_scalars, size_work, size_work1, size_work2, size_work3,
+                                size_work4, size_pivotval, size_pivotidx, size_iinfo);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    scalars = mem[0];
+    work = mem[1];
+    work1 = mem[2];
+    work2 = mem[3];
+    work3 = mem[4];
+    work4 = mem[5];
+    pivotval = mem[6];
+    pivotidx = mem[7];
+    iinfo = mem[8];
+    if(size_scalars > 0)
+        init_scalars(handle, (T*)scalars);
+
+    // execution
+    // (the workspace is reused by all the sub-batches, in the order of the handle's stream)
+    auto launch = [&](void* const* dArrays, rocblas_int count) {
+        return rocsolver_getrf_template<false, true, true, T, S>(
+            handle, m, n, (T*)dArrays[0], 0, lda, stA, (rocblas_int*)dArrays[1], 0, mn,
+            (rocblas_int*)dArrays[2], count, (T*)scalars, (rocblas_index_value_t<S>*)work, work1,
+            work2, work3, work4, (T*)pivotval, (rocblas_int*)pivotidx, (rocblas_int*)iinfo,
+            optim_mem);
+    };
+
+    return rocsolver_staging_pool::run(handle, batch_count, arrays, 3, launch);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sgetrf_strided_batched_host(rocblas_handle handle,
+                                                     const rocblas_int m,
+                                                     const rocblas_int n,
+                                                     float* A,
+                                                     const rocblas_int lda,
+                                                     const rocblas_stride strideA,
+                                                     rocblas_int* ipiv,
+                                                     const rocblas_stride strideP,
+                                                     rocblas_int* info,
+                                                     const rocblas_int batch_count)
+{
+    return rocsolver_getrf_strided_batched_host_impl<float>(handle, m, n, A, lda, strideA, ipiv,
+                                                            strideP, info, batch_count);
+}
+
+rocblas_status rocsolver_dgetrf_strided_batched_host(rocblas_handle handle,
+                                                     const rocblas_int m,
+                                                     const rocblas_int n,
+                                                     double* A,
+                                                     const rocblas_int lda,
+                                                     const rocblas_stride strideA,
+                                                     rocblas_int* ipiv,
+                                                     const rocblas_stride strideP,
+                                                     rocblas_int* info,
+                                                     const rocblas_int batch_count)
+{
+    return rocsolver_getrf_strided_batched_host_impl<double>(handle, m, n, A, lda, strideA, ipiv,
+                                                             strideP, info, batch_count);
+}
+
+rocblas_status rocsolver_cgetrf_strided_batched_host(rocblas_handle handle,
+                                                     const rocblas_int m,
+                                                     const rocblas_int n,
+                                                     rocblas_float_complex* A,
+                                                     const rocblas_int lda,
+                                                     const rocblas_stride strideA,
+                                                     rocblas_int* ipiv,
+                                                     const rocblas_stride strideP,
+                                                     rocblas_int* info,
+                                                     const rocblas_int batch_count)
+{
+    return rocsolver_getrf_strided_batched_host_impl<rocblas_float_complex>(
+        handle, m, n, A, lda, strideA, ipiv, strideP, info, batch_count);
+}
+
+rocblas_status rocsolver_zgetrf_strided_batched_host(rocblas_handle handle,
+                                                     const rocblas_int m,
+                                                     const rocblas_int n,
+                                                     rocblas_double_complex* A,
+                                                     const rocblas_int lda,
+                                                     const rocblas_stride strideA,
+                                                     rocblas_int* ipiv,
+                                                     const rocblas_stride strideP,
+                                                     rocblas_int* info,
+                                                     const rocblas_int batch_count)
+{
+    return rocsolver_getrf_strided_batched_host_impl<rocblas_double_complex>(
+        handle, m, n, A, lda, strideA, ipiv, strideP, info, batch_count);
+}
+
+} // extern C
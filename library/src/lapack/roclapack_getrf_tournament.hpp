@@ -0,0 +1,304 @@
+/************************************************************************
+ * Tournament pivoting for the LU factorization of tall panels (CALU):
+ *     L. Grigori, J. Demmel, H. Xiang,
+ *     CALU: A communication optimal LU factorization algorithm,
+ *     SIAM J. Matrix Anal. Appl. 32(4), 2011.
+ *
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "auxiliary/rocauxiliary_laswp.hpp"
+#include "rocblas.hpp"
+#include "roclapack_getf2.hpp"
+#include "rocsolver.h"
+
+////////////////////////////////////////////////////////////////////////////////////
+// PIVOT SELECTION OF TALL PANELS THROUGH A REDUCTION TREE                        //
+////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ * The rows of the mp-by-jb panel are split in tiles of (at least) 2*jb rows; the last
+ * one is padded with zero rows. A copy of every tile is factorized with partial pivoting
+ * (all the tiles at once, as a batch), and the jb rows that it selects as pivots are the
+ * candidates of the tile. The original values of the candidates are stacked in pairs and
+ * factorized again, level by level, until the root of the binary tree selects the jb pivot
+ * rows of the panel. These rows are moved to the top of the panel, which is then
+ * factorized without pivoting. Thus, the panel is read once to select the pivots, instead
+ * of once per column, and all the pivot searches are done on small matrices.
+ *
+ * The selected rows are the same as those of partial pivoting when the pivot of each
+ * column dominates the rest of the column, but they may differ in general. The growth
+ * factor of tournament pivoting is larger than that of partial pivoting in the worst case,
+ * but it is similar in practice.
+ *
+ * Every node keeps the indices (relative to the panel) of the rows that it holds in the
+ * integer workspace; padding rows have index -1.
+ */
+
+/** GETRF_TOURNAMENT_USABLE returns true if the pivots of the panels with m rows are
+    selected with tournament pivoting (only for single matrices) **/
+template <bool BATCHED, bool STRIDED, bool PIVOT>
+bool rocsolver_getrf_tournament_usable(const rocblas_int m)
+{
+    const rocblas_int switchsize = rocsolver_tuning::get()->getrf_tournament_switchsize;
+    return !BATCHED && !STRIDED && PIVOT && switchsize > 0 && m >= switchsize;
+}
+
+/** GETRF_TOURNAMENT_TILE_ROWS returns the number of rows of the tiles of a panel with jb
+    columns **/
+inline rocblas_int rocsolver_getrf_tournament_tile_rows(const rocblas_int jb)
+{
+    return max(rocsolver_tuning::get()->getrf_tournament_tile_rows, 2 * jb);
+}
+
+/** GETRF_TOURNAMENT_TILES_KERNEL copies the rows of the panel into the tiles, padding the
+    last one with zero rows, and initializes their indices. There is a thread per row of
+    a tile. **/
+template <typename T, typename U>
+__global__ void getrf_tournament_tiles_kernel(const rocblas_int mp,
+                                              const rocblas_int jb,
+                                              const rocblas_int rows,
+                                              U AA,
+                                              const rocblas_int shiftA,
+                                              const rocblas_int lda,
+                                              const rocblas_stride strideA,
+                                              T* W,
+                                              rocblas_int* idx)
+{
+    const rocblas_int tile = hipBlockIdx_y;
+    const rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(i < rows)
+    {
+        const rocblas_int row = tile * rows + i;
+        T* A = load_ptr_batch<T>(AA, 0, shiftA, strideA);
+        T* Wt = W + tile * rows * jb;
+
+        for(rocblas_int j = 0; j < jb; ++j)
+            Wt[i + j * rows] = (row < mp) ? A[row + j * lda] : T(0);
+        idx[tile * rows + i] = (row < mp) ? row : -1;
+    }
+}
+
+/** GETRF_TOURNAMENT_WINNERS_KERNEL applies the row interchanges of the factorization of
+    each of the nodes to the indices of its rows, and writes the indices of the jb rows
+    selected by the node in win. There is a thread per node. **/
+template <typename U>
+__global__ void getrf_tournament_winners_kernel(const rocblas_int jb,
+                                                const rocblas_int rows,
+                                                const rocblas_int nodes,
+                                                const rocblas_int* tipiv,
+                                                rocblas_int* idx,
+                                                rocblas_int* win)
+{
+    const rocblas_int node = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(node < nodes)
+    {
+        rocblas_int* id = idx + node * rows;
+        const rocblas_int* p = tipiv + node * jb;
+
+        for(rocblas_int k = 0; k < jb; ++k)
+        {
+            const rocblas_int q = p[k] - 1;
+            const rocblas_int tmp = id[k];
+            id[k] = id[q];
+            id[q] = tmp;
+            win[node * jb + k] = id[k];
+        }
+    }
+}
+
+/** GETRF_TOURNAMENT_GATHER_KERNEL stacks the original values of the rows selected by the
+    nsrc nodes of a level in pairs, to form the nodes of the next level (with 2*jb rows).
+    A node without a second child is padded with zero rows. There is a thread per row of a
+    node. **/
+template <typename T, typename U>
+__global__ void getrf_tournament_gather_kernel(const rocblas_int jb,
+                                               const rocblas_int nsrc,
+                                               U AA,
+                                               const rocblas_int shiftA,
+                                               const rocblas_int lda,
+                                               const rocblas_stride strideA,
+                                               const rocblas_int* win,
+                                               T* W,
+                                               rocblas_int* idx)
+{
+    const rocblas_int node = hipBlockIdx_y;
+    const rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const rocblas_int rows = 2 * jb;
+
+    if(i < rows)
+    {
+        const rocblas_int child = 2 * node + (i < jb ? 0 : 1);
+        const rocblas_int row = (child < nsrc) ? win[child * jb + (i % jb)] : -1;
+        T* A = load_ptr_batch<T>(AA, 0, shiftA, strideA);
+        T* Wt = W + node * rows * jb;
+
+        for(rocblas_int j = 0; j < jb; ++j)
+            Wt[i + j * rows] = (row >= 0) ? A[row + j * lda] : T(0);
+        idx[node * rows + i] = row;
+    }
+}
+
+/** GETRF_TOURNAMENT_PIVOTS_KERNEL translates the rows selected by the root of the tree
+    into the row interchanges (in LAPACK format) that move them to the top of the panel,
+    in order. If the root selected padding rows (which can only happen when the columns
+    of the candidates are zero), they are replaced by the first rows of the panel that
+    were not selected. The kernel runs on a single thread. **/
+template <typename U>
+__global__ void getrf_tournament_pivots_kernel(const rocblas_int mp,
+                                               const rocblas_int jb,
+                                               const rocblas_int j,
+                                               rocblas_int* win,
+                                               rocblas_int* ipivA,
+                                               const rocblas_int shiftP)
+{
+    if(hipBlockIdx_x == 0 && hipThreadIdx_x == 0)
+    {
+        rocblas_int* ipiv = ipivA + shiftP + j;
+        rocblas_int next = 0;
+
+        for(rocblas_int k = 0; k < jb; ++k)
+        {
+            if(win[k] >= 0)
+                continue;
+
+            bool used = true;
+            while(used && next < mp)
+            {
+                used = false;
+                for(rocblas_int i = 0; i < jb; ++i)
+                    used = used || (win[i] == next);
+                if(used)
+                    next++;
+            }
+            win[k] = next++;
+        }
+
+        // the position of each selected row after the previous interchanges
+        for(rocblas_int k = 0; k < jb; ++k)
+        {
+            rocblas_int p = win[k];
+            for(rocblas_int i = 0; i < k; ++i)
+            {
+                const rocblas_int q = ipiv[i] - j - 1;
+                if(p == i)
+                    p = q;
+                else if(p == q)
+                    p = i;
+            }
+            ipiv[k] = p + j + 1;
+        }
+    }
+}
+
+template <typename T, typename S>
+void rocsolver_getrf_tournament_getMemorySize(const rocblas_int m,
+                                              const rocblas_int jb,
+                                              size_t* size_scalars,
+                                              size_t* size_work,
+                                              size_t* size_pivotval,
+                                              size_t* size_pivotidx,
+                                              size_t* size_nodes)
+{
+    rocblas_int rows = rocsolver_getrf_tournament_tile_rows(jb);
+    rocblas_int tiles = (m - 1) / rows + 1;
+
+    // requirements for the factorization of the tiles (the nodes of the next levels
+    // are smaller)
+    size_t s1, s2, s3, s4;
+    rocsolver_getf2_getMemorySize<true, T, S>(rows, jb, tiles, &s1, &s2, &s3, &s4);
+    *size_scalars = max(*size_scalars, s1);
+    *size_work = max(*size_work, s2);
+    *size_pivotval = max(*size_pivotval, s3);
+    *size_pivotidx = max(*size_pivotidx, s4);
+
+    // the tiles (and the nodes of the next levels), followed by the row indices of the
+    // nodes, the selected rows, and the pivot indices and info of the nodes
+    size_t s = sizeof(T) * tiles * rows * jb
+        + sizeof(rocblas_int) * (tiles * rows + 2 * tiles * jb + tiles);
+    *size_nodes = max(*size_nodes, s);
+}
+
+/** GETRF_TOURNAMENT_TEMPLATE factorizes the panel of columns j : j+jb-1 (rows j : m-1)
+    with tournament pivoting. The pivot indices are written in global (1-based) format;
+    info is set with respect to the panel. **/
+template <bool ISBATCHED, typename T, typename S, typename U>
+void rocsolver_getrf_tournament_template(rocblas_handle handle,
+                                         const rocblas_int m,
+                                         const rocblas_int j,
+                                         const rocblas_int jb,
+                                         U A,
+                                         const rocblas_int shiftA,
+                                         const rocblas_int lda,
+                                         const rocblas_stride strideA,
+                                         rocblas_int* ipiv,
+                                         const rocblas_int shiftP,
+                                         const rocblas_stride strideP,
+                                         rocblas_int* info,
+                                         T* scalars,
+                                         rocblas_index_value_t<S>* work,
+                                         T* pivotval,
+                                         rocblas_int* pivotidx,
+                                         void* nodesArr)
+{
+    ROCSOLVER_ENTER("getrf_tournament", "m:", m, "j:", j, "jb:", jb, "shiftA:", shiftA,
+                    "lda:", lda, "shiftP:", shiftP);
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    const rocblas_int mp = m - j; // rows of the panel
+    const rocblas_int shiftPanel = shiftA + idx2D(j, j, lda);
+    rocblas_int rows = rocsolver_getrf_tournament_tile_rows(jb);
+    rocblas_int nodes = (mp - 1) / rows + 1;
+
+    // workspace
+    T* W = (T*)nodesArr;
+    rocblas_int* idx = (rocblas_int*)(W + nodes * rows * jb);
+    rocblas_int* win = idx + nodes * rows;
+    rocblas_int* tipiv = win + nodes * jb;
+    rocblas_int* tinfo = tipiv + nodes * jb;
+
+    // factorize the tiles and select their candidates
+    dim3 threads(BLOCKSIZE, 1, 1);
+    dim3 grid((rows - 1) / BLOCKSIZE + 1, nodes, 1);
+    hipLaunchKernelGGL(getrf_tournament_tiles_kernel<T>, grid, threads, 0, stream, mp, jb, rows,
+                       A, shiftPanel, lda, strideA, W, idx);
+    rocsolver_getf2_template<true, true, T>(handle, rows, jb, W, 0, rows, rows * jb, tipiv, 0, jb,
+                                            tinfo, nodes, scalars, work, pivotval, pivotidx);
+    hipLaunchKernelGGL(getrf_tournament_winners_kernel<U>, dim3((nodes - 1) / BLOCKSIZE + 1),
+                       threads, 0, stream, jb, rows, nodes, tipiv, idx, win);
+
+    // play the tournament up to the root
+    rows = 2 * jb;
+    while(nodes > 1)
+    {
+        rocblas_int nsrc = nodes;
+        nodes = (nsrc - 1) / 2 + 1;
+
+        grid = dim3((rows - 1) / BLOCKSIZE + 1, nodes, 1);
+        hipLaunchKernelGGL(getrf_tournament_gather_kernel<T>, grid, threads, 0, stream, jb,
+                           nsrc, A, shiftPanel, lda, strideA, win, W, idx);
+        rocsolver_getf2_template<true, true, T>(handle, rows, jb, W, 0, rows, rows * jb, tipiv, 0,
+                                                jb, tinfo, nodes, scalars, work, pivotval,
+                                                pivotidx);
+        hipLaunchKernelGGL(getrf_tournament_winners_kernel<U>,
+                           dim3((nodes - 1) / BLOCKSIZE + 1), threads, 0, stream, jb, rows, nodes,
+                           tipiv, idx, win);
+    }
+
+    // move the selected rows to the top of the panel
+    hipLaunchKernelGGL(getrf_tournament_pivots_kernel<U>, dim3(1), dim3(1), 0, stream, mp, jb, j,
+                       win, ipiv, shiftP);
+    rocsolver_laswp_template<T>(handle, jb, A, shiftA + idx2D(0, j, lda), lda, strideA, j + 1,
+                                j + jb, ipiv, shiftP, strideP, 1, 1);
+
+    // factorize the panel without pivoting
+    rocsolver_getf2_template<ISBATCHED, false, T>(handle, mp, jb, A, shiftPanel, lda, strideA,
+                                                  ipiv, shiftP + j, strideP, info, 1, scalars,
+                                                  work, pivotval, pivotidx);
+}
@@ -348,21 +348,17 @@ __global__ void getri_kernel_large2(const rocblas_int n,
 template <bool ISBATCHED>
 rocblas_int getri_get_blksize(const rocblas_int dim)
 {
+    auto t = rocsolver_tuning::get();
     rocblas_int blk;
 
     if(ISBATCHED)
     {
-        rocblas_int size[] = {GETRI_BATCH_BLKSIZES};
-        rocblas_int intervals[] = {GETRI_BATCH_INTERVALS};
-        rocblas_int max = GETRI_BATCH_NUM_INTERVALS;
-        blk = size[get_index(intervals, max, dim)];
+        blk = rocsolver_tuning_table::get_blksize(t->getri_batch_intervals,
+                                                  t->getri_batch_blksizes, dim);
     }
     else
     {
-        rocblas_int size[] = {GETRI_BLKSIZES};
-        rocblas_int intervals[] = {GETRI_INTERVALS};
-        rocblas_int max = GETRI_NUM_INTERVALS;
-        blk = size[get_index(intervals, max, dim)];
+        blk = rocsolver_tuning_table::get_blksize(t->getri_intervals, t->getri_blksizes, dim);
     }
 
     return blk;
@@ -394,7 +390,9 @@ void rocsolver_getri_getMemorySize(const rocblas_int n,
 
 #ifdef OPTIMAL
     // if tiny size, no workspace needed
-    if((n <= GETRI_TINY_SIZE && !ISBATCHED) || (n <= GETRI_BATCH_TINY_SIZE && ISBATCHED))
+    rocblas_int tiny_size = ISBATCHED ? rocsolver_tuning::get()->getri_batch_tiny_size
+                                      : rocsolver_tuning::get()->getri_tiny_size;
+    if(n <= tiny_size)
     {
         *size_work1 = 0;
         *size_work2 = 0;
@@ -521,7 +519,9 @@ rocblas_status rocsolver_getri_template(rocblas_handle handle,
     static constexpr bool ISBATCHED = BATCHED || STRIDED;
 
 #ifdef OPTIMAL
-    if((n <= GETRI_TINY_SIZE && !ISBATCHED) || (n <= GETRI_BATCH_TINY_SIZE && ISBATCHED))
+    rocblas_int tiny_size = ISBATCHED ? rocsolver_tuning::get()->getri_batch_tiny_size
+                                      : rocsolver_tuning::get()->getri_tiny_size;
+    if(n <= tiny_size)
     {
         return getri_run_small<T>(handle, n, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info,
                                   batch_count, true);
@@ -52,8 +52,8 @@ rocblas_status rocsolver_getri_batched_impl(rocblas_handle handle,
 
     // memory workspace allocation
     void *work1, *work2, *work3, *work4, *tmpcopy, *workArr;
-    rocblas_device_malloc mem(handle, size_work1, size_work2, size_work3, size_work4, size_tmpcopy,
-                              size_workArr);
+    rocsolver_device_malloc mem(handle, size_work1, size_work2, size_work3, size_work4,
+                                size_tmpcopy, size_workArr);
 
     if(!mem)
         return rocblas_status_memory_error;
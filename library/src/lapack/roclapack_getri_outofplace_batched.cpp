@@ -52,7 +52,7 @@ rocblas_status rocsolver_getri_outofplace_batched_impl(rocblas_handle handle,
 
     // memory workspace allocation
     void *work1, *work2, *work3, *work4;
-    rocblas_device_malloc mem(handle, size_work1, size_work2, size_work3, size_work4);
+    rocsolver_device_malloc mem(handle, size_work1, size_work2, size_work3, size_work4);
 
     if(!mem)
         return rocblas_status_memory_error;
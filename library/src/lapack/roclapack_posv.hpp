@@ -0,0 +1,514 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "lib_device_helpers.hpp"
+#include "rocblas.hpp"
+#include "roclapack_potrf.hpp"
+#include "rocsolver.h"
+
+#ifdef OPTIMAL
+/** POSV_SMALL_LMEMSIZE returns the size of the shared memory needed by each
+    group of threads in posv_small_kernel: the current column (or row), the
+    current row of B, and the rows of B owned by the threads **/
+template <typename T>
+size_t posv_small_lmemsize(const rocblas_int n, const rocblas_int nrhs)
+{
+    return sizeof(T) * (size_t(n) + nrhs + size_t(n) * nrhs);
+}
+
+template <typename T>
+bool posv_use_small(const rocblas_int n, const rocblas_int nrhs)
+{
+    return n <= GESV_POSV_MAX_SMALL_SIZE
+        && posv_small_lmemsize<T>(n, nrhs) <= GESV_POSV_MAX_SMALL_LDS;
+}
+
+/*************************************************************
+    posv_small_kernel takes care of systems with
+    n <= GESV_POSV_MAX_SMALL_SIZE. As in CHOLfact_small_kernel, each
+    thread of a group holds a row (lower case) or a column (upper case)
+    of A in registers; it also holds the same row of B in shared memory.
+    The forward substitution with L is applied as the Cholesky factor
+    is computed, followed by the backward substitution with L', without
+    any intermediate write to global memory
+*************************************************************/
+template <rocblas_int DIM, typename T, typename U>
+__global__ void __launch_bounds__(GETF2_MAX_THDS)
+    posv_small_kernel(const rocblas_fill uplo,
+                      const rocblas_int nrhs,
+                      U AA,
+                      const rocblas_int shiftA,
+                      const rocblas_int lda,
+                      const rocblas_stride strideA,
+                      U BB,
+                      const rocblas_int shiftB,
+                      const rocblas_int ldb,
+                      const rocblas_stride strideB,
+                      rocblas_int* infoA,
+                      const rocblas_int batch_count)
+{
+    using S = decltype(std::real(T{}));
+
+    const int myrow = hipThreadIdx_x;
+    const int ty = hipThreadIdx_y;
+    const int id = hipBlockIdx_x * hipBlockDim_y + ty;
+
+    if(id >= batch_count)
+        return;
+
+    // batch instance
+    T* A = load_ptr_batch<T>(AA, id, shiftA, strideA);
+    T* B = (nrhs > 0) ? load_ptr_batch<T>(BB, id, shiftB, strideB) : nullptr;
+    rocblas_int* info = infoA + id;
+
+    // shared memory (for communication between threads in group)
+    extern __shared__ double lmem[];
+    T* common = (T*)lmem;
+    common += ty * (DIM + nrhs + DIM * nrhs);
+    T* xrow = common + DIM;
+    T* rB = xrow + nrhs;
+
+    // local variables
+    S diag;
+    int myinfo = 0; // to build info
+    T rA[DIM]; // to store this-row (this-column) values
+
+    // read corresponding row (column) from global memory into local array.
+    // In the upper case the thread holds the conjugate of the row of L = U'
+    // (see CHOLfact_small_kernel), which is accounted for when solving
+    const bool upper = (uplo == rocblas_fill_upper);
+    const rocblas_int inca = upper ? 1 : lda;
+    const rocblas_int incr = upper ? lda : 1;
+#pragma unroll DIM
+    for(int j = 0; j < DIM; ++j)
+        rA[j] = A[myrow * incr + j * inca];
+    for(int j = 0; j < nrhs; ++j)
+        rB[myrow + j * DIM] = B[myrow + j * ldb];
+
+// Cholesky factorization and forward substitution (main loop)
+#pragma unroll DIM
+    for(int k = 0; k < DIM; ++k)
+    {
+        // share the current diagonal element
+        if(myrow == k)
+            common[k] = rA[k];
+        __syncthreads();
+
+        // test for non-positive-definiteness
+        // (all the threads in the group see the same value, so the test is uniform)
+        if(myinfo == 0)
+        {
+            diag = std::real(common[k]);
+            if(diag <= 0)
+            {
+                myinfo = k + 1;
+                if(myrow == k)
+                    rA[k] = T(diag);
+            }
+            else
+            {
+                diag = sqrt(diag);
+                if(myrow == k)
+                {
+                    // compute and share the k-th row of L^{-1}B
+                    rA[k] = T(diag);
+                    for(int j = 0; j < nrhs; ++j)
+                    {
+                        rB[myrow + j * DIM] = (1 / diag) * rB[myrow + j * DIM];
+                        xrow[j] = rB[myrow + j * DIM];
+                    }
+                }
+                else if(myrow > k)
+                    rA[k] = (1 / diag) * rA[k];
+            }
+        }
+
+        // share the current column
+        if(myinfo == 0 && myrow > k)
+            common[myrow] = rA[k];
+        __syncthreads();
+
+        // update the trailing matrix (only the referenced triangle) and the
+        // right-hand sides
+        if(myinfo == 0 && myrow > k)
+        {
+            for(int j = k + 1; j < DIM; ++j)
+            {
+                if(j <= myrow)
+                    rA[j] -= rA[k] * conj(common[j]);
+            }
+            T lik = upper ? conj(rA[k]) : rA[k];
+            for(int j = 0; j < nrhs; ++j)
+                rB[myrow + j * DIM] -= lik * xrow[j];
+        }
+        __syncthreads();
+    }
+
+// backward substitution with L' (skipped if A is not positive definite)
+#pragma unroll DIM
+    for(int k = DIM - 1; k >= 0; --k)
+    {
+        if(myinfo == 0 && myrow == k)
+        {
+            // compute the k-th row of the solution and share the k-th row of L
+            diag = std::real(rA[k]);
+            for(int j = 0; j < nrhs; ++j)
+            {
+                rB[myrow + j * DIM] = (1 / diag) * rB[myrow + j * DIM];
+                xrow[j] = rB[myrow + j * DIM];
+            }
+            for(int i = 0; i < k; ++i)
+                common[i] = upper ? conj(rA[i]) : rA[i];
+        }
+        __syncthreads();
+
+        if(myinfo == 0 && myrow < k)
+        {
+            T lki = conj(common[myrow]);
+            for(int j = 0; j < nrhs; ++j)
+                rB[myrow + j * DIM] -= lki * xrow[j];
+        }
+        __syncthreads();
+    }
+
+    // write results to global memory
+    // (B is left unchanged if A is not positive definite)
+    if(myrow == 0)
+        *info = myinfo;
+#pragma unroll DIM
+    for(int j = 0; j < DIM; ++j)
+        A[myrow * incr + j * inca] = rA[j];
+    if(myinfo == 0)
+    {
+        for(int j = 0; j < nrhs; ++j)
+            B[myrow + j * ldb] = rB[myrow + j * DIM];
+    }
+}
+
+/*************************************************************
+    Launcher of posv_small kernels
+*************************************************************/
+template <typename T, typename U>
+rocblas_status posv_small(rocblas_handle handle,
+                          const rocblas_fill uplo,
+                          const rocblas_int n,
+                          const rocblas_int nrhs,
+                          U A,
+                          const rocblas_int shiftA,
+                          const rocblas_int lda,
+                          const rocblas_stride strideA,
+                          U B,
+                          const rocblas_int shiftB,
+                          const rocblas_int ldb,
+                          const rocblas_stride strideB,
+                          rocblas_int* info,
+                          const rocblas_int batch_count)
+{
+#define RUN_POSV_SMALL(DIM)                                                                       \
+    hipLaunchKernelGGL((posv_small_kernel<DIM, T>), grid, block, lmemsize, stream, uplo, nrhs, A, \
+                       shiftA, lda, strideA, B, shiftB, ldb, strideB, info, batch_count)
+
+    // determine sizes
+    // (the number of groups per block is limited by the available shared memory)
+    std::vector<int> opval{POTF2_OPTIM_NGRP};
+    size_t lmemgrp = posv_small_lmemsize<T>(n, nrhs);
+    rocblas_int ngrp = (batch_count < 2 || n > 32) ? 1 : opval[n - 1];
+    ngrp = max(1, min(ngrp, rocblas_int(GESV_POSV_MAX_SMALL_LDS / lmemgrp)));
+    rocblas_int blocks = (batch_count - 1) / ngrp + 1;
+    rocblas_int nthds = n;
+
+    // prepare kernel launch
+    dim3 grid(blocks, 1, 1);
+    dim3 block(nthds, ngrp, 1);
+    size_t lmemsize = lmemgrp * ngrp;
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // instantiate cases to make the size n known at compile time
+    // this should allow loop unrolling.
+    // kernel launch
+    switch(n)
+    {
+    case 1: RUN_POSV_SMALL(1); break;
+    case 2: RUN_POSV_SMALL(2); break;
+    case 3: RUN_POSV_SMALL(3); break;
+    case 4: RUN_POSV_SMALL(4); break;
+    case 5: RUN_POSV_SMALL(5); break;
+    case 6: RUN_POSV_SMALL(6); break;
+    case 7: RUN_POSV_SMALL(7); break;
+    case 8: RUN_POSV_SMALL(8); break;
+    case 9: RUN_POSV_SMALL(9); break;
+    case 10: RUN_POSV_SMALL(10); break;
+    case 11: RUN_POSV_SMALL(11); break;
+    case 12: RUN_POSV_SMALL(12); break;
+    case 13: RUN_POSV_SMALL(13); break;
+    case 14: RUN_POSV_SMALL(14); break;
+    case 15: RUN_POSV_SMALL(15); break;
+    case 16: RUN_POSV_SMALL(16); break;
+    case 17: RUN_POSV_SMALL(17); break;
+    case 18: RUN_POSV_SMALL(18); break;
+    case 19: RUN_POSV_SMALL(19); break;
+    case 20: RUN_POSV_SMALL(20); break;
+    case 21: RUN_POSV_SMALL(21); break;
+    case 22: RUN_POSV_SMALL(22); break;
+    case 23: RUN_POSV_SMALL(23); break;
+    case 24: RUN_POSV_SMALL(24); break;
+    case 25: RUN_POSV_SMALL(25); break;
+    case 26: RUN_POSV_SMALL(26); break;
+    case 27: RUN_POSV_SMALL(27); break;
+    case 28: RUN_POSV_SMALL(28); break;
+    case 29: RUN_POSV_SMALL(29); break;
+    case 30: RUN_POSV_SMALL(30); break;
+    case 31: RUN_POSV_SMALL(31); break;
+    case 32: RUN_POSV_SMALL(32); break;
+    case 33: RUN_POSV_SMALL(33); break;
+    case 34: RUN_POSV_SMALL(34); break;
+    case 35: RUN_POSV_SMALL(35); break;
+    case 36: RUN_POSV_SMALL(36); break;
+    case 37: RUN_POSV_SMALL(37); break;
+    case 38: RUN_POSV_SMALL(38); break;
+    case 39: RUN_POSV_SMALL(39); break;
+    case 40: RUN_POSV_SMALL(40); break;
+    case 41: RUN_POSV_SMALL(41); break;
+    case 42: RUN_POSV_SMALL(42); break;
+    case 43: RUN_POSV_SMALL(43); break;
+    case 44: RUN_POSV_SMALL(44); break;
+    case 45: RUN_POSV_SMALL(45); break;
+    case 46: RUN_POSV_SMALL(46); break;
+    case 47: RUN_POSV_SMALL(47); break;
+    case 48: RUN_POSV_SMALL(48); break;
+    case 49: RUN_POSV_SMALL(49); break;
+    case 50: RUN_POSV_SMALL(50); break;
+    case 51: RUN_POSV_SMALL(51); break;
+    case 52: RUN_POSV_SMALL(52); break;
+    case 53: RUN_POSV_SMALL(53); break;
+    case 54: RUN_POSV_SMALL(54); break;
+    case 55: RUN_POSV_SMALL(55); break;
+    case 56: RUN_POSV_SMALL(56); break;
+    case 57: RUN_POSV_SMALL(57); break;
+    case 58: RUN_POSV_SMALL(58); break;
+    case 59: RUN_POSV_SMALL(59); break;
+    case 60: RUN_POSV_SMALL(60); break;
+    case 61: RUN_POSV_SMALL(61); break;
+    case 62: RUN_POSV_SMALL(62); break;
+    case 63: RUN_POSV_SMALL(63); break;
+    case 64: RUN_POSV_SMALL(64); break;
+    default: ROCSOLVER_UNREACHABLE();
+    }
+
+    return rocblas_status_success;
+}
+#endif // OPTIMAL
+
+template <bool BATCHED, typename T>
+void rocsolver_posv_getMemorySize(const rocblas_int n,
+                                  const rocblas_int nrhs,
+                                  const rocblas_fill uplo,
+                                  const rocblas_int batch_count,
+                                  size_t* size_scalars,
+                                  size_t* size_work1,
+                                  size_t* size_work2,
+                                  size_t* size_work3,
+                                  size_t* size_work4,
+                                  size_t* size_pivots,
+                                  size_t* size_iinfo,
+                                  size_t* size_savedB)
+{
+    // if quick return, no workspace needed
+    bool quick = (n == 0 || batch_count == 0);
+#ifdef OPTIMAL
+    // if using the fused kernel for small sizes, no workspace needed
+    quick = quick || posv_use_small<T>(n, nrhs);
+#endif
+    if(quick)
+    {
+        *size_scalars = 0;
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *size_pivots = 0;
+        *size_iinfo = 0;
+        *size_savedB = 0;
+        return;
+    }
+
+    size_t w1 = 0, w2 = 0, w3 = 0, w4 = 0;
+
+    // requirements for calling POTRF
+    rocsolver_potrf_getMemorySize<BATCHED, T>(n, uplo, batch_count, size_scalars, size_work1,
+                                              size_work2, size_work3, size_work4, size_pivots,
+                                              size_iinfo);
+
+    // requirements for calling TRSM
+    if(nrhs > 0)
+        rocblasCall_trsm_mem<BATCHED, T>(rocblas_side_left, n, nrhs, batch_count, &w1, &w2, &w3,
+                                         &w4);
+
+    *size_work1 = std::max(*size_work1, w1);
+    *size_work2 = std::max(*size_work2, w2);
+    *size_work3 = std::max(*size_work3, w3);
+    *size_work4 = std::max(*size_work4, w4);
+
+    // size to save B in cases where A is not positive definite
+    *size_savedB = sizeof(T) * n * nrhs * batch_count;
+}
+
+template <typename T>
+rocblas_status rocsolver_posv_argCheck(rocblas_handle handle,
+                                       const rocblas_fill uplo,
+                                       const rocblas_int n,
+                                       const rocblas_int nrhs,
+                                       const rocblas_int lda,
+                                       const rocblas_int ldb,
+                                       T A,
+                                       T B,
+                                       const rocblas_int* info,
+                                       const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || nrhs < 0 || lda < n || ldb < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (nrhs * n && !B) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, typename S, typename T, typename U>
+rocblas_status rocsolver_posv_template(rocblas_handle handle,
+                                       const rocblas_fill uplo,
+                                       const rocblas_int n,
+                                       const rocblas_int nrhs,
+                                       U A,
+                                       const rocblas_int shiftA,
+                                       const rocblas_int lda,
+                                       const rocblas_stride strideA,
+                                       U B,
+                                       const rocblas_int shiftB,
+                                       const rocblas_int ldb,
+                                       const rocblas_stride strideB,
+                                       rocblas_int* info,
+                                       const rocblas_int batch_count,
+                                       T* scalars,
+                                       void* work1,
+                                       void* work2,
+                                       void* work3,
+                                       void* work4,
+                                       T* pivots,
+                                       rocblas_int* iinfo,
+                                       T* savedB,
+                                       bool optim_mem)
+{
+    ROCSOLVER_ENTER("posv", "uplo:", uplo, "n:", n, "nrhs:", nrhs, "shiftA:", shiftA, "lda:", lda,
+                    "shiftB:", shiftB, "ldb:", ldb, "bc:", batch_count);
+
+    // quick return if zero instances in batch
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocksReset = (batch_count - 1) / BLOCKSIZE + 1;
+    dim3 gridReset(blocksReset, 1, 1);
+    dim3 threads(BLOCKSIZE, 1, 1);
+
+    // info=0 (starting with a positive definite matrix)
+    hipLaunchKernelGGL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
+
+    // quick return if A is empty
+    if(n == 0)
+        return rocblas_status_success;
+
+#ifdef OPTIMAL
+    // factorize and solve with a single kernel launch for small sizes
+    if(posv_use_small<T>(n, nrhs))
+        return posv_small<T>(handle, uplo, n, nrhs, A, shiftA, lda, strideA, B, shiftB, ldb,
+                             strideB, info, batch_count);
+#endif
+
+    // compute Cholesky factorization of A
+    rocsolver_potrf_template<BATCHED, S, T>(handle, uplo, n, A, shiftA, lda, strideA, info,
+                                            batch_count, scalars, work1, work2, work3, work4,
+                                            pivots, iinfo, optim_mem);
+
+    // quick return if B is empty
+    if(nrhs == 0)
+        return rocblas_status_success;
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+
+    // constants in host memory
+    const rocblas_int copyblocksx = (nrhs - 1) / 32 + 1;
+    const rocblas_int copyblocksy = (n - 1) / 32 + 1;
+    const T one = 1;
+
+    // save elements of B that will be overwritten by TRSM for cases where info is nonzero
+    hipLaunchKernelGGL((masked_copymat<T, U>), dim3(copyblocksx, copyblocksy, batch_count),
+                       dim3(32, 32), 0, stream, copymat_to_buffer, n, nrhs, B, shiftB, ldb,
+                       strideB, savedB, info);
+
+    // do the equivalent of potrs
+    if(uplo == rocblas_fill_upper)
+    {
+        // solve U'Y = B, overwriting B with Y
+        rocblasCall_trsm<BATCHED, T>(handle, rocblas_side_left, uplo,
+                                     rocblas_operation_conjugate_transpose,
+                                     rocblas_diagonal_non_unit, n, nrhs, &one, A, shiftA, lda,
+                                     strideA, B, shiftB, ldb, strideB, batch_count, optim_mem,
+                                     work1, work2, work3, work4);
+
+        // solve UX = Y, overwriting B with X
+        rocblasCall_trsm<BATCHED, T>(handle, rocblas_side_left, uplo, rocblas_operation_none,
+                                     rocblas_diagonal_non_unit, n, nrhs, &one, A, shiftA, lda,
+                                     strideA, B, shiftB, ldb, strideB, batch_count, optim_mem,
+                                     work1, work2, work3, work4);
+    }
+    else
+    {
+        // solve LY = B, overwriting B with Y
+        rocblasCall_trsm<BATCHED, T>(handle, rocblas_side_left, uplo, rocblas_operation_none,
+                                     rocblas_diagonal_non_unit, n, nrhs, &one, A, shiftA, lda,
+                                     strideA, B, shiftB, ldb, strideB, batch_count, optim_mem,
+                                     work1, work2, work3, work4);
+
+        // solve L'X = Y, overwriting B with X
+        rocblasCall_trsm<BATCHED, T>(handle, rocblas_side_left, uplo,
+                                     rocblas_operation_conjugate_transpose,
+                                     rocblas_diagonal_non_unit, n, nrhs, &one, A, shiftA, lda,
+                                     strideA, B, shiftB, ldb, strideB, batch_count, optim_mem,
+                                     work1, work2, work3, work4);
+    }
+
+    // restore elements of B that were overwritten by TRSM in cases where info is nonzero
+    hipLaunchKernelGGL((masked_copymat<T, U>), dim3(copyblocksx, copyblocksy, batch_count),
+                       dim3(32, 32), 0, stream, copymat_from_buffer, n, nrhs, B, shiftB, ldb,
+                       strideB, savedB, info);
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
@@ -3,6 +3,7 @@
  * ************************************************************************ */
 
 #include "roclapack_potf2.hpp"
+#include "rocsolver_plan.hpp"
 
 template <typename T, typename U>
 rocblas_status rocsolver_potf2_impl(rocblas_handle handle,
@@ -43,7 +44,7 @@ rocblas_status rocsolver_potf2_impl(rocblas_handle handle,
 
     // memory workspace allocation
     void *scalars, *work, *pivots;
-    rocblas_device_malloc mem(handle, size_scalars, size_work, size_pivots);
+    rocsolver_device_malloc mem(handle, size_scalars, size_work, size_pivots);
 
     if(!mem)
         return rocblas_status_memory_error;
@@ -59,6 +60,27 @@ rocblas_status rocsolver_potf2_impl(rocblas_handle handle,
                                        (T*)scalars, (T*)work, (T*)pivots);
 }
 
+template <typename T>
+void rocsolver_potf2_plan(const rocsolver_batch_mode mode,
+                          const rocblas_int n,
+                          const rocblas_int batch_count,
+                          rocsolver_workspace_plan* plan)
+{
+    // normal execution works with a single matrix
+    const rocblas_int bc = (mode == rocsolver_batch_none ? 1 : batch_count);
+
+    // memory workspace sizes
+    size_t size_scalars, size_work, size_pivots;
+    rocsolver_potf2_getMemorySize<T>(n, bc, &size_scalars, &size_work, &size_pivots);
+
+    rocsolver_plan_add(plan, "scalars", size_scalars);
+    rocsolver_plan_add(plan, "work", size_work);
+    rocsolver_plan_add(plan, "pivots", size_pivots);
+
+    if(!rocsolver_plan_quick_return(mode, n, n, batch_count))
+        plan->algorithm = "potf2";
+}
+
 /*
  * ===========================================================================
  *    C wrapper
@@ -106,4 +128,15 @@ rocblas_status rocsolver_zpotf2(rocblas_handle handle,
 {
     return rocsolver_potf2_impl<rocblas_double_complex>(handle, uplo, n, A, lda, info);
 }
+
+rocblas_status rocsolver_plan_potf2(const rocblas_datatype type,
+                                    const rocsolver_batch_mode mode,
+                                    const rocblas_int n,
+                                    const rocblas_int batch_count,
+                                    rocsolver_workspace_plan* plan)
+{
+    return rocsolver_plan_template(type, mode, n, n, batch_count, plan, [&](auto t) {
+        rocsolver_potf2_plan<decltype(t)>(mode, n, batch_count, plan);
+    });
+}
 }
@@ -75,6 +75,217 @@ __global__ void sqrtDiagOnward(U A,
     }
 }
 
+#ifdef OPTIMAL
+/*************************************************************
+    CHOLfact_small_kernel takes care of matrices with
+    n <= POTF2_MAX_SMALL_SIZE. Each thread of a group holds a row
+    (lower case) or a column (upper case) of the matrix in
+    registers, and a single launch factorizes all the instances
+*************************************************************/
+template <rocblas_int DIM, typename T, typename U>
+__global__ void __launch_bounds__(GETF2_MAX_THDS)
+    CHOLfact_small_kernel(const rocblas_fill uplo,
+                          U AA,
+                          const rocblas_int shiftA,
+                          const rocblas_int lda,
+                          const rocblas_stride strideA,
+                          rocblas_int* infoA,
+                          const rocblas_int batch_count)
+{
+    using S = decltype(std::real(T{}));
+
+    const int myrow = hipThreadIdx_x;
+    const int ty = hipThreadIdx_y;
+    const int id = hipBlockIdx_x * hipBlockDim_y + ty;
+
+    if(id >= batch_count)
+        return;
+
+    // batch instance
+    T* A = load_ptr_batch<T>(AA, id, shiftA, strideA);
+    rocblas_int* info = infoA + id;
+
+    // shared memory (for communication between threads in group)
+    extern __shared__ double lmem[];
+    T* common = (T*)lmem;
+    common += ty * DIM;
+
+    // local variables
+    S diag;
+    int myinfo = 0; // to build info
+    T rA[DIM]; // to store this-row (this-column) values
+
+    // read corresponding row (column) from global memory into local array.
+    // In the upper case, working with the columns of A = U'*U is equivalent to
+    // working with the rows of A' = L*L', thus the main loop is the same for both cases
+    const rocblas_int inca = (uplo == rocblas_fill_upper) ? 1 : lda;
+    const rocblas_int incr = (uplo == rocblas_fill_upper) ? lda : 1;
+#pragma unroll DIM
+    for(int j = 0; j < DIM; ++j)
+        rA[j] = A[myrow * incr + j * inca];
+
+// for each column (main loop)
+#pragma unroll DIM
+    for(int k = 0; k < DIM; ++k)
+    {
+        // share the current diagonal element
+        if(myrow == k)
+            common[k] = rA[k];
+        __syncthreads();
+
+        // test for non-positive-definiteness
+        // (all the threads in the group see the same value, so the test is uniform)
+        if(myinfo == 0)
+        {
+            diag = std::real(common[k]);
+            if(diag <= 0)
+            {
+                myinfo = k + 1;
+                if(myrow == k)
+                    rA[k] = T(diag);
+            }
+            else
+            {
+                diag = sqrt(diag);
+                if(myrow == k)
+                    rA[k] = T(diag);
+                else if(myrow > k)
+                    rA[k] = (1 / diag) * rA[k];
+            }
+        }
+
+        // share the current column
+        if(myinfo == 0 && myrow > k)
+            common[myrow] = rA[k];
+        __syncthreads();
+
+        // update the trailing matrix (only the referenced triangle)
+        if(myinfo == 0 && myrow > k)
+        {
+            for(int j = k + 1; j < DIM; ++j)
+            {
+                if(j <= myrow)
+                    rA[j] -= rA[k] * conj(common[j]);
+            }
+        }
+        __syncthreads();
+    }
+
+    // write results to global memory
+    if(myrow == 0)
+        *info = myinfo;
+#pragma unroll DIM
+    for(int j = 0; j < DIM; ++j)
+        A[myrow * incr + j * inca] = rA[j];
+}
+
+/*************************************************************
+    Launcher of CHOLfact_small kernels
+*************************************************************/
+template <typename T, typename U>
+rocblas_status CHOLfact_small(rocblas_handle handle,
+                              const rocblas_fill uplo,
+                              const rocblas_int n,
+                              U A,
+                              const rocblas_int shiftA,
+                              const rocblas_int lda,
+                              const rocblas_stride strideA,
+                              rocblas_int* info,
+                              const rocblas_int batch_count)
+{
+#define RUN_CHOLFACT_SMALL(DIM)                                                                    \
+    hipLaunchKernelGGL((CHOLfact_small_kernel<DIM, T>), grid, block, lmemsize, stream, uplo, A,    \
+                       shiftA, lda, strideA, info, batch_count)
+
+    // determine sizes
+    std::vector<int> opval{POTF2_OPTIM_NGRP};
+    rocblas_int ngrp = (batch_count < 2 || n > 32) ? 1 : opval[n - 1];
+    rocblas_int blocks = (batch_count - 1) / ngrp + 1;
+    rocblas_int nthds = n;
+
+    // prepare kernel launch
+    dim3 grid(blocks, 1, 1);
+    dim3 block(nthds, ngrp, 1);
+    size_t lmemsize = n * ngrp * sizeof(T);
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // instantiate cases to make the size n known at compile time
+    // this should allow loop unrolling.
+    // kernel launch
+    switch(n)
+    {
+    case 1: RUN_CHOLFACT_SMALL(1); break;
+    case 2: RUN_CHOLFACT_SMALL(2); break;
+    case 3: RUN_CHOLFACT_SMALL(3); break;
+    case 4: RUN_CHOLFACT_SMALL(4); break;
+    case 5: RUN_CHOLFACT_SMALL(5); break;
+    case 6: RUN_CHOLFACT_SMALL(6); break;
+    case 7: RUN_CHOLFACT_SMALL(7); break;
+    case 8: RUN_CHOLFACT_SMALL(8); break;
+    case 9: RUN_CHOLFACT_SMALL(9); break;
+    case 10: RUN_CHOLFACT_SMALL(10); break;
+    case 11: RUN_CHOLFACT_SMALL(11); break;
+    case 12: RUN_CHOLFACT_SMALL(12); break;
+    case 13: RUN_CHOLFACT_SMALL(13); break;
+    case 14: RUN_CHOLFACT_SMALL(14); break;
+    case 15: RUN_CHOLFACT_SMALL(15); break;
+    case 16: RUN_CHOLFACT_SMALL(16); break;
+    case 17: RUN_CHOLFACT_SMALL(17); break;
+    case 18: RUN_CHOLFACT_SMALL(18); break;
+    case 19: RUN_CHOLFACT_SMALL(19); break;
+    case 20: RUN_CHOLFACT_SMALL(20); break;
+    case 21: RUN_CHOLFACT_SMALL(21); break;
+    case 22: RUN_CHOLFACT_SMALL(22); break;
+    case 23: RUN_CHOLFACT_SMALL(23); break;
+    case 24: RUN_CHOLFACT_SMALL(24); break;
+    case 25: RUN_CHOLFACT_SMALL(25); break;
+    case 26: RUN_CHOLFACT_SMALL(26); break;
+    case 27: RUN_CHOLFACT_SMALL(27); break;
+    case 28: RUN_CHOLFACT_SMALL(28); break;
+    case 29: RUN_CHOLFACT_SMALL(29); break;
+    case 30: RUN_CHOLFACT_SMALL(30); break;
+    case 31: RUN_CHOLFACT_SMALL(31); break;
+    case 32: RUN_CHOLFACT_SMALL(32); break;
+    case 33: RUN_CHOLFACT_SMALL(33); break;
+    case 34: RUN_CHOLFACT_SMALL(34); break;
+    case 35: RUN_CHOLFACT_SMALL(35); break;
+    case 36: RUN_CHOLFACT_SMALL(36); break;
+    case 37: RUN_CHOLFACT_SMALL(37); break;
+    case 38: RUN_CHOLFACT_SMALL(38); break;
+    case 39: RUN_CHOLFACT_SMALL(39); break;
+    case 40: RUN_CHOLFACT_SMALL(40); break;
+    case 41: RUN_CHOLFACT_SMALL(41); break;
+    case 42: RUN_CHOLFACT_SMALL(42); break;
+    case 43: RUN_CHOLFACT_SMALL(43); break;
+    case 44: RUN_CHOLFACT_SMALL(44); break;
+    case 45: RUN_CHOLFACT_SMALL(45); break;
+    case 46: RUN_CHOLFACT_SMALL(46); break;
+    case 47: RUN_CHOLFACT_SMALL(47); break;
+    case 48: RUN_CHOLFACT_SMALL(48); break;
+    case 49: RUN_CHOLFACT_SMALL(49); break;
+    case 50: RUN_CHOLFACT_SMALL(50); break;
+    case 51: RUN_CHOLFACT_SMALL(51); break;
+    case 52: RUN_CHOLFACT_SMALL(52); break;
+    case 53: RUN_CHOLFACT_SMALL(53); break;
+    case 54: RUN_CHOLFACT_SMALL(54); break;
+    case 55: RUN_CHOLFACT_SMALL(55); break;
+    case 56: RUN_CHOLFACT_SMALL(56); break;
+    case 57: RUN_CHOLFACT_SMALL(57); break;
+    case 58: RUN_CHOLFACT_SMALL(58); break;
+    case 59: RUN_CHOLFACT_SMALL(59); break;
+    case 60: RUN_CHOLFACT_SMALL(60); break;
+    case 61: RUN_CHOLFACT_SMALL(61); break;
+    case 62: RUN_CHOLFACT_SMALL(62); break;
+    case 63: RUN_CHOLFACT_SMALL(63); break;
+    case 64: RUN_CHOLFACT_SMALL(64); break;
+    default: ROCSOLVER_UNREACHABLE();
+    }
+
+    return rocblas_status_success;
+}
+#endif // OPTIMAL
+
 template <typename T>
 void rocsolver_potf2_getMemorySize(const rocblas_int n,
                                    const rocblas_int batch_count,
@@ -91,6 +302,17 @@ void rocsolver_potf2_getMemorySize(const rocblas_int n,
         return;
     }
 
+#ifdef OPTIMAL
+    // if using optimized algorithm for small sizes, no workspace needed
+    if(n <= POTF2_MAX_SMALL_SIZE)
+    {
+        *size_scalars = 0;
+        *size_work = 0;
+        *size_pivots = 0;
+        return;
+    }
+#endif
+
     // size of scalars (constants)
     *size_scalars = sizeof(T) * 3;
 
@@ -166,6 +388,12 @@ rocblas_status rocsolver_potf2_template(rocblas_handle handle,
     if(n == 0)
         return rocblas_status_success;
 
+#ifdef OPTIMAL
+    // Use optimized Cholesky factorization for the right sizes
+    if(n <= POTF2_MAX_SMALL_SIZE)
+        return CHOLfact_small<T>(handle, uplo, n, A, shiftA, lda, strideA, info, batch_count);
+#endif
+
     // everything must be executed with scalars on the device
     rocblas_pointer_mode old_mode;
     rocblas_get_pointer_mode(handle, &old_mode);
@@ -42,7 +42,7 @@ rocblas_status rocsolver_potf2_strided_batched_impl(rocblas_handle handle,
 
     // memory workspace allocation
     void *scalars, *work, *pivots;
-    rocblas_device_malloc mem(handle, size_scalars, size_work, size_pivots);
+    rocsolver_device_malloc mem(handle, size_scalars, size_work, size_pivots);
 
     if(!mem)
         return rocblas_status_memory_error;
@@ -3,6 +3,7 @@
  * ************************************************************************ */
 
 #include "roclapack_potrf.hpp"
+#include "rocsolver_plan.hpp"
 
 template <typename S, typename T, typename U>
 rocblas_status rocsolver_potrf_impl(rocblas_handle handle,
@@ -52,8 +53,8 @@ rocblas_status rocsolver_potrf_impl(rocblas_handle handle,
 
     // memory workspace allocation
     void *scalars, *work1, *work2, *work3, *work4, *pivots, *iinfo;
-    rocblas_device_malloc mem(handle, size_scalars, size_work1, size_work2, size_work3, size_work4,
-                              size_pivots, size_iinfo);
+    rocsolver_device_malloc mem(handle, size_scalars, size_work1, size_work2, size_work3,
+                                size_work4, size_pivots, size_iinfo);
 
     if(!mem)
         return rocblas_status_memory_error;
@@ -74,6 +75,49 @@ rocblas_status rocsolver_potrf_impl(rocblas_handle handle,
                                                  work4, (T*)pivots, (rocblas_int*)iinfo, optim_mem);
 }
 
+template <typename T>
+void rocsolver_potrf_plan(const rocsolver_batch_mode mode,
+                          const rocblas_fill uplo,
+                          const rocblas_int n,
+                          const rocblas_int batch_count,
+                          rocsolver_workspace_plan* plan)
+{
+    // normal execution works with a single matrix
+    const rocblas_int bc = (mode == rocsolver_batch_none ? 1 : batch_count);
+
+    // memory workspace sizes
+    size_t size_scalars, size_work1, size_work2, size_work3, size_work4, size_pivots, size_iinfo;
+    if(mode == rocsolver_batch_pointers)
+        rocsolver_potrf_getMemorySize<true, T>(n, uplo, bc, &size_scalars, &size_work1,
+                                               &size_work2, &size_work3, &size_work4,
+                                               &size_pivots, &size_iinfo);
+    else
+        rocsolver_potrf_getMemorySize<false, T>(n, uplo, bc, &size_scalars, &size_work1,
+                                                &size_work2, &size_work3, &size_work4,
+                                                &size_pivots, &size_iinfo);
+
+    rocsolver_plan_add(plan, "scalars", size_scalars);
+    rocsolver_plan_add(plan, "work1", size_work1);
+    rocsolver_plan_add(plan, "work2", size_work2);
+    rocsolver_plan_add(plan, "work3", size_work3);
+    rocsolver_plan_add(plan, "work4", size_work4);
+    rocsolver_plan_add(plan, "pivots", size_pivots);
+    rocsolver_plan_add(plan, "iinfo", size_iinfo);
+
+    if(rocsolver_plan_quick_return(mode, n, n, batch_count))
+        return;
+
+    // small matrices are factorized with a single POTF2
+    rocblas_int nb = rocsolver_tuning::get()->potrf_potf2_switchsize;
+    if(n < nb)
+        plan->algorithm = "potf2";
+    else
+    {
+        plan->algorithm = "potrf";
+        plan->block_size = nb;
+    }
+}
+
 /*
  * ===========================================================================
  *    C wrapper
@@ -121,4 +165,19 @@ rocblas_status rocsolver_zpotrf(rocblas_handle handle,
 {
     return rocsolver_potrf_impl<double, rocblas_double_complex>(handle, uplo, n, A, lda, info);
 }
+
+rocblas_status rocsolver_plan_potrf(const rocblas_datatype type,
+                                    const rocsolver_batch_mode mode,
+                                    const rocblas_fill uplo,
+                                    const rocblas_int n,
+                                    const rocblas_int batch_count,
+                                    rocsolver_workspace_plan* plan)
+{
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+
+    return rocsolver_plan_template(type, mode, n, n, batch_count, plan, [&](auto t) {
+        rocsolver_potrf_plan<decltype(t)>(mode, uplo, n, batch_count, plan);
+    });
+}
 }
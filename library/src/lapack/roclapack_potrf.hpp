@@ -47,7 +47,9 @@ void rocsolver_potrf_getMemorySize(const rocblas_int n,
         return;
     }
 
-    if(n < POTRF_POTF2_SWITCHSIZE)
+    rocblas_int nb = rocsolver_tuning::get()->potrf_potf2_switchsize;
+
+    if(n < nb)
     {
         // requirements for calling a single POTF2
         rocsolver_potf2_getMemorySize<T>(n, batch_count, size_scalars, size_work1, size_pivots);
@@ -58,7 +60,7 @@ void rocsolver_potrf_getMemorySize(const rocblas_int n,
     }
     else
     {
-        rocblas_int jb = POTRF_POTF2_SWITCHSIZE;
+        rocblas_int jb = nb;
         size_t s1, s2;
 
         // size to store info about positiveness of each subblock
@@ -124,9 +126,11 @@ rocblas_status rocsolver_potrf_template(rocblas_handle handle,
     rocblas_get_pointer_mode(handle, &old_mode);
     rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
 
+    rocblas_int nb = rocsolver_tuning::get()->potrf_potf2_switchsize;
+
     // if the matrix is small, use the unblocked (BLAS-levelII) variant of the
     // algorithm
-    if(n < POTRF_POTF2_SWITCHSIZE)
+    if(n < nb)
         return rocsolver_potf2_template<T>(handle, uplo, n, A, shiftA, lda, strideA, info,
                                            batch_count, scalars, (T*)work1, pivots);
 
@@ -144,10 +148,10 @@ rocblas_status rocsolver_potrf_template(rocblas_handle handle,
     if(uplo == rocblas_fill_upper)
     {
         // Compute the Cholesky factorization A = U'*U.
-        for(rocblas_int j = 0; j < n; j += POTRF_POTF2_SWITCHSIZE)
+        for(rocblas_int j = 0; j < n; j += nb)
         {
             // Factor diagonal and subdiagonal blocks
-            jb = min(n - j, POTRF_POTF2_SWITCHSIZE); // number of columns in the block
+            jb = min(n - j, nb); // number of columns in the block
             hipLaunchKernelGGL(reset_info, gridReset, threads, 0, stream, iinfo, batch_count, 0);
             rocsolver_potf2_template<T>(handle, uplo, jb, A, shiftA + idx2D(j, j, lda), lda,
                                         strideA, iinfo, batch_count, scalars, (T*)work1, pivots);
@@ -175,10 +179,10 @@ rocblas_status rocsolver_potrf_template(rocblas_handle handle,
     else
     {
         // Compute the Cholesky factorization A = L*L'.
-        for(rocblas_int j = 0; j < n; j += POTRF_POTF2_SWITCHSIZE)
+        for(rocblas_int j = 0; j < n; j += nb)
         {
             // Factor diagonal and subdiagonal blocks
-            jb = min(n - j, POTRF_POTF2_SWITCHSIZE); // number of columns in the block
+            jb = min(n - j, nb); // number of columns in the block
             hipLaunchKernelGGL(reset_info, gridReset, threads, 0, stream, iinfo, batch_count, 0);
             rocsolver_potf2_template<T>(handle, uplo, jb, A, shiftA + idx2D(j, j, lda), lda,
                                         strideA, iinfo, batch_count, scalars, (T*)work1, pivots);
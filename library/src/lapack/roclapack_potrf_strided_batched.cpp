@@ -51,8 +51,8 @@ rocblas_status rocsolver_potrf_strided_batched_impl(rocblas_handle handle,
 
     // memory workspace allocation
     void *scalars, *work1, *work2, *work3, *work4, *pivots, *iinfo;
-    rocblas_device_malloc mem(handle, size_scalars, size_work1, size_work2, size_work3, size_work4,
-                              size_pivots, size_iinfo);
+    rocsolver_device_malloc mem(handle, size_scalars, size_work1, size_work2, size_work3,
+                                size_work4, size_pivots, size_iinfo);
 
     if(!mem)
         return rocblas_status_memory_error;
@@ -0,0 +1,160 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_potrf.hpp"
+#include "rocsolver_staging.hpp"
+
+template <typename S, typename T>
+rocblas_status rocsolver_potrf_strided_batched_host_impl(rocblas_handle handle,
+                                                         const rocblas_fill uplo,
+                                                         const rocblas_int n,
+                                                         T* A,
+                                                         const rocblas_int lda,
+                                                         const rocblas_stride strideA,
+                                                         rocblas_int* info,
+                                                         const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("potrf_strided_batched_host", "--uplo", uplo, "-n", n, "--lda", lda,
+                        "--strideA", strideA, "--batch_count", batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_potf2_potrf_argCheck(handle, uplo, n, lda, A, info, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // the matrices and info are staged through pinned host buffers;
+    // in the staging buffers, consecutive matrices are lda*n elements apart
+    const bool quick = (n == 0 || batch_count == 0);
+    const rocblas_stride stA = rocblas_stride(lda) * n;
+    rocsolver_staged_array arrays[2];
+    rocblas_int chunk = batch_count;
+    if(!quick)
+    {
+        arrays[0] = {A, sizeof(T), size_t(lda) * (n - 1) + n, size_t(strideA), size_t(stA),
+                     true, true};
+        arrays[1] = {info, sizeof(rocblas_int), 1, 1, 1, false, true};
+        chunk = rocsolver_staging_pool::chunk_size(handle, arrays, 2, batch_count);
+    }
+
+    // memory workspace sizes (for a sub-batch):
+    // size for constants in rocblas calls
+    size_t size_scalars;
+    // size of reusable workspace (and for calling TRSM)
+    size_t size_work1, size_work2, size_work3, size_work4;
+    // extra requirements for calling POTF2
+    size_t size_pivots;
+    // size to store info about positiveness of each subblock
+    size_t size_iinfo;
+    rocsolver_potrf_getMemorySize<false, T>(n, uplo, chunk, &size_scalars, &size_work1,
+                                            &size_work2, &size_work3, &size_work4, &size_pivots,
+                                            &size_iinfo);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work1, size_work2,
+                                                      size_work3, size_work4, size_pivots,
+                                                      size_iinfo);
+
+    // quick return (info is in host memory)
+    if(quick)
+    {
+        for(rocblas_int b = 0; b < batch_count; ++b)
+            info[b] = 0;
+        return rocblas_status_success;
+    }
+
+    // always allocate all required memory for TRSM optimal performance
+    bool optim_mem = true;
+
+    // memory workspace allocation
+    void *scalars, *work1, *work2, *work3, *work4, *pivots, *iinfo;
+    rocsolver_device_malloc mem(handle, size_scalars, size_work1, size_work2, size_work3,
+                                size_work4, size_pivots, size_iinfo);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    scalars = mem[0];
+    work1 = mem[1];
+    work2 = mem[2];
+    work3 = mem[3];
+    work4 = mem[4];
+    pivots = mem[5];
+    iinfo = mem[6];
+    if(size_scalars > 0)
+        init_scalars(handle, (T*)scalars);
+
+    // execution
+    // (the workspace is reused by all the sub-batches, in the order of the handle's stream)
+    auto launch = [&](void* const* dArrays, rocblas_int count) {
+        return rocsolver_potrf_template<false, S, T>(
+            handle, uplo, n, (T*)dArrays[0], 0, lda, stA, (rocblas_int*)dArrays[1], count,
+            (T*)scalars, work1, work2, work3, work4, (T*)pivots, (rocblas_int*)iinfo, optim_mem);
+    };
+
+    return rocsolver_staging_pool::run(handle, batch_count, arrays, 2, launch);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_spotrf_strided_batched_host(rocblas_handle handle,
+                                                     const rocblas_fill uplo,
+                                                     const rocblas_int n,
+                                                     float* A,
+                                                     const rocblas_int lda,
+                                                     const rocblas_stride strideA,
+                                                     rocblas_int* info,
+                                                     const rocblas_int batch_count)
+{
+    return rocsolver_potrf_strided_batched_host_impl<float, float>(handle, uplo, n, A, lda,
+                                                                   strideA, info, batch_count);
+}
+
+rocblas_status rocsolver_dpotrf_strided_batched_host(rocblas_handle handle,
+                                                     const rocblas_fill uplo,
+                                                     const rocblas_int n,
+                                                     double* A,
+                                                     const rocblas_int lda,
+                                                     const rocblas_stride strideA,
+                                                     rocblas_int* info,
+                                                     const rocblas_int batch_count)
+{
+    return rocsolver_potrf_strided_batched_host_impl<double, double>(handle, uplo, n, A, lda,
+                                                                     strideA, info, batch_count);
+}
+
+rocblas_status rocsolver_cpotrf_strided_batched_host(rocblas_handle handle,
+                                                     const rocblas_fill uplo,
+                                                     const rocblas_int n,
+                                                     rocblas_float_complex* A,
+                                                     const rocblas_int lda,
+                                                     const rocblas_stride strideA,
+                                                     rocblas_int* info,
+                                                     const rocblas_int batch_count)
+{
+    return rocsolver_potrf_strided_batched_host_impl<float, rocblas_float_complex>(
+        handle, uplo, n, A, lda, strideA, info, batch_count);
+}
+
+rocblas_status rocsolver_zpotrf_strided_batched_host(rocblas_handle handle,
+                                                     const rocblas_fill uplo,
+                                                     const rocblas_int n,
+                                                     rocblas_double_complex* A,
+                                                     const rocblas_int lda,
+                                                     const rocblas_stride strideA,
+                                                     rocblas_int* info,
+                                                     const rocblas_int batch_count)
+{
+    return rocsolver_potrf_strided_batched_host_impl<double, rocblas_double_complex>(
+        handle, uplo, n, A, lda, strideA, info, batch_count);
+}
+}
@@ -59,8 +59,8 @@ rocblas_status rocsolver_syev_heev_strided_batched_impl(rocblas_handle handle,
 
     // memory workspace allocation
     void *scalars, *work_stack, *Abyx_norms_tmptr, *tmptau_trfact, *tau, *workArr;
-    rocblas_device_malloc mem(handle, size_scalars, size_work_stack, size_Abyx_norms_tmptr,
-                              size_tmptau_trfact, size_tau, size_workArr);
+    rocsolver_device_malloc mem(handle, size_scalars, size_work_stack, size_Abyx_norms_tmptr,
+                                size_tmptau_trfact, size_tau, size_workArr);
 
     if(!mem)
         return rocblas_status_memory_error;
@@ -0,0 +1,255 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "auxiliary/rocauxiliary_ormtr_unmtr.hpp"
+#include "auxiliary/rocauxiliary_stedc.hpp"
+#include "auxiliary/rocauxiliary_sterf.hpp"
+#include "rocblas.hpp"
+#include "roclapack_syev_heev.hpp"
+#include "roclapack_sytrd_hetrd.hpp"
+#include "rocsolver.h"
+
+/** wrapper to ORMTR_UNMTR_TEMPLATE **/
+template <bool BATCHED, bool STRIDED, typename T>
+void local_ormtr_unmtr_template(rocblas_handle handle,
+                                const rocblas_fill uplo,
+                                const rocblas_int n,
+                                T* A,
+                                const rocblas_int shiftA,
+                                const rocblas_int lda,
+                                const rocblas_stride strideA,
+                                T* ipiv,
+                                const rocblas_stride strideP,
+                                T* C,
+                                const rocblas_int shiftC,
+                                const rocblas_int ldc,
+                                const rocblas_stride strideC,
+                                const rocblas_int batch_count,
+                                T* scalars,
+                                T* AbyxORwork,
+                                T* diagORtmptr,
+                                T* trfact,
+                                T** workArr)
+{
+    rocsolver_ormtr_unmtr_template<BATCHED, STRIDED>(
+        handle, rocblas_side_left, uplo, rocblas_operation_none, n, n, A, shiftA, lda, strideA,
+        ipiv, strideP, C, shiftC, ldc, strideC, batch_count, scalars, AbyxORwork, diagORtmptr,
+        trfact, workArr);
+}
+
+/** wrapper to ORMTR_UNMTR_TEMPLATE
+    Adapts A and C to be of the same type **/
+template <bool BATCHED, bool STRIDED, typename T>
+void local_ormtr_unmtr_template(rocblas_handle handle,
+                                const rocblas_fill uplo,
+                                const rocblas_int n,
+                                T* const A[],
+                                const rocblas_int shiftA,
+                                const rocblas_int lda,
+                                const rocblas_stride strideA,
+                                T* ipiv,
+                                const rocblas_stride strideP,
+                                T* C,
+                                const rocblas_int shiftC,
+                                const rocblas_int ldc,
+                                const rocblas_stride strideC,
+                                const rocblas_int batch_count,
+                                T* scalars,
+                                T* AbyxORwork,
+                                T* diagORtmptr,
+                                T* trfact,
+                                T** workArr)
+{
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocks = (batch_count - 1) / 256 + 1;
+    hipLaunchKernelGGL(get_array, dim3(blocks), dim3(256), 0, stream, workArr, C, strideC,
+                       batch_count);
+
+    rocsolver_ormtr_unmtr_template<BATCHED, STRIDED>(
+        handle, rocblas_side_left, uplo, rocblas_operation_none, n, n, A, shiftA, lda, strideA,
+        ipiv, strideP, (T* const*)workArr, shiftC, ldc, strideC, batch_count, scalars, AbyxORwork,
+        diagORtmptr, trfact, (workArr + batch_count));
+}
+
+/** Helper to calculate workspace sizes **/
+template <bool BATCHED, typename T, typename S>
+void rocsolver_syevd_heevd_getMemorySize(const rocblas_evect evect,
+                                         const rocblas_fill uplo,
+                                         const rocblas_int n,
+                                         const rocblas_int batch_count,
+                                         size_t* size_scalars,
+                                         size_t* size_work_stack,
+                                         size_t* size_Abyx_norms_tmptr,
+                                         size_t* size_tmptau_trfact,
+                                         size_t* size_tau,
+                                         size_t* size_workArr,
+                                         size_t* size_tempvect,
+                                         size_t* size_tempgemm,
+                                         size_t* size_tmpz,
+                                         size_t* size_splits,
+                                         size_t* size_vectors)
+{
+    // if quick return, set workspace to zero
+    if(n == 0 || batch_count == 0)
+    {
+        *size_scalars = 0;
+        *size_work_stack = 0;
+        *size_Abyx_norms_tmptr = 0;
+        *size_tmptau_trfact = 0;
+        *size_tau = 0;
+        *size_workArr = 0;
+        *size_tempvect = 0;
+        *size_tempgemm = 0;
+        *size_tmpz = 0;
+        *size_splits = 0;
+        *size_vectors = 0;
+        return;
+    }
+
+    size_t unused;
+    size_t w1 = 0, w2 = 0, w3 = 0;
+    size_t a1 = 0, a2 = 0;
+    size_t t1 = 0, t2 = 0;
+    size_t r1 = 0, r2 = 0;
+
+    // requirements for tridiagonalization (sytrd/hetrd)
+    rocsolver_sytrd_hetrd_getMemorySize<T, BATCHED>(n, batch_count, size_scalars, &w1, &a1, &t1,
+                                                    &r1);
+
+    if(evect == rocblas_evect_original)
+    {
+        // extra requirements for computing the eigenvalues and the eigenvectors
+        // of the tridiagonal matrix (stedc)
+        rocsolver_stedc_getMemorySize<S, T>(rocblas_evect_tridiagonal, n, batch_count, &w2,
+                                            size_tempvect, size_tempgemm, size_tmpz, size_splits);
+
+        // extra requirements for applying the orthogonal matrix (ormtr/unmtr)
+        rocsolver_ormtr_unmtr_getMemorySize<T, BATCHED>(rocblas_side_left, uplo, n, n, batch_count,
+                                                        &unused, &w3, &a2, &t2, &r2);
+
+        // size of the eigenvectors of the tridiagonal matrix
+        *size_vectors = sizeof(T) * n * n * batch_count;
+
+        // the batched ormtr/unmtr also needs an array of pointers to the eigenvectors
+        if(BATCHED)
+            r2 += sizeof(T*) * batch_count;
+    }
+    else
+    {
+        // extra requirements for computing only the eigenvalues (sterf)
+        rocsolver_sterf_getMemorySize<T>(n, batch_count, &w2);
+        *size_tempvect = 0;
+        *size_tempgemm = 0;
+        *size_tmpz = 0;
+        *size_splits = 0;
+        *size_vectors = 0;
+    }
+
+    // get max values
+    *size_work_stack = std::max({w1, w2, w3});
+    *size_Abyx_norms_tmptr = std::max(a1, a2);
+    *size_tmptau_trfact = std::max(t1, t2);
+    *size_workArr = std::max(r1, r2);
+
+    // size of array for temporary householder scalars
+    *size_tau = sizeof(T) * n * batch_count;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename S, typename W>
+rocblas_status rocsolver_syevd_heevd_template(rocblas_handle handle,
+                                              const rocblas_evect evect,
+                                              const rocblas_fill uplo,
+                                              const rocblas_int n,
+                                              W A,
+                                              const rocblas_int shiftA,
+                                              const rocblas_int lda,
+                                              const rocblas_stride strideA,
+                                              S* D,
+                                              const rocblas_stride strideD,
+                                              S* E,
+                                              const rocblas_stride strideE,
+                                              rocblas_int* info,
+                                              const rocblas_int batch_count,
+                                              T* scalars,
+                                              void* work_stack,
+                                              T* Abyx_norms_tmptr,
+                                              T* tmptau_trfact,
+                                              T* tau,
+                                              T** workArr,
+                                              S* tempvect,
+                                              S* tempgemm,
+                                              S* tmpz,
+                                              rocblas_int* splits,
+                                              T* vectors)
+{
+    ROCSOLVER_ENTER("syevd_heevd", "evect:", evect, "uplo:", uplo, "n:", n, "shiftA:", shiftA,
+                    "lda:", lda, "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocksReset = (batch_count - 1) / BLOCKSIZE + 1;
+    dim3 gridReset(blocksReset, 1, 1);
+    dim3 threads(BLOCKSIZE, 1, 1);
+
+    // info = 0
+    hipLaunchKernelGGL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
+
+    // quick return
+    if(n == 0)
+        return rocblas_status_success;
+
+    // quick return for n = 1 (scalar case)
+    if(n == 1)
+    {
+        hipLaunchKernelGGL(scalar_case<T>, gridReset, threads, 0, stream, evect, A, strideA, D,
+                           strideD, batch_count);
+        return rocblas_status_success;
+    }
+
+    // reduce A to tridiagonal form
+    rocsolver_sytrd_hetrd_template(handle, uplo, n, A, shiftA, lda, strideA, D, strideD, E, strideE,
+                                   tau, n, batch_count, scalars, (T*)work_stack, Abyx_norms_tmptr,
+                                   tmptau_trfact, workArr);
+
+    if(evect != rocblas_evect_original)
+    {
+        // only compute eigenvalues
+        rocsolver_sterf_template<S>(handle, n, D, 0, strideD, E, 0, strideE, info, batch_count,
+                                    (rocblas_int*)work_stack);
+    }
+    else
+    {
+        // compute eigenvalues and eigenvectors of the tridiagonal matrix
+        rocblas_stride strideV = rocblas_stride(n) * n;
+        rocsolver_stedc_template<S, T>(handle, rocblas_evect_tridiagonal, n, D, 0, strideD, E, 0,
+                                       strideE, vectors, 0, n, strideV, info, batch_count,
+                                       work_stack, tempvect, tempgemm, tmpz, splits);
+
+        // update the eigenvectors with the orthogonal matrix of the reduction
+        local_ormtr_unmtr_template<BATCHED, STRIDED>(
+            handle, uplo, n, A, shiftA, lda, strideA, tau, n, vectors, 0, n, strideV, batch_count,
+            scalars, (T*)work_stack, Abyx_norms_tmptr, tmptau_trfact, workArr);
+
+        // copy the eigenvectors to A
+        rocblas_int blocks = (n - 1) / BS + 1;
+        hipLaunchKernelGGL(copy_mat<T>, dim3(blocks, blocks, batch_count), dim3(BS, BS), 0, stream,
+                           n, n, vectors, 0, n, strideV, A, shiftA, lda, strideA);
+    }
+
+    return rocblas_status_success;
+}
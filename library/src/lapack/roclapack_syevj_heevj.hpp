@@ -0,0 +1,462 @@
+/************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "rocsolver.h"
+
+/****************************************************************************
+(TODO: THE WORKING MATRICES ARE KEPT IN LDS ONLY WHEN THEY FIT IN JACOBI_MAX_LDS
+  BYTES; LARGER PROBLEMS RUN THE SAME KERNEL ON A COPY IN GLOBAL MEMORY. A BLOCKED
+  JACOBI METHOD WOULD BE NEEDED TO HANDLE LARGE SIZES EFFICIENTLY.)
+
+The cyclic Jacobi methods process the n*(n-1)/2 pairs of indices of a sweep in
+n2-1 rounds (n2 = n rounded up to an even number) with the round-robin ordering.
+The n2/2 pairs of a round are disjoint, so their rotations are computed at once
+(one thread per pair) and applied concurrently by all the threads of the group.
+***************************************************************************/
+
+/** JACOBI_ABS2 returns the squared modulus of val **/
+template <typename S, typename T, std::enable_if_t<!is_complex<T>, int> = 0>
+__device__ S jacobi_abs2(const T val)
+{
+    return val * val;
+}
+
+template <typename S, typename T, std::enable_if_t<is_complex<T>, int> = 0>
+__device__ S jacobi_abs2(const T val)
+{
+    return val.real() * val.real() + val.imag() * val.imag();
+}
+
+/** JACOBI_PAIR returns the indices p < q of the k-th pair in round r of the
+    round-robin ordering of n2 (even) indices **/
+__device__ inline void jacobi_pair(const rocblas_int k,
+                                   const rocblas_int r,
+                                   const rocblas_int n2,
+                                   rocblas_int* p,
+                                   rocblas_int* q)
+{
+    // index 0 is fixed; the others move one position per round
+    rocblas_int a = (k == 0 ? 0 : (k - 1 + r) % (n2 - 1) + 1);
+    rocblas_int b = (n2 - 2 - k + r) % (n2 - 1) + 1;
+    *p = min(a, b);
+    *q = max(a, b);
+}
+
+/** JACOBI_ROTATION computes the rotation J = [c s; -conj(s) c] such that
+    J' * [a g; conj(g) b] * J is diagonal (a and b are real) **/
+template <typename T, typename S>
+__device__ void jacobi_rotation(const S a, const S b, const T g, S* c, T* s)
+{
+    S ag = sqrt(jacobi_abs2<S>(g));
+    if(ag == 0)
+    {
+        *c = 1;
+        *s = T(0);
+        return;
+    }
+
+    S tau = (b - a) / (2 * ag);
+    S t = (tau >= 0 ? S(1) : S(-1)) / (std::abs(tau) + sqrt(1 + tau * tau));
+    *c = 1 / sqrt(1 + t * t);
+    *s = (t * (*c) / ag) * g;
+}
+
+/** JACOBI_ROTATE_COLS applies the rotation J = [c s; -conj(s) c] from the right
+    to the row vector [x y] **/
+template <typename T, typename S>
+__device__ void jacobi_rotate_cols(const S c, const T s, T* x, T* y)
+{
+    T temp = *x;
+    *x = c * temp - conj(s) * (*y);
+    *y = s * temp + c * (*y);
+}
+
+/** JACOBI_REDUCE_SUM adds up the values given by the threads of the group and
+    returns the result to all of them. sval must have room for nthreads + 1 values **/
+template <typename S>
+__device__ S jacobi_reduce_sum(const rocblas_int tid,
+                               const rocblas_int nthreads,
+                               const S val,
+                               S* sval)
+{
+    sval[tid] = val;
+    __syncthreads();
+
+    if(tid == 0)
+    {
+        S sum = 0;
+        for(rocblas_int i = 0; i < nthreads; ++i)
+            sum += sval[i];
+        sval[nthreads] = sum;
+    }
+    __syncthreads();
+
+    return sval[nthreads];
+}
+
+/** JACOBI_NTHREADS returns the size of the thread group working on one problem
+    with npairs pairs per round and vectors of length len **/
+inline rocblas_int jacobi_nthreads(const rocblas_int npairs, const rocblas_int len)
+{
+    rocblas_int items = std::max(npairs * len, 1);
+    return std::min(JACOBI_BDIM, ((items - 1) / WAVESIZE + 1) * WAVESIZE);
+}
+
+/** SYEVJ_LDS_LAYOUT decides which working arrays are kept in LDS and returns the
+    size of the dynamic shared memory **/
+template <typename T, typename S>
+void syevj_lds_layout(const rocblas_evect evect,
+                      const rocblas_int n,
+                      bool* lds_a,
+                      bool* lds_v,
+                      size_t* lmemsize)
+{
+    rocblas_int half = (n + 1) / 2;
+    size_t msize = sizeof(T) * n * n;
+    size_t rsize = (sizeof(T) + sizeof(S)) * half;
+
+    *lds_a = (msize + rsize <= JACOBI_MAX_LDS);
+    *lds_v = (*lds_a && evect == rocblas_evect_original && 2 * msize + rsize <= JACOBI_MAX_LDS);
+    *lmemsize = (*lds_a ? (*lds_v ? 2 : 1) * msize + rsize : 0);
+}
+
+/** SYEVJ_KERNEL computes the eigenvalues and optionally the eigenvectors of a
+    symmetric/Hermitian matrix with the two-sided cyclic Jacobi method **/
+template <typename T, typename S, typename U>
+__global__ void __launch_bounds__(JACOBI_BDIM) syevj_kernel(const rocblas_evect evect,
+                                                            const rocblas_fill uplo,
+                                                            const rocblas_int n,
+                                                            U AA,
+                                                            const rocblas_int shiftA,
+                                                            const rocblas_int lda,
+                                                            const rocblas_stride strideA,
+                                                            const S tolerance,
+                                                            S* residualA,
+                                                            const rocblas_int max_sweeps,
+                                                            rocblas_int* n_sweepsA,
+                                                            S* WW,
+                                                            const rocblas_stride strideW,
+                                                            rocblas_int* infoA,
+                                                            T* work,
+                                                            const bool lds_a,
+                                                            const bool lds_v)
+{
+    rocblas_int tid = hipThreadIdx_x;
+    rocblas_int nthreads = hipBlockDim_x;
+    rocblas_int bid = hipBlockIdx_y;
+    rocblas_int bc = hipGridDim_y;
+    rocblas_int n2 = n + (n & 1);
+    rocblas_int half = n2 / 2;
+    bool vect = (evect == rocblas_evect_original);
+
+    // select batch instance
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+    S* W = WW + (bid * strideW);
+
+    // working copy of A, eigenvectors and rotations of the current round
+    // (in LDS when they fit; otherwise in the workspace and, for the
+    // eigenvectors, directly in A)
+    extern __shared__ double lmem[];
+    T *Acpy, *V, *sines;
+    S* cosines;
+    if(lds_a)
+    {
+        Acpy = (T*)lmem;
+        V = (lds_v ? Acpy + n * n : A);
+        sines = Acpy + (lds_v ? 2 : 1) * n * n;
+        cosines = (S*)(sines + half);
+    }
+    else
+    {
+        Acpy = work + bid * n * n;
+        V = A;
+        sines = work + bc * n * n + bid * half;
+        cosines = (S*)(work + bc * (n * n + half)) + bid * half;
+    }
+    rocblas_int ldv = (lds_v ? n : lda);
+
+    __shared__ S sval[JACOBI_BDIM + 1];
+    __shared__ rocblas_int piv;
+
+    // copy the full matrix to the working array
+    for(rocblas_int k = tid; k < n * n; k += nthreads)
+    {
+        rocblas_int i = k % n;
+        rocblas_int j = k / n;
+        bool stored = (uplo == rocblas_fill_upper ? i <= j : i >= j);
+        Acpy[k] = (stored ? A[i + j * lda] : conj(A[j + i * lda]));
+    }
+    __syncthreads();
+
+    // initialize the eigenvectors (after the copy, as V may be A)
+    if(vect)
+    {
+        for(rocblas_int k = tid; k < n * n; k += nthreads)
+        {
+            rocblas_int i = k % n;
+            rocblas_int j = k / n;
+            V[i + j * ldv] = (i == j ? T(1) : T(0));
+        }
+    }
+
+    // norms of A and of its off-diagonal part
+    S lnrm = 0, loff = 0;
+    for(rocblas_int k = tid; k < n * n; k += nthreads)
+    {
+        S a2 = jacobi_abs2<S>(Acpy[k]);
+        lnrm += a2;
+        if(k % n != k / n)
+            loff += a2;
+    }
+    S tol = tolerance * sqrt(jacobi_reduce_sum(tid, nthreads, lnrm, sval));
+    S off = sqrt(jacobi_reduce_sum(tid, nthreads, loff, sval));
+
+    // main loop (off is the same in all threads)
+    rocblas_int sweeps = 0;
+    while(off > tol && sweeps < max_sweeps)
+    {
+        for(rocblas_int r = 0; r < n2 - 1; ++r)
+        {
+            rocblas_int p, q;
+
+            // compute the rotations of this round
+            for(rocblas_int k = tid; k < half; k += nthreads)
+            {
+                jacobi_pair(k, r, n2, &p, &q);
+                if(q < n)
+                    jacobi_rotation(rreal<S>(Acpy[p + p * n]), rreal<S>(Acpy[q + q * n]),
+                                    Acpy[p + q * n], cosines + k, sines + k);
+                else
+                {
+                    cosines[k] = 1;
+                    sines[k] = T(0);
+                }
+            }
+            __syncthreads();
+
+            // update the columns of A and V
+            for(rocblas_int kk = tid; kk < half * n; kk += nthreads)
+            {
+                rocblas_int k = kk / n;
+                rocblas_int i = kk % n;
+                T s = sines[k];
+                if(s != T(0))
+                {
+                    jacobi_pair(k, r, n2, &p, &q);
+                    jacobi_rotate_cols(cosines[k], s, Acpy + i + p * n, Acpy + i + q * n);
+                    if(vect)
+                        jacobi_rotate_cols(cosines[k], s, V + i + p * ldv, V + i + q * ldv);
+                }
+            }
+            __syncthreads();
+
+            // update the rows of A (applying J' from the left)
+            for(rocblas_int kk = tid; kk < half * n; kk += nthreads)
+            {
+                rocblas_int k = kk / n;
+                rocblas_int j = kk % n;
+                T s = sines[k];
+                if(s != T(0))
+                {
+                    jacobi_pair(k, r, n2, &p, &q);
+                    T temp = Acpy[p + j * n];
+                    Acpy[p + j * n] = cosines[k] * temp - s * Acpy[q + j * n];
+                    Acpy[q + j * n] = conj(s) * temp + cosines[k] * Acpy[q + j * n];
+                }
+            }
+            __syncthreads();
+
+            // the annihilated entries are set to zero explicitly
+            for(rocblas_int k = tid; k < half; k += nthreads)
+            {
+                if(sines[k] != T(0))
+                {
+                    jacobi_pair(k, r, n2, &p, &q);
+                    Acpy[p + q * n] = T(0);
+                    Acpy[q + p * n] = T(0);
+                }
+            }
+            __syncthreads();
+        }
+        sweeps++;
+
+        loff = 0;
+        for(rocblas_int k = tid; k < n * n; k += nthreads)
+        {
+            if(k % n != k / n)
+                loff += jacobi_abs2<S>(Acpy[k]);
+        }
+        off = sqrt(jacobi_reduce_sum(tid, nthreads, loff, sval));
+    }
+
+    // the eigenvalues are the diagonal of the resulting matrix
+    for(rocblas_int k = tid; k < n; k += nthreads)
+        W[k] = rreal<S>(Acpy[k + k * n]);
+    __syncthreads();
+
+    // sort the eigenvalues (and eigenvectors) in ascending order
+    for(rocblas_int i = 0; i < n - 1; ++i)
+    {
+        if(tid == 0)
+        {
+            rocblas_int k = i;
+            S p = W[i];
+            for(rocblas_int j = i + 1; j < n; ++j)
+            {
+                if(W[j] < p)
+                {
+                    k = j;
+                    p = W[j];
+                }
+            }
+            W[k] = W[i];
+            W[i] = p;
+            piv = k;
+        }
+        __syncthreads();
+
+        if(vect && piv != i)
+            swapvect(n, V + i * ldv, 1, V + piv * ldv, 1, tid, nthreads);
+        __syncthreads();
+    }
+
+    // copy the eigenvectors back to A
+    if(vect && lds_v)
+    {
+        for(rocblas_int k = tid; k < n * n; k += nthreads)
+        {
+            rocblas_int i = k % n;
+            rocblas_int j = k / n;
+            A[i + j * lda] = V[i + j * ldv];
+        }
+    }
+
+    if(tid == 0)
+    {
+        residualA[bid] = off;
+        n_sweepsA[bid] = sweeps;
+        infoA[bid] = (off <= tol ? 0 : 1);
+    }
+}
+
+/** Helper to calculate workspace sizes **/
+template <typename T, typename S>
+void rocsolver_syevj_heevj_getMemorySize(const rocblas_evect evect,
+                                         const rocblas_int n,
+                                         const rocblas_int batch_count,
+                                         size_t* size_work)
+{
+    // if quick return, set workspace to zero
+    if(n == 0 || batch_count == 0)
+    {
+        *size_work = 0;
+        return;
+    }
+
+    // the working copy of A and the rotations only need global memory when
+    // they do not fit in LDS
+    bool lds_a, lds_v;
+    size_t lmemsize;
+    syevj_lds_layout<T, S>(evect, n, &lds_a, &lds_v, &lmemsize);
+
+    rocblas_int half = (n + 1) / 2;
+    *size_work = (lds_a ? 0 : (sizeof(T) * (n * n + half) + sizeof(S) * half) * batch_count);
+}
+
+/** Argument checking **/
+template <typename T, typename S>
+rocblas_status rocsolver_syevj_heevj_argCheck(rocblas_handle handle,
+                                              const rocblas_evect evect,
+                                              const rocblas_fill uplo,
+                                              const rocblas_int n,
+                                              T A,
+                                              const rocblas_int lda,
+                                              S* residual,
+                                              const rocblas_int max_sweeps,
+                                              rocblas_int* n_sweeps,
+                                              S* W,
+                                              rocblas_int* info,
+                                              const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if((evect != rocblas_evect_original && evect != rocblas_evect_none)
+       || (uplo != rocblas_fill_lower && uplo != rocblas_fill_upper))
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || lda < n || max_sweeps <= 0 || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (n && !W) || (batch_count && !residual) || (batch_count && !n_sweeps)
+       || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_syevj_heevj_template(rocblas_handle handle,
+                                              const rocblas_evect evect,
+                                              const rocblas_fill uplo,
+                                              const rocblas_int n,
+                                              U A,
+                                              const rocblas_int shiftA,
+                                              const rocblas_int lda,
+                                              const rocblas_stride strideA,
+                                              const S abstol,
+                                              S* residual,
+                                              const rocblas_int max_sweeps,
+                                              rocblas_int* n_sweeps,
+                                              S* W,
+                                              const rocblas_stride strideW,
+                                              rocblas_int* info,
+                                              const rocblas_int batch_count,
+                                              T* work)
+{
+    ROCSOLVER_ENTER("syevj_heevj", "evect:", evect, "uplo:", uplo, "n:", n, "shiftA:", shiftA,
+                    "lda:", lda, "abstol:", abstol, "max_sweeps:", max_sweeps, "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // quick return
+    if(n == 0)
+    {
+        rocblas_int blocksReset = (batch_count - 1) / BLOCKSIZE + 1;
+        dim3 gridReset(blocksReset, 1, 1);
+        dim3 threads(BLOCKSIZE, 1, 1);
+        hipLaunchKernelGGL(reset_info, gridReset, threads, 0, stream, residual, batch_count, 0);
+        hipLaunchKernelGGL(reset_info, gridReset, threads, 0, stream, n_sweeps, batch_count, 0);
+        hipLaunchKernelGGL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
+        return rocblas_status_success;
+    }
+
+    bool lds_a, lds_v;
+    size_t lmemsize;
+    syevj_lds_layout<T, S>(evect, n, &lds_a, &lds_v, &lmemsize);
+
+    // the tolerance is relative to the norm of A
+    S tolerance = (abstol <= 0 ? get_epsilon<S>() : abstol);
+
+    rocblas_int nthreads = jacobi_nthreads((n + 1) / 2, n);
+    hipLaunchKernelGGL((syevj_kernel<T>), dim3(1, batch_count), dim3(nthreads), lmemsize, stream,
+                       evect, uplo, n, A, shiftA, lda, strideA, tolerance, residual, max_sweeps,
+                       n_sweeps, W, strideW, info, work, lds_a, lds_v);
+
+    return rocblas_status_success;
+}
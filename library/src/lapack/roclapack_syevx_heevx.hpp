@@ -0,0 +1,326 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "auxiliary/rocauxiliary_ormtr_unmtr.hpp"
+#include "auxiliary/rocauxiliary_stebz.hpp"
+#include "auxiliary/rocauxiliary_stein.hpp"
+#include "rocblas.hpp"
+#include "roclapack_sytrd_hetrd.hpp"
+#include "rocsolver.h"
+
+/** SYEVX_SORT_EIGS sorts the eigenvalues in ascending order, permuting the
+    eigenvectors and remapping the indices in ifail accordingly **/
+template <typename T, typename S, typename U>
+__global__ void syevx_sort_eigs(const rocblas_int n,
+                                rocblas_int* nevA,
+                                S* WW,
+                                const rocblas_stride strideW,
+                                U ZZ,
+                                const rocblas_int shiftZ,
+                                const rocblas_int ldz,
+                                const rocblas_stride strideZ,
+                                rocblas_int* ifailA,
+                                const rocblas_stride strideF,
+                                rocblas_int* infoA)
+{
+    rocblas_int bid = hipBlockIdx_y;
+    rocblas_int tid = hipThreadIdx_x;
+
+    S* W = WW + (bid * strideW);
+    T* Z = load_ptr_batch<T>(ZZ, bid, shiftZ, strideZ);
+    rocblas_int* ifail = ifailA + (bid * strideF);
+    rocblas_int nev = nevA[bid];
+    rocblas_int nfail = infoA[bid];
+
+    __shared__ rocblas_int piv;
+    for(rocblas_int i = 0; i < nev - 1; ++i)
+    {
+        // find the smallest remaining eigenvalue
+        if(tid == 0)
+        {
+            rocblas_int k = i;
+            S p = W[i];
+            for(rocblas_int j = i + 1; j < nev; ++j)
+            {
+                if(W[j] < p)
+                {
+                    k = j;
+                    p = W[j];
+                }
+            }
+
+            if(k != i)
+            {
+                W[k] = W[i];
+                W[i] = p;
+                for(rocblas_int f = 0; f < nfail; ++f)
+                {
+                    if(ifail[f] == i + 1)
+                        ifail[f] = k + 1;
+                    else if(ifail[f] == k + 1)
+                        ifail[f] = i + 1;
+                }
+            }
+            piv = k;
+        }
+        __syncthreads();
+
+        // swap the corresponding eigenvectors
+        rocblas_int k = piv;
+        if(k != i)
+        {
+            for(rocblas_int r = tid; r < n; r += hipBlockDim_x)
+            {
+                T temp = Z[r + i * ldz];
+                Z[r + i * ldz] = Z[r + k * ldz];
+                Z[r + k * ldz] = temp;
+            }
+        }
+        __syncthreads();
+    }
+
+    if(tid == 0)
+        stein_sort_ifail(nfail, ifail);
+}
+
+/** Helper to calculate workspace sizes **/
+template <bool BATCHED, typename T, typename S>
+void rocsolver_syevx_heevx_getMemorySize(const rocblas_evect evect,
+                                         const rocblas_fill uplo,
+                                         const rocblas_int n,
+                                         const rocblas_int batch_count,
+                                         size_t* size_scalars,
+                                         size_t* size_work_stack,
+                                         size_t* size_Abyx_norms_tmptr,
+                                         size_t* size_tmptau_trfact,
+                                         size_t* size_iwork,
+                                         size_t* size_tau,
+                                         size_t* size_D,
+                                         size_t* size_E,
+                                         size_t* size_iblock,
+                                         size_t* size_isplit,
+                                         size_t* size_nsplit,
+                                         size_t* size_workArr)
+{
+    // if quick return, set workspace to zero
+    if(n == 0 || batch_count == 0)
+    {
+        *size_scalars = 0;
+        *size_work_stack = 0;
+        *size_Abyx_norms_tmptr = 0;
+        *size_tmptau_trfact = 0;
+        *size_iwork = 0;
+        *size_tau = 0;
+        *size_D = 0;
+        *size_E = 0;
+        *size_iblock = 0;
+        *size_isplit = 0;
+        *size_nsplit = 0;
+        *size_workArr = 0;
+        return;
+    }
+
+    size_t unused;
+    size_t w1 = 0, w2 = 0, w3 = 0, w4 = 0;
+    size_t a1 = 0, a2 = 0;
+    size_t t1 = 0, t2 = 0;
+    size_t i1 = 0, i2 = 0;
+    size_t r1 = 0, r2 = 0;
+
+    // requirements for tridiagonalization (sytrd/hetrd)
+    rocsolver_sytrd_hetrd_getMemorySize<T, BATCHED>(n, batch_count, size_scalars, &w1, &a1, &t1,
+                                                    &r1);
+
+    // extra requirements for computing the eigenvalues (stebz)
+    rocsolver_stebz_getMemorySize<S>(n, batch_count, &w2, &i1);
+
+    if(evect == rocblas_evect_original)
+    {
+        // extra requirements for computing the eigenvectors (stein)
+        rocsolver_stein_getMemorySize<S>(n, batch_count, &w3, &i2);
+
+        // extra requirements for applying the orthogonal matrix (ormtr/unmtr)
+        rocsolver_ormtr_unmtr_getMemorySize<T, BATCHED>(rocblas_side_left, uplo, n, n, batch_count,
+                                                        &unused, &w4, &a2, &t2, &r2);
+    }
+
+    // get max values
+    *size_work_stack = std::max({w1, w2, w3, w4});
+    *size_Abyx_norms_tmptr = std::max(a1, a2);
+    *size_tmptau_trfact = std::max(t1, t2);
+    *size_iwork = std::max(i1, i2);
+    *size_workArr = std::max(r1, r2);
+
+    // size of array for temporary householder scalars
+    *size_tau = sizeof(T) * n * batch_count;
+
+    // size of arrays for the tridiagonal matrix
+    *size_D = sizeof(S) * n * batch_count;
+    *size_E = sizeof(S) * n * batch_count;
+
+    // size of arrays for the block structure of the tridiagonal matrix
+    *size_iblock = sizeof(rocblas_int) * n * batch_count;
+    *size_isplit = sizeof(rocblas_int) * n * batch_count;
+    *size_nsplit = sizeof(rocblas_int) * batch_count;
+}
+
+/** Argument checking **/
+template <typename T, typename S>
+rocblas_status rocsolver_syevx_heevx_argCheck(rocblas_handle handle,
+                                              const rocblas_evect evect,
+                                              const rocblas_erange erange,
+                                              const rocblas_fill uplo,
+                                              const rocblas_int n,
+                                              T A,
+                                              const rocblas_int lda,
+                                              const S vl,
+                                              const S vu,
+                                              const rocblas_int il,
+                                              const rocblas_int iu,
+                                              rocblas_int* nev,
+                                              S* W,
+                                              T Z,
+                                              const rocblas_int ldz,
+                                              rocblas_int* ifail,
+                                              rocblas_int* info,
+                                              const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if((evect != rocblas_evect_original && evect != rocblas_evect_none)
+       || (erange != rocblas_erange_all && erange != rocblas_erange_value
+           && erange != rocblas_erange_index)
+       || (uplo != rocblas_fill_lower && uplo != rocblas_fill_upper))
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || lda < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+    if(evect == rocblas_evect_original && ldz < n)
+        return rocblas_status_invalid_size;
+    if(erange == rocblas_erange_value && vl >= vu)
+        return rocblas_status_invalid_size;
+    if(erange == rocblas_erange_index && (il < 1 || iu < 0))
+        return rocblas_status_invalid_size;
+    if(erange == rocblas_erange_index && (iu > n || (n > 0 && il > iu)))
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (n && !W) || (batch_count && !nev) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+    if(evect == rocblas_evect_original && ((n && !Z) || (n && !ifail)))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename S, typename U>
+rocblas_status rocsolver_syevx_heevx_template(rocblas_handle handle,
+                                              const rocblas_evect evect,
+                                              const rocblas_erange erange,
+                                              const rocblas_fill uplo,
+                                              const rocblas_int n,
+                                              U A,
+                                              const rocblas_int shiftA,
+                                              const rocblas_int lda,
+                                              const rocblas_stride strideA,
+                                              const S vl,
+                                              const S vu,
+                                              const rocblas_int il,
+                                              const rocblas_int iu,
+                                              const S abstol,
+                                              rocblas_int* nev,
+                                              S* W,
+                                              const rocblas_stride strideW,
+                                              U Z,
+                                              const rocblas_int shiftZ,
+                                              const rocblas_int ldz,
+                                              const rocblas_stride strideZ,
+                                              rocblas_int* ifail,
+                                              const rocblas_stride strideF,
+                                              rocblas_int* info,
+                                              const rocblas_int batch_count,
+                                              T* scalars,
+                                              void* work_stack,
+                                              T* Abyx_norms_tmptr,
+                                              T* tmptau_trfact,
+                                              rocblas_int* iwork,
+                                              T* tau,
+                                              S* D,
+                                              S* E,
+                                              rocblas_int* iblock,
+                                              rocblas_int* isplit,
+                                              rocblas_int* nsplit,
+                                              T** workArr)
+{
+    ROCSOLVER_ENTER("syevx_heevx", "evect:", evect, "erange:", erange, "uplo:", uplo, "n:", n,
+                    "shiftA:", shiftA, "lda:", lda, "vl:", vl, "vu:", vu, "il:", il, "iu:", iu,
+                    "abstol:", abstol, "shiftZ:", shiftZ, "ldz:", ldz, "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocksReset = (batch_count - 1) / BLOCKSIZE + 1;
+    dim3 gridReset(blocksReset, 1, 1);
+    dim3 threads(BLOCKSIZE, 1, 1);
+
+    // info = nev = 0
+    hipLaunchKernelGGL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
+    hipLaunchKernelGGL(reset_info, gridReset, threads, 0, stream, nev, batch_count, 0);
+
+    // quick return
+    if(n == 0)
+        return rocblas_status_success;
+
+    // reduce A to tridiagonal form
+    rocsolver_sytrd_hetrd_template(handle, uplo, n, A, shiftA, lda, strideA, D, n, E, n, tau, n,
+                                   batch_count, scalars, (T*)work_stack, Abyx_norms_tmptr,
+                                   tmptau_trfact, workArr);
+
+    // compute the selected eigenvalues of the tridiagonal matrix; they are
+    // ordered by blocks if the eigenvectors are required
+    rocblas_eorder eorder
+        = (evect == rocblas_evect_original ? rocblas_eorder_blocks : rocblas_eorder_entire);
+    rocsolver_stebz_template<S>(handle, erange, eorder, n, vl, vu, il, iu, abstol, D, 0, n, E, 0,
+                                n, nev, nsplit, W, strideW, iblock, n, isplit, n, info,
+                                batch_count, (S*)work_stack, iwork);
+
+    if(evect == rocblas_evect_original)
+    {
+        // compute the eigenvectors of the tridiagonal matrix
+        rocsolver_stein_template<S, T>(handle, n, D, 0, n, E, 0, n, nev, W, strideW, iblock, n,
+                                       isplit, n, Z, shiftZ, ldz, strideZ, ifail, strideF, info,
+                                       batch_count, (S*)work_stack, iwork);
+
+        // update the eigenvectors with the orthogonal matrix of the reduction
+        // (only the columns that can hold a selected eigenvector are updated)
+        rocblas_int ncols = (erange == rocblas_erange_index ? iu - il + 1 : n);
+        rocsolver_ormtr_unmtr_template<BATCHED, STRIDED>(
+            handle, rocblas_side_left, uplo, rocblas_operation_none, n, ncols, A, shiftA, lda,
+            strideA, tau, n, Z, shiftZ, ldz, strideZ, batch_count, scalars, (T*)work_stack,
+            Abyx_norms_tmptr, tmptau_trfact, workArr);
+
+        // sort the eigenvalues and eigenvectors in ascending order
+        hipLaunchKernelGGL((syevx_sort_eigs<T>), dim3(1, batch_count), dim3(BLOCKSIZE), 0, stream,
+                           n, nev, W, strideW, Z, shiftZ, ldz, strideZ, ifail, strideF, info);
+    }
+
+    return rocblas_status_success;
+}
@@ -52,8 +52,8 @@ rocblas_status rocsolver_sygs2_hegs2_batched_impl(rocblas_handle handle,
 
     // memory workspace allocation
     void *scalars, *work_x_temp, *workArr_temp_arr, *store_invA, *invA_arr;
-    rocblas_device_malloc mem(handle, size_scalars, size_work_x_temp, size_workArr_temp_arr,
-                              size_store_invA, size_invA_arr);
+    rocsolver_device_malloc mem(handle, size_scalars, size_work_x_temp, size_workArr_temp_arr,
+                                size_store_invA, size_invA_arr);
 
     if(!mem)
         return rocblas_status_memory_error;
@@ -34,7 +34,9 @@ void rocsolver_sygst_hegst_getMemorySize(const rocblas_eform itype,
         return;
     }
 
-    if(n < xxGST_xxGS2_BLOCKSIZE)
+    const rocblas_int nb = rocsolver_tuning::get()->xxgst_xxgs2_blocksize;
+
+    if(n < nb)
     {
         // requirements for calling a single SYGS2/HEGS2
         rocsolver_sygs2_hegs2_getMemorySize<T, BATCHED>(itype, n, batch_count, size_scalars,
@@ -43,7 +45,7 @@ void rocsolver_sygst_hegst_getMemorySize(const rocblas_eform itype,
     }
     else
     {
-        rocblas_int kb = xxGST_xxGS2_BLOCKSIZE;
+        rocblas_int kb = nb;
         size_t temp1, temp2, temp3, temp4, temp5, temp6, temp7, temp8;
 
         // requirements for calling SYGS2/HEGS2 for the subblocks
@@ -98,7 +100,7 @@ rocblas_status rocsolver_sygst_hegst_template(rocblas_handle handle,
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
-    rocblas_int nb = xxGST_xxGS2_BLOCKSIZE;
+    rocblas_int nb = rocsolver_tuning::get()->xxgst_xxgs2_blocksize;
 
     // if the matrix is too small, use the unblocked variant of the algorithm
     if(n <= nb)
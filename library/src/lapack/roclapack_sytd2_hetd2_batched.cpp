@@ -55,7 +55,8 @@ rocblas_status rocsolver_sytd2_hetd2_batched_impl(rocblas_handle handle,
 
     // memory workspace allocation
     void *scalars, *work, *norms, *tmptau, *workArr;
-    rocblas_device_malloc mem(handle, size_scalars, size_work, size_norms, size_tmptau, size_workArr);
+    rocsolver_device_malloc mem(handle, size_scalars, size_work, size_norms, size_tmptau,
+                                size_workArr);
 
     if(!mem)
         return rocblas_status_memory_error;
@@ -36,10 +36,13 @@ void rocsolver_sytrd_hetrd_getMemorySize(const rocblas_int n,
 
     size_t s1 = 0, s2;
 
+    const rocblas_int nx = rocsolver_tuning::get()->xxtrd_xxtd2_switchsize;
+    const rocblas_int nb = rocsolver_tuning::get()->xxtrd_xxtd2_blocksize;
+
     // size required to store temporary matrix W
-    if(n > xxTRD_xxTD2_SWITCHSIZE)
+    if(n > nx)
     {
-        s1 = n * xxTRD_xxTD2_BLOCKSIZE;
+        s1 = n * nb;
         s1 *= sizeof(T) * batch_count;
     }
 
@@ -113,8 +116,8 @@ rocblas_status rocsolver_sytrd_hetrd_template(rocblas_handle handle,
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
-    rocblas_int k = xxTRD_xxTD2_BLOCKSIZE;
-    rocblas_int kk = xxTRD_xxTD2_SWITCHSIZE;
+    rocblas_int k = rocsolver_tuning::get()->xxtrd_xxtd2_blocksize;
+    rocblas_int kk = rocsolver_tuning::get()->xxtrd_xxtd2_switchsize;
 
     // if the matrix is too small, use the unblocked variant of the algorithm
     if(n <= kk)
@@ -226,21 +226,17 @@ __global__ void invdiag(const rocblas_diagonal diag,
 template <bool ISBATCHED>
 rocblas_int trtri_get_blksize(const rocblas_int dim)
 {
+    auto t = rocsolver_tuning::get();
     rocblas_int blk;
 
     if(ISBATCHED)
     {
-        rocblas_int size[] = {TRTRI_BATCH_BLKSIZES};
-        rocblas_int intervals[] = {TRTRI_BATCH_INTERVALS};
-        rocblas_int max = TRTRI_BATCH_NUM_INTERVALS;
-        blk = size[get_index(intervals, max, dim)];
+        blk = rocsolver_tuning_table::get_blksize(t->trtri_batch_intervals,
+                                                  t->trtri_batch_blksizes, dim);
     }
     else
     {
-        rocblas_int size[] = {TRTRI_BLKSIZES};
-        rocblas_int intervals[] = {TRTRI_INTERVALS};
-        rocblas_int max = TRTRI_NUM_INTERVALS;
-        blk = size[get_index(intervals, max, dim)];
+        blk = rocsolver_tuning_table::get_blksize(t->trtri_intervals, t->trtri_blksizes, dim);
     }
 
     return blk;
@@ -0,0 +1,511 @@
+/************************************************************************
+ * Tall-skinny QR factorization (TSQR) with Householder reconstruction:
+ *     J. Demmel, L. Grigori, M. Hoemmen, J. Langou,
+ *     Communication-optimal parallel and sequential QR and LU factorizations,
+ *     SIAM J. Sci. Comput. 34(1), 2012.
+ *     G. Ballard, J. Demmel, L. Grigori, M. Jacquelin, H.D. Nguyen, E. Solomonik,
+ *     Reconstructing Householder vectors from tall-skinny QR,
+ *     J. Parallel Distrib. Comput. 85, 2015.
+ *
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "roclapack_geqr2.hpp"
+#include "rocsolver.h"
+
+#ifdef OPTIMAL
+////////////////////////////////////////////////////////////////////////////////////
+// QR FACTORIZATION OF TALL-SKINNY MATRICES THROUGH A REDUCTION TREE              //
+////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ * The rows of the m-by-n matrix A are split in tiles of GEQRF_TSQR_TILE_ROWS rows
+ * (the last one may be shorter) that are factorized independently. Their triangular
+ * factors are stacked in pairs and factorized again, level by level, until a single
+ * triangular factor R remains (the root of a binary reduction tree). The explicit thin
+ * Q factor is then formed top-down, applying the reflectors of each node of the tree
+ * to the corresponding block of its parent, and those of each tile to the block of its
+ * leaf. Finally, the Householder vectors and scalars of the LAPACK representation of Q
+ * are reconstructed from the explicit Q with an LU factorization, so that the result is
+ * the same as that of GEQR2 and can be used by ORMQR, ORGQR, GELS, etc.
+ *
+ * The nodes of the tree are 2n-by-n matrices with leading dimension 2n, stored
+ * consecutively level after level in the workspace.
+ */
+
+/** TSQR_USABLE returns true if the QR factorization of the given matrices is computed
+    with the reduction tree **/
+template <bool BATCHED>
+bool rocsolver_tsqr_usable(const rocblas_int m, const rocblas_int n, const rocblas_int batch_count)
+{
+    return !BATCHED && batch_count == 1 && n <= GEQR2_MAX_SMALL_COLS
+        && m > GEQRF_TSQR_TILE_ROWS && m >= rocsolver_tuning::get()->geqrf_tsqr_switchsize;
+}
+
+/** TSQR_NODES returns the number of nodes of a tree with the given number of leaves **/
+inline rocblas_int rocsolver_tsqr_nodes(rocblas_int leaves)
+{
+    rocblas_int nodes = 0;
+    while(leaves > 1)
+    {
+        leaves = (leaves + 1) / 2;
+        nodes += leaves;
+    }
+    return nodes;
+}
+
+/** TSQR_STACK_KERNEL stacks the upper triangular factors of nsrc consecutive blocks
+    (in the first n rows of each block, strideS elements apart) in pairs, to form the
+    nodes of the next level of the tree in V. The last block may have only last_rows
+    rows; a factor that is missing from the last pair is set to zero. **/
+template <typename T>
+__global__ void tsqr_stack_kernel(const rocblas_int n,
+                                  const rocblas_int nsrc,
+                                  const rocblas_int last_rows,
+                                  T* S,
+                                  const rocblas_int shiftS,
+                                  const rocblas_int ldS,
+                                  const rocblas_stride strideS,
+                                  T* V)
+{
+    const rocblas_int b = hipBlockIdx_z;
+    const auto i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const auto j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+
+    if(i < n && j < n)
+    {
+        const rocblas_int rows = (b == nsrc - 1) ? last_rows : n;
+        T val = 0;
+        if(b < nsrc && i <= j && i < rows)
+            val = S[shiftS + b * strideS + i + j * ldS];
+
+        V[(b / 2) * 2 * n * n + (b % 2) * n + i + j * 2 * n] = val;
+    }
+}
+
+/** TSQR_APPLY_KERNEL overwrites each m-by-DIM block of V, that holds the Householder
+    vectors of a QR factorization (with scalars in tau), with the product Q * [C; 0], where
+    C is the DIM-by-DIM block of the parent node that corresponds to the block (the identity
+    if there is no parent). The block with index first is the first child. **/
+template <rocblas_int DIM, typename T>
+__global__ void __launch_bounds__(GEQR2_MAX_SMALL_ROWS)
+    tsqr_apply_kernel(const rocblas_int m,
+                      T* VA,
+                      const rocblas_int shiftV,
+                      const rocblas_int ldv,
+                      const rocblas_stride strideV,
+                      T* tauA,
+                      const rocblas_stride strideT,
+                      const rocblas_int first,
+                      T* C)
+{
+    const int myrow = hipThreadIdx_x;
+    const int id = hipBlockIdx_x;
+    const rocblas_int child = first + id;
+
+    // block instance
+    T* V = VA + shiftV + id * strideV;
+    T* tau = tauA + id * strideT;
+
+    // shared memory (for the reductions)
+    extern __shared__ double lmem[];
+    T* red = (T*)lmem;
+
+    // local variables
+    T v;
+    T rV[DIM]; // to store this-row values of the Householder vectors
+    T rX[DIM]; // to store this-row values of the product
+
+// read corresponding row from global memory into local arrays
+#pragma unroll DIM
+    for(int j = 0; j < DIM; ++j)
+    {
+        rV[j] = V[myrow + j * ldv];
+        if(C)
+            rX[j] = (myrow < DIM)
+                ? C[(child / 2) * 2 * DIM * DIM + (child % 2) * DIM + myrow + j * 2 * DIM]
+                : T(0);
+        else
+            rX[j] = (myrow == j) ? T(1) : T(0);
+    }
+
+// Q = H(0) * H(1) * ... * H(k-1) is applied starting with the last reflector
+#pragma unroll DIM
+    for(int k = DIM - 1; k >= 0; --k)
+    {
+        if(k >= m)
+            continue;
+
+        v = (myrow == k) ? T(1) : (myrow > k ? rV[k] : T(0));
+
+        // X = X - tau * v * (v' * X), GEQR2_SMALL_REDCOLS columns at a time
+        for(int j0 = 0; j0 < DIM; j0 += GEQR2_SMALL_REDCOLS)
+        {
+            const int nb = min(GEQR2_SMALL_REDCOLS, DIM - j0);
+
+            for(int jj = 0; jj < nb; ++jj)
+                red[myrow + jj * m] = conj(v) * rX[j0 + jj];
+            __syncthreads();
+            qrfact_small_reduce(myrow, m, nb, red);
+
+            if(myrow >= k)
+            {
+                for(int jj = 0; jj < nb; ++jj)
+                    rX[j0 + jj] -= tau[k] * v * red[jj * m];
+            }
+            __syncthreads();
+        }
+    }
+
+// write results to global memory
+#pragma unroll DIM
+    for(int j = 0; j < DIM; ++j)
+        V[myrow + j * ldv] = rX[j];
+}
+
+/** TSQR_RECONSTRUCT_KERNEL computes the Householder vectors and scalars of the QR
+    factorization from the explicit thin Q factor in A (whose first DIM rows are also
+    given in Q1) and the triangular factor R of the root of the tree. The LU factorization
+    without pivoting of Q - S, where S is the diagonal matrix of signs that keeps the
+    pivots larger than 1 in magnitude, gives the Householder vectors as its unit lower
+    triangular factor; the scalars are -S * diag(U), and the triangular factor of A is
+    S * R. Every block factorizes the first DIM rows, and then solves x * U = q for each
+    of its remaining rows. **/
+template <rocblas_int DIM, typename T>
+__global__ void __launch_bounds__(BLOCKSIZE) tsqr_reconstruct_kernel(const rocblas_int m,
+                                                                     T* A,
+                                                                     const rocblas_int shiftA,
+                                                                     const rocblas_int lda,
+                                                                     T* Q1,
+                                                                     T* R,
+                                                                     T* ipiv)
+{
+    const int tid = hipThreadIdx_x;
+    const rocblas_int myrow = hipBlockIdx_x * hipBlockDim_x + tid;
+    T* Ap = A + shiftA;
+
+    // shared memory (for the factor U and the signs)
+    extern __shared__ double lmem[];
+    T* U = (T*)lmem;
+    T* sg = U + DIM * DIM;
+
+    // local variables
+    T rA[DIM]; // to store this-row values
+
+    // factorize the first DIM rows (one row per thread)
+    if(tid < DIM)
+    {
+#pragma unroll DIM
+        for(int j = 0; j < DIM; ++j)
+            rA[j] = Q1[tid + j * DIM];
+    }
+
+#pragma unroll DIM
+    for(int k = 0; k < DIM; ++k)
+    {
+        // choose the sign and share the pivot row
+        if(tid == k)
+        {
+            sg[k] = (std::real(rA[k]) >= 0) ? T(-1) : T(1);
+            rA[k] -= sg[k];
+            for(int j = k; j < DIM; ++j)
+                U[k + j * DIM] = rA[j];
+        }
+        __syncthreads();
+
+        // update the rows below
+        if(tid > k && tid < DIM)
+        {
+            rA[k] /= U[k + k * DIM];
+            for(int j = k + 1; j < DIM; ++j)
+                rA[j] -= rA[k] * U[k + j * DIM];
+        }
+        __syncthreads();
+    }
+
+    // write the first DIM rows: Householder vectors below the diagonal and S * R above
+    if(hipBlockIdx_x == 0 && tid < DIM)
+    {
+#pragma unroll DIM
+        for(int j = 0; j < DIM; ++j)
+            Ap[tid + j * lda] = (j < tid) ? rA[j] : sg[tid] * R[tid + j * DIM];
+        ipiv[tid] = -sg[tid] * U[tid + tid * DIM];
+    }
+
+    // solve the remaining rows
+    if(myrow >= DIM && myrow < m)
+    {
+#pragma unroll DIM
+        for(int j = 0; j < DIM; ++j)
+            rA[j] = Ap[myrow + j * lda];
+
+#pragma unroll DIM
+        for(int j = 0; j < DIM; ++j)
+        {
+            for(int i = 0; i < j; ++i)
+                rA[j] -= rA[i] * U[i + j * DIM];
+            rA[j] /= U[j + j * DIM];
+        }
+
+#pragma unroll DIM
+        for(int j = 0; j < DIM; ++j)
+            Ap[myrow + j * lda] = rA[j];
+    }
+}
+
+/*************************************************************
+    Launchers of TSQR kernels
+*************************************************************/
+template <typename T>
+void tsqr_apply(rocblas_handle handle,
+                const rocblas_int m,
+                const rocblas_int n,
+                T* V,
+                const rocblas_int shiftV,
+                const rocblas_int ldv,
+                const rocblas_stride strideV,
+                T* tau,
+                const rocblas_stride strideT,
+                const rocblas_int first,
+                T* C,
+                const rocblas_int blocks)
+{
+#define RUN_TSQR_APPLY(DIM)                                                                       \
+    hipLaunchKernelGGL((tsqr_apply_kernel<DIM, T>), grid, block, lmemsize, stream, m, V, shiftV, \
+                       ldv, strideV, tau, strideT, first, C)
+
+    // prepare kernel launch
+    dim3 grid(blocks, 1, 1);
+    dim3 block(m, 1, 1);
+    size_t lmemsize = m * GEQR2_SMALL_REDCOLS * sizeof(T);
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // instantiate cases to make number of columns n known at compile time
+    // this should allow loop unrolling.
+    // kernel launch
+    switch(n)
+    {
+    case 1: RUN_TSQR_APPLY(1); break;
+    case 2: RUN_TSQR_APPLY(2); break;
+    case 3: RUN_TSQR_APPLY(3); break;
+    case 4: RUN_TSQR_APPLY(4); break;
+    case 5: RUN_TSQR_APPLY(5); break;
+    case 6: RUN_TSQR_APPLY(6); break;
+    case 7: RUN_TSQR_APPLY(7); break;
+    case 8: RUN_TSQR_APPLY(8); break;
+    case 9: RUN_TSQR_APPLY(9); break;
+    case 10: RUN_TSQR_APPLY(10); break;
+    case 11: RUN_TSQR_APPLY(11); break;
+    case 12: RUN_TSQR_APPLY(12); break;
+    case 13: RUN_TSQR_APPLY(13); break;
+    case 14: RUN_TSQR_APPLY(14); break;
+    case 15: RUN_TSQR_APPLY(15); break;
+    case 16: RUN_TSQR_APPLY(16); break;
+    case 17: RUN_TSQR_APPLY(17); break;
+    case 18: RUN_TSQR_APPLY(18); break;
+    case 19: RUN_TSQR_APPLY(19); break;
+    case 20: RUN_TSQR_APPLY(20); break;
+    case 21: RUN_TSQR_APPLY(21); break;
+    case 22: RUN_TSQR_APPLY(22); break;
+    case 23: RUN_TSQR_APPLY(23); break;
+    case 24: RUN_TSQR_APPLY(24); break;
+    case 25: RUN_TSQR_APPLY(25); break;
+    case 26: RUN_TSQR_APPLY(26); break;
+    case 27: RUN_TSQR_APPLY(27); break;
+    case 28: RUN_TSQR_APPLY(28); break;
+    case 29: RUN_TSQR_APPLY(29); break;
+    case 30: RUN_TSQR_APPLY(30); break;
+    case 31: RUN_TSQR_APPLY(31); break;
+    case 32: RUN_TSQR_APPLY(32); break;
+    default: ROCSOLVER_UNREACHABLE();
+    }
+}
+
+template <typename T>
+void tsqr_reconstruct(rocblas_handle handle,
+                      const rocblas_int m,
+                      const rocblas_int n,
+                      T* A,
+                      const rocblas_int shiftA,
+                      const rocblas_int lda,
+                      T* Q1,
+                      T* R,
+                      T* ipiv)
+{
+#define RUN_TSQR_RECONSTRUCT(DIM)                                                          \
+    hipLaunchKernelGGL((tsqr_reconstruct_kernel<DIM, T>), grid, block, lmemsize, stream, m, \
+                       A, shiftA, lda, Q1, R, ipiv)
+
+    // prepare kernel launch
+    dim3 grid((m - 1) / BLOCKSIZE + 1, 1, 1);
+    dim3 block(BLOCKSIZE, 1, 1);
+    size_t lmemsize = (n * n + n) * sizeof(T);
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // instantiate cases to make number of columns n known at compile time
+    // this should allow loop unrolling.
+    // kernel launch
+    switch(n)
+    {
+    case 1: RUN_TSQR_RECONSTRUCT(1); break;
+    case 2: RUN_TSQR_RECONSTRUCT(2); break;
+    case 3: RUN_TSQR_RECONSTRUCT(3); break;
+    case 4: RUN_TSQR_RECONSTRUCT(4); break;
+    case 5: RUN_TSQR_RECONSTRUCT(5); break;
+    case 6: RUN_TSQR_RECONSTRUCT(6); break;
+    case 7: RUN_TSQR_RECONSTRUCT(7); break;
+    case 8: RUN_TSQR_RECONSTRUCT(8); break;
+    case 9: RUN_TSQR_RECONSTRUCT(9); break;
+    case 10: RUN_TSQR_RECONSTRUCT(10); break;
+    case 11: RUN_TSQR_RECONSTRUCT(11); break;
+    case 12: RUN_TSQR_RECONSTRUCT(12); break;
+    case 13: RUN_TSQR_RECONSTRUCT(13); break;
+    case 14: RUN_TSQR_RECONSTRUCT(14); break;
+    case 15: RUN_TSQR_RECONSTRUCT(15); break;
+    case 16: RUN_TSQR_RECONSTRUCT(16); break;
+    case 17: RUN_TSQR_RECONSTRUCT(17); break;
+    case 18: RUN_TSQR_RECONSTRUCT(18); break;
+    case 19: RUN_TSQR_RECONSTRUCT(19); break;
+    case 20: RUN_TSQR_RECONSTRUCT(20); break;
+    case 21: RUN_TSQR_RECONSTRUCT(21); break;
+    case 22: RUN_TSQR_RECONSTRUCT(22); break;
+    case 23: RUN_TSQR_RECONSTRUCT(23); break;
+    case 24: RUN_TSQR_RECONSTRUCT(24); break;
+    case 25: RUN_TSQR_RECONSTRUCT(25); break;
+    case 26: RUN_TSQR_RECONSTRUCT(26); break;
+    case 27: RUN_TSQR_RECONSTRUCT(27); break;
+    case 28: RUN_TSQR_RECONSTRUCT(28); break;
+    case 29: RUN_TSQR_RECONSTRUCT(29); break;
+    case 30: RUN_TSQR_RECONSTRUCT(30); break;
+    case 31: RUN_TSQR_RECONSTRUCT(31); break;
+    case 32: RUN_TSQR_RECONSTRUCT(32); break;
+    default: ROCSOLVER_UNREACHABLE();
+    }
+}
+
+template <typename T>
+void rocsolver_tsqr_getMemorySize(const rocblas_int m, const rocblas_int n, size_t* size_work)
+{
+    const rocblas_int ntiles = (m - 1) / GEQRF_TSQR_TILE_ROWS + 1;
+    const rocblas_int nnodes = rocsolver_tsqr_nodes(ntiles);
+
+    // nodes of the tree, scalars of the tiles and the nodes, and the triangular
+    // factor and first rows of Q used by the reconstruction
+    *size_work = sizeof(T)
+        * (size_t(nnodes) * 2 * n * n + size_t(ntiles) * n + size_t(nnodes) * n + 2 * n * n);
+}
+
+template <typename T>
+rocblas_status rocsolver_tsqr_template(rocblas_handle handle,
+                                       const rocblas_int m,
+                                       const rocblas_int n,
+                                       T* A,
+                                       const rocblas_int shiftA,
+                                       const rocblas_int lda,
+                                       T* ipiv,
+                                       T* work)
+{
+    ROCSOLVER_ENTER("tsqr", "m:", m, "n:", n, "shiftA:", shiftA, "lda:", lda);
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    const rocblas_int mb = GEQRF_TSQR_TILE_ROWS;
+    const rocblas_int ntiles = (m - 1) / mb + 1;
+    const rocblas_int mlast = m - (ntiles - 1) * mb;
+    const rocblas_int nnodes = rocsolver_tsqr_nodes(ntiles);
+    const rocblas_int ldv = 2 * n;
+    const rocblas_stride strideV = rocblas_stride(ldv) * n;
+
+    // workspace
+    T* V = work;
+    T* tauT = V + nnodes * strideV;
+    T* tauN = tauT + ntiles * n;
+    T* R = tauN + nnodes * n;
+    T* Q1 = R + n * n;
+
+    // number of nodes of each level, and the offset of its first node
+    std::vector<rocblas_int> count, offset;
+
+    rocblas_int blocks = (n - 1) / 32 + 1;
+    dim3 threads(32, 32, 1);
+
+    // factorize the tiles
+    if(ntiles > 1)
+        QRfact_small<T>(handle, mb, n, A, shiftA, lda, mb, tauT, n, ntiles - 1);
+    QRfact_small<T>(handle, mlast, n, A, shiftA + (ntiles - 1) * mb, lda, 0,
+                    tauT + (ntiles - 1) * n, 0, 1);
+
+    // reduction tree (bottom-up)
+    rocblas_int c = ntiles;
+    rocblas_int first = 0;
+    while(c > 1)
+    {
+        const rocblas_int nodes = (c + 1) / 2;
+
+        // stack the triangular factors of the previous level
+        if(count.empty())
+            hipLaunchKernelGGL(tsqr_stack_kernel<T>, dim3(blocks, blocks, 2 * nodes), threads, 0,
+                               stream, n, c, min(mlast, n), A, shiftA, lda, mb,
+                               V + first * strideV);
+        else
+            hipLaunchKernelGGL(tsqr_stack_kernel<T>, dim3(blocks, blocks, 2 * nodes), threads, 0,
+                               stream, n, c, n, V, offset.back() * strideV, ldv, strideV,
+                               V + first * strideV);
+
+        // factorize the stacked factors
+        QRfact_small<T>(handle, ldv, n, V, first * strideV, ldv, strideV, tauN + first * n, n,
+                        nodes);
+
+        count.push_back(nodes);
+        offset.push_back(first);
+        first += nodes;
+        c = nodes;
+    }
+
+    // keep the triangular factor of the root
+    hipLaunchKernelGGL(copy_mat<T>, dim3(blocks, blocks, 1), threads, 0, stream, n, n, V,
+                       offset.back() * strideV, ldv, strideV, R, 0, n, 0, rocblas_fill_upper);
+
+    // explicit thin Q factor (top-down)
+    for(int l = count.size() - 1; l >= 0; --l)
+    {
+        T* C = (l == int(count.size()) - 1) ? nullptr : V + offset[l + 1] * strideV;
+        tsqr_apply<T>(handle, ldv, n, V, offset[l] * strideV, ldv, strideV, tauN + offset[l] * n,
+                      n, 0, C, count[l]);
+    }
+    if(ntiles > 1)
+        tsqr_apply<T>(handle, mb, n, A, shiftA, lda, mb, tauT, n, 0, V, ntiles - 1);
+    tsqr_apply<T>(handle, mlast, n, A, shiftA + (ntiles - 1) * mb, lda, 0,
+                  tauT + (ntiles - 1) * n, 0, ntiles - 1, V, 1);
+
+    // Householder reconstruction
+    hipLaunchKernelGGL(copy_mat<T>, dim3(blocks, blocks, 1), threads, 0, stream, n, n, A, shiftA,
+                       lda, 0, Q1, 0, n, 0);
+    tsqr_reconstruct<T>(handle, m, n, A, shiftA, lda, Q1, R, ipiv);
+
+    return rocblas_status_success;
+}
+
+template <typename T>
+rocblas_status rocsolver_tsqr_template(rocblas_handle handle,
+                                       const rocblas_int m,
+                                       const rocblas_int n,
+                                       T* const A[],
+                                       const rocblas_int shiftA,
+                                       const rocblas_int lda,
+                                       T* ipiv,
+                                       T* work)
+{
+    ROCSOLVER_UNREACHABLE_X("the reduction tree is only used with non-batched arrays");
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+//                      END OF TSQR                                                     //
+//////////////////////////////////////////////////////////////////////////////////////////
+#endif // OPTIMAL